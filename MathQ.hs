@@ -6,6 +6,7 @@ import Foreign.C.String
 
 foreign import ccall "Absolute_Student_t_Distribution" c_Absolute_Student_t_Distribution :: CDouble -> CInt -> CDouble
 foreign import ccall "Absolute_Student_t_Distribution_Large_dof" c_Absolute_Student_t_Distribution_Large_dof :: CDouble -> CInt -> CDouble 
+foreign import ccall "Absolute_Student_t_Quantile" c_Absolute_Student_t_Quantile :: CDouble -> CInt -> CDouble
 foreign import ccall "Auxiliary_Cos_Integral_gi" c_Auxiliary_Cos_Integral_gi :: CDouble -> CDouble 
 foreign import ccall "Auxiliary_Sin_Integral_fi" c_Auxiliary_Sin_Integral_fi :: CDouble -> CDouble 
 foreign import ccall "Bernoulli_Number" c_Bernoulli_Number :: CInt -> CDouble 
@@ -13,7 +14,9 @@ foreign import ccall "Bernoulli_Random_Variate" c_Bernoulli_Random_Variate :: CD
 foreign import ccall "Beta_Density" c_Beta_Density :: CDouble -> CDouble -> CDouble -> CDouble
 foreign import ccall "Beta_Distribution" c_Beta_Distribution :: CDouble -> CDouble -> CDouble -> CDouble
 foreign import ccall "Beta_Function" c_Beta_Function :: CDouble -> CDouble -> CDouble
+foreign import ccall "Beta_Quantile" c_Beta_Quantile :: CDouble -> CDouble -> CDouble -> CDouble
 foreign import ccall "Beta_Random_Variate" c_Beta_Random_Variate :: CDouble -> CDouble -> IO CDouble
+foreign import ccall "Beta_Variate_Inversion" c_Beta_Variate_Inversion :: CDouble -> CDouble -> IO CDouble
 foreign import ccall "Binomial_Coefficient" c_Binomial_Coefficient :: CInt -> CInt -> CDouble
 foreign import ccall "Binomial_Cumulative_Distribution" c_Binomial_Cumulative_Distribution :: CInt -> CInt -> CDouble -> CDouble
 foreign import ccall "Binomial_Point_Distribution" c_Binomial_Point_Distribution :: CInt -> CInt -> CDouble -> CDouble
@@ -22,6 +25,7 @@ foreign import ccall "Catalan_Beta_Function" c_Catalan_Beta_Function :: CDouble
 foreign import ccall "Catalan_Beta_Star_Function" c_Catalan_Beta_Star_Function :: CDouble -> CDouble
 foreign import ccall "Cauchy_Density" c_Cauchy_Density :: CDouble -> CDouble
 foreign import ccall "Cauchy_Distribution" c_Cauchy_Distribution :: CDouble -> CDouble
+foreign import ccall "Cauchy_Quantile" c_Cauchy_Quantile :: CDouble -> CDouble
 foreign import ccall "Cauchy_Random_Variate" c_Cauchy_Random_Variate :: IO CDouble
 foreign import ccall "Charlier_Cn" c_Charlier_Cn :: CDouble -> CDouble -> CInt -> CDouble
 foreign import ccall "Chebyshev_Shifted_Tn" c_Chebyshev_Shifted_Tn :: CDouble -> CInt -> CDouble
@@ -35,6 +39,9 @@ foreign import ccall "Chebyshev_Wn" c_Chebyshev_Wn :: CDouble -> CInt -> CDouble
 foreign import ccall "Chi_Square_Density" c_Chi_Square_Density :: CDouble -> CInt -> CDouble
 foreign import ccall "Chi_Square_Distribution" c_Chi_Square_Distribution :: CDouble -> CInt -> CDouble
 foreign import ccall "Chi_Square_Distribution_Large_dof" c_Chi_Square_Distribution_Large_dof :: CDouble -> CInt -> CDouble
+foreign import ccall "Chi_Square_Quantile" c_Chi_Square_Quantile :: CDouble -> CInt -> CDouble
+foreign import ccall "Chi_Square_Random_Variate" c_Chi_Square_Random_Variate :: CDouble -> IO CDouble
+foreign import ccall "Chi_Square_Variate_Inversion" c_Chi_Square_Variate_Inversion :: CInt -> IO CDouble
 foreign import ccall "Complete_Elliptic_Integral_First_Kind" c_Complete_Elliptic_Integral_First_Kind :: CChar -> CDouble -> CDouble
 foreign import ccall "Complete_Elliptic_Integral_Second_Kind" c_Complete_Elliptic_Integral_Second_Kind :: CChar -> CDouble -> CDouble
 foreign import ccall "Cos_Integral_Ci" c_Cos_Integral_Ci :: CDouble -> CDouble
@@ -55,6 +62,7 @@ foreign import ccall "Exponential_Integral_Beta_n" c_Exponential_Integral_Beta_n
 foreign import ccall "Exponential_Integral_Ei" c_Exponential_Integral_Ei :: CDouble -> CDouble
 foreign import ccall "Exponential_Integral_Ein" c_Exponential_Integral_Ein :: CDouble -> CDouble
 foreign import ccall "Exponential_Integral_En" c_Exponential_Integral_En :: CDouble -> CInt -> CDouble
+foreign import ccall "Exponential_Quantile" c_Exponential_Quantile :: CDouble -> CDouble
 foreign import ccall "Exponential_Random_Variate" c_Exponential_Random_Variate :: IO CDouble
 foreign import ccall "Exponential_Variate_Inversion" c_Exponential_Variate_Inversion :: IO CDouble
 foreign import ccall "Exponential_Variate_Ziggurat" c_Exponential_Variate_Ziggurat :: IO CDouble
@@ -63,6 +71,9 @@ foreign import ccall "F_Distribution" c_F_Distribution :: CDouble -> CInt -> CIn
 foreign import ccall "F_Distribution_Large_Denominator_dof" c_F_Distribution_Large_Denominator_dof :: CDouble -> CInt -> CInt -> CDouble
 foreign import ccall "F_Distribution_Large_dofs" c_F_Distribution_Large_dofs :: CDouble -> CInt -> CInt -> CDouble
 foreign import ccall "F_Distribution_Large_Numerator_dof" c_F_Distribution_Large_Numerator_dof :: CDouble -> CInt -> CInt -> CDouble
+foreign import ccall "F_Quantile" c_F_Quantile :: CDouble -> CInt -> CInt -> CDouble
+foreign import ccall "F_Random_Variate" c_F_Random_Variate :: CDouble -> CDouble -> IO CDouble
+foreign import ccall "F_Variate_Inversion" c_F_Variate_Inversion :: CInt -> CInt -> IO CDouble
 foreign import ccall "Factorial" c_Factorial :: CInt -> CDouble
 foreign import ccall "Fresnel_Auxiliary_Cosine_Integral" c_Fresnel_Auxiliary_Cosine_Integral :: CDouble -> CDouble
 foreign import ccall "Fresnel_Auxiliary_Sine_Integral" c_Fresnel_Auxiliary_Sine_Integral :: CDouble -> CDouble
@@ -72,11 +83,15 @@ foreign import ccall "Gamma_Density" c_Gamma_Density :: CDouble -> CDouble -> CD
 foreign import ccall "Gamma_Distribution" c_Gamma_Distribution :: CDouble -> CDouble -> CDouble
 foreign import ccall "Gamma_Function" c_Gamma_Function :: CDouble -> CDouble
 foreign import ccall "Gamma_Function_Max_Arg" c_Gamma_Function_Max_Arg :: IO CDouble
+foreign import ccall "Gamma_Quantile" c_Gamma_Quantile :: CDouble -> CDouble -> CDouble
 foreign import ccall "Gamma_Random_Variate" c_Gamma_Random_Variate :: CDouble -> IO CDouble
+foreign import ccall "Gamma_Variate_Inversion" c_Gamma_Variate_Inversion :: CDouble -> IO CDouble
 foreign import ccall "Gaussian_Density" c_Gaussian_Density :: CDouble -> CDouble
 foreign import ccall "Gaussian_Distribution" c_Gaussian_Distribution :: CDouble -> CDouble
+foreign import ccall "Gaussian_Quantile" c_Gaussian_Quantile :: CDouble -> CDouble
 foreign import ccall "Gaussian_Random_Variate" c_Gaussian_Random_Variate :: IO CDouble
 foreign import ccall "Gaussian_Variate_Box_Muller" c_Gaussian_Variate_Box_Muller :: IO CDouble
+foreign import ccall "Gaussian_Variate_Inversion" c_Gaussian_Variate_Inversion :: IO CDouble
 foreign import ccall "Gaussian_Variate_Marsaglias_Ziggurat" c_Gaussian_Variate_Marsaglias_Ziggurat :: IO CDouble
 foreign import ccall "Gaussian_Variate_Polar_Marsaglia" c_Gaussian_Variate_Polar_Marsaglia :: IO CDouble
 foreign import ccall "Gaussian_Variate_Sum_12_Uniforms" c_Gaussian_Variate_Sum_12_Uniforms :: IO CDouble
@@ -86,15 +101,18 @@ foreign import ccall "Geometric_Point_Distribution" c_Geometric_Point_Distributi
 foreign import ccall "Geometric_Random_Variate" c_Geometric_Random_Variate :: CDouble -> IO CInt
 foreign import ccall "Gumbels_Maximum_Density" c_Gumbels_Maximum_Density :: CDouble -> CDouble
 foreign import ccall "Gumbels_Maximum_Distribution" c_Gumbels_Maximum_Distribution :: CDouble -> CDouble
+foreign import ccall "Gumbels_Maximum_Quantile" c_Gumbels_Maximum_Quantile :: CDouble -> CDouble
 foreign import ccall "Gumbels_Maximum_Random_Variate" c_Gumbels_Maximum_Random_Variate :: IO CDouble
 foreign import ccall "Gumbels_Minimum_Density" c_Gumbels_Minimum_Density :: CDouble -> CDouble
 foreign import ccall "Gumbels_Minimum_Distribution" c_Gumbels_Minimum_Distribution :: CDouble -> CDouble
+foreign import ccall "Gumbels_Minimum_Quantile" c_Gumbels_Minimum_Quantile :: CDouble -> CDouble
 foreign import ccall "Gumbels_Minimum_Random_Variate" c_Gumbels_Minimum_Random_Variate :: IO CDouble
 foreign import ccall "Hermite_Hen" c_Hermite_Hen :: CDouble -> CInt -> CDouble
 foreign import ccall "Hermite_Hn" c_Hermite_Hn :: CDouble -> CInt -> CDouble
 foreign import ccall "Heumans_Lambda_Naught" c_Heumans_Lambda_Naught :: CDouble -> CDouble -> CDouble
 foreign import ccall "Hypergeometric_Cumulative_Distribution" c_Hypergeometric_Cumulative_Distribution :: CInt -> CInt -> CInt -> CInt -> CDouble
 foreign import ccall "Hypergeometric_Point_Distribution" c_Hypergeometric_Point_Distribution :: CInt -> CInt -> CInt -> CInt -> CDouble
+foreign import ccall "Hypergeometric_Random_Variate" c_Hypergeometric_Random_Variate :: CInt -> CInt -> CInt -> IO CInt
 foreign import ccall "Incomplete_Beta_Function" c_Incomplete_Beta_Function :: CDouble -> CDouble -> CDouble -> CDouble
 foreign import ccall "Incomplete_Gamma_Function" c_Incomplete_Gamma_Function :: CDouble -> CDouble -> CDouble
 foreign import ccall "Inverse_Jacobi_cn" c_Inverse_Jacobi_cn :: CDouble -> CChar -> CDouble -> CDouble
@@ -107,14 +125,18 @@ foreign import ccall "Jacobi_Pn" c_Jacobi_Pn :: CDouble -> CDouble -> CDouble ->
 foreign import ccall "Jacobi_sn" c_Jacobi_sn :: CDouble -> CChar -> CDouble -> CDouble
 foreign import ccall "Jacobi_Zeta_Function" c_Jacobi_Zeta_Function :: CDouble -> CChar -> CDouble -> CDouble
 foreign import ccall "Kolmogorov_Asymptotic_Distribution" c_Kolmogorov_Asymptotic_Distribution :: CDouble -> CInt -> CDouble
+foreign import ccall "Kolmogorov_Distribution" c_Kolmogorov_Distribution :: CDouble -> CInt -> CDouble
+foreign import ccall "Kolmogorov_Distribution_Complement" c_Kolmogorov_Distribution_Complement :: CDouble -> CInt -> CDouble
 foreign import ccall "Krawtchouk_Kn" c_Krawtchouk_Kn :: CDouble -> CDouble -> CInt -> CInt -> CDouble
 foreign import ccall "Kumaraswamys_Density" c_Kumaraswamys_Density :: CDouble -> CDouble -> CDouble -> CDouble
 foreign import ccall "Kumaraswamys_Distribution" c_Kumaraswamys_Distribution :: CDouble -> CDouble -> CDouble -> CDouble
+foreign import ccall "Kumaraswamys_Quantile" c_Kumaraswamys_Quantile :: CDouble -> CDouble -> CDouble -> CDouble
 foreign import ccall "Kumaraswamys_Random_Variate" c_Kumaraswamys_Random_Variate :: CDouble -> CDouble -> IO CDouble
 foreign import ccall "Laguerre_Ln" c_Laguerre_Ln :: CDouble -> CInt -> CDouble
 foreign import ccall "Laguerre_Ln_alpha" c_Laguerre_Ln_alpha :: CDouble -> CDouble -> CInt -> CDouble
 foreign import ccall "Laplace_Density" c_Laplace_Density :: CDouble -> CDouble
 foreign import ccall "Laplace_Distribution" c_Laplace_Distribution :: CDouble -> CDouble
+foreign import ccall "Laplace_Quantile" c_Laplace_Quantile :: CDouble -> CDouble
 foreign import ccall "Laplace_Random_Variate" c_Laplace_Random_Variate :: IO CDouble
 foreign import ccall "Legendre_Elliptic_Integral_First_Kind" c_Legendre_Elliptic_Integral_First_Kind :: CDouble -> CChar -> CDouble -> CDouble
 foreign import ccall "Legendre_Elliptic_Integral_Second_Kind" c_Legendre_Elliptic_Integral_Second_Kind :: CDouble -> CChar -> CDouble -> CDouble
@@ -128,6 +150,7 @@ foreign import ccall "Log_Series_Point_Distribution" c_Log_Series_Point_Distribu
 foreign import ccall "Log_Series_Random_Variate" c_Log_Series_Random_Variate :: CDouble -> IO CInt
 foreign import ccall "Logistic_Density" c_Logistic_Density :: CDouble -> CDouble
 foreign import ccall "Logistic_Distribution" c_Logistic_Distribution :: CDouble -> CDouble
+foreign import ccall "Logistic_Quantile" c_Logistic_Quantile :: CDouble -> CDouble
 foreign import ccall "Logistic_Random_Variate" c_Logistic_Random_Variate :: IO CDouble
 foreign import ccall "Negative_Binomial_Cumulative_Distribution" c_Negative_Binomial_Cumulative_Distribution :: CInt -> CInt -> CDouble -> CDouble
 foreign import ccall "Negative_Binomial_Point_Distribution" c_Negative_Binomial_Point_Distribution :: CInt -> CInt -> CDouble -> CDouble
@@ -135,11 +158,17 @@ foreign import ccall "Negative_Binomial_Random_Variate" c_Negative_Binomial_Rand
 foreign import ccall "Nome" c_Nome :: CDouble -> CDouble
 foreign import ccall "Pareto_Density" c_Pareto_Density :: CDouble -> CDouble -> CDouble
 foreign import ccall "Pareto_Distribution" c_Pareto_Distribution :: CDouble -> CDouble -> CDouble
+foreign import ccall "Pareto_Quantile" c_Pareto_Quantile :: CDouble -> CDouble -> CDouble
 foreign import ccall "Pareto_Random_Variate" c_Pareto_Random_Variate :: CDouble -> IO CDouble
 foreign import ccall "Poisson_Cumulative_Distribution" c_Poisson_Cumulative_Distribution :: CInt -> CDouble -> CDouble
 foreign import ccall "Poisson_Point_Distribution" c_Poisson_Point_Distribution :: CInt -> CDouble -> CDouble
 foreign import ccall "Poisson_Random_Variate" c_Poisson_Random_Variate :: CDouble -> IO CInt
+foreign import ccall "Polygamma_Function" c_Polygamma_Function :: CInt -> CDouble -> CDouble
 foreign import ccall "Quadruple_Factorial" c_Quadruple_Factorial :: CInt -> CDouble
+foreign import ccall "Regularized_Incomplete_Beta" c_Regularized_Incomplete_Beta :: CDouble -> CDouble -> CDouble -> CDouble
+foreign import ccall "Regularized_Incomplete_Beta_Complement" c_Regularized_Incomplete_Beta_Complement :: CDouble -> CDouble -> CDouble -> CDouble
+foreign import ccall "Regularized_Incomplete_Gamma_P" c_Regularized_Incomplete_Gamma_P :: CDouble -> CDouble -> CDouble
+foreign import ccall "Regularized_Incomplete_Gamma_Q" c_Regularized_Incomplete_Gamma_Q :: CDouble -> CDouble -> CDouble
 foreign import ccall "Riemann_Zeta_Function" c_Riemann_Zeta_Function :: CDouble -> CDouble
 foreign import ccall "Riemann_Zeta_Star_Function" c_Riemann_Zeta_Star_Function :: CDouble -> CDouble
 foreign import ccall "Rising_Factorial" c_Rising_Factorial :: CInt -> CInt -> CDouble
@@ -147,18 +176,26 @@ foreign import ccall "Sin_Integral_Si" c_Sin_Integral_Si :: CDouble -> CDouble
 foreign import ccall "Student_t_Density" c_Student_t_Density :: CDouble -> CInt -> CDouble
 foreign import ccall "Student_t_Distribution" c_Student_t_Distribution :: CDouble -> CInt -> CDouble
 foreign import ccall "Student_t_Distribution_Large_dof" c_Student_t_Distribution_Large_dof :: CDouble -> CInt -> CDouble
+foreign import ccall "Student_t_Quantile" c_Student_t_Quantile :: CDouble -> CInt -> CDouble
+foreign import ccall "Student_t_Random_Variate" c_Student_t_Random_Variate :: CDouble -> IO CDouble
+foreign import ccall "Student_t_Variate_Inversion" c_Student_t_Variate_Inversion :: CInt -> IO CDouble
 foreign import ccall "t2_Density" c_t2_Density :: CDouble -> CDouble
 foreign import ccall "t2_Distribution" c_t2_Distribution :: CDouble -> CDouble
+foreign import ccall "t2_Quantile" c_t2_Quantile :: CDouble -> CDouble
 foreign import ccall "t2_Variate_Inversion" c_t2_Variate_Inversion :: IO CDouble
+foreign import ccall "TriGamma_Function" c_TriGamma_Function :: CDouble -> CDouble
 foreign import ccall "Triple_Factorial" c_Triple_Factorial :: CInt -> CDouble
 foreign import ccall "Uniform_0_1_Init_Seed" c_Uniform_0_1_Init_Seed :: CInt -> IO ()
 foreign import ccall "Uniform_0_1_Init_Time" c_Uniform_0_1_Init_Time :: IO ()
+foreign import ccall "Uniform_0_1_Select_Engine" c_Uniform_0_1_Select_Engine :: CInt -> IO ()
 foreign import ccall "Uniform_0_1_Density" c_Uniform_0_1_Density :: CDouble -> CDouble
 foreign import ccall "Uniform_0_1_Distribution" c_Uniform_0_1_Distribution :: CDouble -> CDouble
 foreign import ccall "Uniform_0_1_Random_Variate" c_Uniform_0_1_Random_Variate :: IO CDouble
 foreign import ccall "Weibull_Density" c_Weibull_Density :: CDouble -> CDouble -> CDouble
 foreign import ccall "Weibull_Distribution" c_Weibull_Distribution :: CDouble -> CDouble -> CDouble
+foreign import ccall "Weibull_Quantile" c_Weibull_Quantile :: CDouble -> CDouble -> CDouble
 foreign import ccall "Weibull_Random_Variate" c_Weibull_Random_Variate :: CDouble -> IO CDouble
+foreign import ccall "Weibull_Variate_Inversion" c_Weibull_Variate_Inversion :: CDouble -> IO CDouble
 
 absolute_student_t_distribution :: Double -> Int -> Double
 absolute_student_t_distribution x n = realToFrac $ c_Absolute_Student_t_Distribution (realToFrac x) (fromIntegral n)
@@ -166,6 +203,9 @@ absolute_student_t_distribution x n = realToFrac $ c_Absolute_Student_t_Distribu
 absolute_student_t_distribution_large_dof :: Double -> Int -> Double
 absolute_student_t_distribution_large_dof x n = realToFrac $ c_Absolute_Student_t_Distribution_Large_dof (realToFrac x) (fromIntegral n)
 
+absolute_student_t_quantile :: Double -> Int -> Double
+absolute_student_t_quantile p n = realToFrac $ c_Absolute_Student_t_Quantile (realToFrac p) (fromIntegral n)
+
 auxiliary_cos_integral_gi :: Double -> Double 
 auxiliary_cos_integral_gi x = realToFrac $ c_Auxiliary_Cos_Integral_gi (realToFrac x)
 
@@ -187,9 +227,15 @@ beta_distribution x a b = realToFrac $ c_Beta_Distribution (realToFrac x) (realT
 beta_function :: Double -> Double -> Double
 beta_function a b = realToFrac $ c_Beta_Function (realToFrac a) (realToFrac b)
 
+beta_quantile :: Double -> Double -> Double -> Double
+beta_quantile p a b = realToFrac $ c_Beta_Quantile (realToFrac p) (realToFrac a) (realToFrac b)
+
 beta_random_variate :: Double -> Double -> IO Double
 beta_random_variate a b = do return . realToFrac =<< c_Beta_Random_Variate (realToFrac a) (realToFrac b)
 
+beta_variate_inversion :: Double -> Double -> IO Double
+beta_variate_inversion a b = do return . realToFrac =<< c_Beta_Variate_Inversion (realToFrac a) (realToFrac b)
+
 binomial_coefficient :: Int -> Int -> Double
 binomial_coefficient n m = realToFrac $ c_Binomial_Coefficient (fromIntegral n) (fromIntegral m)
 
@@ -214,6 +260,9 @@ cauchy_density x = realToFrac $ c_Cauchy_Density (realToFrac x)
 cauchy_distribution :: Double -> Double
 cauchy_distribution x = realToFrac $ c_Cauchy_Distribution (realToFrac x)
 
+cauchy_quantile :: Double -> Double
+cauchy_quantile p = realToFrac $ c_Cauchy_Quantile (realToFrac p)
+
 cauchy_random_variate :: IO Double
 cauchy_random_variate = do return . realToFrac =<< c_Cauchy_Random_Variate
 
@@ -253,6 +302,15 @@ chi_square_distribution x n = realToFrac $ c_Chi_Square_Distribution (realToFrac
 chi_square_distribution_large_dof :: Double -> Int -> Double
 chi_square_distribution_large_dof x n = realToFrac $ c_Chi_Square_Distribution_Large_dof (realToFrac x) (fromIntegral n)
 
+chi_square_quantile :: Double -> Int -> Double
+chi_square_quantile p n = realToFrac $ c_Chi_Square_Quantile (realToFrac p) (fromIntegral n)
+
+chi_square_random_variate :: Double -> IO Double
+chi_square_random_variate nu = do return . realToFrac =<< c_Chi_Square_Random_Variate (realToFrac nu)
+
+chi_square_variate_inversion :: Int -> IO Double
+chi_square_variate_inversion n = do return . realToFrac =<< c_Chi_Square_Variate_Inversion (fromIntegral n)
+
 complete_elliptic_integral_first_kind :: Char -> Double -> Double
 complete_elliptic_integral_first_kind arg x = realToFrac $ c_Complete_Elliptic_Integral_First_Kind (castCharToCChar arg) (realToFrac x)
 
@@ -313,6 +371,9 @@ exponential_integral_ein x = realToFrac $ c_Exponential_Integral_Ein (realToFrac
 exponential_integral_en :: Double -> Int -> Double
 exponential_integral_en x n = realToFrac $ c_Exponential_Integral_En (realToFrac x) (fromIntegral n)
 
+exponential_quantile :: Double -> Double
+exponential_quantile p = realToFrac $ c_Exponential_Quantile (realToFrac p)
+
 exponential_random_variate :: IO Double
 exponential_random_variate = do return . realToFrac =<< c_Exponential_Random_Variate
 
@@ -337,6 +398,15 @@ f_distribution_large_dofs f v1 v2 = realToFrac $ c_F_Distribution_Large_dofs (re
 f_distribution_large_numerator_dof :: Double -> Int -> Int -> Double
 f_distribution_large_numerator_dof f v1 v2 = realToFrac $ c_F_Distribution_Large_Numerator_dof (realToFrac f) (fromIntegral v1) (fromIntegral v2)
 
+f_quantile :: Double -> Int -> Int -> Double
+f_quantile p v1 v2 = realToFrac $ c_F_Quantile (realToFrac p) (fromIntegral v1) (fromIntegral v2)
+
+f_random_variate :: Double -> Double -> IO Double
+f_random_variate nu1 nu2 = do return . realToFrac =<< c_F_Random_Variate (realToFrac nu1) (realToFrac nu2)
+
+f_variate_inversion :: Int -> Int -> IO Double
+f_variate_inversion v1 v2 = do return . realToFrac =<< c_F_Variate_Inversion (fromIntegral v1) (fromIntegral v2)
+
 factorial :: Int -> Double
 factorial n = realToFrac $ c_Factorial (fromIntegral n)
 
@@ -364,21 +434,33 @@ gamma_function x = realToFrac $ c_Gamma_Function (realToFrac x)
 gamma_function_max_arg :: IO Double
 gamma_function_max_arg = do return . realToFrac =<< c_Gamma_Function_Max_Arg
 
+gamma_quantile :: Double -> Double -> Double
+gamma_quantile p nu = realToFrac $ c_Gamma_Quantile (realToFrac p) (realToFrac nu)
+
 gamma_random_variate :: Double -> IO Double
 gamma_random_variate a = do return . realToFrac =<< c_Gamma_Random_Variate (realToFrac a)
 
+gamma_variate_inversion :: Double -> IO Double
+gamma_variate_inversion a = do return . realToFrac =<< c_Gamma_Variate_Inversion (realToFrac a)
+
 gaussian_density :: Double -> Double
 gaussian_density x = realToFrac $ c_Gaussian_Density (realToFrac x)
 
 gaussian_distribution :: Double -> Double
 gaussian_distribution x = realToFrac $ c_Gaussian_Distribution (realToFrac x)
 
+gaussian_quantile :: Double -> Double
+gaussian_quantile p = realToFrac $ c_Gaussian_Quantile (realToFrac p)
+
 gaussian_random_variate :: IO Double
 gaussian_random_variate = do return . realToFrac =<< c_Gaussian_Random_Variate
 
 gaussian_variate_box_muller :: IO Double
 gaussian_variate_box_muller = do return . realToFrac =<< c_Gaussian_Variate_Box_Muller
 
+gaussian_variate_inversion :: IO Double
+gaussian_variate_inversion = do return . realToFrac =<< c_Gaussian_Variate_Inversion
+
 gaussian_variate_marsaglias_ziggurat :: IO Double
 gaussian_variate_marsaglias_ziggurat = do return . realToFrac =<< c_Gaussian_Variate_Marsaglias_Ziggurat
 
@@ -406,6 +488,9 @@ gumbels_maximum_density x = realToFrac $ c_Gumbels_Maximum_Density (realToFrac x
 gumbels_maximum_distribution :: Double -> Double
 gumbels_maximum_distribution x = realToFrac $ c_Gumbels_Maximum_Distribution (realToFrac x)
 
+gumbels_maximum_quantile :: Double -> Double
+gumbels_maximum_quantile p = realToFrac $ c_Gumbels_Maximum_Quantile (realToFrac p)
+
 gumbels_maximum_random_variate :: IO Double
 gumbels_maximum_random_variate = do return . realToFrac =<< c_Gumbels_Maximum_Random_Variate
 
@@ -415,6 +500,9 @@ gumbels_minimum_density x = realToFrac $ c_Gumbels_Minimum_Density (realToFrac x
 gumbels_minimum_distribution :: Double -> Double
 gumbels_minimum_distribution x = realToFrac $ c_Gumbels_Minimum_Distribution (realToFrac x)
 
+gumbels_minimum_quantile :: Double -> Double
+gumbels_minimum_quantile p = realToFrac $ c_Gumbels_Minimum_Quantile (realToFrac p)
+
 gumbels_minimum_random_variate :: IO Double
 gumbels_minimum_random_variate = do return . realToFrac =<< c_Gumbels_Minimum_Random_Variate
 
@@ -433,6 +521,9 @@ hypergeometric_cumulative_distribution n1 n2 n k = realToFrac $ c_Hypergeometric
 hypergeometric_point_distribution :: Int -> Int -> Int -> Int -> Double
 hypergeometric_point_distribution n1 n2 n k = realToFrac $ c_Hypergeometric_Point_Distribution (fromIntegral n1) (fromIntegral n2) (fromIntegral n) (fromIntegral k)
 
+hypergeometric_random_variate :: Int -> Int -> Int -> IO Int
+hypergeometric_random_variate n1 n2 n = do return . fromIntegral =<< c_Hypergeometric_Random_Variate (fromIntegral n1) (fromIntegral n2) (fromIntegral n)
+
 incomplete_beta_function :: Double -> Double -> Double -> Double
 incomplete_beta_function x a b = realToFrac $ c_Incomplete_Beta_Function (realToFrac x) (realToFrac a) (realToFrac b)
 
@@ -469,6 +560,12 @@ jacobi_zeta_function amplitude arg x = realToFrac $ c_Jacobi_Zeta_Function (real
 kolmogorov_asymptotic_distribution :: Double -> Int -> Double
 kolmogorov_asymptotic_distribution dn sample_size = realToFrac $ c_Kolmogorov_Asymptotic_Distribution (realToFrac dn) (fromIntegral sample_size)
 
+kolmogorov_distribution :: Double -> Int -> Double
+kolmogorov_distribution dn sample_size = realToFrac $ c_Kolmogorov_Distribution (realToFrac dn) (fromIntegral sample_size)
+
+kolmogorov_distribution_complement :: Double -> Int -> Double
+kolmogorov_distribution_complement dn sample_size = realToFrac $ c_Kolmogorov_Distribution_Complement (realToFrac dn) (fromIntegral sample_size)
+
 krawtchouk_kn :: Double -> Double -> Int -> Int -> Double
 krawtchouk_kn x p n k = realToFrac $ c_Krawtchouk_Kn (realToFrac x) (realToFrac p) (fromIntegral n) (fromIntegral k)
 
@@ -478,6 +575,9 @@ kumaraswamys_density x a b = realToFrac $ c_Kumaraswamys_Density (realToFrac x)
 kumaraswamys_distribution :: Double -> Double -> Double -> Double
 kumaraswamys_distribution x a b = realToFrac $ c_Kumaraswamys_Distribution (realToFrac x) (realToFrac a) (realToFrac b)
 
+kumaraswamys_quantile :: Double -> Double -> Double -> Double
+kumaraswamys_quantile p a b = realToFrac $ c_Kumaraswamys_Quantile (realToFrac p) (realToFrac a) (realToFrac b)
+
 kumaraswamys_random_variate :: Double -> Double -> IO Double
 kumaraswamys_random_variate a b = do return . realToFrac =<< c_Kumaraswamys_Random_Variate (realToFrac a) (realToFrac b)
 
@@ -493,6 +593,9 @@ laplace_density x = realToFrac $ c_Laplace_Density (realToFrac x)
 laplace_distribution :: Double -> Double
 laplace_distribution x = realToFrac $ c_Laplace_Distribution (realToFrac x)
 
+laplace_quantile :: Double -> Double
+laplace_quantile p = realToFrac $ c_Laplace_Quantile (realToFrac p)
+
 laplace_random_variate :: IO Double
 laplace_random_variate = do return . realToFrac =<< c_Laplace_Random_Variate
 
@@ -532,6 +635,9 @@ logistic_density x = realToFrac $ c_Logistic_Density (realToFrac x)
 logistic_distribution :: Double -> Double
 logistic_distribution x = realToFrac $ c_Logistic_Distribution (realToFrac x)
 
+logistic_quantile :: Double -> Double
+logistic_quantile p = realToFrac $ c_Logistic_Quantile (realToFrac p)
+
 logistic_random_variate :: IO Double
 logistic_random_variate = do return . realToFrac =<< c_Logistic_Random_Variate
 
@@ -553,6 +659,9 @@ pareto_density x a = realToFrac $ c_Pareto_Density (realToFrac x) (realToFrac a)
 pareto_distribution :: Double -> Double -> Double
 pareto_distribution x a = realToFrac $ c_Pareto_Distribution (realToFrac x) (realToFrac a)
 
+pareto_quantile :: Double -> Double -> Double
+pareto_quantile p a = realToFrac $ c_Pareto_Quantile (realToFrac p) (realToFrac a)
+
 pareto_random_variate :: Double -> IO Double
 pareto_random_variate a = do return . realToFrac =<< c_Pareto_Random_Variate (realToFrac a)
 
@@ -565,9 +674,24 @@ poisson_point_distribution k mu = realToFrac $ c_Poisson_Point_Distribution (fro
 poisson_random_variate :: Double -> IO Int
 poisson_random_variate mu = do return . fromIntegral =<< c_Poisson_Random_Variate (realToFrac mu)
 
+polygamma_function :: Int -> Double -> Double
+polygamma_function n x = realToFrac $ c_Polygamma_Function (fromIntegral n) (realToFrac x)
+
 quadruple_factorial :: Int -> Double
 quadruple_factorial n = realToFrac $ c_Quadruple_Factorial (fromIntegral n)
 
+regularized_incomplete_beta :: Double -> Double -> Double -> Double
+regularized_incomplete_beta x a b = realToFrac $ c_Regularized_Incomplete_Beta (realToFrac x) (realToFrac a) (realToFrac b)
+
+regularized_incomplete_beta_complement :: Double -> Double -> Double -> Double
+regularized_incomplete_beta_complement x a b = realToFrac $ c_Regularized_Incomplete_Beta_Complement (realToFrac x) (realToFrac a) (realToFrac b)
+
+regularized_incomplete_gamma_p :: Double -> Double -> Double
+regularized_incomplete_gamma_p x nu = realToFrac $ c_Regularized_Incomplete_Gamma_P (realToFrac x) (realToFrac nu)
+
+regularized_incomplete_gamma_q :: Double -> Double -> Double
+regularized_incomplete_gamma_q x nu = realToFrac $ c_Regularized_Incomplete_Gamma_Q (realToFrac x) (realToFrac nu)
+
 riemann_zeta_function :: Double -> Double
 riemann_zeta_function s = realToFrac $ c_Riemann_Zeta_Function (realToFrac s)
 
@@ -589,15 +713,30 @@ student_t_distribution x n = realToFrac $ c_Student_t_Distribution (realToFrac x
 student_t_distribution_large_dof :: Double -> Int -> Double
 student_t_distribution_large_dof x n = realToFrac $ c_Student_t_Distribution_Large_dof (realToFrac x) (fromIntegral n)
 
+student_t_quantile :: Double -> Int -> Double
+student_t_quantile p n = realToFrac $ c_Student_t_Quantile (realToFrac p) (fromIntegral n)
+
+student_t_random_variate :: Double -> IO Double
+student_t_random_variate nu = do return . realToFrac =<< c_Student_t_Random_Variate (realToFrac nu)
+
+student_t_variate_inversion :: Int -> IO Double
+student_t_variate_inversion n = do return . realToFrac =<< c_Student_t_Variate_Inversion (fromIntegral n)
+
 t2_density :: Double -> Double
 t2_density x = realToFrac $ c_t2_Density (realToFrac x)
 
 t2_distribution :: Double -> Double
 t2_distribution x = realToFrac $ c_t2_Distribution (realToFrac x)
 
+t2_quantile :: Double -> Double
+t2_quantile p = realToFrac $ c_t2_Quantile (realToFrac p)
+
 t2_variate_inversion :: IO Double
 t2_variate_inversion = do return . realToFrac =<< c_t2_Variate_Inversion
 
+trigamma_function :: Double -> Double
+trigamma_function x = realToFrac $ c_TriGamma_Function (realToFrac x)
+
 triple_factorial :: Int -> Double
 triple_factorial n = realToFrac $ c_Triple_Factorial (fromIntegral n)
 
@@ -607,6 +746,9 @@ uniform_0_1_init_seed seed = c_Uniform_0_1_Init_Seed $ fromIntegral seed
 uniform_0_1_init_time :: IO ()
 uniform_0_1_init_time = c_Uniform_0_1_Init_Time
 
+uniform_0_1_select_engine :: Int -> IO ()
+uniform_0_1_select_engine engine = c_Uniform_0_1_Select_Engine $ fromIntegral engine
+
 uniform_0_1_density :: Double -> Double
 uniform_0_1_density x = realToFrac $ c_Uniform_0_1_Density (realToFrac x)
 
@@ -622,5 +764,11 @@ weibull_density x a = realToFrac $ c_Weibull_Density (realToFrac x) (realToFrac
 weibull_distribution :: Double -> Double -> Double
 weibull_distribution x a = realToFrac $ c_Weibull_Distribution (realToFrac x) (realToFrac a)
 
+weibull_quantile :: Double -> Double -> Double
+weibull_quantile p a = realToFrac $ c_Weibull_Quantile (realToFrac p) (realToFrac a)
+
 weibull_random_variate :: Double -> IO Double
 weibull_random_variate a = do return . realToFrac =<< c_Weibull_Random_Variate (realToFrac a)
+
+weibull_variate_inversion :: Double -> IO Double
+weibull_variate_inversion a = do return . realToFrac =<< c_Weibull_Variate_Inversion (realToFrac a)
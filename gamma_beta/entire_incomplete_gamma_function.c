@@ -3,6 +3,7 @@
 // Routine(s):                                                                //
 //    Entire_Incomplete_Gamma_Function                                        //
 //    xEntire_Incomplete_Gamma_Function                                       //
+//    Entire_Incomplete_Gamma_Function_Array                                  //
 ////////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////
 //  Description:                                                              //
@@ -10,6 +11,12 @@
 //     incomplete gamma function, is defined as the integral from 0 to x of   //
 //     the integrand t^(nu-1) exp(-t) / gamma(nu) dt.  The parameter nu is    //
 //     sometimes referred to as the shape parameter.                          //
+//                                                                            //
+//     For x > 0 and nu > 0 it is the regularized incomplete gamma function   //
+//     P(nu,x), which is evaluated by xRegularized_Incomplete_Gamma_P() with  //
+//     a cost which does not grow with nu, so that the library has a single   //
+//     gamma distribution function.  The series below are used only for x < 0 //
+//     or nu <= 0.                                                            //
 ////////////////////////////////////////////////////////////////////////////////
 #include <math.h>           // required for fabsl(), powl(), expl() and logl().
 #include <float.h>          // required for DBL_EPSILON
@@ -20,15 +27,21 @@ extern long double xGamma_Function( long double x );
 extern double Gamma_Function_Max_Arg( void );
 extern long double xLn_Gamma_Function( long double x );
 extern long double xFactorial( int n );
+extern long double xRegularized_Incomplete_Gamma_P( long double x,
+                                                            long double nu );
+extern long double xRegularized_Incomplete_Gamma_Normalizer( long double nu );
+extern double Regularized_Incomplete_Gamma_P_Prepared( double x, double nu,
+                                                  long double ln_gamma_star );
 
 //                         Internally Defined Routines                        //
 
 double Entire_Incomplete_Gamma_Function(double x, double nu); 
 long double xEntire_Incomplete_Gamma_Function(long double x, long double nu);
  
-static long double xSmall_x(long double x, long double nu);
-static long double xMedium_x(long double x, long double nu);
-static long double xLarge_x(long double x, long double nu);
+static long double xGamma_Or_Ln_Gamma(long double nu);
+static long double xSmall_x(long double x, long double nu, long double g);
+static long double xMedium_x(long double x, long double nu, long double g);
+static long double xLarge_x(long double x, long double nu, long double g);
 
 ////////////////////////////////////////////////////////////////////////////////
 // double Entire_Incomplete_Gamma_Function(double x, double nu)               //
@@ -81,16 +94,99 @@ double Entire_Incomplete_Gamma_Function(double x, double nu)
 ////////////////////////////////////////////////////////////////////////////////
 long double xEntire_Incomplete_Gamma_Function(long double x, long double nu)
 {
-   
    if (x == 0.0L) return 0.0L;
-   if (fabsl(x) <= 1.0L) return xSmall_x(x, nu);
-   if (fabsl(x) < (nu + 1.0L) ) return xMedium_x(x, nu);
-   return xLarge_x(x, nu);
+   if (x > 0.0L && nu > 0.0L) return xRegularized_Incomplete_Gamma_P(x, nu);
+   if (fabsl(x) <= 1.0L) return xSmall_x(x, nu, xGamma_Or_Ln_Gamma(nu));
+   if (fabsl(x) < (nu + 1.0L) )
+      return xMedium_x(x, nu, xGamma_Or_Ln_Gamma(nu));
+   return xLarge_x(x, nu, xGamma_Or_Ln_Gamma(nu));
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// void Entire_Incomplete_Gamma_Function_Array(double x[], double g[], int n, //
+//                                                                 double nu) //
+//                                                                            //
+//  Description:                                                              //
+//     This function evaluates the entire incomplete gamma function with      //
+//     shape parameter nu at each of the n points x[0],...,x[n-1].  The part  //
+//     of the normalization depending only on nu is calculated once rather    //
+//     than for each point, xRegularized_Incomplete_Gamma_Normalizer(nu) for  //
+//     the positive points and gamma(nu), or its logarithm if gamma(nu) would //
+//     overflow, for the negative ones.                                       //
+//                                                                            //
+//  Arguments:                                                                //
+//     double x[] Array of n upper limits of the integral with integrand      //
+//                given above.                                                //
+//     double g[] Array of n elements, g[i] is set to the entire incomplete   //
+//                gamma function evaluated at x[i].  g may be the same array  //
+//                as x.                                                       //
+//     int    n   The number of points.                                       //
+//     double nu  The shape parameter of the entire incomplete gamma function.//
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     #define N 100                                                          //
+//     double x[N], g[N], nu;                                                 //
+//                                                                            //
+//     Entire_Incomplete_Gamma_Function_Array( x, g, N, nu );                 //
+////////////////////////////////////////////////////////////////////////////////
+
+void Entire_Incomplete_Gamma_Function_Array(double x[], double g[], int n,
+                                                                     double nu)
+{
+   long double xnu = (long double) nu;
+   long double ln_gamma_star = xRegularized_Incomplete_Gamma_Normalizer(xnu);
+   long double gamma_nu = xGamma_Or_Ln_Gamma(xnu);
+   long double xx;
+   int i;
+
+   for (i = 0; i < n; i++) {
+      xx = (long double) x[i];
+      if (xx == 0.0L) g[i] = 0.0;
+      else if (xx > 0.0L && xnu > 0.0L)
+         g[i] = Regularized_Incomplete_Gamma_P_Prepared(x[i], nu,
+                                                               ln_gamma_star);
+      else if (fabsl(xx) <= 1.0L) g[i] = (double) xSmall_x(xx, xnu, gamma_nu);
+      else if (fabsl(xx) < (xnu + 1.0L) )
+         g[i] = (double) xMedium_x(xx, xnu, gamma_nu);
+      else g[i] = (double) xLarge_x(xx, xnu, gamma_nu);
+   }
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// static long double xGamma_Or_Ln_Gamma(long double nu)                      //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns the normalizing factor used by xSmall_x(),       //
+//     xMedium_x() and xLarge_x(), gamma(nu) if nu <= Gamma_Function_Max_Arg()//
+//     and ln(gamma(nu)) otherwise.                                           //
+//                                                                            //
+//  Arguments:                                                                //
+//     long double nu  The shape parameter of the entire incomplete gamma     //
+//                     function.                                              //
+//                                                                            //
+//  Return Values:                                                            //
+//     gamma(nu) or ln(gamma(nu)).                                            //
+//                                                                            //
+//  Example:                                                                  //
+//     long double g, nu;                                                     //
+//                                                                            //
+//     g = xGamma_Or_Ln_Gamma( nu );                                          //
+////////////////////////////////////////////////////////////////////////////////
+
+static long double xGamma_Or_Ln_Gamma(long double nu)
+{
+   if ( nu <= Gamma_Function_Max_Arg() ) return xGamma_Function(nu);
+   return xLn_Gamma_Function(nu);
 }
 
 
 ////////////////////////////////////////////////////////////////////////////////
-// static long double xSmall_x(long double x, long double nu)                 //
+// static long double xSmall_x(long double x, long double nu, long double g)  //
 //                                                                            //
 //  Description:                                                              //
 //     This function approximates the entire incomplete gamma function for    //
@@ -101,6 +197,8 @@ long double xEntire_Incomplete_Gamma_Function(long double x, long double nu)
 //                     in the section under Entire_Incomplete_Gamma_Function. //
 //     long double nu  The shape parameter of the entire incomplete gamma     //
 //                     function.                                              //
+//     long double g   gamma(nu) if nu <= Gamma_Function_Max_Arg() and        //
+//                     ln(gamma(nu)) otherwise.                               //
 //                                                                            //
 //  Return Values:                                                            //
 //     The entire incomplete gamma function:                                  //
@@ -109,10 +207,10 @@ long double xEntire_Incomplete_Gamma_Function(long double x, long double nu)
 //  Example:                                                                  //
 //     long double x, g, nu;                                                  //
 //                                                                            //
-//     g = xSmall_x( x, nu);                                                  //
+//     g = xSmall_x( x, nu, xGamma_Or_Ln_Gamma(nu) );                         //
 ////////////////////////////////////////////////////////////////////////////////
 #define Nterms 20
-static long double xSmall_x(long double x, long double nu)
+static long double xSmall_x(long double x, long double nu, long double g)
 {
    long double terms[Nterms];
    long double x_term = -x;
@@ -127,13 +225,13 @@ static long double xSmall_x(long double x, long double nu)
    sum = terms[Nterms-1];
    for (i = Nterms-2; i >= 0; i--) sum += terms[i];
    if ( nu <= Gamma_Function_Max_Arg() )
-      return powl(x,nu) * sum / xGamma_Function(nu);
-   else return expl(nu * logl(x) + logl(sum) - xLn_Gamma_Function(nu));
+      return powl(x,nu) * sum / g;
+   else return expl(nu * logl(x) + logl(sum) - g);
 }
 
 
 ////////////////////////////////////////////////////////////////////////////////
-// static long double xMedium_x(long double x, long double nu)                //
+// static long double xMedium_x(long double x, long double nu, long double g) //
 //                                                                            //
 //  Description:                                                              //
 //     This function approximates the entire incomplete gamma function for    //
@@ -146,6 +244,8 @@ static long double xSmall_x(long double x, long double nu)
 //                     in the section under Entire_Incomplete_Gamma_Function. //
 //     long double nu  The shape parameter of the entire incomplete gamma     //
 //                     function.                                              //
+//     long double g   gamma(nu) if nu <= Gamma_Function_Max_Arg() and        //
+//                     ln(gamma(nu)) otherwise.                               //
 //                                                                            //
 //  Return Values:                                                            //
 //     The entire incomplete gamma function:                                  //
@@ -154,9 +254,9 @@ static long double xSmall_x(long double x, long double nu)
 //  Example:                                                                  //
 //     long double x, g, nu;                                                  //
 //                                                                            //
-//     g = xMedium_x( x, nu);                                                 //
+//     g = xMedium_x( x, nu, xGamma_Or_Ln_Gamma(nu) );                        //
 ////////////////////////////////////////////////////////////////////////////////
-static long double xMedium_x(long double x, long double nu)
+static long double xMedium_x(long double x, long double nu, long double g)
 {
    long double coef;
    long double term = 1.0L / nu;
@@ -169,10 +269,10 @@ static long double xMedium_x(long double x, long double nu)
    int i;
 
    if (nu > Gamma_Function_Max_Arg()) {
-      coef = expl( nu * logl(x) - x - xLn_Gamma_Function(nu) );
+      coef = expl( nu * logl(x) - x - g );
       if (coef > 0.0L) epsilon = DBL_EPSILON/coef;
    } else {
-      coef = powl(x, nu) * expl(-x) / xGamma_Function(nu);
+      coef = powl(x, nu) * expl(-x) / g;
       epsilon = DBL_EPSILON/coef;
    }
    if (epsilon <= 0.0L) epsilon = (long double) DBL_EPSILON;
@@ -204,7 +304,7 @@ static long double xMedium_x(long double x, long double nu)
 
 
 ////////////////////////////////////////////////////////////////////////////////
-// static long double xLarge_x(long double x, long double nu)                 //
+// static long double xLarge_x(long double x, long double nu, long double g)  //
 //                                                                            //
 //  Description:                                                              //
 //     This function approximates the entire incomplete gamma function for    //
@@ -217,6 +317,8 @@ static long double xMedium_x(long double x, long double nu)
 //                     in the section under Entire_Incomplete_Gamma_Function. //
 //     long double nu  The shape parameter of the entire incomplete gamma     //
 //                     function.                                              //
+//     long double g   gamma(nu) if nu <= Gamma_Function_Max_Arg() and        //
+//                     ln(gamma(nu)) otherwise.                               //
 //                                                                            //
 //  Return Values:                                                            //
 //     If x is positive and is less than 171 then Gamma(x) is returned and    //
@@ -225,9 +327,9 @@ static long double xMedium_x(long double x, long double nu)
 //  Example:                                                                  //
 //     long double x, g, nu;                                                  //
 //                                                                            //
-//     g = xLarge_x( x, nu);                                                  //
+//     g = xLarge_x( x, nu, xGamma_Or_Ln_Gamma(nu) );                         //
 ////////////////////////////////////////////////////////////////////////////////
-static long double xLarge_x(long double x, long double nu)
+static long double xLarge_x(long double x, long double nu, long double g)
 {
    long double temp = 1.0L / nu;
    long double sum = temp;
@@ -241,11 +343,11 @@ static long double xLarge_x(long double x, long double nu)
       sum += temp;
    }
    if ( nu <= Gamma_Function_Max_Arg() ) {
-      coef = powl(x, nu) * expl(-x) / xGamma_Function(nu);
-      return xMedium_x(x, nu + n) + coef * sum;
+      coef = powl(x, nu) * expl(-x) / g;
+      return xMedium_x(x, nu + n, xGamma_Or_Ln_Gamma(nu + n)) + coef * sum;
    } else {
-      return expl(logl(sum) + nu * logl(x) - x - xLn_Gamma_Function(nu)) +
-                                                        xMedium_x(x, nu + n); 
+      return expl(logl(sum) + nu * logl(x) - x - g) +
+                             xMedium_x(x, nu + n, xGamma_Or_Ln_Gamma(nu + n));
    }   
 }
 
@@ -19,6 +19,8 @@ extern double Gamma_Function_Max_Arg( void );
 extern long double xLn_Gamma_Function( long double x );
 extern long double xEntire_Incomplete_Gamma_Function(long double x,
                                                                 long double nu);
+extern long double xRegularized_Incomplete_Gamma_P(long double x,
+                                                                long double nu);
 
 //                         Internally Defined Routines                        //
 
@@ -58,6 +60,10 @@ double Incomplete_Gamma_Function(double x, double nu) {
 //     of the integrand t^(nu-1) exp(-t) dt.  The parameter nu is sometimes   //
 //     referred to as the shape parameter.                                    //
 //                                                                            //
+//     For x > 0 and nu > 0 the regularized incomplete gamma function         //
+//     P(nu,x), whose cost does not grow with nu, is multiplied by gamma(nu), //
+//     otherwise the entire incomplete gamma function is used.                //
+//                                                                            //
 //  Arguments:                                                                //
 //     long double x   Upper limit of the integral with integrand given above.//
 //     long double nu  The shape parameter of the incomplete gamma function.  //
@@ -73,10 +79,13 @@ double Incomplete_Gamma_Function(double x, double nu) {
 
 long double xIncomplete_Gamma_Function(long double x, long double nu) {
    
+   long double p;
+
    if ( x == 0.0L ) return 0.0L;
+   if ( x > 0.0L && nu > 0.0L ) p = xRegularized_Incomplete_Gamma_P(x,nu);
+   else p = xEntire_Incomplete_Gamma_Function(x,nu);
    if ( nu <= Gamma_Function_Max_Arg() )
-      return xEntire_Incomplete_Gamma_Function(x,nu) * xGamma_Function(nu);
+      return p * xGamma_Function(nu);
    else
-      return expl(logl(xEntire_Incomplete_Gamma_Function(x,nu))
-                                                  + xLn_Gamma_Function(nu));
+      return expl(logl(p) + xLn_Gamma_Function(nu));
 }
@@ -3,6 +3,7 @@
 // Routine(s):                                                                //
 //    Ln_Beta_Function                                                        //
 //    xLn_Beta_Function                                                       //
+//    Ln_Beta_Function_Array                                                  //
 ////////////////////////////////////////////////////////////////////////////////
 //  Description:                                                              //
 //     The beta function is the integral from 0 to 1 of the integrand         //
@@ -13,18 +14,23 @@
 //     These functions return                                                 //
 //       ln(Beta(a,b) = ln(Gamma(a)) + ln(Gamma(b)) - ln(Gamma(a + b)).       //
 ////////////////////////////////////////////////////////////////////////////////
-#include <math.h>                        // required for logl()
+#include <math.h>                        // required for logl() and log()
+#include <float.h>                       // required for DBL_MIN and DBL_MAX
 
 //                         Internally Defined Routines                        //
 
 double Ln_Beta_Function(double a, double b);
 long double xLn_Beta_Function(long double a, long double b);
+void Ln_Beta_Function_Array( double a[], double b[], double lnbeta[], int n );
 
 //                         Externally Defined Routines                        //
 
 extern double Gamma_Function_Max_Arg(void);
 extern long double xGamma_Function(long double x);
 extern long double xLn_Gamma_Function(long double x);
+extern void Beta_Function_Array( double a[], double b[], double beta[], int n );
+
+#define BLOCK 256
 
 ////////////////////////////////////////////////////////////////////////////////
 // double Ln_Beta_Function( double a, double b)                               //
@@ -87,3 +93,53 @@ long double xLn_Beta_Function(long double a, long double b)
    return xLn_Gamma_Function(a) + xLn_Gamma_Function(b)
                                                   - xLn_Gamma_Function(a+b);
 }
+
+
+////////////////////////////////////////////////////////////////////////////////
+// void Ln_Beta_Function_Array( double a[], double b[], double lnbeta[],      //
+//                                                                  int n )   //
+//                                                                            //
+//  Description:                                                              //
+//     This function calculates ln(beta(a[i],b[i])) for each of the n pairs   //
+//     of arguments (a[0],b[0]),...,(a[n-1],b[n-1]).  For a[i] > 0, b[i] > 0  //
+//     and a[i] + b[i] <= Gamma_Function_Max_Arg() the log of the result of   //
+//     Beta_Function_Array() is returned, and otherwise the result of         //
+//     Ln_Beta_Function().  Ln_Beta_Function() is also used if the result of  //
+//     Beta_Function_Array() is not a normal number, so that at the poles and //
+//     where the Beta function overflows the array form returns the same      //
+//     values as the scalar form.                                             //
+//                                                                            //
+//  Arguments:                                                                //
+//     double a[]      Array of n first arguments of the Beta function.       //
+//     double b[]      Array of n second arguments of the Beta function.      //
+//     double lnbeta[] Array of n elements, lnbeta[i] is set to               //
+//                     ln(beta(a[i],b[i])).  lnbeta may be the same array as  //
+//                     a or b.                                                //
+//     int    n        The number of pairs.                                   //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     #define N 100                                                          //
+//     double a[N], b[N], lnbeta[N];                                          //
+//                                                                            //
+//     Ln_Beta_Function_Array( a, b, lnbeta, N );                             //
+////////////////////////////////////////////////////////////////////////////////
+
+void Ln_Beta_Function_Array( double a[], double b[], double lnbeta[], int n )
+{
+   double beta[BLOCK];
+   double max = Gamma_Function_Max_Arg();
+   int i, j, m;
+
+   for (j = 0; j < n; j += m) {
+      m = (n - j < BLOCK) ? n - j : BLOCK;
+      Beta_Function_Array(&a[j], &b[j], beta, m);
+      for (i = 0; i < m; i++)
+         if ( a[j+i] > 0.0 && b[j+i] > 0.0 && a[j+i] + b[j+i] <= max
+                           && beta[i] >= DBL_MIN && beta[i] < DBL_MAX )
+            lnbeta[j+i] = log(beta[i]);
+         else lnbeta[j+i] = Ln_Beta_Function(a[j+i], b[j+i]);
+   }
+}
@@ -0,0 +1,762 @@
+////////////////////////////////////////////////////////////////////////////////
+// File: polygamma_function.c                                                 //
+// Routine(s):                                                                //
+//    TriGamma_Function                                                       //
+//    xTriGamma_Function                                                      //
+//    Polygamma_Function                                                      //
+//    xPolygamma_Function                                                     //
+//    TriGamma_Function_Array                                                 //
+//    Polygamma_Function_Array                                                //
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+//  Description:                                                              //
+//     The polygamma function of order n, psi(n,x), is the n-th derivative of //
+//     the digamma function, psi(n,x) = d^n psi(x) / dx^n, i.e. the (n+1)-st  //
+//     derivative of ln gamma(x).  The trigamma function is psi(1,x) and the  //
+//     tetragamma function is psi(2,x).  For n >= 1                           //
+//            psi(n,x) = (-1)^(n+1) n! Sum 1 / (x+k)^(n+1),                   //
+//     summed over k = 0,1,..., from which follow the recurrence              //
+//            psi(n,x+1) = psi(n,x) + (-1)^n n! / x^(n+1),                    //
+//     the reflection formula for the trigamma function                       //
+//            psi(1,x) + psi(1,1-x) = pi^2 / sin^2(pi x)                      //
+//     and the asymptotic expansion                                           //
+//            psi(n,x) ~ (-1)^(n+1) [ (n-1)! / x^n + n! / (2 x^(n+1))         //
+//                    + Sum B[2k] (2k+n-1)! / ((2k)! x^(2k+n)) ]              //
+//     summed over k = 1,2,..., where B[2k] is the 2k-th Bernoulli number.    //
+//     The polygamma functions have poles at the nonpositive integers.        //
+////////////////////////////////////////////////////////////////////////////////
+#include <math.h>      // required for sinl(), floorl(), ceill(), roundl(), NAN
+#include <float.h>            // required for DBL_MAX, LDBL_MAX and LDBL_EPSILON
+
+#include "simd_math.h"
+
+//                         Internally Defined Routines                        //
+
+double TriGamma_Function( double x );
+long double xTriGamma_Function( long double x );
+double Polygamma_Function( int n, double x );
+long double xPolygamma_Function( int n, long double x );
+void TriGamma_Function_Array( double x[], double psi1[], int n );
+void Polygamma_Function_Array( double x[], double psi[], int n, int order );
+
+static long double xTriGamma( long double x );
+static long double xTriGamma_Asymptotic_Expansion( long double x );
+static void Polygamma_Coefficients( int n, long double a[] );
+static long double xPolygamma( int n, long double x, long double a[] );
+static long double xPolygamma_Sum( int n, long double x, long double a[] );
+static long double xPower( long double x, int n );
+static void TriGamma_Array( double x[], double psi1[], int n );
+
+#ifdef GAMMA_BETA_SIMD
+static void TriGamma_Array_AVX2( double x[], double psi1[], int n );
+static void TriGamma_Array_AVX512( double x[], double psi1[], int n );
+#endif
+
+static void (*trigamma_array)( double x[], double psi1[], int n )
+                                                              = TriGamma_Array;
+
+//                         Externally Defined Routines                        //
+
+extern long double xBernoulli_Number( int n );
+extern long double xDiGamma_Function( long double x );
+extern void DiGamma_Function_Array( double x[], double psi[], int n );
+
+//                         Internally Defined Constants                       //
+
+static long double const pi = 3.14159265358979323846264338L;
+static long double const trigamma_cutoff = 10.0L;
+
+#define TERMS 20
+
+////////////////////////////////////////////////////////////////////////////////
+// double TriGamma_Function( double x )                                       //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns the trigamma function psi(1,x), the derivative   //
+//     of the digamma function, which is needed, for example, by each step of //
+//     Newton's method for the maximum likelihood estimates of the parameters //
+//     of the gamma, beta and Dirichlet distributions.  For x < 10 the        //
+//     recurrence psi(1,x) = psi(1,x+1) + 1/x^2 shifts the argument to        //
+//     x >= 10 where the asymptotic expansion is used, and for x < 0 the      //
+//     reflection formula is used.  At a singularity, DBL_MAX is returned.    //
+//                                                                            //
+//  Arguments:                                                                //
+//     double x   Argument of the trigamma function.                          //
+//                                                                            //
+//  Return Values:                                                            //
+//     If x is a nonpositive integer then DBL_MAX is returned otherwise       //
+//     psi(1,x) is returned, or DBL_MAX if psi(1,x) exceeds DBL_MAX.          //
+//                                                                            //
+//  Example:                                                                  //
+//     double x, psi1;                                                        //
+//                                                                            //
+//     psi1 = TriGamma_Function( x );                                         //
+////////////////////////////////////////////////////////////////////////////////
+double TriGamma_Function( double x )
+{
+   long double psi1 = xTriGamma_Function((long double) x);
+
+   return (psi1 < DBL_MAX) ? (double) psi1 : DBL_MAX;
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// long double xTriGamma_Function( long double x )                            //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns the trigamma function psi(1,x).  For x < 10 the  //
+//     recurrence psi(1,x) = psi(1,x+1) + 1/x^2 shifts the argument to        //
+//     x >= 10 where the asymptotic expansion is used, and for x < 0 the      //
+//     reflection formula psi(1,x) = pi^2 / sin^2(pi x) - psi(1,1-x) is used. //
+//     At a singularity, LDBL_MAX is returned.                                //
+//                                                                            //
+//  Arguments:                                                                //
+//     long double x   Argument of the trigamma function.                     //
+//                                                                            //
+//  Return Values:                                                            //
+//     If x is a nonpositive integer then LDBL_MAX is returned otherwise      //
+//     psi(1,x) is returned.                                                  //
+//                                                                            //
+//  Example:                                                                  //
+//     long double x, psi1;                                                   //
+//                                                                            //
+//     psi1 = xTriGamma_Function( x );                                        //
+////////////////////////////////////////////////////////////////////////////////
+long double xTriGamma_Function( long double x )
+{
+   long double sin_x;
+
+   if ( x > 0.0L ) return xTriGamma(x);
+
+                  // For a nonpositive argument (x <= 0). //
+               // If x is a singularity then return LDBL_MAX. //
+
+   if ( x == floorl(x) ) return LDBL_MAX;
+
+              // sin^2(pi x) = sin^2(pi r) where r = x - round(x). //
+
+   sin_x = sinl( pi * (x - roundl(x)) );
+   return pi * pi / (sin_x * sin_x) - xTriGamma(1.0L - x);
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// static long double xTriGamma( long double x )                              //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns psi(1,x) for x > 0, shifting x to x >= 10 with   //
+//     the recurrence psi(1,x) = psi(1,x+1) + 1/x^2.                          //
+//                                                                            //
+//  Arguments:                                                                //
+//     long double x   Argument of the trigamma function, x > 0.              //
+//                                                                            //
+//  Return Values:                                                            //
+//     psi(1,x)                                                               //
+////////////////////////////////////////////////////////////////////////////////
+static long double xTriGamma( long double x )
+{
+   long double sum = 0.0L;
+
+   for (; x < trigamma_cutoff; x += 1.0L) sum += 1.0L / (x * x);
+   return sum + xTriGamma_Asymptotic_Expansion(x);
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// static long double xTriGamma_Asymptotic_Expansion( long double x )         //
+//                                                                            //
+//  Description:                                                              //
+//     This function estimates psi(1,x) by evaluating the asymptotic          //
+//     expression:                                                            //
+//         psi(1,x) ~ 1/x + 1/(2 x^2) + Sum B[2k] / x^(2k+1),                 //
+//     summed over k from 1 to 13, where B[2k] is the 2k-th Bernoulli number. //
+//     For x >= 10 the first neglected term is less than 1.0e-20 relative to  //
+//     psi(1,x).                                                              //
+//                                                                            //
+//  Arguments:                                                                //
+//     long double x   Argument of the trigamma function, x >= 10.            //
+//                                                                            //
+//  Return Values:                                                            //
+//     psi(1,x)                                                               //
+////////////////////////////////////////////////////////////////////////////////
+static long double xTriGamma_Asymptotic_Expansion( long double x )
+{
+   const int m = 13;
+   long double xx = 1.0L / (x * x);
+   long double sum = 0.0L;
+   int k;
+
+   for (k = m; k >= 1; k--) sum = (sum + xBernoulli_Number(k + k)) * xx;
+   return (1.0L + 0.5L / x + sum) / x;
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// double Polygamma_Function( int n, double x )                               //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns the polygamma function psi(n,x) of order n >= 0  //
+//     for which psi(0,x) is the digamma function, psi(1,x) the trigamma      //
+//     function and psi(2,x) the tetragamma function.  At a singularity       //
+//     DBL_MAX is returned.                                                   //
+//                                                                            //
+//  Arguments:                                                                //
+//     int    n   The order of the polygamma function, n >= 0.                //
+//     double x   Argument of the polygamma function.                         //
+//                                                                            //
+//  Return Values:                                                            //
+//     If n < 0 then NaN is returned.  If x is a nonpositive integer then     //
+//     DBL_MAX is returned otherwise psi(n,x) is returned, or +-DBL_MAX if    //
+//     |psi(n,x)| exceeds DBL_MAX.                                            //
+//                                                                            //
+//  Example:                                                                  //
+//     double x, psi;                                                         //
+//     int n;                                                                 //
+//                                                                            //
+//     psi = Polygamma_Function( n, x );                                      //
+////////////////////////////////////////////////////////////////////////////////
+double Polygamma_Function( int n, double x )
+{
+   long double psi;
+
+   if ( n < 0 ) return NAN;
+   psi = xPolygamma_Function(n, (long double) x);
+   if (fabsl(psi) < DBL_MAX) return (double) psi;
+   return (psi < 0.0L) ? -DBL_MAX : DBL_MAX;
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// long double xPolygamma_Function( int n, long double x )                    //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns the polygamma function psi(n,x) of order n >= 0  //
+//     (see Polygamma_Function()).                                            //
+//     For n = 0 and n = 1 xDiGamma_Function() and xTriGamma_Function() are   //
+//     called.  For n >= 2 and x > 0 the recurrence shifts x to x >= n + 16   //
+//     where the asymptotic expansion converges to long double precision      //
+//     within 20 terms, the coefficients of which are calculated from the     //
+//     Bernoulli numbers of xBernoulli_Number().  For x < 0 the series        //
+//     Sum 1 / (x+k)^(n+1) is split as                                        //
+//        S(f) + (-1)^(n+1) [ S(1-f) - S(1-x) ],  S(y) = Sum 1 / (y+k)^(n+1), //
+//     where f = x - floor(x), each S being evaluated as for x > 0, so that   //
+//     the cost does not grow with |x|.  For even n the terms of opposite     //
+//     sign cancel near the zeros of psi(n,x), x < 0.  At a singularity       //
+//     LDBL_MAX is returned.                                                  //
+//                                                                            //
+//  Arguments:                                                                //
+//     int         n   The order of the polygamma function, n >= 0.           //
+//     long double x   Argument of the polygamma function.                    //
+//                                                                            //
+//  Return Values:                                                            //
+//     If n < 0 then NaN is returned.  If x is a nonpositive integer then     //
+//     LDBL_MAX is returned otherwise psi(n,x) is returned, or +-LDBL_MAX if  //
+//     |psi(n,x)| exceeds LDBL_MAX.                                           //
+//                                                                            //
+//  Example:                                                                  //
+//     long double x, psi;                                                    //
+//     int n;                                                                 //
+//                                                                            //
+//     psi = xPolygamma_Function( n, x );                                     //
+////////////////////////////////////////////////////////////////////////////////
+long double xPolygamma_Function( int n, long double x )
+{
+   long double a[TERMS];
+   long double psi;
+
+   if ( n < 0 ) return NAN;
+   if ( n == 0 ) return xDiGamma_Function(x);
+   if ( n == 1 ) return xTriGamma_Function(x);
+   Polygamma_Coefficients(n, a);
+   psi = xPolygamma(n, x, a);
+   if (fabsl(psi) < LDBL_MAX) return psi;
+   return (psi < 0.0L) ? -LDBL_MAX : LDBL_MAX;
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// static void Polygamma_Coefficients( int n, long double a[] )               //
+//                                                                            //
+//  Description:                                                              //
+//     This function sets a[0] = (n-1)! and                                   //
+//                  a[k] = B[2k] (2k+n-1)! / ( (2k)! (n-1)! )                 //
+//     for k = 1,...,TERMS-1, so that for large x                             //
+//     |psi(n,x)| ~ a[0] / x^n [ 1 + n / (2x) + Sum a[k] / x^(2k) ].          //
+//                                                                            //
+//  Arguments:                                                                //
+//     int         n   The order of the polygamma function, n >= 1.           //
+//     long double a[] Array of dimension TERMS set to the coefficients.      //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+////////////////////////////////////////////////////////////////////////////////
+static void Polygamma_Coefficients( int n, long double a[] )
+{
+   long double p = 1.0L;
+   int k;
+
+   a[0] = 1.0L;
+   for (k = 2; k < n; k++) a[0] *= (long double) k;
+   for (k = 1; k < TERMS; k++) {
+      p *= (long double) (2*k + n - 2) * (long double) (2*k + n - 1)
+                        / ( (long double) (2*k - 1) * (long double) (2*k) );
+      a[k] = xBernoulli_Number(k + k) * p;
+   }
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// static long double xPolygamma( int n, long double x, long double a[] )     //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns psi(n,x), n >= 1, given the coefficients a[] of  //
+//     Polygamma_Coefficients().                                              //
+//                                                                            //
+//  Arguments:                                                                //
+//     int         n   The order of the polygamma function, n >= 1.           //
+//     long double x   Argument of the polygamma function.                    //
+//     long double a[] The coefficients of the asymptotic expansion.          //
+//                                                                            //
+//  Return Values:                                                            //
+//     If x is a nonpositive integer then LDBL_MAX is returned otherwise      //
+//     psi(n,x) is returned.                                                  //
+////////////////////////////////////////////////////////////////////////////////
+static long double xPolygamma( int n, long double x, long double a[] )
+{
+   long double sum;
+
+   if ( x > 0.0L ) sum = xPolygamma_Sum(n, x, a);
+   else {
+      if ( x == floorl(x) ) return LDBL_MAX;
+      sum = xPolygamma_Sum(n, ceill(x) - x, a) - xPolygamma_Sum(n, 1.0L - x, a);
+      if ( n % 2 == 0 ) sum = -sum;
+      sum += xPolygamma_Sum(n, x - floorl(x), a);
+   }
+   return ( n % 2 == 1 ) ? sum : -sum;
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// static long double xPolygamma_Sum( int n, long double x, long double a[] ) //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns n! Sum 1 / (x+k)^(n+1), summed over k = 0,1,..., //
+//     i.e. |psi(n,x)|, for x > 0.  The first terms are summed explicitly     //
+//     until x + k >= n + 16 and the remainder is given by the asymptotic     //
+//     expansion.                                                             //
+//                                                                            //
+//  Arguments:                                                                //
+//     int         n   The order of the polygamma function, n >= 1.           //
+//     long double x   Argument of the polygamma function, x > 0.             //
+//     long double a[] The coefficients of the asymptotic expansion.          //
+//                                                                            //
+//  Return Values:                                                            //
+//     |psi(n,x)|                                                             //
+////////////////////////////////////////////////////////////////////////////////
+static long double xPolygamma_Sum( int n, long double x, long double a[] )
+{
+   long double x0 = (long double) (n + 16);
+   long double sum = 0.0L;
+   long double series = 0.0L;
+   long double xx, xk, term;
+   int k;
+
+   for (; x < x0; x += 1.0L) sum += xPower(1.0L / x, n + 1);
+
+   xx = 1.0L / (x * x);
+   xk = xx;
+   for (k = 1; k < TERMS; k++) {
+      term = a[k] * xk;
+      series += term;
+      if ( fabsl(term) < 0.5L * LDBL_EPSILON ) break;
+      xk *= xx;
+   }
+   return a[0] * ( (long double) n * sum + xPower(1.0L / x, n)
+                            * (1.0L + (long double) n / (x + x) + series) );
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// static long double xPower( long double x, int n )                          //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns x^n, n >= 0, by repeated squaring.               //
+//                                                                            //
+//  Arguments:                                                                //
+//     long double x   The base.                                              //
+//     int         n   The exponent, n >= 0.                                  //
+//                                                                            //
+//  Return Values:                                                            //
+//     x^n                                                                    //
+////////////////////////////////////////////////////////////////////////////////
+static long double xPower( long double x, int n )
+{
+   long double p = 1.0L;
+
+   for (; n > 0; n >>= 1) {
+      if (n & 1) p *= x;
+      x *= x;
+   }
+   return p;
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// void TriGamma_Function_Array( double x[], double psi1[], int n )           //
+//                                                                            //
+//  Description:                                                              //
+//     This function calculates psi(1,x[i]) for each of the n arguments       //
+//     x[0],...,x[n-1], for example for the gradient and Hessian of a         //
+//     log-likelihood over many parameter values.  On x86-64 processors with  //
+//     AVX2 and FMA, or with AVX-512F, four or eight arguments are evaluated  //
+//     at once, the kernel being selected when the library is loaded;         //
+//     otherwise, and for any block of arguments containing a singularity, a  //
+//     NaN, an infinity, an argument of magnitude less than 1e-150 or an      //
+//     argument less than -1e15, TriGamma_Function() is called for each       //
+//     argument.                                                              //
+//                                                                            //
+//     The vector kernels evaluate psi(1,w), w = |x|, for w >= 2.5 by         //
+//     shifting w up to 10 <= u < 11 and the asymptotic expansion, and for    //
+//     w < 2.5 by shifting w up to 1.5 <= y < 2.5 and summing the second      //
+//     derivative of the Taylor series of ln gamma(y) about 2.  For x < 0 the //
+//     reflection formula                                                     //
+//            psi(1,x) = pi^2 / sin^2(pi x) - psi(1,w) + 1/w^2                //
+//     is applied under a mask.  Tests against a quadruple precision          //
+//     reference give a maximum error of 4 ulp.                               //
+//                                                                            //
+//  Arguments:                                                                //
+//     double x[]    Array of n arguments of the trigamma function.           //
+//     double psi1[] Array of n elements, psi1[i] is set to psi(1,x[i]).      //
+//                   psi1 may be the same array as x.                         //
+//     int    n      The number of arguments.                                 //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     #define N 100                                                          //
+//     double x[N], psi1[N];                                                  //
+//                                                                            //
+//     TriGamma_Function_Array( x, psi1, N );                                 //
+////////////////////////////////////////////////////////////////////////////////
+
+void TriGamma_Function_Array( double x[], double psi1[], int n )
+{
+   trigamma_array(x, psi1, n);
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// void Polygamma_Function_Array( double x[], double psi[], int n,            //
+//                                                             int order )    //
+//                                                                            //
+//  Description:                                                              //
+//     This function calculates psi(order,x[i]) for each of the n arguments   //
+//     x[0],...,x[n-1].  For order 0 and 1 DiGamma_Function_Array() and       //
+//     TriGamma_Function_Array() are called, otherwise the coefficients of    //
+//     the asymptotic expansion are calculated once rather than for each      //
+//     argument.  If order < 0, each psi[i] is set to NaN.                    //
+//                                                                            //
+//  Arguments:                                                                //
+//     double x[]   Array of n arguments of the polygamma function.           //
+//     double psi[] Array of n elements, psi[i] is set to psi(order,x[i]).    //
+//                  psi may be the same array as x.                           //
+//     int    n     The number of arguments.                                  //
+//     int    order The order of the polygamma function, order >= 0.          //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     #define N 100                                                          //
+//     double x[N], psi[N];                                                   //
+//                                                                            //
+//     Polygamma_Function_Array( x, psi, N, 2 );                              //
+////////////////////////////////////////////////////////////////////////////////
+
+void Polygamma_Function_Array( double x[], double psi[], int n, int order )
+{
+   long double a[TERMS];
+   long double p;
+   int i;
+
+   if ( order < 0 ) {
+      for (i = 0; i < n; i++) psi[i] = NAN;
+      return;
+   }
+   if ( order == 0 ) { DiGamma_Function_Array(x, psi, n); return; }
+   if ( order == 1 ) { TriGamma_Function_Array(x, psi, n); return; }
+   Polygamma_Coefficients(order, a);
+   for (i = 0; i < n; i++) {
+      p = xPolygamma(order, (long double) x[i], a);
+      if (fabsl(p) < DBL_MAX) psi[i] = (double) p;
+      else psi[i] = (p < 0.0L) ? -DBL_MAX : DBL_MAX;
+   }
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// static void TriGamma_Array( double x[], double psi1[], int n )             //
+//                                                                            //
+//  Description:                                                              //
+//     The portable form of TriGamma_Function_Array(), which calls            //
+//     TriGamma_Function() for each argument.                                 //
+//                                                                            //
+//  Arguments:                                                                //
+//     double x[]    Array of n arguments of the trigamma function.           //
+//     double psi1[] Array of n elements set to psi(1,x[i]).                  //
+//     int    n      The number of arguments.                                 //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+////////////////////////////////////////////////////////////////////////////////
+
+static void TriGamma_Array( double x[], double psi1[], int n )
+{
+   int i;
+
+   for (i = 0; i < n; i++) psi1[i] = TriGamma_Function(x[i]);
+}
+
+#ifdef GAMMA_BETA_SIMD
+
+// Coefficients of 1, z, ..., z^31 of the Taylor series of psi(1,2+z), the   //
+// second derivative of the series of ln gamma(2+z) in ln_gamma_function.c.  //
+// The coefficient of z^(k-2) is (-1)^k (k-1) (zeta(k) - 1).                 //
+
+static const double trigamma_near_two[] = {
+   +6.44934066848226406e-01, -4.04113806319188584e-01,
+   +2.46969701133414571e-01, -1.47711020573479707e-01,
+   +8.67153099222457008e-02, -5.00956642915369593e-02,
+   +2.85414933856103746e-02, -1.60671426086577140e-02,
+   +8.95117615036276730e-03, -4.94188604119464529e-03,
+   +2.70695208638853119e-03, -1.47256017094186975e-03,
+   +7.96225755763162787e-04, -4.28235308298286919e-04,
+   +2.29233891129778088e-04, -1.22195162206396201e-04,
+   +6.48939855049972735e-05, -3.43478288979708998e-05,
+   +1.81252786435831251e-05, -9.53865973575612851e-06,
+   +5.00746055728239304e-06, -2.62283837123684361e-06,
+   +1.37098834817896807e-06, -7.15284084351654756e-07,
+   +3.72538870709126034e-07, -1.93718506535721178e-07,
+   +1.00584018669288346e-07, -5.21544722583653743e-08,
+   +2.70084955401703789e-08, -1.39698871951013528e-08,
+   +7.21776668439716732e-09, -3.72529605526416618e-09
+};
+
+// B(2k), k = 1,...,10, for the asymptotic expansion. //
+
+static const double dB[] = {     1.0 / 6.0,      -1.0 / 30.0,   1.0 / 42.0,
+                                -1.0 / 30.0,      5.0 / 66.0, -691.0 / 2730.0,
+                                 7.0 / 6.0,   -3617.0 / 510.0,
+                             43867.0 / 798.0, -174611.0 / 330.0
+                           };
+
+// For w >= 2.5 psi(1,w) = psi(1,u) + Sum 1/(w+i)^2, i = 0,...,m-1, where   //
+// u = w + m is the first of w, w+1, ..., w+8 not less than 10, the sum of   //
+// the at most 8 reciprocal squares being accumulated as a single fraction,  //
+// and psi(1,u) ~ (1/u) [ 1 + 1/(2u) + Sum B(2k) / u^(2k) ], u being limited //
+// to 1e15 inside the brackets so that 1/u^2 does not underflow.  Shifting   //
+// upwards adds terms of the same sign; shifting down from w >= 2.5 would    //
+// subtract the reciprocal squares from psi(1,y) and lose several bits.      //
+// For w < 2.5 let k = floor(w - 1.5) and z = w - (k + 2), so that           //
+// psi(1,w) = psi(1,2+z) [ + 1/w^2 [ + 1/(w+1)^2 ] ] for k = 0, -1, -2.      //
+
+__attribute__((target("avx2,fma")))
+static void TriGamma_Array_AVX2( double x[], double psi1[], int n )
+{
+   int const nc = sizeof(trigamma_near_two) / sizeof(double);
+   int const nb = sizeof(dB) / sizeof(double);
+   const __m256d zero = _mm256_setzero_pd();
+   const __m256d one = _mm256_set1_pd(1.0);
+   const __m256d lower = _mm256_set1_pd(1.5);
+   const __m256d sign = _mm256_set1_pd(-0.0);
+   __m256d v, w, r, t, u, y, yy, m, num, den, sum, big, small, rw, rc, rcc;
+   __m256d s;
+   int i;
+   int j = 0;
+
+   for (; j + 4 <= n; j += 4) {
+      v = _mm256_loadu_pd(&x[j]);
+      w = _mm256_andnot_pd(sign, v);
+      r = _mm256_round_pd(v, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+      m = _mm256_and_pd(_mm256_cmp_pd(w, _mm256_set1_pd(1.0e-150), _CMP_GE_OQ),
+                    _mm256_cmp_pd(v, _mm256_set1_pd(1.0e300), _CMP_LE_OQ));
+      m = _mm256_and_pd(m, _mm256_cmp_pd(v, _mm256_set1_pd(-1.0e15),
+                                                                   _CMP_GE_OQ));
+      m = _mm256_andnot_pd(_mm256_and_pd(_mm256_cmp_pd(v, r, _CMP_EQ_OQ),
+                                _mm256_cmp_pd(v, zero, _CMP_LE_OQ)), m);
+      if ( _mm256_movemask_pd(m) != 0xf ) {
+         TriGamma_Array(&x[j], &psi1[j], 4);
+         continue;
+      }
+
+          // psi(1,w) by shifting w up to u and the asymptotic expansion. //
+
+      u = w;
+      num = zero;
+      den = one;
+      for (i = 0; i < 8; i++) {
+         m = _mm256_cmp_pd(u, _mm256_set1_pd(10.0), _CMP_LT_OQ);
+         yy = _mm256_mul_pd(u, u);
+         num = _mm256_blendv_pd(num, _mm256_fmadd_pd(num, yy, den), m);
+         den = _mm256_blendv_pd(den, _mm256_mul_pd(den, yy), m);
+         u = _mm256_blendv_pd(u, _mm256_add_pd(u, one), m);
+      }
+      rw = _mm256_div_pd(one, u);
+      rc = _mm256_div_pd(one, _mm256_min_pd(u, _mm256_set1_pd(1.0e15)));
+      rcc = _mm256_mul_pd(rc, rc);
+      sum = _mm256_set1_pd(dB[nb - 1]);
+      for (i = nb - 2; i >= 0; i--)
+         sum = _mm256_fmadd_pd(sum, rcc, _mm256_set1_pd(dB[i]));
+      sum = _mm256_fmadd_pd(sum, rcc, _mm256_mul_pd(_mm256_set1_pd(0.5), rc));
+      big = _mm256_add_pd(_mm256_fmadd_pd(rw, sum, rw),
+                                                    _mm256_div_pd(num, den));
+
+               // psi(1,w) by shifting w up to 2 + z, w < 2.5. //
+
+      t = _mm256_min_pd(_mm256_floor_pd(_mm256_sub_pd(w, lower)), zero);
+      y = _mm256_sub_pd(w, _mm256_add_pd(t, _mm256_set1_pd(2.0)));
+      sum = _mm256_set1_pd(trigamma_near_two[nc - 1]);
+      for (i = nc - 2; i >= 0; i--)
+         sum = _mm256_fmadd_pd(sum, y, _mm256_set1_pd(trigamma_near_two[i]));
+      yy = _mm256_mul_pd(w, w);
+      y = _mm256_add_pd(w, one);
+      y = _mm256_mul_pd(y, y);
+      m = _mm256_cmp_pd(t, zero, _CMP_LT_OQ);
+      num = _mm256_blendv_pd(zero, one, m);
+      den = _mm256_blendv_pd(one, yy, m);
+      m = _mm256_cmp_pd(t, _mm256_set1_pd(-2.0), _CMP_LE_OQ);
+      num = _mm256_blendv_pd(num, _mm256_add_pd(yy, y), m);
+      den = _mm256_blendv_pd(den, _mm256_mul_pd(yy, y), m);
+      small = _mm256_add_pd(sum, _mm256_div_pd(num, den));
+
+      sum = _mm256_blendv_pd(small, big,
+                   _mm256_cmp_pd(w, _mm256_set1_pd(2.5), _CMP_GE_OQ));
+
+        // psi(1,x) = pi^2 / sin^2(pi r) - psi(1,w) + 1/w^2 for x < 0. //
+
+      s = Sin_Pi_AVX2(_mm256_sub_pd(v, r));
+      s = _mm256_div_pd(_mm256_set1_pd((double) (pi * pi)),
+                                                         _mm256_mul_pd(s, s));
+      s = _mm256_sub_pd(s, _mm256_sub_pd(sum, _mm256_div_pd(one, yy)));
+
+      _mm256_storeu_pd(&psi1[j], _mm256_blendv_pd(sum, s,
+                                          _mm256_cmp_pd(v, zero, _CMP_LT_OQ)));
+   }
+   _mm256_zeroupper();
+   if (j < n) TriGamma_Array(&x[j], &psi1[j], n - j);
+}
+
+__attribute__((target("avx512f")))
+static void TriGamma_Array_AVX512( double x[], double psi1[], int n )
+{
+   int const nc = sizeof(trigamma_near_two) / sizeof(double);
+   int const nb = sizeof(dB) / sizeof(double);
+   const __m512d zero = _mm512_setzero_pd();
+   const __m512d one = _mm512_set1_pd(1.0);
+   const __m512d lower = _mm512_set1_pd(1.5);
+   __m512d v, w, r, t, u, y, yy, num, den, sum, big, small, rw, rc, rcc;
+   __m512d s;
+   __mmask8 m;
+   int i;
+   int j = 0;
+
+   for (; j + 8 <= n; j += 8) {
+      v = _mm512_loadu_pd(&x[j]);
+      w = _mm512_abs_pd(v);
+      r = _mm512_roundscale_pd(v, _MM_FROUND_TO_NEAREST_INT);
+      m = _mm512_cmp_pd_mask(w, _mm512_set1_pd(1.0e-150), _CMP_GE_OQ)
+          & _mm512_cmp_pd_mask(v, _mm512_set1_pd(1.0e300), _CMP_LE_OQ)
+          & _mm512_cmp_pd_mask(v, _mm512_set1_pd(-1.0e15), _CMP_GE_OQ);
+      m &= ~( _mm512_cmp_pd_mask(v, r, _CMP_EQ_OQ)
+                                & _mm512_cmp_pd_mask(v, zero, _CMP_LE_OQ) );
+      if ( m != 0xff ) {
+         TriGamma_Array(&x[j], &psi1[j], 8);
+         continue;
+      }
+
+          // psi(1,w) by shifting w up to u and the asymptotic expansion. //
+
+      u = w;
+      num = zero;
+      den = one;
+      for (i = 0; i < 8; i++) {
+         m = _mm512_cmp_pd_mask(u, _mm512_set1_pd(10.0), _CMP_LT_OQ);
+         yy = _mm512_mul_pd(u, u);
+         num = _mm512_mask_fmadd_pd(num, m, yy, den);
+         den = _mm512_mask_mul_pd(den, m, den, yy);
+         u = _mm512_mask_add_pd(u, m, u, one);
+      }
+      rw = _mm512_div_pd(one, u);
+      rc = _mm512_div_pd(one, _mm512_min_pd(u, _mm512_set1_pd(1.0e15)));
+      rcc = _mm512_mul_pd(rc, rc);
+      sum = _mm512_set1_pd(dB[nb - 1]);
+      for (i = nb - 2; i >= 0; i--)
+         sum = _mm512_fmadd_pd(sum, rcc, _mm512_set1_pd(dB[i]));
+      sum = _mm512_fmadd_pd(sum, rcc, _mm512_mul_pd(_mm512_set1_pd(0.5), rc));
+      big = _mm512_add_pd(_mm512_fmadd_pd(rw, sum, rw),
+                                                    _mm512_div_pd(num, den));
+
+               // psi(1,w) by shifting w up to 2 + z, w < 2.5. //
+
+      t = _mm512_min_pd(_mm512_roundscale_pd(_mm512_sub_pd(w, lower),
+                                               _MM_FROUND_TO_NEG_INF), zero);
+      y = _mm512_sub_pd(w, _mm512_add_pd(t, _mm512_set1_pd(2.0)));
+      sum = _mm512_set1_pd(trigamma_near_two[nc - 1]);
+      for (i = nc - 2; i >= 0; i--)
+         sum = _mm512_fmadd_pd(sum, y, _mm512_set1_pd(trigamma_near_two[i]));
+      yy = _mm512_mul_pd(w, w);
+      y = _mm512_add_pd(w, one);
+      y = _mm512_mul_pd(y, y);
+      m = _mm512_cmp_pd_mask(t, zero, _CMP_LT_OQ);
+      num = _mm512_mask_mov_pd(zero, m, one);
+      den = _mm512_mask_mov_pd(one, m, yy);
+      m = _mm512_cmp_pd_mask(t, _mm512_set1_pd(-2.0), _CMP_LE_OQ);
+      num = _mm512_mask_add_pd(num, m, yy, y);
+      den = _mm512_mask_mul_pd(den, m, yy, y);
+      small = _mm512_add_pd(sum, _mm512_div_pd(num, den));
+
+      sum = _mm512_mask_blend_pd(_mm512_cmp_pd_mask(w, _mm512_set1_pd(2.5),
+                                                 _CMP_GE_OQ), small, big);
+
+        // psi(1,x) = pi^2 / sin^2(pi r) - psi(1,w) + 1/w^2 for x < 0. //
+
+      s = Sin_Pi_AVX512(_mm512_sub_pd(v, r));
+      s = _mm512_div_pd(_mm512_set1_pd((double) (pi * pi)),
+                                                         _mm512_mul_pd(s, s));
+      s = _mm512_sub_pd(s, _mm512_sub_pd(sum, _mm512_div_pd(one, yy)));
+
+      _mm512_storeu_pd(&psi1[j], _mm512_mask_blend_pd(
+                            _mm512_cmp_pd_mask(v, zero, _CMP_LT_OQ), sum, s));
+   }
+   _mm256_zeroupper();
+   if (j < n) TriGamma_Array(&x[j], &psi1[j], n - j);
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// static void Init_TriGamma_Array( void )                                    //
+//                                                                            //
+//  Description:                                                              //
+//     This function is run when the library is loaded.  It selects the       //
+//     widest version of TriGamma_Function_Array() which the processor        //
+//     supports.                                                              //
+//                                                                            //
+//  Arguments:                                                                //
+//     None                                                                   //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+////////////////////////////////////////////////////////////////////////////////
+
+__attribute__((constructor))
+static void Init_TriGamma_Array( void )
+{
+   __builtin_cpu_init();
+   if ( __builtin_cpu_supports("avx512f") )
+      trigamma_array = TriGamma_Array_AVX512;
+   else if ( __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma") )
+      trigamma_array = TriGamma_Array_AVX2;
+}
+
+#endif
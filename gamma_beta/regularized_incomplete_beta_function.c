@@ -0,0 +1,681 @@
+////////////////////////////////////////////////////////////////////////////////
+// File: regularized_incomplete_beta_function.c                               //
+// Routine(s):                                                                //
+//    Regularized_Incomplete_Beta                                             //
+//    xRegularized_Incomplete_Beta                                            //
+//    Regularized_Incomplete_Beta_Complement                                  //
+//    xRegularized_Incomplete_Beta_Complement                                 //
+//    Regularized_Incomplete_Beta_Prepared                                    //
+//    Regularized_Incomplete_Beta_Complement_Prepared                         //
+//    Regularized_Incomplete_Beta_Array                                       //
+//    Regularized_Incomplete_Beta_Complement_Array                            //
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+//  Description:                                                              //
+//     The regularized incomplete beta function with shape parameters a > 0   //
+//     and b > 0 is defined for 0 <= x <= 1 by                                //
+//            I(x,a,b) = Integral[0,x] t^(a-1) (1-t)^(b-1) dt / B(a,b),       //
+//     where B(a,b) is the (complete) beta function, and its complement is    //
+//            1 - I(x,a,b) = I(1-x,b,a).                                      //
+//     I(x,a,b) is the beta distribution with shape parameters a and b.       //
+//                                                                            //
+//     Both are calculated together in a single pass, the one whose argument  //
+//     lies below the mean directly and the other as 1 minus it.  If          //
+//     x <= (a+1) / (a+b+2), I(x,a,b) is calculated by the continued fraction //
+//        I(x,a,b) = D / a * ( (1/1+)(d[1]/1+)(d[2]/1+)... )                  //
+//     where d[2m+1] = - (a+m)(a+b+m)x/((a+2m)(a+2m+1))                       //
+//           d[2m] = m(b-m)x/((a+2m)(a+2m-1)),                                //
+//     and otherwise I(1-x,b,a) is calculated by the same continued fraction  //
+//     with the roles of (x,a) and (1-x,b) exchanged.  The continued fraction //
+//     converges for all shape parameters, so that unlike the recurrences in  //
+//     a+1 and b+1 no shape parameter need be shifted above 1.  It is         //
+//     evaluated in the form given by Didonato and Morris, ACM Trans. Math.   //
+//     Software 18 (1992), which avoids the cancellation of its leading terms //
+//     for x near 1.                                                          //
+//                                                                            //
+//     The prefactor D = x^a (1-x)^b / B(a,b) is calculated in log space.     //
+//     With x0 = a / (a+b) and y0 = b / (a+b),                                //
+//        D = K exp( a (ln(x/x0) - x/x0 + 1) + b (ln(y/y0) - y/y0 + 1) ),     //
+//     y = 1 - x, where the linear terms cancel since a (x/x0 - 1) +          //
+//     b (y/y0 - 1) = 0, and K = x0^a y0^b / B(a,b) depends only on a and b:  //
+//        K = sqrt( ab / (2 pi (a+b)) ) G(a+b) / ( G(a) G(b) ),               //
+//     G(z) = gamma(z) / ( sqrt(2 pi / z) (z/e)^z ) being the gamma function  //
+//     with its Stirling approximation removed.  Neither x^a (1-x)^b nor      //
+//     B(a,b) is formed, so that D neither overflows nor loses precision when //
+//     a and b are large.  ln K is calculated once for each pair (a,b) by the //
+//     batch routines.                                                        //
+//                                                                            //
+//     The complement of a value near 1 is calculated as 1 minus it, so that  //
+//     for a very small shape parameter a, for which I(x,a,b) is near 1 over  //
+//     most of (0,1), 1 - I(x,a,b) is accurate only in absolute terms.        //
+////////////////////////////////////////////////////////////////////////////////
+#include <math.h>       // required for expl(), logl(), log1pl() and fabsl().
+#include <float.h>      // required for LDBL_EPSILON and LDBL_MIN.
+
+//                         Externally Defined Routines                        //
+
+extern long double xLn_Gamma_Function( long double x );
+
+//                         Internally Defined Routines                        //
+
+double Regularized_Incomplete_Beta( double x, double a, double b );
+long double xRegularized_Incomplete_Beta( long double x, long double a,
+                                                               long double b );
+double Regularized_Incomplete_Beta_Complement( double x, double a, double b );
+long double xRegularized_Incomplete_Beta_Complement( long double x,
+                                               long double a, long double b );
+double Regularized_Incomplete_Beta_Prepared( double x, double a, double b,
+                                                             long double beta );
+double Regularized_Incomplete_Beta_Complement_Prepared( double x, double a,
+                                                  double b, long double beta );
+void Regularized_Incomplete_Beta_Array( double x[], double p[], int n,
+                                                        double a, double b );
+void Regularized_Incomplete_Beta_Complement_Array( double x[], double q[],
+                                                 int n, double a, double b );
+
+static void xIncomplete_Beta_IJ( long double x, long double y, long double a,
+                   long double b, long double ln_k, long double *w,
+                                                            long double *w1 );
+static long double xPrefactor( long double x, long double y, long double a,
+                                             long double b, long double ln_k );
+static long double xContinued_Fraction( long double x, long double y,
+                                               long double a, long double b );
+static long double xLn_Beta_Scale( long double a, long double b );
+static long double xLn_Gamma_Star( long double z );
+static long double xLog1pmx( long double mu );
+
+//                         Internally Defined Constants                       //
+
+static const long double log_sqrt_2pi = 9.18938533204672741780329736e-1L;
+static const long double stirling_cutoff = 10.0L;
+
+// Bernoulli numbers B(2),B(4),B(6),...,B(20) divided by 2j (2j-1).           //
+
+static const long double B[] = {   1.0L / (long double)(6 * 2 * 1),
+                                  -1.0L / (long double)(30 * 4 * 3),
+                                   1.0L / (long double)(42 * 6 * 5),
+                                  -1.0L / (long double)(30 * 8 * 7),
+                                   5.0L / (long double)(66 * 10 * 9),
+                                -691.0L / (long double)(2730 * 12 * 11),
+                                   7.0L / (long double)(6 * 14 * 13),
+                               -3617.0L / (long double)(510 * 16 * 15),
+                               43867.0L / (long double)(796 * 18 * 17),
+                             -174611.0L / (long double)(330 * 20 * 19)
+                           };
+
+static const int nB = sizeof(B) / sizeof(long double);
+
+
+////////////////////////////////////////////////////////////////////////////////
+// double Regularized_Incomplete_Beta( double x, double a, double b )         //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns the regularized incomplete beta function         //
+//     I(x,a,b), the integral from 0 to x of t^(a-1) (1-t)^(b-1) dt / B(a,b). //
+//                                                                            //
+//  Arguments:                                                                //
+//     double x   Upper limit of the integral with integrand given above.     //
+//     double a   Shape parameter, a > 0, a - 1 is the exponent of the factor //
+//                t in the integrand.                                         //
+//     double b   Shape parameter, b > 0, b - 1 is the exponent of the factor //
+//                (1-t) in the integrand.                                     //
+//                                                                            //
+//  Return Values:                                                            //
+//     I(x,a,b), a real number between 0 and 1.  If x <= 0, 0 is returned     //
+//     and if x >= 1, 1 is returned.                                          //
+//                                                                            //
+//  Example:                                                                  //
+//     double x, a, b, p;                                                     //
+//                                                                            //
+//     p = Regularized_Incomplete_Beta( x, a, b );                            //
+////////////////////////////////////////////////////////////////////////////////
+double Regularized_Incomplete_Beta( double x, double a, double b )
+{
+   return (double) xRegularized_Incomplete_Beta((long double) x,
+                                            (long double) a, (long double) b);
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// long double xRegularized_Incomplete_Beta( long double x, long double a,    //
+//                                                            long double b ) //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns the regularized incomplete beta function         //
+//     I(x,a,b), the integral from 0 to x of t^(a-1) (1-t)^(b-1) dt / B(a,b). //
+//                                                                            //
+//  Arguments:                                                                //
+//     long double x   Upper limit of the integral with integrand given above.//
+//     long double a   Shape parameter, a > 0.                                //
+//     long double b   Shape parameter, b > 0.                                //
+//                                                                            //
+//  Return Values:                                                            //
+//     I(x,a,b), a real number between 0 and 1.  If x <= 0, 0 is returned     //
+//     and if x >= 1, 1 is returned.                                          //
+//                                                                            //
+//  Example:                                                                  //
+//     long double x, a, b, p;                                                //
+//                                                                            //
+//     p = xRegularized_Incomplete_Beta( x, a, b );                           //
+////////////////////////////////////////////////////////////////////////////////
+long double xRegularized_Incomplete_Beta( long double x, long double a,
+                                                                long double b )
+{
+   long double w, w1;
+
+   if ( x <= 0.0L ) return 0.0L;
+   if ( x >= 1.0L ) return 1.0L;
+   xIncomplete_Beta_IJ(x, 1.0L - x, a, b, xLn_Beta_Scale(a, b), &w, &w1);
+   return w;
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// double Regularized_Incomplete_Beta_Complement( double x, double a,         //
+//                                                                 double b ) //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns the complement 1 - I(x,a,b) = I(1-x,b,a) of the  //
+//     regularized incomplete beta function, the integral from x to 1 of      //
+//     t^(a-1) (1-t)^(b-1) dt / B(a,b).  1 - x is not formed when it would    //
+//     be inexact, so that the complement keeps its relative precision for    //
+//     x near 0.                                                              //
+//                                                                            //
+//  Arguments:                                                                //
+//     double x   Lower limit of the integral with integrand given above.     //
+//     double a   Shape parameter, a > 0.                                     //
+//     double b   Shape parameter, b > 0.                                     //
+//                                                                            //
+//  Return Values:                                                            //
+//     1 - I(x,a,b), a real number between 0 and 1.  If x <= 0, 1 is          //
+//     returned and if x >= 1, 0 is returned.                                 //
+//                                                                            //
+//  Example:                                                                  //
+//     double x, a, b, q;                                                     //
+//                                                                            //
+//     q = Regularized_Incomplete_Beta_Complement( x, a, b );                 //
+////////////////////////////////////////////////////////////////////////////////
+double Regularized_Incomplete_Beta_Complement( double x, double a, double b )
+{
+   return (double) xRegularized_Incomplete_Beta_Complement((long double) x,
+                                            (long double) a, (long double) b);
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// long double xRegularized_Incomplete_Beta_Complement( long double x,        //
+//                                           long double a, long double b )   //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns the complement 1 - I(x,a,b) = I(1-x,b,a) of the  //
+//     regularized incomplete beta function.                                  //
+//                                                                            //
+//  Arguments:                                                                //
+//     long double x   Lower limit of the integral with integrand given above.//
+//     long double a   Shape parameter, a > 0.                                //
+//     long double b   Shape parameter, b > 0.                                //
+//                                                                            //
+//  Return Values:                                                            //
+//     1 - I(x,a,b), a real number between 0 and 1.  If x <= 0, 1 is          //
+//     returned and if x >= 1, 0 is returned.                                 //
+//                                                                            //
+//  Example:                                                                  //
+//     long double x, a, b, q;                                                //
+//                                                                            //
+//     q = xRegularized_Incomplete_Beta_Complement( x, a, b );                //
+////////////////////////////////////////////////////////////////////////////////
+long double xRegularized_Incomplete_Beta_Complement( long double x,
+                                                long double a, long double b )
+{
+   long double w, w1;
+
+   if ( x <= 0.0L ) return 1.0L;
+   if ( x >= 1.0L ) return 0.0L;
+   xIncomplete_Beta_IJ(x, 1.0L - x, a, b, xLn_Beta_Scale(a, b), &w, &w1);
+   return w1;
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// double Regularized_Incomplete_Beta_Prepared( double x, double a, double b, //
+//                                                         long double beta ) //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns the regularized incomplete beta function         //
+//     I(x,a,b), as Regularized_Incomplete_Beta(), but with the complete beta //
+//     function beta = xBeta_Function(a,b) supplied by the caller, from which //
+//     ln K = a ln(x0) + b ln(y0) - ln(beta) is calculated with three         //
+//     logarithms rather than with three evaluations of ln gamma.             //
+//                                                                            //
+//  Arguments:                                                                //
+//     double x          Upper limit of the integral.                         //
+//     double a          Shape parameter, a > 0.                              //
+//     double b          Shape parameter, b > 0.                              //
+//     long double beta  The complete beta function B(a,b), as returned by    //
+//                       xBeta_Function(a,b).                                 //
+//                                                                            //
+//  Return Values:                                                            //
+//     I(x,a,b), a real number between 0 and 1.  If x <= 0, 0 is returned     //
+//     and if x >= 1, 1 is returned.                                          //
+//                                                                            //
+//  Example:                                                                  //
+//     long double beta;                                                      //
+//     double x, a, b, p;                                                     //
+//                                                                            //
+//     beta = xBeta_Function( a, b );                                         //
+//     p = Regularized_Incomplete_Beta_Prepared( x, a, b, beta );             //
+////////////////////////////////////////////////////////////////////////////////
+double Regularized_Incomplete_Beta_Prepared( double x, double a, double b,
+                                                             long double beta )
+{
+   long double xa = (long double) a;
+   long double xb = (long double) b;
+   long double s = xa + xb;
+   long double ln_k = xa * logl(xa / s) + xb * logl(xb / s) - logl(beta);
+   long double w, w1;
+
+   if ( x <= 0.0 ) return 0.0;
+   if ( x >= 1.0 ) return 1.0;
+   xIncomplete_Beta_IJ((long double) x, 1.0L - (long double) x, xa, xb, ln_k,
+                                                                     &w, &w1);
+   return (double) w;
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// double Regularized_Incomplete_Beta_Complement_Prepared( double x,          //
+//                                   double a, double b, long double beta )   //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns the complement 1 - I(x,a,b) = I(1-x,b,a), as     //
+//     Regularized_Incomplete_Beta_Complement(), but with the complete beta   //
+//     function beta = xBeta_Function(a,b) supplied by the caller as for      //
+//     Regularized_Incomplete_Beta_Prepared().  Unlike evaluating             //
+//     I(1-x,b,a) with the prepared form, 1 - x is formed in extended         //
+//     precision, so that no precision is lost for small x.                   //
+//                                                                            //
+//  Arguments:                                                                //
+//     double x          Lower limit of the integral.                         //
+//     double a          Shape parameter, a > 0.                              //
+//     double b          Shape parameter, b > 0.                              //
+//     long double beta  The complete beta function B(a,b), as returned by    //
+//                       xBeta_Function(a,b).                                 //
+//                                                                            //
+//  Return Values:                                                            //
+//     1 - I(x,a,b), a real number between 0 and 1.  If x <= 0, 1 is          //
+//     returned and if x >= 1, 0 is returned.                                 //
+//                                                                            //
+//  Example:                                                                  //
+//     long double beta;                                                      //
+//     double x, a, b, q;                                                     //
+//                                                                            //
+//     beta = xBeta_Function( a, b );                                         //
+//     q = Regularized_Incomplete_Beta_Complement_Prepared( x, a, b, beta );  //
+////////////////////////////////////////////////////////////////////////////////
+double Regularized_Incomplete_Beta_Complement_Prepared( double x, double a,
+                                                   double b, long double beta )
+{
+   long double xa = (long double) a;
+   long double xb = (long double) b;
+   long double s = xa + xb;
+   long double ln_k = xa * logl(xa / s) + xb * logl(xb / s) - logl(beta);
+   long double w, w1;
+
+   if ( x <= 0.0 ) return 1.0;
+   if ( x >= 1.0 ) return 0.0;
+   xIncomplete_Beta_IJ((long double) x, 1.0L - (long double) x, xa, xb, ln_k,
+                                                                     &w, &w1);
+   return (double) w1;
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// void Regularized_Incomplete_Beta_Array( double x[], double p[], int n,     //
+//                                                     double a, double b )   //
+//                                                                            //
+//  Description:                                                              //
+//     This function evaluates the regularized incomplete beta function       //
+//     I(x,a,b) with shape parameters a and b at each of the n points         //
+//     x[0],...,x[n-1].  The part of the prefactor depending only on a and b  //
+//     is calculated once rather than for each point.                         //
+//                                                                            //
+//  Arguments:                                                                //
+//     double x[] Array of n upper limits of the integral.                    //
+//     double p[] Array of n elements, p[i] is set to I(x[i],a,b).  p may be  //
+//                the same array as x.                                        //
+//     int    n   The number of points.                                       //
+//     double a   Shape parameter, a > 0.                                     //
+//     double b   Shape parameter, b > 0.                                     //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     #define N 100                                                          //
+//     double x[N], p[N], a, b;                                               //
+//                                                                            //
+//     Regularized_Incomplete_Beta_Array( x, p, N, a, b );                    //
+////////////////////////////////////////////////////////////////////////////////
+void Regularized_Incomplete_Beta_Array( double x[], double p[], int n,
+                                                         double a, double b )
+{
+   long double xa = (long double) a;
+   long double xb = (long double) b;
+   long double ln_k = xLn_Beta_Scale(xa, xb);
+   long double w, w1;
+   int i;
+
+   for (i = 0; i < n; i++)
+      if ( x[i] <= 0.0 ) p[i] = 0.0;
+      else if ( x[i] >= 1.0 ) p[i] = 1.0;
+      else {
+         xIncomplete_Beta_IJ((long double) x[i], 1.0L - (long double) x[i],
+                                                      xa, xb, ln_k, &w, &w1);
+         p[i] = (double) w;
+      }
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// void Regularized_Incomplete_Beta_Complement_Array( double x[], double q[], //
+//                                              int n, double a, double b )   //
+//                                                                            //
+//  Description:                                                              //
+//     This function evaluates the complement 1 - I(x,a,b) = I(1-x,b,a) of    //
+//     the regularized incomplete beta function with shape parameters a and b //
+//     at each of the n points x[0],...,x[n-1].  The part of the prefactor    //
+//     depending only on a and b is calculated once rather than for each      //
+//     point.                                                                 //
+//                                                                            //
+//  Arguments:                                                                //
+//     double x[] Array of n lower limits of the integral.                    //
+//     double q[] Array of n elements, q[i] is set to 1 - I(x[i],a,b).  q may //
+//                be the same array as x.                                     //
+//     int    n   The number of points.                                       //
+//     double a   Shape parameter, a > 0.                                     //
+//     double b   Shape parameter, b > 0.                                     //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     #define N 100                                                          //
+//     double x[N], q[N], a, b;                                               //
+//                                                                            //
+//     Regularized_Incomplete_Beta_Complement_Array( x, q, N, a, b );         //
+////////////////////////////////////////////////////////////////////////////////
+void Regularized_Incomplete_Beta_Complement_Array( double x[], double q[],
+                                                  int n, double a, double b )
+{
+   long double xa = (long double) a;
+   long double xb = (long double) b;
+   long double ln_k = xLn_Beta_Scale(xa, xb);
+   long double w, w1;
+   int i;
+
+   for (i = 0; i < n; i++)
+      if ( x[i] <= 0.0 ) q[i] = 1.0;
+      else if ( x[i] >= 1.0 ) q[i] = 0.0;
+      else {
+         xIncomplete_Beta_IJ((long double) x[i], 1.0L - (long double) x[i],
+                                                      xa, xb, ln_k, &w, &w1);
+         q[i] = (double) w1;
+      }
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// static void xIncomplete_Beta_IJ( long double x, long double y,             //
+//                     long double a, long double b, long double ln_k,        //
+//                                       long double *w, long double *w1 )    //
+//                                                                            //
+//  Description:                                                              //
+//     This function calculates both I(x,a,b) and its complement I(y,b,a),    //
+//     where y = 1 - x.  If x <= (a+1) / (a+b+2), I(x,a,b) is calculated by   //
+//     the continued fraction and its complement as 1 minus it, otherwise     //
+//     I(y,b,a) is calculated by the continued fraction and I(x,a,b) as 1     //
+//     minus it.                                                              //
+//                                                                            //
+//  Arguments:                                                                //
+//     long double x     The argument, 0 < x < 1.                             //
+//     long double y     1 - x, 0 < y < 1.                                    //
+//     long double a     Shape parameter, a > 0.                              //
+//     long double b     Shape parameter, b > 0.                              //
+//     long double ln_k  ln K = ln( x0^a y0^b / B(a,b) ), as returned by      //
+//                       xLn_Beta_Scale(a,b).                                 //
+//     long double *w    Set to I(x,a,b).                                     //
+//     long double *w1   Set to 1 - I(x,a,b).                                 //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     long double x, a, b, w, w1;                                            //
+//                                                                            //
+//     xIncomplete_Beta_IJ( x, 1.0L - x, a, b, xLn_Beta_Scale(a,b), &w, &w1 );//
+////////////////////////////////////////////////////////////////////////////////
+static void xIncomplete_Beta_IJ( long double x, long double y, long double a,
+                   long double b, long double ln_k, long double *w,
+                                                             long double *w1 )
+{
+   long double d;
+
+   if ( x <= (a + 1.0L) / (a + b + 2.0L) ) {
+      d = xPrefactor(x, y, a, b, ln_k);
+      *w = d * xContinued_Fraction(x, y, a, b);
+      *w1 = 1.0L - *w;
+   } else {
+      d = xPrefactor(y, x, b, a, ln_k);
+      *w1 = d * xContinued_Fraction(y, x, b, a);
+      *w = 1.0L - *w1;
+   }
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// static long double xPrefactor( long double x, long double y,               //
+//                      long double a, long double b, long double ln_k )      //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns D = x^a y^b / B(a,b), y = 1 - x, calculated in   //
+//     log space as K exp( a phi(x/x0 - 1) + b phi(y/y0 - 1) ), where         //
+//     phi(mu) = ln(1 + mu) - mu, x0 = a / (a+b) and y0 = b / (a+b).  Both    //
+//     x/x0 - 1 = d / a and y/y0 - 1 = -d / b are calculated from             //
+//     d = x b - y a.  phi(mu) is calculated by xLog1pmx(mu) for |mu| <= 1/4  //
+//     and as ln(x/x0) - mu otherwise, where the rounding of mu would be      //
+//     magnified by ln(1 + mu) near mu = -1.                                  //
+//                                                                            //
+//  Arguments:                                                                //
+//     long double x     The argument, 0 < x < 1.                             //
+//     long double y     1 - x, 0 < y < 1.                                    //
+//     long double a     Shape parameter, a > 0.                              //
+//     long double b     Shape parameter, b > 0.                              //
+//     long double ln_k  ln K = ln( x0^a y0^b / B(a,b) ).                     //
+//                                                                            //
+//  Return Values:                                                            //
+//     x^a (1-x)^b / B(a,b).                                                  //
+//                                                                            //
+//  Example:                                                                  //
+//     long double x, a, b, d;                                                //
+//                                                                            //
+//     d = xPrefactor( x, 1.0L - x, a, b, xLn_Beta_Scale(a,b) );              //
+////////////////////////////////////////////////////////////////////////////////
+static long double xPrefactor( long double x, long double y, long double a,
+                                              long double b, long double ln_k )
+{
+   long double s = a + b;
+   long double d = x * b - y * a;
+   long double mu_a = d / a;
+   long double mu_b = -d / b;
+   long double phi_a, phi_b;
+
+   if ( fabsl(mu_a) <= 0.25L ) phi_a = xLog1pmx(mu_a);
+   else phi_a = logl(x * s / a) - mu_a;
+   if ( fabsl(mu_b) <= 0.25L ) phi_b = xLog1pmx(mu_b);
+   else phi_b = logl(y * s / b) - mu_b;
+   return expl( a * phi_a + b * phi_b + ln_k );
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// static long double xContinued_Fraction( long double x, long double y,      //
+//                                            long double a, long double b )  //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns the reciprocal of the continued fraction         //
+//        beta[0] + alpha[1]/(beta[1] + alpha[2]/(beta[2] + ...))             //
+//     where lambda = a y - b x, beta[0] = a (1 + lambda) / (a + 1),          //
+//        alpha[n] = (a+n-1)(a+b+n-1) n(b-n) x^2 / (a+2n-1)^2,                //
+//        beta[n] = n + n(b-n)x/(a+2n-1) + (a+n)(1+lambda+n(1+y))/(a+2n+1),   //
+//     evaluated by the modified Lentz method, so that I(x,a,b) = D times     //
+//     the reciprocal, for x <= (a+1) / (a+b+2).  This is the even part of    //
+//     the continued fraction given above, rearranged by Didonato and Morris  //
+//     so that the cancellation of 1 - (a+b)x / (a+1), which is severe for x  //
+//     near 1 and a large, is carried by lambda, calculated from x and y.     //
+//                                                                            //
+//  Arguments:                                                                //
+//     long double x   The argument, 0 < x <= (a+1) / (a+b+2).                //
+//     long double y   1 - x.                                                 //
+//     long double a   Shape parameter, a > 0.                                //
+//     long double b   Shape parameter, b > 0.                                //
+//                                                                            //
+//  Return Values:                                                            //
+//     The reciprocal of the continued fraction.                              //
+//                                                                            //
+//  Example:                                                                  //
+//     long double x, a, b, r;                                                //
+//                                                                            //
+//     r = xContinued_Fraction( x, 1.0L - x, a, b );                          //
+////////////////////////////////////////////////////////////////////////////////
+static long double xContinued_Fraction( long double x, long double y,
+                                                long double a, long double b )
+{
+   long double lambda = y * a - x * b;
+   long double f = a * (1.0L + lambda) / (a + 1.0L);
+   long double c, d, alpha, beta, delta, n2;
+   long double n = 0.0L;
+
+   if ( fabsl(f) < LDBL_MIN ) f = LDBL_MIN;
+   c = f;
+   d = 0.0L;
+   do {
+      n += 1.0L;
+      n2 = a + n + n - 1.0L;
+      alpha = (a + n - 1.0L) * (a + b + n - 1.0L) * n * (b - n) * x * x
+                                                                / (n2 * n2);
+      beta = n + n * (b - n) * x / n2
+                 + (a + n) * (1.0L + lambda + n * (1.0L + y)) / (n2 + 2.0L);
+      d = beta + alpha * d;
+      if ( fabsl(d) < LDBL_MIN ) d = LDBL_MIN;
+      c = beta + alpha / c;
+      if ( fabsl(c) < LDBL_MIN ) c = LDBL_MIN;
+      d = 1.0L / d;
+      delta = c * d;
+      f *= delta;
+   } while ( fabsl(delta - 1.0L) > LDBL_EPSILON );
+   return 1.0L / f;
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// static long double xLn_Beta_Scale( long double a, long double b )          //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns ln K, where K = x0^a y0^b / B(a,b),              //
+//     x0 = a / (a+b) and y0 = b / (a+b), calculated as                       //
+//        ln K = ln G(a+b) - ln G(a) - ln G(b) + ln sqrt( ab / (2 pi (a+b)) ) //
+//     where G(z) = gamma(z) / ( sqrt(2 pi / z) (z/e)^z ).                    //
+//                                                                            //
+//  Arguments:                                                                //
+//     long double a   Shape parameter, a > 0.                                //
+//     long double b   Shape parameter, b > 0.                                //
+//                                                                            //
+//  Return Values:                                                            //
+//     ln K.                                                                  //
+//                                                                            //
+//  Example:                                                                  //
+//     long double a, b, ln_k;                                                //
+//                                                                            //
+//     ln_k = xLn_Beta_Scale( a, b );                                         //
+////////////////////////////////////////////////////////////////////////////////
+static long double xLn_Beta_Scale( long double a, long double b )
+{
+   long double s = a + b;
+
+   return xLn_Gamma_Star(s) - xLn_Gamma_Star(a) - xLn_Gamma_Star(b)
+                              + 0.5L * logl(a * (b / s)) - log_sqrt_2pi;
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// static long double xLn_Gamma_Star( long double z )                         //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns ln G, where                                      //
+//              G = gamma(z) / ( sqrt(2 pi / z) (z/e)^z ),                    //
+//     by Stirling's series for z >= 10 and otherwise as                      //
+//              ln gamma(z) - (z - 1/2) ln(z) + z - ln sqrt(2 pi).            //
+//                                                                            //
+//  Arguments:                                                                //
+//     long double z  The argument, z > 0.                                    //
+//                                                                            //
+//  Return Values:                                                            //
+//     ln G.                                                                  //
+//                                                                            //
+//  Example:                                                                  //
+//     long double z, ln_gamma_star;                                          //
+//                                                                            //
+//     ln_gamma_star = xLn_Gamma_Star( z );                                   //
+////////////////////////////////////////////////////////////////////////////////
+static long double xLn_Gamma_Star( long double z )
+{
+   long double w, ww, sum;
+   int i;
+
+   if ( z >= stirling_cutoff ) {
+      w = 1.0L / z;
+      ww = w * w;
+      sum = B[nB - 1];
+      for (i = nB - 2; i >= 0; i--) sum = sum * ww + B[i];
+      return sum * w;
+   }
+   return xLn_Gamma_Function(z) - (z - 0.5L) * logl(z) + z - log_sqrt_2pi;
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// static long double xLog1pmx( long double mu )                              //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns ln(1 + mu) - mu.  For |mu| <= 1/4, with          //
+//     t = mu / (2 + mu),                                                     //
+//           ln(1 + mu) - mu = -t mu + 2 (t^3/3 + t^5/5 + t^7/7 + ...),       //
+//     which is free of the cancellation of log1pl(mu) - mu.                  //
+//                                                                            //
+//  Arguments:                                                                //
+//     long double mu  The argument, mu > -1.                                 //
+//                                                                            //
+//  Return Values:                                                            //
+//     ln(1 + mu) - mu.                                                       //
+//                                                                            //
+//  Example:                                                                  //
+//     long double mu, r;                                                     //
+//                                                                            //
+//     r = xLog1pmx( mu );                                                    //
+////////////////////////////////////////////////////////////////////////////////
+static long double xLog1pmx( long double mu )
+{
+   long double t, tt, term;
+   long double sum = 0.0L;
+   long double k;
+
+   if ( fabsl(mu) > 0.25L ) return log1pl(mu) - mu;
+   t = mu / (2.0L + mu);
+   tt = t * t;
+   term = t * tt;
+   for (k = 3.0L; fabsl(term) > LDBL_EPSILON * fabsl(t * mu); k += 2.0L) {
+      sum += term / k;
+      term *= tt;
+   }
+   return 2.0L * sum - t * mu;
+}
@@ -0,0 +1,933 @@
+////////////////////////////////////////////////////////////////////////////////
+// File: regularized_incomplete_gamma_function.c                              //
+// Routine(s):                                                                //
+//    Regularized_Incomplete_Gamma_P                                          //
+//    xRegularized_Incomplete_Gamma_P                                         //
+//    Regularized_Incomplete_Gamma_Q                                          //
+//    xRegularized_Incomplete_Gamma_Q                                         //
+//    Regularized_Incomplete_Gamma_P_Array                                    //
+//    Regularized_Incomplete_Gamma_Q_Array                                    //
+//    xRegularized_Incomplete_Gamma_Normalizer                                //
+//    Regularized_Incomplete_Gamma_P_Prepared                                 //
+//    Regularized_Incomplete_Gamma_Q_Prepared                                 //
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+//  Description:                                                              //
+//     The regularized incomplete gamma functions with shape parameter        //
+//     nu > 0 are defined for x >= 0 by                                       //
+//            P(nu,x) = Integral[0,x] t^(nu-1) exp(-t) dt / gamma(nu),        //
+//            Q(nu,x) = Integral[x,inf] t^(nu-1) exp(-t) dt / gamma(nu),      //
+//     so that P(nu,x) + Q(nu,x) = 1.  P(nu,x) is the entire incomplete gamma //
+//     function and the gamma distribution with shape parameter nu.           //
+//                                                                            //
+//     Both are calculated together, the smaller directly and the other as 1  //
+//     minus it, in one of three regions.  Let lambda = x / nu.               //
+//                                                                            //
+//     If nu >= 50 and |lambda - 1| <= 0.4, near the transition of P from 0   //
+//     to 1, Temme's uniform asymptotic expansion is used                     //
+//            Q(nu,x) = erfc( eta sqrt(nu/2) ) / 2 + R(nu,eta),               //
+//            P(nu,x) = erfc( -eta sqrt(nu/2) ) / 2 - R(nu,eta),              //
+//     where eta^2 / 2 = lambda - 1 - ln(lambda), eta having the sign of      //
+//     lambda - 1, and                                                        //
+//        R(nu,eta) = exp(-nu eta^2 / 2) / sqrt(2 pi nu) Sum C[k](eta) / nu^k //
+//     summed over k = 0,...,10.  The coefficients C[k](eta) are analytic at  //
+//     eta = 0 and are summed as Taylor series in eta.                        //
+//                                                                            //
+//     Otherwise, if x < nu + 1 (or lambda < 0.6 if nu >= 50), the series     //
+//            P(nu,x) = D Sum x^n / ( (nu+1)(nu+2)...(nu+n) )                 //
+//     summed over n >= 0 is used, and if x >= nu + 1 (or lambda > 1.4) the   //
+//     continued fraction                                                     //
+//            Q(nu,x) = D nu / (x+1-nu- 1(1-nu)/(x+3-nu- 2(2-nu)/(x+5-nu-...  //
+//     is used, where D = x^nu exp(-x) / gamma(nu+1) is calculated in log     //
+//     space as                                                               //
+//            D = exp( -nu (lambda - 1 - ln(lambda)) ) / (sqrt(2 pi nu) G),   //
+//     G = gamma(nu) / ( sqrt(2 pi / nu) (nu/e)^nu ) being the gamma function //
+//     with its Stirling approximation removed.  Since the ratio of           //
+//     successive terms of the series is at most max(x / (nu+1), 0.6) and     //
+//     the continued fraction converges at least as quickly as it does at     //
+//     lambda = 1.4, the cost is bounded independently of nu.                 //
+//     Each series and continued fraction is cut off after 1000 terms, which  //
+//     arguments in the domain never approach.                                //
+//                                                                            //
+//     For nu < 1 and x < nu + 1, Q(nu,x) is calculated as                    //
+//            Q(nu,x) = 1 - w - w nu Sum (-x)^n / ( n! (nu + n) )             //
+//     summed over n >= 1, where w = x^nu / gamma(nu+1) and 1 - w is          //
+//     calculated by expm1l() so that Q(nu,x) keeps its relative precision    //
+//     when nu is small and P(nu,x) is near 1.                                //
+////////////////////////////////////////////////////////////////////////////////
+#include <math.h>       // required for expl(), expm1l(), logl(), log1pl(),
+                        // sqrtl(), erfcl(), fabsl() and NAN.
+#include <float.h>      // required for LDBL_EPSILON, LDBL_MIN and LDBL_MAX.
+
+//                         Externally Defined Routines                        //
+
+extern long double xLn_Gamma_Function( long double x );
+
+//                         Internally Defined Routines                        //
+
+double Regularized_Incomplete_Gamma_P( double x, double nu );
+long double xRegularized_Incomplete_Gamma_P( long double x, long double nu );
+double Regularized_Incomplete_Gamma_Q( double x, double nu );
+long double xRegularized_Incomplete_Gamma_Q( long double x, long double nu );
+void Regularized_Incomplete_Gamma_P_Array( double x[], double p[], int n,
+                                                                   double nu );
+void Regularized_Incomplete_Gamma_Q_Array( double x[], double q[], int n,
+                                                                   double nu );
+long double xRegularized_Incomplete_Gamma_Normalizer( long double nu );
+double Regularized_Incomplete_Gamma_P_Prepared( double x, double nu,
+                                                  long double ln_gamma_star );
+double Regularized_Incomplete_Gamma_Q_Prepared( double x, double nu,
+                                                  long double ln_gamma_star );
+
+static void xIncomplete_Gamma_PQ( long double x, long double nu,
+                    long double ln_gamma_star, long double *p, long double *q );
+static void xTemme_Expansion( long double x, long double nu, long double *p,
+                                                              long double *q );
+static long double xPrefactor( long double x, long double nu,
+                                                  long double ln_gamma_star );
+static long double xSeries( long double x, long double nu );
+static long double xContinued_Fraction( long double x, long double nu );
+static long double xSmall_Shape_Q( long double x, long double nu );
+static long double xLn_Gamma_Star( long double nu );
+static long double xLog1pmx( long double mu );
+
+//                         Internally Defined Constants                       //
+
+static const long double log_sqrt_2pi = 9.18938533204672741780329736e-1L;
+static const long double temme_cutoff = 50.0L;
+static const long double temme_width = 0.4L;
+static const long double stirling_cutoff = 10.0L;
+static const int max_terms = 1000;
+
+// Coefficients of the Taylor series in eta of C[k](eta), k = 0,...,10, of    //
+// Temme's expansion, truncated where the terms fall below 1.0e-22 for        //
+// nu >= 50 and |eta| <= 0.48.  C[0](eta) = 1 / (lambda - 1) - 1 / eta and    //
+//     C[k](eta) = C'[k-1](eta) / eta + (-1)^k g[k] / (lambda - 1),           //
+// where g[k] are the coefficients of Stirling's series for gamma(nu).        //
+
+static const long double d0[] = {
+   -3.333333333333333333333e-1L, +8.333333333333333333333e-2L,
+   -1.481481481481481481481e-2L, +1.157407407407407407407e-3L,
+   +3.527336860670194003527e-4L, -1.787551440329218106996e-4L,
+   +3.919263178522437781697e-5L, -2.185448510679992161474e-6L,
+   -1.854062210715159960702e-6L, +8.296711340953086005016e-7L,
+   -1.766595273682607930436e-7L, +6.707853543401498580369e-9L,
+   +1.026180978424030804257e-8L, -4.382036018453353186553e-9L,
+   +9.147699582236790234182e-10L, -2.551419399494624976688e-11L,
+   -5.830772132550425067464e-11L, +2.436194802066741624369e-11L,
+   -5.027669280114175589091e-12L, +1.100439203195613477084e-13L,
+   +3.371763262400985378828e-13L, -1.392388722418162065919e-13L,
+   +2.853489380704744320397e-14L
+};
+
+static const long double d1[] = {
+   -1.851851851851851851852e-3L, -3.472222222222222222222e-3L,
+   +2.645502645502645502646e-3L, -9.902263374485596707819e-4L,
+   +2.057613168724279835391e-4L, -4.018775720164609053498e-7L,
+   -1.809855033448997783703e-5L, +7.649160916081110084637e-6L,
+   -1.612090089456344600378e-6L, +4.647127802807434342261e-9L,
+   +1.378633446915720959312e-7L, -5.752545603517704964022e-8L,
+   +1.195162859977814732431e-8L, -1.754324171974764762375e-11L,
+   -1.009154371060041262746e-9L, +4.162792991842582636234e-10L,
+   -8.563907026492980638074e-11L, +6.067215101604758615127e-14L,
+   +7.162498964811485390080e-12L, -2.933186643771437117406e-12L,
+   +5.996696365683688723304e-13L
+};
+
+static const long double d2[] = {
+   +4.133597883597883597884e-3L, -2.681327160493827160494e-3L,
+   +7.716049382716049382716e-4L, +2.009387860082304526749e-6L,
+   -1.073665322636516052154e-4L, +5.292344882912012541642e-5L,
+   -1.276063518861872771338e-5L, +3.423578734096138074190e-8L,
+   +1.372195730906293320559e-6L, -6.298992138380055022907e-7L,
+   +1.428061420606424179158e-7L, -2.047709842199086601492e-10L,
+   -1.409252991086752105329e-8L, +6.228974084922022033564e-9L,
+   -1.367048839661711349927e-9L, +9.428356159014678195477e-13L,
+   +1.287225240008931805955e-10L, -5.564595613436332114654e-11L,
+   +1.197593554636698100359e-11L, -4.168978225183863504038e-15L,
+   -1.094064042788459440993e-12L
+};
+
+static const long double d3[] = {
+   +6.494341563786008230453e-4L, +2.294720936213991769547e-4L,
+   -4.691894943952557121281e-4L, +2.677206320628388529623e-4L,
+   -7.561801671883976410725e-5L, -2.396505113867296651933e-7L,
+   +1.108265411534730236148e-5L, -5.674952826991596567500e-6L,
+   +1.423090073243588391455e-6L, -2.786108029152814224058e-11L,
+   -1.695840409193027728986e-7L, +8.099464905388082363353e-8L,
+   -1.911116848597365406067e-8L, +2.392862043980811796864e-12L,
+   +2.062013181548879843699e-9L, -9.460496661855132173754e-10L,
+   +2.154104977577490783801e-10L, -1.388823336813903046034e-14L,
+   -2.189476168196393940641e-11L
+};
+
+static const long double d4[] = {
+   -8.618882909167116986047e-4L, +7.840392217200666274740e-4L,
+   -2.990724803031901797334e-4L, -1.463845257884341817812e-6L,
+   +6.641498215465122186659e-5L, -3.968365047179434664431e-5L,
+   +1.137572697067841909806e-5L, +2.507497226237532801652e-10L,
+   -1.695414953655830601472e-6L, +8.907507532205309688829e-7L,
+   -2.292934834000804870572e-7L, +2.956794137544049046966e-11L,
+   +2.886582974270878362973e-8L, -1.418973943780321938948e-8L,
+   +3.446358049946489706595e-9L, -2.302451717452806713202e-13L,
+   -3.940923302804640527507e-10L, +1.860233896850450191343e-10L
+};
+
+static const long double d5[] = {
+   -3.367985533663581503088e-4L, -6.972813758365857774294e-5L,
+   +2.772753244959392078734e-4L, -1.993257051618884770034e-4L,
+   +6.797780477937207838816e-5L, +1.419062920643967014834e-7L,
+   -1.359404818976869327846e-5L, +8.018470256334201539719e-6L,
+   -2.291481176508095170380e-6L, -3.252473551298453951662e-10L,
+   +3.465284649108526495592e-7L, -1.844718719117134327653e-7L,
+   +4.824096703789418075638e-8L, -1.798946672174351530258e-14L,
+   -6.306194500013523435175e-9L, +3.162417628774567937738e-9L
+};
+
+static const long double d6[] = {
+   +5.313079364639922231657e-4L, -5.921664373536938828648e-4L,
+   +2.708782096718044827713e-4L, +7.902353232660327872120e-7L,
+   -8.153969367561968750929e-5L, +5.611682753106249650038e-5L,
+   -1.832911658284337556733e-5L, -3.079613450603304782564e-9L,
+   +3.465155368803609086737e-6L, -2.029132739605860372695e-6L,
+   +5.788792863149003708900e-7L, +2.338630673826656989335e-13L,
+   -8.828600746330483525051e-8L, +4.743595888040812780322e-8L
+};
+
+static const long double d7[] = {
+   +3.443676068923776712543e-4L, +5.171790908260592193371e-5L,
+   -3.349316108114223631166e-4L, +2.812695154763237022737e-4L,
+   -1.097658224468473102354e-4L, -1.274100909548448537946e-7L,
+   +2.774445151156364415707e-5L, -1.826348880571133266143e-5L,
+   +5.787694949735052398942e-6L, +4.938758933936270399818e-10L,
+   -1.059536701402604273381e-6L, +6.166714376110407478588e-7L
+};
+
+static const long double d8[] = {
+   -6.526239185953094189220e-4L, +8.394987206720872799934e-4L,
+   -4.382970985417210050611e-4L, -6.969091458420551971369e-7L,
+   +1.664484664206754783738e-4L, -1.278351767976921858533e-4L,
+   +4.629953263691304290614e-5L, +4.557909867922707711627e-9L,
+   -1.059527112580519547182e-5L, +6.783342904865166622731e-6L
+};
+
+static const long double d9[] = {
+   -5.967612901927462501244e-4L, -7.204895416020010559086e-5L,
+   +6.782308837667328361620e-4L, -6.401475260262758451000e-4L,
+   +2.775010763432870449924e-4L, +1.819700838046515104617e-7L,
+   -8.479507117068503182397e-5L, +6.105192082501531017647e-5L
+};
+
+static const long double d10[] = {
+   +1.332445449480065637127e-3L, -1.914438498565477526501e-3L,
+   +1.108936913459663733961e-3L, +9.932404122642298967423e-7L,
+   -5.087450129309319898484e-4L, +4.273505666539288432843e-4L
+};
+
+static const long double *temme_d[] = {
+   d0, d1, d2, d3, d4, d5, d6, d7, d8, d9, d10
+};
+
+static const int temme_n[] = {
+   sizeof(d0) / sizeof(long double), sizeof(d1) / sizeof(long double),
+   sizeof(d2) / sizeof(long double), sizeof(d3) / sizeof(long double),
+   sizeof(d4) / sizeof(long double), sizeof(d5) / sizeof(long double),
+   sizeof(d6) / sizeof(long double), sizeof(d7) / sizeof(long double),
+   sizeof(d8) / sizeof(long double), sizeof(d9) / sizeof(long double),
+   sizeof(d10) / sizeof(long double)
+};
+
+static const int temme_k = sizeof(temme_n) / sizeof(int);
+
+// Bernoulli numbers B(2),B(4),B(6),...,B(20) divided by 2j (2j-1).           //
+
+static const long double B[] = {   1.0L / (long double)(6 * 2 * 1),
+                                  -1.0L / (long double)(30 * 4 * 3),
+                                   1.0L / (long double)(42 * 6 * 5),
+                                  -1.0L / (long double)(30 * 8 * 7),
+                                   5.0L / (long double)(66 * 10 * 9),
+                                -691.0L / (long double)(2730 * 12 * 11),
+                                   7.0L / (long double)(6 * 14 * 13),
+                               -3617.0L / (long double)(510 * 16 * 15),
+                               43867.0L / (long double)(796 * 18 * 17),
+                             -174611.0L / (long double)(330 * 20 * 19)
+                           };
+
+static const int nB = sizeof(B) / sizeof(long double);
+
+// Coefficients of a, a^2, ..., a^7 of the Taylor series of ln gamma(1+a),    //
+// i.e. -gamma followed by (-1)^k zeta(k) / k, k = 2,...,7.                   //
+
+static const long double ln_gamma_1p[] = {
+   -5.772156649015328606065e-1L, +8.224670334241132182362e-1L,
+   -4.006856343865314284666e-1L, +2.705808084277845478790e-1L,
+   -2.073855510286739852663e-1L, +1.695571769974081899524e-1L,
+   -1.440498967688461181200e-1L
+};
+
+static const int n1p = sizeof(ln_gamma_1p) / sizeof(long double);
+
+
+////////////////////////////////////////////////////////////////////////////////
+// double Regularized_Incomplete_Gamma_P( double x, double nu )               //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns the regularized incomplete gamma function        //
+//     P(nu,x), the integral from 0 to x of t^(nu-1) exp(-t) dt / gamma(nu),  //
+//     with a cost which does not grow with the shape parameter nu.           //
+//                                                                            //
+//  Arguments:                                                                //
+//     double x   Upper limit of the integral with integrand given above.     //
+//     double nu  The shape parameter, nu > 0.                                //
+//                                                                            //
+//  Return Values:                                                            //
+//     P(nu,x), a real number between 0 and 1.  If x <= 0, 0 is returned.     //
+//     If nu <= 0 or x or nu is NaN, NaN is returned.                         //
+//                                                                            //
+//  Example:                                                                  //
+//     double x, p, nu;                                                       //
+//                                                                            //
+//     p = Regularized_Incomplete_Gamma_P( x, nu );                           //
+////////////////////////////////////////////////////////////////////////////////
+double Regularized_Incomplete_Gamma_P( double x, double nu )
+{
+   return (double) xRegularized_Incomplete_Gamma_P((long double) x,
+                                                             (long double) nu);
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// long double xRegularized_Incomplete_Gamma_P( long double x,                //
+//                                                           long double nu ) //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns the regularized incomplete gamma function        //
+//     P(nu,x), the integral from 0 to x of t^(nu-1) exp(-t) dt / gamma(nu).  //
+//                                                                            //
+//  Arguments:                                                                //
+//     long double x   Upper limit of the integral with integrand given above.//
+//     long double nu  The shape parameter, nu > 0.                           //
+//                                                                            //
+//  Return Values:                                                            //
+//     P(nu,x), a real number between 0 and 1.  If x <= 0, 0 is returned.     //
+//     If nu <= 0 or x or nu is NaN, NaN is returned.                         //
+//                                                                            //
+//  Example:                                                                  //
+//     long double x, p, nu;                                                  //
+//                                                                            //
+//     p = xRegularized_Incomplete_Gamma_P( x, nu );                          //
+////////////////////////////////////////////////////////////////////////////////
+long double xRegularized_Incomplete_Gamma_P( long double x, long double nu )
+{
+   long double p, q;
+
+   xIncomplete_Gamma_PQ(x, nu, xLn_Gamma_Star(nu), &p, &q);
+   return p;
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// double Regularized_Incomplete_Gamma_Q( double x, double nu )               //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns the complementary regularized incomplete gamma   //
+//     function Q(nu,x) = 1 - P(nu,x), the integral from x to infinity of     //
+//     t^(nu-1) exp(-t) dt / gamma(nu).  Q(nu,x) is calculated directly, not  //
+//     as 1 - P(nu,x), so that it keeps its relative precision in the upper   //
+//     tail.                                                                  //
+//                                                                            //
+//  Arguments:                                                                //
+//     double x   Lower limit of the integral with integrand given above.     //
+//     double nu  The shape parameter, nu > 0.                                //
+//                                                                            //
+//  Return Values:                                                            //
+//     Q(nu,x), a real number between 0 and 1.  If x <= 0, 1 is returned.     //
+//     If nu <= 0 or x or nu is NaN, NaN is returned.                         //
+//                                                                            //
+//  Example:                                                                  //
+//     double x, q, nu;                                                       //
+//                                                                            //
+//     q = Regularized_Incomplete_Gamma_Q( x, nu );                           //
+////////////////////////////////////////////////////////////////////////////////
+double Regularized_Incomplete_Gamma_Q( double x, double nu )
+{
+   return (double) xRegularized_Incomplete_Gamma_Q((long double) x,
+                                                             (long double) nu);
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// long double xRegularized_Incomplete_Gamma_Q( long double x,                //
+//                                                           long double nu ) //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns the complementary regularized incomplete gamma   //
+//     function Q(nu,x) = 1 - P(nu,x), the integral from x to infinity of     //
+//     t^(nu-1) exp(-t) dt / gamma(nu).                                       //
+//                                                                            //
+//  Arguments:                                                                //
+//     long double x   Lower limit of the integral with integrand given above.//
+//     long double nu  The shape parameter, nu > 0.                           //
+//                                                                            //
+//  Return Values:                                                            //
+//     Q(nu,x), a real number between 0 and 1.  If x <= 0, 1 is returned.     //
+//     If nu <= 0 or x or nu is NaN, NaN is returned.                         //
+//                                                                            //
+//  Example:                                                                  //
+//     long double x, q, nu;                                                  //
+//                                                                            //
+//     q = xRegularized_Incomplete_Gamma_Q( x, nu );                          //
+////////////////////////////////////////////////////////////////////////////////
+long double xRegularized_Incomplete_Gamma_Q( long double x, long double nu )
+{
+   long double p, q;
+
+   xIncomplete_Gamma_PQ(x, nu, xLn_Gamma_Star(nu), &p, &q);
+   return q;
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// void Regularized_Incomplete_Gamma_P_Array( double x[], double p[], int n,  //
+//                                                                double nu ) //
+//                                                                            //
+//  Description:                                                              //
+//     This function evaluates the regularized incomplete gamma function      //
+//     P(nu,x) with shape parameter nu at each of the n points                //
+//     x[0],...,x[n-1].  The part of the prefactor depending only on nu is    //
+//     calculated once rather than for each point.  If nu <= 0 or nu or x[i]  //
+//     is NaN, the corresponding result is NaN.                               //
+//                                                                            //
+//  Arguments:                                                                //
+//     double x[] Array of n upper limits of the integral.                    //
+//     double p[] Array of n elements, p[i] is set to P(nu,x[i]).  p may be   //
+//                the same array as x.                                        //
+//     int    n   The number of points.                                       //
+//     double nu  The shape parameter, nu > 0.                                //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     #define N 100                                                          //
+//     double x[N], p[N], nu;                                                 //
+//                                                                            //
+//     Regularized_Incomplete_Gamma_P_Array( x, p, N, nu );                   //
+////////////////////////////////////////////////////////////////////////////////
+void Regularized_Incomplete_Gamma_P_Array( double x[], double p[], int n,
+                                                                    double nu )
+{
+   long double xnu = (long double) nu;
+   long double ln_gamma_star = xLn_Gamma_Star(xnu);
+   long double pp, qq;
+   int i;
+
+   for (i = 0; i < n; i++) {
+      xIncomplete_Gamma_PQ((long double) x[i], xnu, ln_gamma_star, &pp, &qq);
+      p[i] = (double) pp;
+   }
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// void Regularized_Incomplete_Gamma_Q_Array( double x[], double q[], int n,  //
+//                                                                double nu ) //
+//                                                                            //
+//  Description:                                                              //
+//     This function evaluates the complementary regularized incomplete gamma //
+//     function Q(nu,x) with shape parameter nu at each of the n points       //
+//     x[0],...,x[n-1].  The part of the prefactor depending only on nu is    //
+//     calculated once rather than for each point.  If nu <= 0 or nu or x[i]  //
+//     is NaN, the corresponding result is NaN.                               //
+//                                                                            //
+//  Arguments:                                                                //
+//     double x[] Array of n lower limits of the integral.                    //
+//     double q[] Array of n elements, q[i] is set to Q(nu,x[i]).  q may be   //
+//                the same array as x.                                        //
+//     int    n   The number of points.                                       //
+//     double nu  The shape parameter, nu > 0.                                //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     #define N 100                                                          //
+//     double x[N], q[N], nu;                                                 //
+//                                                                            //
+//     Regularized_Incomplete_Gamma_Q_Array( x, q, N, nu );                   //
+////////////////////////////////////////////////////////////////////////////////
+void Regularized_Incomplete_Gamma_Q_Array( double x[], double q[], int n,
+                                                                    double nu )
+{
+   long double xnu = (long double) nu;
+   long double ln_gamma_star = xLn_Gamma_Star(xnu);
+   long double pp, qq;
+   int i;
+
+   for (i = 0; i < n; i++) {
+      xIncomplete_Gamma_PQ((long double) x[i], xnu, ln_gamma_star, &pp, &qq);
+      q[i] = (double) qq;
+   }
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// long double xRegularized_Incomplete_Gamma_Normalizer( long double nu )     //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns ln G(nu), G(nu) = gamma(nu) / ( sqrt(2 pi / nu)  //
+//     (nu/e)^nu ) being the gamma function with its Stirling approximation   //
+//     removed, the part of the prefactor of P(nu,x) and Q(nu,x) which        //
+//     depends only on nu.  Callers who evaluate the functions repeatedly     //
+//     with the same shape parameter, such as a quantile iteration, calculate //
+//     it once and pass it to Regularized_Incomplete_Gamma_P_Prepared() or    //
+//     Regularized_Incomplete_Gamma_Q_Prepared().                             //
+//                                                                            //
+//  Arguments:                                                                //
+//     long double nu  The shape parameter, nu > 0.                           //
+//                                                                            //
+//  Return Values:                                                            //
+//     ln G(nu).                                                              //
+//                                                                            //
+//  Example:                                                                  //
+//     long double ln_gamma_star;                                             //
+//     double nu;                                                             //
+//                                                                            //
+//     ln_gamma_star = xRegularized_Incomplete_Gamma_Normalizer( nu );        //
+////////////////////////////////////////////////////////////////////////////////
+long double xRegularized_Incomplete_Gamma_Normalizer( long double nu )
+{
+   return xLn_Gamma_Star(nu);
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// double Regularized_Incomplete_Gamma_P_Prepared( double x, double nu,       //
+//                                              long double ln_gamma_star )   //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns the regularized incomplete gamma function        //
+//     P(nu,x), as Regularized_Incomplete_Gamma_P(), but with ln G(nu) =      //
+//     xRegularized_Incomplete_Gamma_Normalizer(nu) supplied by the caller    //
+//     rather than recalculated.                                              //
+//                                                                            //
+//  Arguments:                                                                //
+//     double x                   Upper limit of the integral.                //
+//     double nu                  The shape parameter, nu > 0.                //
+//     long double ln_gamma_star  The value returned by                       //
+//                                xRegularized_Incomplete_Gamma_Normalizer(nu)//
+//                                                                            //
+//  Return Values:                                                            //
+//     P(nu,x), a real number between 0 and 1.  If x <= 0, 0 is returned.     //
+//     If nu <= 0 or x or nu is NaN, NaN is returned.                         //
+//                                                                            //
+//  Example:                                                                  //
+//     long double ln_gamma_star;                                             //
+//     double x, p, nu;                                                       //
+//                                                                            //
+//     ln_gamma_star = xRegularized_Incomplete_Gamma_Normalizer( nu );        //
+//     p = Regularized_Incomplete_Gamma_P_Prepared( x, nu, ln_gamma_star );   //
+////////////////////////////////////////////////////////////////////////////////
+double Regularized_Incomplete_Gamma_P_Prepared( double x, double nu,
+                                                   long double ln_gamma_star )
+{
+   long double p, q;
+
+   xIncomplete_Gamma_PQ((long double) x, (long double) nu, ln_gamma_star,
+                                                                      &p, &q);
+   return (double) p;
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// double Regularized_Incomplete_Gamma_Q_Prepared( double x, double nu,       //
+//                                              long double ln_gamma_star )   //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns the complementary regularized incomplete gamma   //
+//     function Q(nu,x), as Regularized_Incomplete_Gamma_Q(), but with        //
+//     ln G(nu) = xRegularized_Incomplete_Gamma_Normalizer(nu) supplied by    //
+//     the caller rather than recalculated.                                   //
+//                                                                            //
+//  Arguments:                                                                //
+//     double x                   Lower limit of the integral.                //
+//     double nu                  The shape parameter, nu > 0.                //
+//     long double ln_gamma_star  The value returned by                       //
+//                                xRegularized_Incomplete_Gamma_Normalizer(nu)//
+//                                                                            //
+//  Return Values:                                                            //
+//     Q(nu,x), a real number between 0 and 1.  If x <= 0, 1 is returned.     //
+//     If nu <= 0 or x or nu is NaN, NaN is returned.                         //
+//                                                                            //
+//  Example:                                                                  //
+//     long double ln_gamma_star;                                             //
+//     double x, q, nu;                                                       //
+//                                                                            //
+//     ln_gamma_star = xRegularized_Incomplete_Gamma_Normalizer( nu );        //
+//     q = Regularized_Incomplete_Gamma_Q_Prepared( x, nu, ln_gamma_star );   //
+////////////////////////////////////////////////////////////////////////////////
+double Regularized_Incomplete_Gamma_Q_Prepared( double x, double nu,
+                                                   long double ln_gamma_star )
+{
+   long double p, q;
+
+   xIncomplete_Gamma_PQ((long double) x, (long double) nu, ln_gamma_star,
+                                                                      &p, &q);
+   return (double) q;
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// static void xIncomplete_Gamma_PQ( long double x, long double nu,           //
+//                                    long double ln_gamma_star,              //
+//                                    long double *p, long double *q )        //
+//                                                                            //
+//  Description:                                                              //
+//     This function calculates both P(nu,x) and Q(nu,x), choosing the method //
+//     as described at the head of this file.  If nu <= 0 or x or nu is NaN,  //
+//     both are set to NaN.                                                   //
+//                                                                            //
+//  Arguments:                                                                //
+//     long double x              The argument.                               //
+//     long double nu             The shape parameter.                        //
+//     long double ln_gamma_star  The value returned by xLn_Gamma_Star(nu).   //
+//     long double *p             Set to P(nu,x).                             //
+//     long double *q             Set to Q(nu,x).                             //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     long double x, nu, p, q;                                               //
+//                                                                            //
+//     xIncomplete_Gamma_PQ( x, nu, xLn_Gamma_Star(nu), &p, &q );             //
+////////////////////////////////////////////////////////////////////////////////
+static void xIncomplete_Gamma_PQ( long double x, long double nu,
+                    long double ln_gamma_star, long double *p, long double *q )
+{
+   long double mu;
+
+   if ( !(nu > 0.0L) || x != x ) { *p = NAN; *q = NAN; return; }
+   if ( x <= 0.0L ) { *p = 0.0L; *q = 1.0L; return; }
+   if ( x > LDBL_MAX ) { *p = 1.0L; *q = 0.0L; return; }
+
+   if ( nu >= temme_cutoff ) {
+      mu = (x - nu) / nu;
+      if ( fabsl(mu) <= temme_width ) {
+         xTemme_Expansion(x, nu, p, q);
+         return;
+      }
+      if ( mu < 0.0L ) {
+         *p = xPrefactor(x, nu, ln_gamma_star) * xSeries(x, nu);
+         *q = 1.0L - *p;
+      } else {
+         *q = xPrefactor(x, nu, ln_gamma_star) * nu
+                                                  * xContinued_Fraction(x, nu);
+         *p = 1.0L - *q;
+      }
+      return;
+   }
+
+   if ( x < nu + 1.0L ) {
+      *p = xPrefactor(x, nu, ln_gamma_star) * xSeries(x, nu);
+      *q = ( nu < 1.0L ) ? xSmall_Shape_Q(x, nu) : 1.0L - *p;
+   } else {
+      *q = xPrefactor(x, nu, ln_gamma_star) * nu * xContinued_Fraction(x, nu);
+      *p = 1.0L - *q;
+   }
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// static void xTemme_Expansion( long double x, long double nu,               //
+//                                             long double *p, long double *q)//
+//                                                                            //
+//  Description:                                                              //
+//     This function calculates P(nu,x) and Q(nu,x) by Temme's uniform        //
+//     asymptotic expansion for nu >= 50 and |x/nu - 1| <= 0.4.  The argument //
+//     of erfcl() and the exponent of R(nu,eta) are both formed from          //
+//     nu (lambda - 1 - ln(lambda)), which is calculated without cancellation //
+//     as -nu xLog1pmx(lambda - 1).                                           //
+//                                                                            //
+//  Arguments:                                                                //
+//     long double x   The argument.                                          //
+//     long double nu  The shape parameter, nu >= 50.                         //
+//     long double *p  Set to P(nu,x).                                        //
+//     long double *q  Set to Q(nu,x).                                        //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     long double x, nu, p, q;                                               //
+//                                                                            //
+//     xTemme_Expansion( x, nu, &p, &q );                                     //
+////////////////////////////////////////////////////////////////////////////////
+static void xTemme_Expansion( long double x, long double nu, long double *p,
+                                                               long double *q )
+{
+   long double mu = (x - nu) / nu;
+   long double phi = -xLog1pmx(mu);
+   long double eta = sqrtl(phi + phi);
+   long double w = 1.0L / nu;
+   long double y, r, c, sum;
+   int i, k;
+
+   if ( mu < 0.0L ) eta = -eta;
+   y = eta * sqrtl(0.5L * nu);
+
+   sum = 0.0L;
+   for (k = temme_k - 1; k >= 0; k--) {
+      c = temme_d[k][temme_n[k] - 1];
+      for (i = temme_n[k] - 2; i >= 0; i--) c = c * eta + temme_d[k][i];
+      sum = sum * w + c;
+   }
+   r = expl( -nu * phi - log_sqrt_2pi - 0.5L * logl(nu) ) * sum;
+   *q = 0.5L * erfcl(y) + r;
+   *p = 0.5L * erfcl(-y) - r;
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// static long double xPrefactor( long double x, long double nu,              //
+//                                                long double ln_gamma_star ) //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns D = x^nu exp(-x) / gamma(nu+1), calculated in    //
+//     log space as exp(-nu phi - ln G) / sqrt(2 pi nu), where                //
+//     phi = x/nu - 1 - ln(x/nu) and G = gamma(nu) / (sqrt(2pi/nu) (nu/e)^nu).//
+//     Neither x^nu nor gamma(nu+1) is formed, so that D neither overflows    //
+//     nor loses precision to the cancellation of nu ln(x) - ln gamma(nu+1)   //
+//     when nu is large.  nu phi is calculated as -nu xLog1pmx(x/nu - 1) for  //
+//     |x/nu - 1| <= 1/4 and as x - nu - nu ln(x/nu) otherwise, where the     //
+//     rounding of x/nu - 1 would be magnified by ln(x/nu) near x = 0.        //
+//                                                                            //
+//  Arguments:                                                                //
+//     long double x              The argument, x > 0.                        //
+//     long double nu             The shape parameter, nu > 0.                //
+//     long double ln_gamma_star  The value ln G returned by                  //
+//                                xLn_Gamma_Star(nu).                         //
+//                                                                            //
+//  Return Values:                                                            //
+//     x^nu exp(-x) / gamma(nu+1).                                            //
+//                                                                            //
+//  Example:                                                                  //
+//     long double x, nu, d;                                                  //
+//                                                                            //
+//     d = xPrefactor( x, nu, xLn_Gamma_Star(nu) );                           //
+////////////////////////////////////////////////////////////////////////////////
+static long double xPrefactor( long double x, long double nu,
+                                                   long double ln_gamma_star )
+{
+   long double mu = (x - nu) / nu;
+   long double nu_phi;
+
+   if ( fabsl(mu) <= 0.25L ) nu_phi = -nu * xLog1pmx(mu);
+   else nu_phi = (x - nu) - nu * logl(x / nu);
+   return expl( -nu_phi - ln_gamma_star - log_sqrt_2pi - 0.5L * logl(nu) );
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// static long double xSeries( long double x, long double nu )                //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns the sum over n >= 0 of                           //
+//                       x^n / ( (nu+1)(nu+2)...(nu+n) ),                     //
+//     so that P(nu,x) = D times the sum, for x < nu + 1.  The terms decrease //
+//     from the first.                                                        //
+//                                                                            //
+//  Arguments:                                                                //
+//     long double x   The argument, 0 < x < nu + 1.                          //
+//     long double nu  The shape parameter, nu > 0.                           //
+//                                                                            //
+//  Return Values:                                                            //
+//     The sum of the series.                                                 //
+//                                                                            //
+//  Example:                                                                  //
+//     long double x, nu, sum;                                                //
+//                                                                            //
+//     sum = xSeries( x, nu );                                                //
+////////////////////////////////////////////////////////////////////////////////
+static long double xSeries( long double x, long double nu )
+{
+   long double term = 1.0L;
+   long double sum = 1.0L;
+   long double t = nu;
+   int i = 0;
+
+   do {
+      t += 1.0L;
+      term *= x / t;
+      sum += term;
+   } while ( term > LDBL_EPSILON * sum && ++i < max_terms );
+   return sum;
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// static long double xContinued_Fraction( long double x, long double nu )    //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns the continued fraction                           //
+//           1 / (x+1-nu- 1(1-nu)/(x+3-nu- 2(2-nu)/(x+5-nu- ...)))            //
+//     evaluated by the modified Lentz method, so that Q(nu,x) = D nu times   //
+//     the continued fraction, for x >= nu + 1.                               //
+//                                                                            //
+//  Arguments:                                                                //
+//     long double x   The argument, x >= nu + 1.                             //
+//     long double nu  The shape parameter, nu > 0.                           //
+//                                                                            //
+//  Return Values:                                                            //
+//     The value of the continued fraction.                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     long double x, nu, cf;                                                 //
+//                                                                            //
+//     cf = xContinued_Fraction( x, nu );                                     //
+////////////////////////////////////////////////////////////////////////////////
+static long double xContinued_Fraction( long double x, long double nu )
+{
+   long double b = x + 1.0L - nu;
+   long double c = 1.0L / LDBL_MIN;
+   long double d = 1.0L / b;
+   long double h = d;
+   long double a, delta;
+   long double i = 0.0L;
+
+   do {
+      i += 1.0L;
+      a = -i * (i - nu);
+      b += 2.0L;
+      d = a * d + b;
+      if ( fabsl(d) < LDBL_MIN ) d = LDBL_MIN;
+      c = b + a / c;
+      if ( fabsl(c) < LDBL_MIN ) c = LDBL_MIN;
+      d = 1.0L / d;
+      delta = d * c;
+      h *= delta;
+   } while ( fabsl(delta - 1.0L) > LDBL_EPSILON && i < max_terms );
+   return h;
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// static long double xSmall_Shape_Q( long double x, long double nu )         //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns Q(nu,x) for nu < 1 and x < nu + 1 as             //
+//              Q(nu,x) = 1 - w - w nu Sum (-x)^n / ( n! (nu + n) ),          //
+//     summed over n >= 1, where w = x^nu / gamma(nu+1).  The logarithm of w  //
+//     is nu ln(x) - ln gamma(1+nu), where ln gamma(1+nu) is calculated by    //
+//     its Taylor series if nu < 2^(-11), for which 1 + nu is not exact.      //
+//                                                                            //
+//  Arguments:                                                                //
+//     long double x   The argument, 0 < x < nu + 1.                          //
+//     long double nu  The shape parameter, 0 < nu < 1.                       //
+//                                                                            //
+//  Return Values:                                                            //
+//     Q(nu,x).                                                               //
+//                                                                            //
+//  Example:                                                                  //
+//     long double x, nu, q;                                                  //
+//                                                                            //
+//     q = xSmall_Shape_Q( x, nu );                                           //
+////////////////////////////////////////////////////////////////////////////////
+static long double xSmall_Shape_Q( long double x, long double nu )
+{
+   long double ln_w, w, term, sum;
+   long double t = 0.0L;
+   int i;
+
+   if ( nu < 1.0L / 2048.0L ) {
+      ln_w = ln_gamma_1p[n1p - 1];
+      for (i = n1p - 2; i >= 0; i--) ln_w = ln_w * nu + ln_gamma_1p[i];
+      ln_w *= nu;
+   } else ln_w = xLn_Gamma_Function(1.0L + nu);
+   ln_w = nu * logl(x) - ln_w;
+   w = expl(ln_w);
+
+   term = 1.0L;
+   sum = 0.0L;
+   do {
+      t += 1.0L;
+      term *= -x / t;
+      sum += term / (nu + t);
+   } while ( fabsl(term) > LDBL_EPSILON * fabsl(sum) && t < max_terms );
+
+   return -expm1l(ln_w) - w * nu * sum;
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// static long double xLn_Gamma_Star( long double nu )                        //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns ln G, where                                      //
+//              G = gamma(nu) / ( sqrt(2 pi / nu) (nu/e)^nu ),                //
+//     by Stirling's series for nu >= 10 and otherwise as                     //
+//              ln gamma(nu) - (nu - 1/2) ln(nu) + nu - ln sqrt(2 pi).        //
+//                                                                            //
+//  Arguments:                                                                //
+//     long double nu  The shape parameter, nu > 0.                           //
+//                                                                            //
+//  Return Values:                                                            //
+//     ln G.                                                                  //
+//                                                                            //
+//  Example:                                                                  //
+//     long double nu, ln_gamma_star;                                         //
+//                                                                            //
+//     ln_gamma_star = xLn_Gamma_Star( nu );                                  //
+////////////////////////////////////////////////////////////////////////////////
+static long double xLn_Gamma_Star( long double nu )
+{
+   long double w, ww, sum;
+   int i;
+
+   if ( nu >= stirling_cutoff ) {
+      w = 1.0L / nu;
+      ww = w * w;
+      sum = B[nB - 1];
+      for (i = nB - 2; i >= 0; i--) sum = sum * ww + B[i];
+      return sum * w;
+   }
+   return xLn_Gamma_Function(nu) - (nu - 0.5L) * logl(nu) + nu - log_sqrt_2pi;
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// static long double xLog1pmx( long double mu )                              //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns ln(1 + mu) - mu.  For |mu| <= 1/4, with          //
+//     t = mu / (2 + mu),                                                     //
+//           ln(1 + mu) - mu = -t mu + 2 (t^3/3 + t^5/5 + t^7/7 + ...),       //
+//     which is free of the cancellation of log1pl(mu) - mu.                  //
+//                                                                            //
+//  Arguments:                                                                //
+//     long double mu  The argument, mu > -1.                                 //
+//                                                                            //
+//  Return Values:                                                            //
+//     ln(1 + mu) - mu.                                                       //
+//                                                                            //
+//  Example:                                                                  //
+//     long double mu, r;                                                     //
+//                                                                            //
+//     r = xLog1pmx( mu );                                                    //
+////////////////////////////////////////////////////////////////////////////////
+static long double xLog1pmx( long double mu )
+{
+   long double t, tt, term;
+   long double sum = 0.0L;
+   long double k;
+
+   if ( fabsl(mu) > 0.25L ) return log1pl(mu) - mu;
+   t = mu / (2.0L + mu);
+   tt = t * t;
+   term = t * tt;
+   for (k = 3.0L; fabsl(term) > LDBL_EPSILON * fabsl(t * mu); k += 2.0L) {
+      sum += term / k;
+      term *= tt;
+   }
+   return 2.0L * sum - t * mu;
+}
@@ -0,0 +1,268 @@
+////////////////////////////////////////////////////////////////////////////////
+// File: simd_math.h                                                          //
+// Routine(s):                                                                //
+//    Log_AVX2                                                                //
+//    Log_AVX512                                                              //
+//    Exp_Small_AVX2                                                          //
+//    Exp_Small_AVX512                                                        //
+//    Sin_Pi_AVX2                                                             //
+//    Sin_Pi_AVX512                                                           //
+//    Cos_Pi_AVX2                                                             //
+//    Cos_Pi_AVX512                                                           //
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+//  Description:                                                              //
+//     Elementary functions on vectors of 4 (AVX2) or 8 (AVX-512F) doubles    //
+//     for the batch forms of the gamma and beta functions.  They are defined //
+//     static inline so that each kernel which includes this file compiles    //
+//     them for its own instruction set.                                      //
+//                                                                            //
+//     The routines are only defined on x86-64 with a GNU compatible compiler //
+//     and then GAMMA_BETA_SIMD is defined.  The callers select the kernel at //
+//     load time with __builtin_cpu_supports(), so the library itself need    //
+//     not be compiled with -mavx2.  The AVX2 routines use only AVX2          //
+//     instructions so that they may be inlined into kernels compiled either  //
+//     for "avx2" or for "avx2,fma".                                          //
+////////////////////////////////////////////////////////////////////////////////
+#ifndef SIMD_MATH_H
+#define SIMD_MATH_H
+
+#if defined(__GNUC__) && defined(__x86_64__) && defined(__LP64__)
+#define GAMMA_BETA_SIMD
+#include <immintrin.h>          // required for the AVX2 and AVX-512 intrinsics
+
+////////////////////////////////////////////////////////////////////////////////
+//  Description:                                                              //
+//     The natural logarithm by the method of fdlibm's log():  x = 2^k (1+f)  //
+//     with sqrt(2)/2 <= 1+f < sqrt(2), s = f / (2+f) and                     //
+//          log(1+f) = f - f^2/2 + s (f^2/2 + R(s^2)),                        //
+//     where R is a minimax polynomial of degree 7, and k ln 2 is added in    //
+//     two parts.  The error is less than 1 ulp.  The argument must be a      //
+//     positive normal number; zero, subnormal, infinite and NaN arguments    //
+//     are to be handled by the caller.                                       //
+////////////////////////////////////////////////////////////////////////////////
+
+static const double simd_ln2_hi = 6.93147180369123816490e-01;
+static const double simd_ln2_lo = 1.90821492927058770002e-10;
+static const double simd_lg[] = {
+   6.666666666666735130e-01, 3.999999999940941908e-01,
+   2.857142874366239149e-01, 2.222219843214978396e-01,
+   1.818357216161805012e-01, 1.531383769920937332e-01,
+   1.479819860511658591e-01
+};
+
+__attribute__((target("avx2")))
+static inline __m256d Log_AVX2( __m256d x )
+{
+   const __m256i mantissa = _mm256_set1_epi64x(0x000fffffffffffffLL);
+   const __m256i one_bits = _mm256_set1_epi64x(0x3ff0000000000000LL);
+   const __m256i two52 = _mm256_set1_epi64x(0x4330000000000000LL);
+   const __m256d two52d = _mm256_set1_pd(4503599627370496.0 + 1023.0);
+   const __m256d sqrt2 = _mm256_set1_pd(1.41421356237309504880);
+   const __m256d one = _mm256_set1_pd(1.0);
+   const __m256d half = _mm256_set1_pd(0.5);
+   __m256i bits = _mm256_castpd_si256(x);
+   __m256d m, k, big, f, s, z, w, t1, t2, hfsq;
+
+   m = _mm256_castsi256_pd(_mm256_or_si256(_mm256_and_si256(bits, mantissa),
+                                                                   one_bits));
+   k = _mm256_sub_pd(_mm256_castsi256_pd(_mm256_or_si256(
+                                 _mm256_srli_epi64(bits, 52), two52)), two52d);
+   big = _mm256_cmp_pd(m, sqrt2, _CMP_GT_OQ);
+   m = _mm256_blendv_pd(m, _mm256_mul_pd(m, half), big);
+   k = _mm256_add_pd(k, _mm256_and_pd(big, one));
+
+   f = _mm256_sub_pd(m, one);
+   s = _mm256_div_pd(f, _mm256_add_pd(_mm256_set1_pd(2.0), f));
+   z = _mm256_mul_pd(s, s);
+   w = _mm256_mul_pd(z, z);
+   t1 = _mm256_add_pd(_mm256_set1_pd(simd_lg[3]),
+                           _mm256_mul_pd(w, _mm256_set1_pd(simd_lg[5])));
+   t1 = _mm256_add_pd(_mm256_set1_pd(simd_lg[1]), _mm256_mul_pd(w, t1));
+   t1 = _mm256_mul_pd(w, t1);
+   t2 = _mm256_add_pd(_mm256_set1_pd(simd_lg[4]),
+                           _mm256_mul_pd(w, _mm256_set1_pd(simd_lg[6])));
+   t2 = _mm256_add_pd(_mm256_set1_pd(simd_lg[2]), _mm256_mul_pd(w, t2));
+   t2 = _mm256_add_pd(_mm256_set1_pd(simd_lg[0]), _mm256_mul_pd(w, t2));
+   t2 = _mm256_mul_pd(z, t2);
+   hfsq = _mm256_mul_pd(half, _mm256_mul_pd(f, f));
+
+   t1 = _mm256_mul_pd(s, _mm256_add_pd(hfsq, _mm256_add_pd(t2, t1)));
+   t1 = _mm256_add_pd(t1, _mm256_mul_pd(k, _mm256_set1_pd(simd_ln2_lo)));
+   t1 = _mm256_sub_pd(_mm256_sub_pd(hfsq, t1), f);
+   return _mm256_sub_pd(_mm256_mul_pd(k, _mm256_set1_pd(simd_ln2_hi)), t1);
+}
+
+__attribute__((target("avx512f")))
+static inline __m512d Log_AVX512( __m512d x )
+{
+   const __m512i mantissa = _mm512_set1_epi64(0x000fffffffffffffLL);
+   const __m512i one_bits = _mm512_set1_epi64(0x3ff0000000000000LL);
+   const __m512i two52 = _mm512_set1_epi64(0x4330000000000000LL);
+   const __m512d two52d = _mm512_set1_pd(4503599627370496.0 + 1023.0);
+   const __m512d sqrt2 = _mm512_set1_pd(1.41421356237309504880);
+   const __m512d one = _mm512_set1_pd(1.0);
+   const __m512d half = _mm512_set1_pd(0.5);
+   __m512i bits = _mm512_castpd_si512(x);
+   __m512d m, k, f, s, z, w, t1, t2, hfsq;
+   __mmask8 big;
+
+   m = _mm512_castsi512_pd(_mm512_or_si512(_mm512_and_si512(bits, mantissa),
+                                                                   one_bits));
+   k = _mm512_sub_pd(_mm512_castsi512_pd(_mm512_or_si512(
+                                 _mm512_srli_epi64(bits, 52), two52)), two52d);
+   big = _mm512_cmp_pd_mask(m, sqrt2, _CMP_GT_OQ);
+   m = _mm512_mask_mul_pd(m, big, m, half);
+   k = _mm512_mask_add_pd(k, big, k, one);
+
+   f = _mm512_sub_pd(m, one);
+   s = _mm512_div_pd(f, _mm512_add_pd(_mm512_set1_pd(2.0), f));
+   z = _mm512_mul_pd(s, s);
+   w = _mm512_mul_pd(z, z);
+   t1 = _mm512_add_pd(_mm512_set1_pd(simd_lg[3]),
+                           _mm512_mul_pd(w, _mm512_set1_pd(simd_lg[5])));
+   t1 = _mm512_add_pd(_mm512_set1_pd(simd_lg[1]), _mm512_mul_pd(w, t1));
+   t1 = _mm512_mul_pd(w, t1);
+   t2 = _mm512_add_pd(_mm512_set1_pd(simd_lg[4]),
+                           _mm512_mul_pd(w, _mm512_set1_pd(simd_lg[6])));
+   t2 = _mm512_add_pd(_mm512_set1_pd(simd_lg[2]), _mm512_mul_pd(w, t2));
+   t2 = _mm512_add_pd(_mm512_set1_pd(simd_lg[0]), _mm512_mul_pd(w, t2));
+   t2 = _mm512_mul_pd(z, t2);
+   hfsq = _mm512_mul_pd(half, _mm512_mul_pd(f, f));
+
+   t1 = _mm512_mul_pd(s, _mm512_add_pd(hfsq, _mm512_add_pd(t2, t1)));
+   t1 = _mm512_add_pd(t1, _mm512_mul_pd(k, _mm512_set1_pd(simd_ln2_lo)));
+   t1 = _mm512_sub_pd(_mm512_sub_pd(hfsq, t1), f);
+   return _mm512_sub_pd(_mm512_mul_pd(k, _mm512_set1_pd(simd_ln2_hi)), t1);
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+//  Description:                                                              //
+//     exp(x) for |x| <= 0.3 by its Taylor polynomial of degree 13, whose     //
+//     truncation error is less than 6.0e-19.  The error is less than 1 ulp. //
+//     There is no argument reduction; the routines serve the kernels which   //
+//     exponentiate ln Gamma(y) for 1.5 <= y < 2.5.                           //
+////////////////////////////////////////////////////////////////////////////////
+
+static const double simd_exp[] = {
+   1.0, 1.0, 5.0e-1, 1.66666666666666667e-1, 4.16666666666666667e-2,
+   8.33333333333333333e-3, 1.38888888888888889e-3, 1.98412698412698413e-4,
+   2.48015873015873016e-5, 2.75573192239858907e-6, 2.75573192239858907e-7,
+   2.50521083854417188e-8, 2.08767569878680990e-9, 1.60590438368216146e-10
+};
+
+__attribute__((target("avx2")))
+static inline __m256d Exp_Small_AVX2( __m256d x )
+{
+   int const n = sizeof(simd_exp) / sizeof(double);
+   __m256d sum = _mm256_set1_pd(simd_exp[n - 1]);
+   int i;
+
+   for (i = n - 2; i >= 0; i--)
+      sum = _mm256_add_pd(_mm256_mul_pd(sum, x), _mm256_set1_pd(simd_exp[i]));
+   return sum;
+}
+
+__attribute__((target("avx512f")))
+static inline __m512d Exp_Small_AVX512( __m512d x )
+{
+   int const n = sizeof(simd_exp) / sizeof(double);
+   __m512d sum = _mm512_set1_pd(simd_exp[n - 1]);
+   int i;
+
+   for (i = n - 2; i >= 0; i--)
+      sum = _mm512_add_pd(_mm512_mul_pd(sum, x), _mm512_set1_pd(simd_exp[i]));
+   return sum;
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+//  Description:                                                              //
+//     sin(pi r) and cos(pi r) for |r| <= 1/2, where r is the difference      //
+//     between an argument and the nearest integer, by their Taylor series    //
+//             sin(pi r) = r Sum (-1)^k pi^(2k+1) r^(2k) / (2k+1)!,           //
+//             cos(pi r) = Sum (-1)^k pi^(2k) r^(2k) / (2k)!.                 //
+//     The cosine series is used for |r| <= 1/4 only and cos(pi r) =          //
+//     sin(pi (1/2 - |r|)) otherwise, 1/2 - |r| being exact, so that both     //
+//     functions have a small relative error up to their zeros.               //
+////////////////////////////////////////////////////////////////////////////////
+
+static const double simd_sin_pi[] = {
+   +3.14159265358979324e+0, -5.16771278004997003e+0, +2.55016403987734544e+0,
+   -5.99264529320792077e-1, +8.21458866111282288e-2, -7.37043094571435078e-3,
+   +4.66302805767612564e-4, -2.19153534478302158e-5, +7.95205400147551278e-7,
+   -2.29484289972698731e-8, +5.39266466260812849e-10, -1.05184717169320645e-11
+};
+
+static const double simd_cos_pi[] = {
+   +1.00000000000000000e+0, -4.93480220054467931e+0, +4.05871212641676822e+0,
+   -1.33526276885458950e+0, +2.35330630358893205e-1, -2.58068913900140600e-2,
+   +1.92957430940392305e-3, -1.04638104924845707e-4, +4.30306958703294701e-6,
+   -1.38789524622137721e-7
+};
+
+__attribute__((target("avx2")))
+static inline __m256d Sin_Pi_AVX2( __m256d r )
+{
+   int const n = sizeof(simd_sin_pi) / sizeof(double);
+   __m256d rr = _mm256_mul_pd(r, r);
+   __m256d sum = _mm256_set1_pd(simd_sin_pi[n - 1]);
+   int i;
+
+   for (i = n - 2; i >= 0; i--)
+      sum = _mm256_add_pd(_mm256_mul_pd(sum, rr),
+                                             _mm256_set1_pd(simd_sin_pi[i]));
+   return _mm256_mul_pd(sum, r);
+}
+
+__attribute__((target("avx512f")))
+static inline __m512d Sin_Pi_AVX512( __m512d r )
+{
+   int const n = sizeof(simd_sin_pi) / sizeof(double);
+   __m512d rr = _mm512_mul_pd(r, r);
+   __m512d sum = _mm512_set1_pd(simd_sin_pi[n - 1]);
+   int i;
+
+   for (i = n - 2; i >= 0; i--)
+      sum = _mm512_add_pd(_mm512_mul_pd(sum, rr),
+                                             _mm512_set1_pd(simd_sin_pi[i]));
+   return _mm512_mul_pd(sum, r);
+}
+
+__attribute__((target("avx2")))
+static inline __m256d Cos_Pi_AVX2( __m256d r )
+{
+   int const n = sizeof(simd_cos_pi) / sizeof(double);
+   __m256d abs_r = _mm256_andnot_pd(_mm256_set1_pd(-0.0), r);
+   __m256d rr = _mm256_mul_pd(r, r);
+   __m256d sum = _mm256_set1_pd(simd_cos_pi[n - 1]);
+   __m256d far = _mm256_cmp_pd(abs_r, _mm256_set1_pd(0.25), _CMP_GT_OQ);
+   int i;
+
+   for (i = n - 2; i >= 0; i--)
+      sum = _mm256_add_pd(_mm256_mul_pd(sum, rr),
+                                             _mm256_set1_pd(simd_cos_pi[i]));
+   return _mm256_blendv_pd(sum,
+            Sin_Pi_AVX2(_mm256_sub_pd(_mm256_set1_pd(0.5), abs_r)), far);
+}
+
+__attribute__((target("avx512f")))
+static inline __m512d Cos_Pi_AVX512( __m512d r )
+{
+   int const n = sizeof(simd_cos_pi) / sizeof(double);
+   __m512d abs_r = _mm512_abs_pd(r);
+   __m512d rr = _mm512_mul_pd(r, r);
+   __m512d sum = _mm512_set1_pd(simd_cos_pi[n - 1]);
+   __mmask8 far = _mm512_cmp_pd_mask(abs_r, _mm512_set1_pd(0.25), _CMP_GT_OQ);
+   int i;
+
+   for (i = n - 2; i >= 0; i--)
+      sum = _mm512_add_pd(_mm512_mul_pd(sum, rr),
+                                             _mm512_set1_pd(simd_cos_pi[i]));
+   return _mm512_mask_blend_pd(far, sum,
+            Sin_Pi_AVX512(_mm512_sub_pd(_mm512_set1_pd(0.5), abs_r)));
+}
+
+#endif
+#endif
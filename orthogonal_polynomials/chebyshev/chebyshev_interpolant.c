@@ -0,0 +1,579 @@
+////////////////////////////////////////////////////////////////////////////////
+// File: chebyshev_interpolant.c                                              //
+// Routine(s):                                                                //
+//    Chebyshev_Interpolant_Init                                              //
+//    Chebyshev_Interpolant_Init_With_Parameters                              //
+//    Chebyshev_Interpolant_Evaluate                                          //
+//    Chebyshev_Interpolant_Evaluate_Array                                    //
+//    Chebyshev_Interpolant_Free                                              //
+////////////////////////////////////////////////////////////////////////////////
+#include <stdlib.h>                 // required for malloc(), realloc(), free()
+#include <math.h>                   // required for cos(), fabs(), ldexp()
+#include <float.h>                  // required for DBL_EPSILON, DBL_MAX
+
+#include "chebyshev_interpolant.h"
+
+#define NODES (CHEBYSHEV_INTERPOLANT_MAX_DEGREE + 1)
+#define TAIL 8
+#define MAX_RANGE 16.0
+#define BLOCK 64
+
+//                    Required Internally Defined Routines                    //
+
+int Chebyshev_Interpolant_Init_With_Parameters( Chebyshev_Interpolant *ci,
+                  double (*f)(double, void*), void *parameters, double lower,
+                                           double upper, double tolerance );
+void Chebyshev_Interpolant_Free( Chebyshev_Interpolant *ci );
+static double Plain_Function( double x, void *parameters );
+static int Fit_Piece( double (*f)(double, void*), void *parameters,
+                  double left, double right, double tolerance, double c[],
+                                           const double cosine[], int *degree );
+static int Grow( Chebyshev_Interpolant *ci, int **level, int capacity );
+
+typedef struct {
+   double (*f)(double);
+} Plain_Function_Pointer;
+
+////////////////////////////////////////////////////////////////////////////////
+// int Chebyshev_Interpolant_Init( Chebyshev_Interpolant *ci,                 //
+//                                 double (*f)(double), double lower,         //
+//                                 double upper, double tolerance )           //
+//                                                                            //
+//  Description:                                                              //
+//     This routine builds a piecewise Chebyshev interpolant of the function  //
+//     f on the interval [lower, upper], see                                  //
+//     Chebyshev_Interpolant_Init_With_Parameters().  It is intended for      //
+//     functions of one argument such as Catalan_Beta_Function() or           //
+//     Dawsons_Integral().                                                    //
+//                                                                            //
+//  Arguments:                                                                //
+//     Chebyshev_Interpolant *ci                                              //
+//        The interpolant to build.                                           //
+//     double (*f)(double)                                                    //
+//        The function to be approximated.                                    //
+//     double lower                                                           //
+//        The left endpoint of the interval.                                  //
+//     double upper                                                           //
+//        The right endpoint of the interval, upper > lower.                  //
+//     double tolerance                                                       //
+//        The relative accuracy required, see                                 //
+//        Chebyshev_Interpolant_Init_With_Parameters().                       //
+//                                                                            //
+//  Return Values:                                                            //
+//     See Chebyshev_Interpolant_Init_With_Parameters().                      //
+//                                                                            //
+//  Example:                                                                  //
+//     Chebyshev_Interpolant ci;                                              //
+//     extern double Catalan_Beta_Function(double x);                         //
+//     double y;                                                              //
+//                                                                            //
+//     Chebyshev_Interpolant_Init( &ci, Catalan_Beta_Function, 0.0, 10.0,     //
+//                                                             1.0e-14 );     //
+//     y = Chebyshev_Interpolant_Evaluate( &ci, 2.5 );                        //
+//     Chebyshev_Interpolant_Free( &ci );                                     //
+////////////////////////////////////////////////////////////////////////////////
+
+int Chebyshev_Interpolant_Init( Chebyshev_Interpolant *ci, double (*f)(double),
+                          double lower, double upper, double tolerance )
+{
+   Plain_Function_Pointer pointer;
+
+   pointer.f = f;
+   return Chebyshev_Interpolant_Init_With_Parameters( ci, Plain_Function,
+                                      &pointer, lower, upper, tolerance );
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// int Chebyshev_Interpolant_Init_With_Parameters( Chebyshev_Interpolant *ci, //
+//                  double (*f)(double, void*), void *parameters,             //
+//                  double lower, double upper, double tolerance )            //
+//                                                                            //
+//  Description:                                                              //
+//     This routine builds a piecewise Chebyshev interpolant of the function  //
+//     f(x, parameters) on the interval [lower, upper].  The second argument  //
+//     of f is passed parameters unchanged and is used to fix the remaining   //
+//     arguments of a library function, e.g. the order n of                   //
+//     Exponential_Integral_En() or the modulus of                            //
+//     Legendre_Elliptic_Integral_First_Kind().                               //
+//                                                                            //
+//     Starting with the whole interval, f is sampled at the 32 Chebyshev     //
+//     nodes of a piece and the coefficients of the interpolating polynomial  //
+//     are found by a discrete cosine transform.  The piece is kept if the    //
+//     last eight coefficients sum in magnitude to at most tolerance times    //
+//     the smallest |f| sampled on the piece, and if the largest |f| sampled  //
+//     is at most 16 times the smallest, so that the error is small relative  //
+//     to f everywhere on the piece.  If f changes sign on the piece, the     //
+//     error is instead measured relative to the largest |f| sampled.  A      //
+//     piece which is not kept is bisected and each half is fitted in turn,   //
+//     to at most CHEBYSHEV_INTERPOLANT_MAX_DEPTH bisections.  The series of  //
+//     a piece which is kept is truncated to the shortest one whose dropped   //
+//     coefficients still satisfy the bound.                                  //
+//                                                                            //
+//     The interpolant is built once, at a cost of 32 evaluations of f per    //
+//     piece fitted, and thereafter each evaluation takes one table look-up   //
+//     and degree steps of Clenshaw's recursion, independent of how f itself  //
+//     is computed.  Since the coefficients carry rounding errors of about    //
+//     DBL_EPSILON times the largest |f| on the piece, a tolerance below      //
+//     about 1.0e-14 is not attained and the bound is never taken below       //
+//     16 DBL_EPSILON times the largest |f|.  f must be finite on the open    //
+//     interval (lower, upper); it is never evaluated at the endpoints, so a  //
+//     function which is finite but not smooth at an endpoint, such as        //
+//     Exponential_Integral_En() at 0, can be approximated but fills the      //
+//     pieces next to that endpoint to the maximum depth.                     //
+//                                                                            //
+//  Arguments:                                                                //
+//     Chebyshev_Interpolant *ci                                              //
+//        The interpolant to build.  Its storage is allocated here and must   //
+//        be released by Chebyshev_Interpolant_Free().                        //
+//     double (*f)(double, void*)                                             //
+//        The function to be approximated.                                    //
+//     void *parameters                                                       //
+//        The second argument passed to f.                                    //
+//     double lower                                                           //
+//        The left endpoint of the interval.                                  //
+//     double upper                                                           //
+//        The right endpoint of the interval, upper > lower.                  //
+//     double tolerance                                                       //
+//        The relative accuracy required on each piece, e.g. 1.0e-14.         //
+//                                                                            //
+//  Return Values:                                                            //
+//     0 if the tolerance was met on every piece, 1 if some piece at the      //
+//     maximum depth did not meet it (the interpolant is usable but less      //
+//     accurate there), -1 if the arguments are invalid and -2 if memory      //
+//     could not be allocated.  After a return of -1 or -2 the interpolant is //
+//     empty and Chebyshev_Interpolant_Free() may still be called.            //
+//                                                                            //
+//  Example:                                                                  //
+//     typedef struct { int n; } En_Parameters;                               //
+//                                                                            //
+//     double En( double x, void *parameters ) {                              //
+//        return Exponential_Integral_En(x, ((En_Parameters*)parameters)->n); //
+//     }                                                                      //
+//                                                                            //
+//     Chebyshev_Interpolant ci;                                              //
+//     En_Parameters e3 = { 3 };                                              //
+//     double y;                                                              //
+//                                                                            //
+//     Chebyshev_Interpolant_Init_With_Parameters( &ci, En, &e3, 0.1, 20.0,   //
+//                                                                 1.0e-14 ); //
+//     y = Chebyshev_Interpolant_Evaluate( &ci, 2.5 );                        //
+//     Chebyshev_Interpolant_Free( &ci );                                     //
+////////////////////////////////////////////////////////////////////////////////
+
+int Chebyshev_Interpolant_Init_With_Parameters( Chebyshev_Interpolant *ci,
+                  double (*f)(double, void*), void *parameters, double lower,
+                                           double upper, double tolerance )
+{
+   double cosine[4 * NODES];
+   double c[NODES];
+   int stack_index[2 * CHEBYSHEV_INTERPOLANT_MAX_DEPTH + 2];
+   int stack_level[2 * CHEBYSHEV_INTERPOLANT_MAX_DEPTH + 2];
+   int *level = NULL;
+   int capacity = 0;
+   int top = 0;
+   int status = 0;
+   int index, depth, degree, fit, cells, i, j, k;
+   double width, left, right, half_width;
+
+   ci->pieces = 0;
+   ci->degree = 0;
+   ci->depth = 0;
+   ci->piece = NULL;
+   ci->midpoint = NULL;
+   ci->inverse_half_width = NULL;
+   ci->coefficients = NULL;
+
+   if ( !(upper > lower) || upper - lower > DBL_MAX ) return -1;
+   if ( !(tolerance > 0.0) ) return -1;
+   if ( tolerance < 16.0 * DBL_EPSILON ) tolerance = 16.0 * DBL_EPSILON;
+
+   ci->lower = lower;
+   ci->upper = upper;
+   width = upper - lower;
+   for (k = 0; k < 4 * NODES; k++) cosine[k] = cos(k * M_PI / (2 * NODES));
+
+         // Fit the pieces depth first, left half before right half, so //
+         // that they are stored in order of increasing x.  The piece   //
+         // with the given index at the given depth is                  //
+         // [lower + index * width / 2^depth, lower + (index + 1) * ...] //
+
+   stack_index[0] = 0;
+   stack_level[0] = 0;
+   top = 1;
+   while ( top > 0 ) {
+      top--;
+      index = stack_index[top];
+      depth = stack_level[top];
+      left = lower + width * ldexp((double) index, -depth);
+      right = lower + width * ldexp((double) (index + 1), -depth);
+      fit = Fit_Piece( f, parameters, left, right, tolerance, c, cosine,
+                                                                   &degree );
+      if ( fit != 1 ) {
+         if ( depth < CHEBYSHEV_INTERPOLANT_MAX_DEPTH ) {
+            stack_index[top] = 2 * index + 1;
+            stack_level[top++] = depth + 1;
+            stack_index[top] = 2 * index;
+            stack_level[top++] = depth + 1;
+            continue;
+         }
+         if ( fit == 0 ) status = 1;
+      }
+      if ( ci->pieces == capacity ) {
+         capacity = (capacity == 0) ? 16 : 2 * capacity;
+         if ( Grow( ci, &level, capacity ) < 0 ) {
+            free( level );
+            Chebyshev_Interpolant_Free( ci );
+            return -2;
+         }
+      }
+      i = ci->pieces++;
+      half_width = 0.5 * (right - left);
+      ci->midpoint[i] = left + half_width;
+      ci->inverse_half_width[i] = 1.0 / half_width;
+      for (k = 0; k < NODES; k++)
+         ci->coefficients[i * NODES + k] = (k <= degree) ? c[k] : 0.0;
+      level[i] = depth;
+      if ( degree > ci->degree ) ci->degree = degree;
+      if ( depth > ci->depth ) ci->depth = depth;
+   }
+
+          // Pack the coefficients with a stride of degree + 1 in place. //
+
+   for (i = 0; i < ci->pieces; i++)
+      for (k = 0; k <= ci->degree; k++)
+         ci->coefficients[i * (ci->degree + 1) + k] =
+                                             ci->coefficients[i * NODES + k];
+
+             // Build the table of the piece containing each cell. //
+
+   cells = 1 << ci->depth;
+   ci->piece = (int*) malloc( cells * sizeof(int) );
+   if ( ci->piece == NULL ) {
+      free( level );
+      Chebyshev_Interpolant_Free( ci );
+      return -2;
+   }
+   for (i = 0, j = 0; i < ci->pieces; i++)
+      for (k = 1 << (ci->depth - level[i]); k > 0; k--) ci->piece[j++] = i;
+   ci->cell_scale = (double) cells / width;
+   free( level );
+   return status;
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// double Chebyshev_Interpolant_Evaluate( const Chebyshev_Interpolant *ci,    //
+//                                        double x )                          //
+//                                                                            //
+//  Description:                                                              //
+//     This routine evaluates the piecewise Chebyshev interpolant ci at x.    //
+//     The piece containing x is read from the table ci->piece[] and its      //
+//     series is summed by Clenshaw's recursion in double precision, always   //
+//     for ci->degree steps, so the only branches are those of the loop.      //
+//                                                                            //
+//     If x lies outside [ci->lower, ci->upper], the series of the first or   //
+//     last piece is extrapolated, which quickly loses accuracy.              //
+//                                                                            //
+//  Arguments:                                                                //
+//     const Chebyshev_Interpolant *ci                                        //
+//        An interpolant built by Chebyshev_Interpolant_Init() or             //
+//        Chebyshev_Interpolant_Init_With_Parameters().                       //
+//     double x                                                               //
+//        The argument, ci->lower <= x <= ci->upper.                          //
+//                                                                            //
+//  Return Values:                                                            //
+//     The value of the interpolant at x.                                     //
+//                                                                            //
+//  Example:                                                                  //
+//     Chebyshev_Interpolant ci;                                              //
+//     double x, y;                                                           //
+//                                                                            //
+//     y = Chebyshev_Interpolant_Evaluate( &ci, x );                          //
+////////////////////////////////////////////////////////////////////////////////
+
+double Chebyshev_Interpolant_Evaluate( const Chebyshev_Interpolant *ci,
+                                                                     double x )
+{
+   int cells = 1 << ci->depth;
+   double s = (x - ci->lower) * ci->cell_scale;
+   int j = (s > 0.0) ? ( (s < (double) cells) ? (int) s : cells - 1 ) : 0;
+   int i = ci->piece[j];
+   const double *a = ci->coefficients + i * (ci->degree + 1);
+   double t = (x - ci->midpoint[i]) * ci->inverse_half_width[i];
+   double two_t = t + t;
+   double yp2 = 0.0;
+   double yp1 = 0.0;
+   double y = 0.0;
+   int k;
+
+   for (k = ci->degree; k >= 1; k--, yp2 = yp1, yp1 = y)
+      y = two_t * yp1 - yp2 + a[k];
+   return t * yp1 - yp2 + a[0];
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// void Chebyshev_Interpolant_Evaluate_Array(                                 //
+//          const Chebyshev_Interpolant *ci, double x[], double y[], int n )  //
+//                                                                            //
+//  Description:                                                              //
+//     This routine sets y[i] to Chebyshev_Interpolant_Evaluate(ci, x[i]) for //
+//     i = 0, ..., n-1.  The arguments are processed in blocks of 64: the     //
+//     pieces and the reduced arguments of a block are found first and then   //
+//     each step of Clenshaw's recursion is applied to the whole block, so    //
+//     that the inner loop has no branches and a fixed trip count and can be  //
+//     vectorized by the compiler.  x and y may be the same array.            //
+//                                                                            //
+//  Arguments:                                                                //
+//     const Chebyshev_Interpolant *ci                                        //
+//        An interpolant built by Chebyshev_Interpolant_Init() or             //
+//        Chebyshev_Interpolant_Init_With_Parameters().                       //
+//     double x[]                                                             //
+//        The arguments.                                                      //
+//     double y[]                                                             //
+//        The values of the interpolant at x[i], i = 0, ..., n-1.             //
+//     int n                                                                  //
+//        The number of arguments.                                            //
+//                                                                            //
+//  Return Values:                                                            //
+//     void                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     #define N 1000                                                         //
+//     Chebyshev_Interpolant ci;                                              //
+//     double x[N], y[N];                                                     //
+//                                                                            //
+//     Chebyshev_Interpolant_Evaluate_Array( &ci, x, y, N );                  //
+////////////////////////////////////////////////////////////////////////////////
+
+void Chebyshev_Interpolant_Evaluate_Array( const Chebyshev_Interpolant *ci,
+                                               double x[], double y[], int n )
+{
+   int offset[BLOCK];
+   double t[BLOCK], yp1[BLOCK], yp2[BLOCK];
+   int cells = 1 << ci->depth;
+   int stride = ci->degree + 1;
+   const double *a = ci->coefficients;
+   double s, yk;
+   int start, m, i, j, k;
+
+   for (start = 0; start < n; start += BLOCK) {
+      m = (n - start < BLOCK) ? n - start : BLOCK;
+
+                // Locate the piece and the reduced argument. //
+
+      for (j = 0; j < m; j++) {
+         s = (x[start + j] - ci->lower) * ci->cell_scale;
+         i = (s > 0.0) ? ( (s < (double) cells) ? (int) s : cells - 1 ) : 0;
+         i = ci->piece[i];
+         offset[j] = i * stride;
+         t[j] = (x[start + j] - ci->midpoint[i]) * ci->inverse_half_width[i];
+         yp1[j] = 0.0;
+         yp2[j] = 0.0;
+      }
+
+           // Apply each step of Clenshaw's recursion to the block. //
+
+      for (k = ci->degree; k >= 1; k--)
+         for (j = 0; j < m; j++) {
+            yk = 2.0 * t[j] * yp1[j] - yp2[j] + a[offset[j] + k];
+            yp2[j] = yp1[j];
+            yp1[j] = yk;
+         }
+      for (j = 0; j < m; j++)
+         y[start + j] = t[j] * yp1[j] - yp2[j] + a[offset[j]];
+   }
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// void Chebyshev_Interpolant_Free( Chebyshev_Interpolant *ci )               //
+//                                                                            //
+//  Description:                                                              //
+//     This routine releases the storage of an interpolant built by           //
+//     Chebyshev_Interpolant_Init() or                                        //
+//     Chebyshev_Interpolant_Init_With_Parameters() and leaves it empty.      //
+//                                                                            //
+//  Arguments:                                                                //
+//     Chebyshev_Interpolant *ci                                              //
+//        The interpolant to release.                                         //
+//                                                                            //
+//  Return Values:                                                            //
+//     void                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     Chebyshev_Interpolant ci;                                              //
+//                                                                            //
+//     Chebyshev_Interpolant_Free( &ci );                                     //
+////////////////////////////////////////////////////////////////////////////////
+
+void Chebyshev_Interpolant_Free( Chebyshev_Interpolant *ci )
+{
+   free( ci->piece );
+   free( ci->midpoint );
+   free( ci->inverse_half_width );
+   free( ci->coefficients );
+   ci->piece = NULL;
+   ci->midpoint = NULL;
+   ci->inverse_half_width = NULL;
+   ci->coefficients = NULL;
+   ci->pieces = 0;
+   ci->degree = 0;
+   ci->depth = 0;
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// static double Plain_Function( double x, void *parameters )                 //
+//                                                                            //
+//  Description:                                                              //
+//     Call the function of one argument whose address is held in the         //
+//     Plain_Function_Pointer parameters.                                     //
+//                                                                            //
+//  Arguments:                                                                //
+//     double x                                                               //
+//        The argument.                                                       //
+//     void *parameters                                                       //
+//        A pointer to a Plain_Function_Pointer.                              //
+//                                                                            //
+//  Return Values:                                                            //
+//     The value of the function at x.                                        //
+////////////////////////////////////////////////////////////////////////////////
+
+static double Plain_Function( double x, void *parameters )
+{
+   return ((Plain_Function_Pointer*) parameters)->f(x);
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// static int Fit_Piece( double (*f)(double, void*), void *parameters,        //
+//                       double left, double right, double tolerance,         //
+//                       double c[], const double cosine[], int *degree )     //
+//                                                                            //
+//  Description:                                                              //
+//     Find the coefficients c[0], ..., c[NODES-1] of the Chebyshev series    //
+//     interpolating f at the NODES Chebyshev nodes of [left, right], and the //
+//     degree of the shortest truncation whose dropped coefficients sum in    //
+//     magnitude to at most tolerance times the smallest |f| sampled, or the  //
+//     largest if f changes sign, but not less than 2 TAIL DBL_EPSILON times  //
+//     the largest.                                                           //
+//                                                                            //
+//  Arguments:                                                                //
+//     double (*f)(double, void*)                                             //
+//        The function to be approximated.                                    //
+//     void *parameters                                                       //
+//        The second argument passed to f.                                    //
+//     double left                                                            //
+//        The left endpoint of the piece.                                     //
+//     double right                                                           //
+//        The right endpoint of the piece.                                    //
+//     double tolerance                                                       //
+//        The relative accuracy required.                                     //
+//     double c[]                                                             //
+//        The NODES coefficients of the series.                               //
+//     const double cosine[]                                                  //
+//        cosine[m] = cos(m pi / (2 NODES)), m = 0, ..., 4 NODES - 1.         //
+//     int *degree                                                            //
+//        The degree of the truncated series.                                 //
+//                                                                            //
+//  Return Values:                                                            //
+//     1 if the last TAIL coefficients are negligible and the largest |f|     //
+//     sampled is at most MAX_RANGE times the smallest, 2 if the coefficients //
+//     are negligible but the range is larger and 0 if they are not           //
+//     negligible.                                                            //
+////////////////////////////////////////////////////////////////////////////////
+
+static int Fit_Piece( double (*f)(double, void*), void *parameters,
+                  double left, double right, double tolerance, double c[],
+                                           const double cosine[], int *degree )
+{
+   double value[NODES];
+   double midpoint = 0.5 * (left + right);
+   double half_width = 0.5 * (right - left);
+   double largest = 0.0;
+   double smallest = DBL_MAX;
+   double sum;
+   int j, k;
+
+              // Sample f at the Chebyshev nodes cos((2j+1) pi / 2N). //
+
+   for (j = 0; j < NODES; j++) {
+      value[j] = f( midpoint + half_width * cosine[2 * j + 1], parameters );
+      if ( fabs(value[j]) > largest ) largest = fabs(value[j]);
+      if ( fabs(value[j]) < smallest ) smallest = fabs(value[j]);
+   }
+
+                     // Discrete cosine transform. //
+
+   for (k = 0; k < NODES; k++) {
+      sum = 0.0;
+      for (j = 0; j < NODES; j++)
+         sum += value[j] * cosine[ (k * (2 * j + 1)) % (4 * NODES) ];
+      c[k] = sum * (2.0 / NODES);
+   }
+   c[0] *= 0.5;
+
+        // Measure the error relative to the smallest |f| unless f  //
+        // changes sign on the piece, but not below the level of the //
+        // rounding errors in the coefficients.                      //
+
+   for (j = 1; j < NODES; j++)
+      if ( value[j] * value[0] <= 0.0 ) { smallest = largest; break; }
+   tolerance *= smallest;
+   if ( tolerance < 2.0 * TAIL * DBL_EPSILON * largest )
+      tolerance = 2.0 * TAIL * DBL_EPSILON * largest;
+
+            // Truncate the series and test the tail. //
+
+   sum = 0.0;
+   for (k = NODES - 1; k > 0; k--) {
+      if ( !(sum + fabs(c[k]) <= tolerance) ) break;
+      sum += fabs(c[k]);
+   }
+   *degree = k;
+   if ( k >= NODES - TAIL ) return 0;
+   return ( largest <= MAX_RANGE * smallest ) ? 1 : 2;
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// static int Grow( Chebyshev_Interpolant *ci, int **level, int capacity )    //
+//                                                                            //
+//  Description:                                                              //
+//     Reallocate the arrays of pieces of ci under construction, and the      //
+//     array of their depths, to hold capacity pieces.                        //
+//                                                                            //
+//  Arguments:                                                                //
+//     Chebyshev_Interpolant *ci                                              //
+//        The interpolant under construction.                                 //
+//     int **level                                                            //
+//        The address of the array of depths.                                 //
+//     int capacity                                                           //
+//        The number of pieces to be held.                                    //
+//                                                                            //
+//  Return Values:                                                            //
+//     0 on success, -2 if memory could not be allocated.  The arrays are     //
+//     unchanged on failure.                                                  //
+////////////////////////////////////////////////////////////////////////////////
+
+static int Grow( Chebyshev_Interpolant *ci, int **level, int capacity )
+{
+   double *p;
+   int *q;
+
+   p = (double*) realloc( ci->midpoint, capacity * sizeof(double) );
+   if ( p == NULL ) return -2;
+   ci->midpoint = p;
+   p = (double*) realloc( ci->inverse_half_width, capacity * sizeof(double) );
+   if ( p == NULL ) return -2;
+   ci->inverse_half_width = p;
+   p = (double*) realloc( ci->coefficients, capacity * NODES * sizeof(double) );
+   if ( p == NULL ) return -2;
+   ci->coefficients = p;
+   q = (int*) realloc( *level, capacity * sizeof(int) );
+   if ( q == NULL ) return -2;
+   *level = q;
+   return 0;
+}
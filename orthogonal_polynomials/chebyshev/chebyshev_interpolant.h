@@ -0,0 +1,51 @@
+////////////////////////////////////////////////////////////////////////////////
+// File: chebyshev_interpolant.h                                              //
+// Type(s):                                                                   //
+//    Chebyshev_Interpolant                                                   //
+////////////////////////////////////////////////////////////////////////////////
+#ifndef CHEBYSHEV_INTERPOLANT_H
+#define CHEBYSHEV_INTERPOLANT_H
+
+////////////////////////////////////////////////////////////////////////////////
+// Chebyshev_Interpolant                                                      //
+//                                                                            //
+//  Description:                                                              //
+//     A piecewise Chebyshev interpolant of a function f on an interval       //
+//     [lower, upper], built once by Chebyshev_Interpolant_Init() or          //
+//     Chebyshev_Interpolant_Init_With_Parameters() and evaluated by          //
+//     Chebyshev_Interpolant_Evaluate() and                                   //
+//     Chebyshev_Interpolant_Evaluate_Array().  The storage is allocated by   //
+//     the builder and released by Chebyshev_Interpolant_Free().              //
+//                                                                            //
+//     The interval is split by repeated bisection into pieces, each of       //
+//     length (upper - lower) / 2^d for some depth d <= depth.  On piece i,   //
+//     f(x) is approximated by                                                //
+//          c[0] + c[1] T[1](t) + ... + c[degree] T[degree](t),               //
+//     where t = (x - midpoint[i]) * inverse_half_width[i] and c[] =          //
+//     coefficients + i * (degree + 1).  Pieces which need fewer terms than   //
+//     degree are padded with zeros so that every piece is evaluated by the   //
+//     same number of steps of Clenshaw's recursion.                          //
+//                                                                            //
+//     piece[] has 2^depth entries, one for each cell of width                //
+//     (upper - lower) / 2^depth, and piece[j] is the index of the piece      //
+//     containing cell j, so that the piece containing x is found without a   //
+//     search as piece[(int)((x - lower) * cell_scale)].                      //
+////////////////////////////////////////////////////////////////////////////////
+
+#define CHEBYSHEV_INTERPOLANT_MAX_DEGREE 31
+#define CHEBYSHEV_INTERPOLANT_MAX_DEPTH  12
+
+typedef struct {
+   double lower;
+   double upper;
+   double cell_scale;
+   int degree;
+   int depth;
+   int pieces;
+   int *piece;
+   double *midpoint;
+   double *inverse_half_width;
+   double *coefficients;
+} Chebyshev_Interpolant;
+
+#endif
@@ -2,7 +2,11 @@
 // File: chebyshev_tn_series.c                                                //
 // Routine(s):                                                                //
 //    Chebyshev_tn_Series                                                     //
+//    Chebyshev_tn_Series_Array                                               //
 ////////////////////////////////////////////////////////////////////////////////
+
+#define BLOCK 64
+
 #define Clenshaw_Chebyshev_Step(a, tn1, g, tn2, kp1, c) \
                      ((( a * tn1 ) / kp1  - ( g * tn2 ) / ( kp1 + 1.0L ) )+ c )
 ////////////////////////////////////////////////////////////////////////////////
@@ -80,3 +84,96 @@ double Chebyshev_tn_Series(double x, int N, double c[], int degree)
    }
    return (double) y; 
 }
+
+
+////////////////////////////////////////////////////////////////////////////////
+// void Chebyshev_tn_Series_Array(double x[], double y[], int n, int N,       //
+//                                 double c[], int degree)                    //
+//                                                                            //
+//  Description:                                                              //
+//     This routine evaluates the polynomial p(x) of Chebyshev_tn_Series() at //
+//     each of the n points x[0], ..., x[n-1], setting y[i] = p(x[i]).  The   //
+//     points are processed in blocks of 64.  Each step of Clenshaw's         //
+//     recursion is applied to the whole block, and since its coefficients    //
+//     depend only on k they are computed once per step rather than once per  //
+//     point.  The loop over the points of a block carries no dependence from //
+//     one point to the next, so it can be vectorized by the compiler.        //
+//                                                                            //
+//     The recursion is carried out in double precision, so that the block    //
+//     fits the vector registers, and the results may differ from those of    //
+//     Chebyshev_tn_Series() by rounding errors of the order of DBL_EPSILON   //
+//     times the largest term of the recursion.                               //
+//                                                                            //
+//  Arguments:                                                                //
+//     double x[]                                                             //
+//        The points at which to evaluate the polynomial p(x).                //
+//     double y[]                                                             //
+//        The values y[i] = p(x[i]), i = 0, ..., n-1.  y may be the same      //
+//        array as x.                                                         //
+//     int    n                                                               //
+//        The number of points.                                               //
+//     int    N                                                               //
+//        The number of support points, degree < N.                           //
+//     double c[]                                                             //
+//        The coefficients of the expansion, i.e. c[k] is the coefficient of  //
+//        t[k](x).  c must be defined double c[L] where L >= degree + 1.      //
+//     int    degree                                                          //
+//        The degree of the polynomial p(x).  If degree > N - 1, degree is    //
+//        reset internally to N - 1.                                          //
+//                                                                            //
+//  Return Value:                                                             //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     #define N_POINTS 1000                                                  //
+//     double x[N_POINTS], y[N_POINTS], c[L];                                 //
+//     int    N;                                                              //
+//     int    deg = L - 1;                                                    //
+//                                                                            //
+//     ( code to initialize x[i] and c[i] )                                   //
+//                                                                            //
+//     Chebyshev_tn_Series_Array(x, y, N_POINTS, N, c, deg);                  //
+////////////////////////////////////////////////////////////////////////////////
+
+void Chebyshev_tn_Series_Array(double x[], double y[], int n, int N, double c[],
+                                                                    int degree)
+{
+   double xx[BLOCK], yp1[BLOCK], yp2[BLOCK];
+   double N2 = (double) N * (double) N;
+   double alpha, gamma, kp1;
+   double ak, yk;
+   int start, m, j, k;
+
+   if ( degree > N - 1 ) degree = N - 1;
+
+             // Check that degree >= 0.  If not, then return 0. //
+
+   if ( degree < 0 ) {
+      for (j = 0; j < n; j++) y[j] = 0.0;
+      return;
+   }
+
+   for (start = 0; start < n; start += BLOCK) {
+      m = (n - start < BLOCK) ? n - start : BLOCK;
+      for (j = 0; j < m; j++) {
+         xx[j] = x[start + j] + x[start + j] - (double) (N - 1);
+         yp1[j] = 0.0;
+         yp2[j] = 0.0;
+      }
+
+           // Apply each step of Clenshaw's recursion to the block. //
+
+      for (k = degree; k >= 0; k--) {
+         kp1 = (double) (k + 1);
+         alpha = (double) (k + k + 1) / kp1;
+         gamma = kp1 * (N2 - kp1 * kp1) / (kp1 + 1.0);
+         ak = c[k];
+         for (j = 0; j < m; j++) {
+            yk = alpha * xx[j] * yp1[j] - gamma * yp2[j] + ak;
+            yp2[j] = yp1[j];
+            yp1[j] = yk;
+         }
+      }
+      for (j = 0; j < m; j++) y[start + j] = yp1[j];
+   }
+}
@@ -2,8 +2,11 @@
 // File: jacobi_Pn_series.c                                                   //
 // Routine(s):                                                                //
 //    Jacobi_Pn_Series                                                        //
+//    Jacobi_Pn_Series_Array                                                  //
 ////////////////////////////////////////////////////////////////////////////////
 
+#define BLOCK 64
+
 #define Clenshaw_Jacobi_Step(b, pn1, c, pn2, a) (b * pn1 - c * pn2 + a)
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -127,3 +130,113 @@ double Jacobi_Pn_Series(double x, double alpha, double beta, double a[],
    }
    return y; 
 }
+
+
+////////////////////////////////////////////////////////////////////////////////
+// void Jacobi_Pn_Series_Array(double x[], double y[], int n, double alpha,   //
+//                              double beta, double a[], int degree)          //
+//                                                                            //
+//  Description:                                                              //
+//     This routine evaluates the polynomial p(x) of Jacobi_Pn_Series() at    //
+//     each of the n points x[0], ..., x[n-1], setting y[i] = p(x[i]).  The   //
+//     points are processed in blocks of 64.  Each step of Clenshaw's         //
+//     recursion is applied to the whole block, and since its coefficients    //
+//     depend only on k they are computed once per step rather than once per  //
+//     point.  The loop over the points of a block carries no dependence from //
+//     one point to the next, so it can be vectorized by the compiler.        //
+//                                                                            //
+//     The recursion is carried out in double precision, so that the block    //
+//     fits the vector registers, and the results may differ from those of    //
+//     Jacobi_Pn_Series() by rounding errors of the order of DBL_EPSILON      //
+//     times the largest term of the recursion.                               //
+//                                                                            //
+//  Arguments:                                                                //
+//     double x[]                                                             //
+//        The points at which to evaluate the polynomial p(x).                //
+//     double y[]                                                             //
+//        The values y[i] = p(x[i]), i = 0, ..., n-1.  y may be the same      //
+//        array as x.                                                         //
+//     int    n                                                               //
+//        The number of points.                                               //
+//     double alpha                                                           //
+//        The first parameter of the Jacobi polynomials, alpha > -1.          //
+//     double beta                                                            //
+//        The second parameter of the Jacobi polynomials, beta > -1.          //
+//     double a[]                                                             //
+//        The coefficients of the expansion, i.e. a[k] is the coefficient of  //
+//        P[k](x).  a must be defined double a[L] where L >= degree + 1.      //
+//     int    degree                                                          //
+//        The degree of the polynomial p(x).                                  //
+//                                                                            //
+//  Return Value:                                                             //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     #define N 1000                                                         //
+//     double x[N], y[N], a[L], alpha, beta;                                  //
+//     int    deg = L - 1;                                                    //
+//                                                                            //
+//     ( code to initialize x[i] and a[i] )                                   //
+//                                                                            //
+//     Jacobi_Pn_Series_Array(x, y, N, alpha, beta, a, deg);                  //
+////////////////////////////////////////////////////////////////////////////////
+
+void Jacobi_Pn_Series_Array(double x[], double y[], int n, double alpha,
+                                           double beta, double a[], int degree)
+{
+   double xx[BLOCK], yp1[BLOCK], yp2[BLOCK];
+   double gamma = alpha + beta;
+   double a2mb2 = (alpha - beta) * gamma;
+   double b1, b0, c, d;
+   double ak, yk;
+   int start, m, j, k;
+
+             // Check that degree >= 0.  If not, then return 0. //
+
+   if ( degree < 0 ) {
+      for (j = 0; j < n; j++) y[j] = 0.0;
+      return;
+   }
+
+   for (start = 0; start < n; start += BLOCK) {
+      m = (n - start < BLOCK) ? n - start : BLOCK;
+      for (j = 0; j < m; j++) {
+         xx[j] = x[start + j];
+         yp1[j] = 0.0;
+         yp2[j] = 0.0;
+      }
+
+           // Apply each step of Clenshaw's recursion to the block. //
+
+      for (k = degree; k >= 0; k--) {
+         if ( gamma == 0.0 && k == 0 ) {
+            b1 = 1.0;
+            b0 = 0.5 * (alpha - beta);
+            c = 0.5 * (alpha + 1.0) * (beta + 1.0);
+         }
+         else if ( gamma == -1.0 && k == 0 ) {
+            b1 = 0.5;
+            b0 = 0.5 * (alpha - beta);
+            c = 1.5 * (alpha + 1.0) * (beta + 1.0);
+         }
+         else {
+            d = 2.0 * (double) (k + 1) * ((double) (k + 1) + gamma);
+            b1 = ((double) (k + k + 1) + gamma) * ((double) (k + k + 2) + gamma)
+                                                                          / d;
+            b0 = ((double) (k + k + 1) + gamma) * a2mb2
+                                          / ( ((double) (k + k) + gamma) * d );
+            c = ((double) (k + 1) + alpha) * ((double) (k + 1) + beta)
+                                              * ((double) (k + k + 4) + gamma);
+            c /= (double) (k + 2) * ((double) (k + 2) + gamma)
+                                              * ((double) (k + k + 2) + gamma);
+         }
+         ak = a[k];
+         for (j = 0; j < m; j++) {
+            yk = (b1 * xx[j] + b0) * yp1[j] - c * yp2[j] + ak;
+            yp2[j] = yp1[j];
+            yp1[j] = yk;
+         }
+      }
+      for (j = 0; j < m; j++) y[start + j] = yp1[j];
+   }
+}
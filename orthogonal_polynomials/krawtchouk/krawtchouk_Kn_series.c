@@ -2,7 +2,11 @@
 // File: krawtchouk_Kn_series.c                                               //
 // Routine(s):                                                                //
 //    Krawtchouk_Kn_Series                                                    //
+//    Krawtchouk_Kn_Series_Array                                              //
 ////////////////////////////////////////////////////////////////////////////////
+
+#define BLOCK 64
+
 ////////////////////////////////////////////////////////////////////////////////
 //  Description:                                                              //
 //     These routines uses Clenshaw's recursion formula to evaluate a given   //
@@ -96,3 +100,98 @@ double Krawtchouk_Kn_Series(double x, double p, int N, double c[], int degree)
    }
    return (double) y; 
 }
+
+
+////////////////////////////////////////////////////////////////////////////////
+// void Krawtchouk_Kn_Series_Array(double x[], double y[], int n, double p,   //
+//                                  int N, double c[], int degree)            //
+//                                                                            //
+//  Description:                                                              //
+//     This routine evaluates the polynomial p(x) of Krawtchouk_Kn_Series()   //
+//     at each of the n points x[0], ..., x[n-1], setting y[i] = p(x[i]).     //
+//     The points are processed in blocks of 64.  Each step of Clenshaw's     //
+//     recursion is applied to the whole block, and since its coefficients    //
+//     depend only on k they are computed once per step rather than once per  //
+//     point.  The loop over the points of a block carries no dependence from //
+//     one point to the next, so it can be vectorized by the compiler.        //
+//                                                                            //
+//     The recursion is carried out in double precision, so that the block    //
+//     fits the vector registers, and the results may differ from those of    //
+//     Krawtchouk_Kn_Series() by rounding errors of the order of DBL_EPSILON  //
+//     times the largest term of the recursion.                               //
+//                                                                            //
+//  Arguments:                                                                //
+//     double x[]                                                             //
+//        The points at which to evaluate the polynomial p(x).                //
+//     double y[]                                                             //
+//        The values y[i] = p(x[i]), i = 0, ..., n-1.  y may be the same      //
+//        array as x.                                                         //
+//     int    n                                                               //
+//        The number of points.                                               //
+//     double p                                                               //
+//        A parameter of the Krawtchouk polynomials, 0 < p < 1.               //
+//     int    N                                                               //
+//        N + 1 is the number of support points, degree <= N.                 //
+//     double c[]                                                             //
+//        The coefficients of the expansion, i.e. c[k] is the coefficient of  //
+//        K[k](x).  c must be defined double c[L] where L >= degree + 1.      //
+//     int    degree                                                          //
+//        The degree of the polynomial p(x).  If degree > N, degree is reset  //
+//        internally to N.                                                    //
+//                                                                            //
+//  Return Value:                                                             //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     #define N_POINTS 1000                                                  //
+//     double x[N_POINTS], y[N_POINTS], c[L], p;                              //
+//     int    N;                                                              //
+//     int    deg = L - 1;                                                    //
+//                                                                            //
+//     ( code to initialize x[i] and c[i] )                                   //
+//                                                                            //
+//     Krawtchouk_Kn_Series_Array(x, y, N_POINTS, p, N, c, deg);              //
+////////////////////////////////////////////////////////////////////////////////
+
+void Krawtchouk_Kn_Series_Array(double x[], double y[], int n, double p, int N,
+                                                        double c[], int degree)
+{
+   double xx[BLOCK], yp1[BLOCK], yp2[BLOCK];
+   double pq = p * (1.0 - p);
+   double shift, beta, gamma;
+   double ak, yk;
+   int start, m, j, k;
+
+   if ( degree > N ) degree = N;
+
+             // Check that degree >= 0.  If not, then return 0. //
+
+   if ( degree < 0 ) {
+      for (j = 0; j < n; j++) y[j] = 0.0;
+      return;
+   }
+
+   for (start = 0; start < n; start += BLOCK) {
+      m = (n - start < BLOCK) ? n - start : BLOCK;
+      for (j = 0; j < m; j++) {
+         xx[j] = x[start + j];
+         yp1[j] = 0.0;
+         yp2[j] = 0.0;
+      }
+
+           // Apply each step of Clenshaw's recursion to the block. //
+
+      for (k = degree; k >= 0; k--) {
+         shift = (double) k + p * (double) (N - k - k);
+         beta = 1.0 / (double) (k + 1);
+         gamma = (double) (N - k) * pq / (double) (k + 2);
+         ak = c[k];
+         for (j = 0; j < m; j++) {
+            yk = (xx[j] - shift) * beta * yp1[j] - gamma * yp2[j] + ak;
+            yp2[j] = yp1[j];
+            yp1[j] = yk;
+         }
+      }
+      for (j = 0; j < m; j++) y[start + j] = yp1[j];
+   }
+}
@@ -2,7 +2,11 @@
 // File: laguerre_Ln_series.c                                                 //
 // Routine(s):                                                                //
 //    Laguerre_Ln_Series                                                      //
+//    Laguerre_Ln_Series_Array                                                //
 ////////////////////////////////////////////////////////////////////////////////
+
+#define BLOCK 64
+
 #define Clenshaw_Laguerre_Step(alpha, ln1, kp1, kp2, ln2, a) \
                               ( (alpha * ln1) / kp1 - (kp1 * ln2) / kp2 + a )
 ////////////////////////////////////////////////////////////////////////////////
@@ -67,3 +71,89 @@ double Laguerre_Ln_Series(double x, double a[], int degree)
 
    return (double) y; 
 }
+
+
+////////////////////////////////////////////////////////////////////////////////
+// void Laguerre_Ln_Series_Array(double x[], double y[], int n, double a[],   //
+//                                int degree)                                 //
+//                                                                            //
+//  Description:                                                              //
+//     This routine evaluates the polynomial p(x) of Laguerre_Ln_Series() at  //
+//     each of the n points x[0], ..., x[n-1], setting y[i] = p(x[i]).  The   //
+//     points are processed in blocks of 64.  Each step of Clenshaw's         //
+//     recursion is applied to the whole block, and since its coefficients    //
+//     depend only on k they are computed once per step rather than once per  //
+//     point.  The loop over the points of a block carries no dependence from //
+//     one point to the next, so it can be vectorized by the compiler.        //
+//                                                                            //
+//     The recursion is carried out in double precision, so that the block    //
+//     fits the vector registers, and the results may differ from those of    //
+//     Laguerre_Ln_Series() by rounding errors of the order of DBL_EPSILON    //
+//     times the largest term of the recursion.                               //
+//                                                                            //
+//  Arguments:                                                                //
+//     double x[]                                                             //
+//        The points at which to evaluate the polynomial p(x).                //
+//     double y[]                                                             //
+//        The values y[i] = p(x[i]), i = 0, ..., n-1.  y may be the same      //
+//        array as x.                                                         //
+//     int    n                                                               //
+//        The number of points.                                               //
+//     double a[]                                                             //
+//        The coefficients of the expansion, i.e. a[k] is the coefficient of  //
+//        L[k](x).  a must be defined double a[L] where L >= degree + 1.      //
+//     int    degree                                                          //
+//        The degree of the polynomial p(x).                                  //
+//                                                                            //
+//  Return Value:                                                             //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     #define N 1000                                                         //
+//     double x[N], y[N], a[L];                                               //
+//     int    deg = L - 1;                                                    //
+//                                                                            //
+//     ( code to initialize x[i] and a[i] )                                   //
+//                                                                            //
+//     Laguerre_Ln_Series_Array(x, y, N, a, deg);                             //
+////////////////////////////////////////////////////////////////////////////////
+
+void Laguerre_Ln_Series_Array(double x[], double y[], int n, double a[],
+                                                                    int degree)
+{
+   double xx[BLOCK], yp1[BLOCK], yp2[BLOCK];
+   double alpha, beta, gamma;
+   double ak, yk;
+   int start, m, j, k;
+
+             // Check that degree >= 0.  If not, then return 0. //
+
+   if ( degree < 0 ) {
+      for (j = 0; j < n; j++) y[j] = 0.0;
+      return;
+   }
+
+   for (start = 0; start < n; start += BLOCK) {
+      m = (n - start < BLOCK) ? n - start : BLOCK;
+      for (j = 0; j < m; j++) {
+         xx[j] = x[start + j];
+         yp1[j] = 0.0;
+         yp2[j] = 0.0;
+      }
+
+           // Apply each step of Clenshaw's recursion to the block. //
+
+      for (k = degree; k >= 0; k--) {
+         beta = 1.0 / (double) (k + 1);
+         alpha = (double) (k + k + 1) * beta;
+         gamma = (double) (k + 1) / (double) (k + 2);
+         ak = a[k];
+         for (j = 0; j < m; j++) {
+            yk = (alpha - beta * xx[j]) * yp1[j] - gamma * yp2[j] + ak;
+            yp2[j] = yp1[j];
+            yp1[j] = yk;
+         }
+      }
+      for (j = 0; j < m; j++) y[start + j] = yp1[j];
+   }
+}
@@ -3,13 +3,19 @@
 // Routine(s):                                                                //
 //    Legendre_Pn                                                             //
 ////////////////////////////////////////////////////////////////////////////////
-#include <math.h>             // required for fabsl()
+#include <math.h>             // required for fabsl() and fabs()
 #include <float.h>            // required for DBL_MAX
 
 //                        Externally Defined Routines                         //
 
 extern long double xLegendre_Pn(long double x, int n);
 
+#ifdef MATHQ_NATIVE_DOUBLE
+//                        Internally Defined Routines                         //
+
+static double dLegendre_Pn(double x, int n);
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////
 // double Legendre_Pn(double x, int n)                                        //
 //                                                                            //
@@ -35,6 +41,11 @@ extern long double xLegendre_Pn(long double x, int n);
 //     If Pn(x) > DBL_MAX, then DBL_MAX is returned and if Pn(x) < -DBL_MAX   //
 //     then -DBL_MAX is returned (this applies only if |x| > 1).              //
 //                                                                            //
+//     If the library is compiled with MATHQ_NATIVE_DOUBLE defined, then the  //
+//     recursion is carried out in double precision by dLegendre_Pn() rather  //
+//     than in long double precision by xLegendre_Pn().  For |x| <= 1 the     //
+//     absolute error is then at most 2 n DBL_EPSILON.                        //
+//                                                                            //
 //  Example:                                                                  //
 //     double Pn;                                                             //
 //     double x;                                                              //
@@ -46,11 +57,74 @@ extern long double xLegendre_Pn(long double x, int n);
 ////////////////////////////////////////////////////////////////////////////////
 double Legendre_Pn(double x, int n)
 {
+#ifdef MATHQ_NATIVE_DOUBLE
+   if (n < 0) return 0.0;
+   return dLegendre_Pn(x, n);
+#else
    long double Pn;
 
    if (n < 0) return 0.0;
    Pn = xLegendre_Pn((long double)x, n);
    if (fabsl(Pn) < DBL_MAX) return (double) Pn;
    return (Pn > 0.0L) ? DBL_MAX : -DBL_MAX;
+#endif
+}
+
+
+#ifdef MATHQ_NATIVE_DOUBLE
+
+////////////////////////////////////////////////////////////////////////////////
+// static double dLegendre_Pn(double x, int n)                                //
+//                                                                            //
+//  Description:                                                              //
+//     This function calculates Pn(x) in double precision using the same      //
+//     recursion as xLegendre_Pn().  If the recursion overflows, which can    //
+//     only happen if |x| > 1, then DBL_MAX or -DBL_MAX is returned.          //
+//                                                                            //
+//  Arguments:                                                                //
+//     double x                                                               //
+//        The argument of the Legendre polynomial Pn.                         //
+//     int    n                                                               //
+//        The degree of the Legendre polynomial Pn, n >= 0.                   //
+//                                                                            //
+//  Return Value:                                                             //
+//     Pn(x) clamped to [-DBL_MAX, DBL_MAX].                                  //
+//                                                                            //
+//  Example:                                                                  //
+//     double Pn;                                                             //
+//     double x;                                                              //
+//     int    n;                                                              //
+//                                                                            //
+//     (user code to set x and n)                                             //
+//                                                                            //
+//     Pn = dLegendre_Pn(x, n);                                               //
+////////////////////////////////////////////////////////////////////////////////
+static double dLegendre_Pn(double x, int n)
+{
+   double P0, P1, Pn;
+   int k;
+
+   if ( fabs(x) == 1.0 ) {
+      if (x > 0.0) return 1.0;
+      else if (n % 2 == 0) return 1.0;
+      else return -1.0;
+   }
+
+                    // Initialize the recursion process. //
 
+   if (n == 0) return 1.0;
+   if (n == 1) return x;
+   P0 = 1.0;
+   P1 = x;
+
+                             // Calculate Pn(x) //
+
+   for (k = 1; k < n; k++, P0 = P1, P1 = Pn) {
+      Pn = ( (double)( k + k + 1) * x * P1 - (double)k * P0) / (double)(k + 1);
+      if ( !(fabs(Pn) <= DBL_MAX) ) return (Pn > 0.0) ? DBL_MAX : -DBL_MAX;
+   }
+
+   return Pn;
 }
+
+#endif
@@ -5,7 +5,7 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 //                         Externally Defined Routines                        //
-double Beta_Distribution( double x, double a, double b );
+double Regularized_Incomplete_Beta_Complement( double x, double a, double b );
 
 ////////////////////////////////////////////////////////////////////////////////
 // double Binomial_Cumulative_Distribution( int n, int k, double p )          //
@@ -24,6 +24,9 @@ double Beta_Distribution( double x, double a, double b );
 //                  Pr[X = j] = C(n,j) * p^j * (1-p)^(n-j)                    //
 //     for 0 <= j <= n, where C(n,j) = n! / (j! (n-j)!) and Pr[X = j] = 0 if  //
 //     either j < 0 or j > n.                                                 //
+//     Pr[X <= k] is calculated as the complement 1 - I(p,k+1,n-k) of the     //
+//     regularized incomplete beta function, which equals I(1-p,n-k,k+1),     //
+//     so that 1 - p is not rounded before use.                               //
 //                                                                            //
 //  Arguments:                                                                //
 //     int    n   The total number of trials, n >= 1.                         //
@@ -47,5 +50,6 @@ double Binomial_Cumulative_Distribution( int n, int k, double p )
    if ( k >= n ) return 1.0;
    if ( p == 0.0 ) return 1.0;
    if ( p == 1.0 ) return (k < n) ? 0.0 : 1.0;
-   return Beta_Distribution( 1.0 - p, (double)(n-k), (double)(k+1));
+   return Regularized_Incomplete_Beta_Complement( p, (double)(k+1),
+                                                             (double)(n-k) );
 }
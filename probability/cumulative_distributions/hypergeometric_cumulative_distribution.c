@@ -4,64 +4,105 @@
 //    Hypergeometric_Cumulative_Distribution                                  //
 ////////////////////////////////////////////////////////////////////////////////
 
+#include <math.h>                                 // required for expl()
+#include <float.h>                                // required for DBL_EPSILON
+
 //                         Externally Defined Routines                        //
-double Binomial_Coefficient( int n, int m );
+long double xLn_Factorial( int n );
 
 ////////////////////////////////////////////////////////////////////////////////
 // double Hypergeometric_Cumulative_Distribution( int n1, int n2, int n,      //
-//                                                                   int k )  //
+//                                                                    int k ) //
 //                                                                            //
 //  Description:                                                              //
 //     Given n1 objects labeled 1 and n2 objects labeled 0.  The probability  //
-//     by drawing n objects without replacement that k 1's are drawn and      //
-//     n - k 0's are drawn is:                                                //
+//     by drawing n objects without replacement that k 1's are drawn and n -  //
+//     k 0's are drawn is:                                                    //
 //                    C(n1,k) C(n2,n-k) / C(n1 + n2,n)                        //
-//     where C(r,s) = r! / (s! (r-s)!).                                       //
-//     Let X be the number of 1's that are drawn. The distribution of X       //
-//     is called the hypergeometric distribution.                             //
-//     The cumulative distribution function of X is Pr[X <= k],               //
+//     where C(r,s) = r! / (s! (r-s)!).  Let X be the number of 1's that are  //
+//     drawn. The distribution of X is called the hypergeometric              //
+//     distribution.  The cumulative distribution function of X is Pr[X <=    //
+//     k],                                                                    //
 //                        Pr[X <= k] = Sum Pr[X = j]                          //
 //     where the sum is over j = 0,...,k <= n and                             //
 //     Pr[X = j] = C(n1,j) C(n2,n-j) / C(n1 + n2,n) if j <= n1 & n-j <= n2    //
-//               = 0                                elsewhere.                 //
+//               = 0                                elsewhere.                //
+//                                                                            //
+//     Pr[X = k] is calculated from the logarithms of the factorials, see     //
+//     xLn_Factorial(), so that none of the binomial coefficients overflows.  //
+//     The terms Pr[X = j] increase up to the mode m = [(n + 1)(n1 + 1) / (n1 //
+//     + n2 + 2)] and decrease after it, and consecutive terms are related by //
+//     Pr[X = j+1] = Pr[X = j] (n1 - j)(n - j) / ((j + 1)(n2 - n + j + 1)).   //
+//     If k < m, the terms Pr[X = j], j = k, k-1, ..., are summed until they  //
+//     no longer change the sum, otherwise Pr[X <= k] = 1 - Pr[X > k] and the //
+//     terms Pr[X = j], j = k+1, k+2, ..., are summed.  Either way the sum    //
+//     starts at its largest term and runs away from the mode, so that only   //
+//     the terms which contribute are evaluated and the sum is accurate in    //
+//     both tails.  Callers who need the distribution for many k with the     //
+//     same n1, n2 and n should use Hypergeometric_Support_Init() and those   //
+//     who need Fisher's exact test should use Fisher_Exact_Test().           //
 //                                                                            //
 //  Arguments:                                                                //
-//     int    n1  The number of objects labeled 1.                            //
-//     int    n2  The number of objects labeled 0.                            //
-//     int    n   The number of objects drawn without replacement.            //
-//                n <= n1 + n2.                                               //
-//     int    k   The maximum number of 1's drawn, n-k is the minimum number  //
-//                of 0's drawn.                                               //
+//     int    n1                                                              //
+//        The number of objects labeled 1.                                    //
+//     int    n2                                                              //
+//        The number of objects labeled 0.                                    //
+//     int    n                                                               //
+//        The number of objects drawn without replacement. n <= n1 + n2.      //
+//     int    k                                                               //
+//        The maximum number of 1's drawn, n-k is the minimum number of 0's   //
+//        drawn.                                                              //
 //                                                                            //
 //  Return Values:                                                            //
 //     A real number between 0 and 1.                                         //
 //                                                                            //
 //  Example:                                                                  //
-//     double p, pr;                                                          //
+//     double pr;                                                             //
 //     int n1, n2, n, k;                                                      //
 //                                                                            //
 //     pr = Hypergeometric_Cumulative_Distribution(n1, n2, n, k);             //
 ////////////////////////////////////////////////////////////////////////////////
 double Hypergeometric_Cumulative_Distribution( int n1, int n2, int n, int k )
 {
-   double pr = 0.0;
    double summand;
+   double sum;
    int i;
    int k1 = (n <= n2) ? 0 : n - n2;
    int k2 = (n <= n1) ? n : n1;
+   int mode = (int) ( ((double)(n + 1) * (double)(n1 + 1))
+                                                   / (double)(n1 + n2 + 2) );
 
    if ( k < k1 ) return 0.0;
    if ( k >= k2 ) return 1.0;
    if ( k2 < k1 ) return 0.0;
 
-   summand = Binomial_Coefficient(n1,k1) * Binomial_Coefficient(n2,n-k1) 
-                                             / Binomial_Coefficient(n1+n2,n);
-   pr = summand;
-   for (i = k1; i < k; i++) {
+   summand = (double) expl( xLn_Factorial(n1) - xLn_Factorial(k)
+                 - xLn_Factorial(n1 - k) + xLn_Factorial(n2)
+                 - xLn_Factorial(n - k) - xLn_Factorial(n2 - n + k)
+                 - xLn_Factorial(n1 + n2) + xLn_Factorial(n)
+                 + xLn_Factorial(n1 + n2 - n) );
+
+                 // Below the mode sum the lower tail from k downward. //
+
+   if ( k < mode ) {
+      sum = summand;
+      for (i = k; i > k1; i--) {
+         summand *= (double) i * (double)(n2 - n + i)
+                              / ((double)(n1 - i + 1) * (double)(n - i + 1));
+         if ( summand <= DBL_EPSILON * sum ) break;
+         sum += summand;
+      }
+      return sum;
+   }
+
+                 // Otherwise sum the upper tail from k + 1 upward. //
+
+   sum = 0.0;
+   for (i = k; i < k2; i++) {
       summand *= (double)(n1 - i) * (double)(n - i)
                                 / ((double)(i + 1) * (double)(n2 - n + i + 1));
-      pr += summand;
+      if ( summand <= DBL_EPSILON * sum ) break;
+      sum += summand;
    }
-
-   return pr;
+   return ( sum < 1.0 ) ? 1.0 - sum : 0.0;
 }
@@ -5,7 +5,7 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 //                         Externally Defined Routines                        //
-double Gamma_Distribution( double x, double a );
+double Regularized_Incomplete_Gamma_Q( double x, double nu );
 
 ////////////////////////////////////////////////////////////////////////////////
 // double Poisson_Cumulative_Distribution( int k, double mu )                 //
@@ -22,6 +22,10 @@ double Gamma_Distribution( double x, double a );
 //     where the sum is over j = 0,...,k <= n, Pr[X = j] is the point         //
 //     distribution given above, and Gamma_Distribution(mu,k+1) is the area   //
 //     of the gamma distribution with shape parameter k+1 from 0 to mu.       //
+//     1 - Gamma_Distribution(mu,k+1) is calculated directly as the           //
+//     regularized incomplete gamma function Q(k+1,mu), so that the small     //
+//     probabilities for mu much larger than k are not lost to cancellation,  //
+//     at a cost which does not grow with k.                                  //
 //                                                                            //
 //  Arguments:                                                                //
 //     int    k   The maximum number of events.                               //
@@ -41,5 +45,5 @@ double Poisson_Cumulative_Distribution( int k, double mu )
 {
    if ( k < 0) return 0.0;
 
-   return 1.0 - Gamma_Distribution( mu, (double)(k+1) );
+   return Regularized_Incomplete_Gamma_Q( mu, (double)(k+1) );
 }
@@ -2,6 +2,7 @@
 // File: beta_density.c                                                       //
 // Routine(s):                                                                //
 //    Beta_Density                                                            //
+//    Beta_Density_Array                                                      //
 ////////////////////////////////////////////////////////////////////////////////
 
 #include <math.h>                    // required for pow()
@@ -50,3 +51,41 @@ double Beta_Density(double x, double a, double b)
 
    return pow(x, a - 1.0) * pow(1.0 - x, b - 1.0) / Beta_Function(a,b);
 }
+
+
+////////////////////////////////////////////////////////////////////////////////
+// void Beta_Density_Array( double x[], double p[], int n, double a,          //
+//                                                                 double b ) //
+//                                                                            //
+//  Description:                                                              //
+//     This function evaluates the beta density with shape parameters a and b //
+//     at each of the n points x[0],...,x[n-1].  The complete beta function   //
+//     B(a,b) is calculated once rather than for each point.                  //
+//                                                                            //
+//  Arguments:                                                                //
+//     double x[] Array of n arguments of the density.                        //
+//     double p[] Array of n elements, p[i] is set to the beta density        //
+//                evaluated at x[i].  p may be the same array as x.           //
+//     int    n   The number of points.                                       //
+//     double a   A positive shape parameter of the beta density.             //
+//     double b   A positive shape parameter of the beta density.             //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     #define N 100                                                          //
+//     double a, b, p[N], x[N];                                               //
+//                                                                            //
+//     Beta_Density_Array(x, p, N, a, b);                                     //
+////////////////////////////////////////////////////////////////////////////////
+
+void Beta_Density_Array(double x[], double p[], int n, double a, double b)
+{
+   double beta = Beta_Function(a,b);
+   int i;
+
+   for (i = 0; i < n; i++)
+      if ( x[i] <= 0.0 || x[i] >= 1.0 ) p[i] = 0.0;
+      else p[i] = pow(x[i], a - 1.0) * pow(1.0 - x[i], b - 1.0) / beta;
+}
@@ -2,6 +2,7 @@
 // File: chi_square_density.c                                                 //
 // Routine(s):                                                                //
 //    Chi_Square_Density                                                      //
+//    Chi_Square_Density_Array                                                //
 ////////////////////////////////////////////////////////////////////////////////
 
 #include <math.h>                    // required for log() and exp()
@@ -51,3 +52,44 @@ double Chi_Square_Density( double x, int n )
    ln_density = (n2 - 1.0) * log(0.5 * x) - 0.5 * x - Ln_Gamma_Function(n2);
    return 0.5 * exp(ln_density);
 }
+
+
+////////////////////////////////////////////////////////////////////////////////
+// void Chi_Square_Density_Array( double x[], double p[], int size, int n )   //
+//                                                                            //
+//  Description:                                                              //
+//     This function evaluates the Chi-square density with n degrees of       //
+//     freedom at each of the size points x[0],...,x[size-1].  ln Gamma(n/2)  //
+//     is calculated once rather than for each point.                         //
+//                                                                            //
+//  Arguments:                                                                //
+//     double x[]  Array of size arguments of the density.                    //
+//     double p[]  Array of size elements, p[i] is set to the Chi-square      //
+//                 density evaluated at x[i].  p may be the same array as x.  //
+//     int    size The number of points.                                      //
+//     int    n    The number of degrees of freedom.                          //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     #define N 100                                                          //
+//     double p[N], x[N];                                                     //
+//     int    n;                                                              //
+//                                                                            //
+//     Chi_Square_Density_Array(x, p, N, n);                                  //
+////////////////////////////////////////////////////////////////////////////////
+
+void Chi_Square_Density_Array( double x[], double p[], int size, int n )
+{
+   double n2 = 0.5 * (double) n;
+   double ln_gamma = Ln_Gamma_Function(n2);
+   double at_zero = ( n == 1 ) ? DBL_MAX : ( n == 2 ) ? 0.5 : 0.0;
+   int i;
+
+   for (i = 0; i < size; i++)
+      if ( x[i] < 0.0 ) p[i] = 0.0;
+      else if ( x[i] == 0.0 ) p[i] = at_zero;
+      else p[i] = 0.5 * exp( (n2 - 1.0) * log(0.5 * x[i]) - 0.5 * x[i]
+                                                                  - ln_gamma );
+}
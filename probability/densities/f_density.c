@@ -2,6 +2,7 @@
 // File: f_density.c                                                          //
 // Routine(s):                                                                //
 //    F_Density                                                               //
+//    F_Density_Array                                                         //
 ////////////////////////////////////////////////////////////////////////////////
 
 #include <math.h>                    // required for log() and exp()
@@ -53,3 +54,46 @@ double F_Density( double x, int v1, int v2 )
                 - Ln_Beta_Function(v12, v22);
    return exp(ln_density);
 }
+
+
+////////////////////////////////////////////////////////////////////////////////
+// void F_Density_Array( double x[], double p[], int n, int v1, int v2 )      //
+//                                                                            //
+//  Description:                                                              //
+//     This function evaluates the F density with v1 and v2 degrees of        //
+//     freedom at each of the n points x[0],...,x[n-1].  The terms of the     //
+//     logarithm of the density which depend only on v1 and v2, including ln  //
+//     B(v1/2,v2/2), are calculated once.                                     //
+//                                                                            //
+//  Arguments:                                                                //
+//     double x[] Array of n arguments of the density.                        //
+//     double p[] Array of n elements, p[i] is set to the F density evaluated //
+//                at x[i].  p may be the same array as x.                     //
+//     int    n   The number of points.                                       //
+//     int    v1  The number of degrees of freedom of the numerator.          //
+//     int    v2  The number of degrees of freedom of the denominator.        //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     #define N 100                                                          //
+//     double p[N], x[N];                                                     //
+//     int    v1, v2;                                                         //
+//                                                                            //
+//     F_Density_Array(x, p, N, v1, v2);                                      //
+////////////////////////////////////////////////////////////////////////////////
+
+void F_Density_Array( double x[], double p[], int n, int v1, int v2 )
+{
+   double v12 = (double)v1 / 2.0;
+   double v22 = (double)v2 / 2.0;
+   double ln_v = v12*log((double)v1) + v22 * log((double)v2);
+   double ln_beta = Ln_Beta_Function(v12, v22);
+   int i;
+
+   for (i = 0; i < n; i++)
+      if ( x[i] <= 0.0 ) p[i] = 0.0;
+      else p[i] = exp( ln_v + (v12 - 1.0) * log(x[i])
+                       - (v12 + v22) * log((double)v2+v1*x[i]) - ln_beta );
+}
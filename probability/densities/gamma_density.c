@@ -2,6 +2,7 @@
 // File: gamma_density.c                                                      //
 // Routine(s):                                                                //
 //    Gamma_Density                                                           //
+//    Gamma_Density_Array                                                     //
 ////////////////////////////////////////////////////////////////////////////////
 #include <math.h>                     // required for exp(), log(),  pow().
 
@@ -38,3 +39,48 @@ double Gamma_Density(double x, double nu) {
       return pow(x,nu-1.0) * exp(-x) / Gamma_Function(nu);
    else return exp( (nu - 1.0) * log(x) - x - Ln_Gamma_Function(nu) );
 }
+
+
+////////////////////////////////////////////////////////////////////////////////
+// void Gamma_Density_Array( double x[], double g[], int n, double nu )       //
+//                                                                            //
+//  Description:                                                              //
+//     This function evaluates the gamma density with shape parameter nu at   //
+//     each of the n points x[0],...,x[n-1].  Gamma(nu), or ln Gamma(nu) if   //
+//     Gamma(nu) would overflow, is calculated once rather than for each      //
+//     point.                                                                 //
+//                                                                            //
+//  Arguments:                                                                //
+//     double x[] Array of n arguments of the density.                        //
+//     double g[] Array of n elements, g[i] is set to the gamma density       //
+//                evaluated at x[i].  g may be the same array as x.           //
+//     int    n   The number of points.                                       //
+//     double nu  The shape parameter of the gamma density.                   //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     #define N 100                                                          //
+//     double x[N], g[N], nu;                                                 //
+//                                                                            //
+//     Gamma_Density_Array( x, g, N, nu );                                    //
+////////////////////////////////////////////////////////////////////////////////
+
+void Gamma_Density_Array(double x[], double g[], int n, double nu)
+{
+   double gamma;
+   int i;
+
+   if (nu <= Gamma_Function_Max_Arg() ) {
+      gamma = Gamma_Function(nu);
+      for (i = 0; i < n; i++)
+         g[i] = (x[i] <= 0.0) ? 0.0 : pow(x[i],nu-1.0) * exp(-x[i]) / gamma;
+   }
+   else {
+      gamma = Ln_Gamma_Function(nu);
+      for (i = 0; i < n; i++)
+         g[i] = (x[i] <= 0.0) ? 0.0
+                              : exp( (nu - 1.0) * log(x[i]) - x[i] - gamma );
+   }
+}
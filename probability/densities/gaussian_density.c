@@ -2,6 +2,7 @@
 // File: gaussian_density.c                                                   //
 // Routine(s):                                                                //
 //    Gaussian_Density                                                        //
+//    Gaussian_Density_Array                                                  //
 ////////////////////////////////////////////////////////////////////////////////
 
 #include <math.h>              // required for exp(), M_SQRT1_2 and
@@ -33,3 +34,34 @@ double Gaussian_Density( double x )
 {
    return  normalization * exp( - 0.5 * x * x );
 }
+
+
+////////////////////////////////////////////////////////////////////////////////
+// void Gaussian_Density_Array( double x[], double pr[], int n )              //
+//                                                                            //
+//  Description:                                                              //
+//     This function evaluates the standard Gaussian density at each of the n //
+//     points x[0],...,x[n-1].                                                //
+//                                                                            //
+//  Arguments:                                                                //
+//     double x[]  Array of n arguments of the density.                       //
+//     double pr[] Array of n elements, pr[i] is set to the Gaussian density  //
+//                 evaluated at x[i].  pr may be the same array as x.         //
+//     int    n    The number of points.                                      //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     #define N 100                                                          //
+//     double x[N], pr[N];                                                    //
+//                                                                            //
+//     Gaussian_Density_Array(x, pr, N);                                      //
+////////////////////////////////////////////////////////////////////////////////
+
+void Gaussian_Density_Array( double x[], double pr[], int n )
+{
+   int i;
+
+   for (i = 0; i < n; i++) pr[i] = normalization * exp( - 0.5 * x[i] * x[i] );
+}
@@ -2,6 +2,7 @@
 // File: student_t_density.c                                                  //
 // Routine(s):                                                                //
 //    Student_t_Density                                                       //
+//    Student_t_Density_Array                                                 //
 ////////////////////////////////////////////////////////////////////////////////
 
 #include <math.h>                    // required for log() and exp()
@@ -41,3 +42,43 @@ double Student_t_Density( double x, int n )
 
    return exp(ln_density);
 }
+
+
+////////////////////////////////////////////////////////////////////////////////
+// void Student_t_Density_Array( double x[], double p[], int size, int n )    //
+//                                                                            //
+//  Description:                                                              //
+//     This function evaluates the Student-t density with n degrees of        //
+//     freedom at each of the size points x[0],...,x[size-1].  The terms of   //
+//     the logarithm of the density which depend only on n, including ln      //
+//     B(n/2,1/2), are calculated once.                                       //
+//                                                                            //
+//  Arguments:                                                                //
+//     double x[]  Array of size arguments of the density.                    //
+//     double p[]  Array of size elements, p[i] is set to the Student-t       //
+//                 density evaluated at x[i].  p may be the same array as x.  //
+//     int    size The number of points.                                      //
+//     int    n    The number of degrees of freedom.                          //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     #define N 100                                                          //
+//     double p[N], x[N];                                                     //
+//     int    n;                                                              //
+//                                                                            //
+//     Student_t_Density_Array(x, p, N, n);                                   //
+////////////////////////////////////////////////////////////////////////////////
+
+void Student_t_Density_Array( double x[], double p[], int size, int n )
+{
+   double exponent = -(double)(n+1)/2.0;
+   double ln_sqrt_n = 0.5*log((double)n);
+   double ln_beta = Ln_Beta_Function(0.5 * (double)n, 0.5);
+   int i;
+
+   for (i = 0; i < size; i++)
+      p[i] = exp( exponent * log(1.0 + x[i] * x[i] /(double)n)
+                                                       - ln_sqrt_n - ln_beta );
+}
@@ -2,11 +2,13 @@
 // File: chi_square_distribution.c                                            //
 // Routine(s):                                                                //
 //    Chi_Square_Distribution                                                 //
+//    Chi_Square_Distribution_Array                                           //
 ////////////////////////////////////////////////////////////////////////////////
 
 //                         Externally Defined Routines                        //
 
 extern double Gamma_Distribution(double x, double a);
+extern void Gamma_Distribution_Array(double x[], double g[], int n, double nu);
 
 ////////////////////////////////////////////////////////////////////////////////
 // double Chi_Square_Distribution( double x, int n )                          //
@@ -49,3 +51,46 @@ double Chi_Square_Distribution(double x, int n)
 
    return Gamma_Distribution( 0.5 * x, 0.5 * (double) n);
 }
+
+
+////////////////////////////////////////////////////////////////////////////////
+// void Chi_Square_Distribution_Array( double x[], double p[], int size,      //
+//                                                                    int n ) //
+//                                                                            //
+//  Description:                                                              //
+//     This function evaluates the Chi-square distribution with n degrees of  //
+//     freedom at each of the size points x[0],...,x[size-1] using            //
+//     Gamma_Distribution_Array() with shape parameter n/2 evaluated at x/2.  //
+//                                                                            //
+//  Arguments:                                                                //
+//     double x[]  Array of size upper limits of the integral of the density. //
+//     double p[]  Array of size elements, p[i] is set to the Chi-square      //
+//                 distribution evaluated at x[i].  p may be the same array   //
+//                 as x.                                                      //
+//     int    size The number of points.                                      //
+//     int    n    The number of degrees of freedom.                          //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     #define N 100                                                          //
+//     double p[N], x[N];                                                     //
+//     int    n;                                                              //
+//                                                                            //
+//     Chi_Square_Distribution_Array(x, p, N, n);                             //
+////////////////////////////////////////////////////////////////////////////////
+
+#define BLOCK 256
+
+void Chi_Square_Distribution_Array(double x[], double p[], int size, int n)
+{
+   double t[BLOCK];
+   int i, j, m;
+
+   for (j = 0; j < size; j += m) {
+      m = (size - j < BLOCK) ? size - j : BLOCK;
+      for (i = 0; i < m; i++) t[i] = 0.5 * x[j + i];
+      Gamma_Distribution_Array(t, &p[j], m, 0.5 * (double) n);
+   }
+}
@@ -2,10 +2,13 @@
 // File: f_distribution.c                                                     //
 // Routine(s):                                                                //
 //    F_Distribution                                                          //
+//    F_Distribution_Array                                                    //
 ////////////////////////////////////////////////////////////////////////////////
 
 //                         Externally Defined Routines                        //
-extern double Beta_Distribution(double x, double a, double b);
+extern double Regularized_Incomplete_Beta(double x, double a, double b);
+extern void Regularized_Incomplete_Beta_Array(double x[], double p[], int n,
+                                                          double a, double b);
 
 ////////////////////////////////////////////////////////////////////////////////
 // double F_Distribution( double x, int v1, int v2 )                          //
@@ -25,7 +28,8 @@ extern double Beta_Distribution(double x, double a, double b);
 //                                                                            //
 //     By making the change of variables: g = v1*f / (v2 + v1*f),             //
 //                   F(x,v1,v2) = B(v1*x / (v2 + v1*x), v1/2, v2/2),          //
-//     where B(,,) is the incomplete beta function.                           //
+//     where B(,,) is the regularized incomplete beta function, evaluated by  //
+//     Regularized_Incomplete_Beta().                                         //
 //                                                                            //
 //  Arguments:                                                                //
 //     double x   The upper limit of the integral of the density given above. //
@@ -54,5 +58,54 @@ double F_Distribution(double f, int v1, int v2)
 
    if ( f <= 0.0 ) return 0.0;
 
-   return Beta_Distribution( g / (b + g), a, b);
+   return Regularized_Incomplete_Beta( g / (b + g), a, b);
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// void F_Distribution_Array( double f[], double p[], int n, int v1,          //
+//                                                                   int v2 ) //
+//                                                                            //
+//  Description:                                                              //
+//     This function evaluates the F distribution with v1 and v2 degrees of   //
+//     freedom at each of the n points f[0],...,f[n-1].  The points are       //
+//     transformed to v1 f / (v2 + v1 f) a block at a time and passed to      //
+//     Regularized_Incomplete_Beta_Array() so that the part of the prefactor  //
+//     depending only on the shape parameters v1/2 and v2/2 is not            //
+//     recalculated for every point.                                          //
+//                                                                            //
+//  Arguments:                                                                //
+//     double f[] Array of n upper limits of the integral of the density.     //
+//     double p[] Array of n elements, p[i] is set to the F distribution      //
+//                evaluated at f[i].  p may be the same array as f.           //
+//     int    n   The number of points.                                       //
+//     int    v1  The number of degrees of freedom of the numerator.          //
+//     int    v2  The number of degrees of freedom of the denominator.        //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     #define N 100                                                          //
+//     double f[N], p[N];                                                     //
+//     int    v1, v2;                                                         //
+//                                                                            //
+//     F_Distribution_Array(f, p, N, v1, v2);                                 //
+////////////////////////////////////////////////////////////////////////////////
+
+#define BLOCK 256
+
+void F_Distribution_Array(double f[], double p[], int n, int v1, int v2)
+{
+   double a = (double) v1 / 2.0;
+   double b = (double) v2 / 2.0;
+   double g[BLOCK];
+   int i, j, m;
+
+   for (j = 0; j < n; j += m) {
+      m = (n - j < BLOCK) ? n - j : BLOCK;
+      for (i = 0; i < m; i++)
+         g[i] = ( f[j + i] <= 0.0 ) ? 0.0 : a * f[j + i] / (b + a * f[j + i]);
+      Regularized_Incomplete_Beta_Array(g, &p[j], m, a, b);
+   }
 }
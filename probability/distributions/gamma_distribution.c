@@ -2,11 +2,14 @@
 // File: gamma_distribution.c                                                 //
 // Routine(s):                                                                //
 //    Gamma_Distribution                                                      //
+//    Gamma_Distribution_Array                                                //
 ////////////////////////////////////////////////////////////////////////////////
 
 //                         Externally Defined Routines                        //
 
-extern double Entire_Incomplete_Gamma_Function(double x, double nu);
+extern double Regularized_Incomplete_Gamma_P(double x, double nu);
+extern void Regularized_Incomplete_Gamma_P_Array(double x[], double p[], int n,
+                                                                    double nu);
 
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -18,6 +21,10 @@ extern double Entire_Incomplete_Gamma_Function(double x, double nu);
 //     parameter nu > 0. The parameter nu is referred to as the shape         //
 //     parameter.                                                             //
 //                                                                            //
+//     The distribution is the regularized incomplete gamma function          //
+//     P(nu,x), calculated by Regularized_Incomplete_Gamma_P() whose cost     //
+//     does not grow with nu.                                                 //
+//                                                                            //
 //  Arguments:                                                                //
 //     double x   Upper limit of the integral of the density given above.     //
 //     double nu  The shape parameter of the gamma distribution.              //
@@ -32,5 +39,37 @@ extern double Entire_Incomplete_Gamma_Function(double x, double nu);
 
 
 double Gamma_Distribution(double x, double nu) {
-   return  ( x <= 0.0 ) ? 0.0 : Entire_Incomplete_Gamma_Function(x,nu);
+   return  ( x <= 0.0 ) ? 0.0 : Regularized_Incomplete_Gamma_P(x,nu);
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// void Gamma_Distribution_Array( double x[], double g[], int n, double nu )  //
+//                                                                            //
+//  Description:                                                              //
+//     This function evaluates the gamma distribution with shape parameter nu //
+//     at each of the n points x[0],...,x[n-1] using                          //
+//     Regularized_Incomplete_Gamma_P_Array(), which calculates the part of   //
+//     the prefactor depending on nu once rather than once for each point.    //
+//                                                                            //
+//  Arguments:                                                                //
+//     double x[] Array of n upper limits of the integral of the density.     //
+//     double g[] Array of n elements, g[i] is set to the gamma distribution  //
+//                evaluated at x[i].  g may be the same array as x.           //
+//     int    n   The number of points.                                       //
+//     double nu  The shape parameter of the gamma distribution.              //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     #define N 100                                                          //
+//     double x[N], g[N], nu;                                                 //
+//                                                                            //
+//     Gamma_Distribution_Array( x, g, N, nu );                               //
+////////////////////////////////////////////////////////////////////////////////
+
+void Gamma_Distribution_Array(double x[], double g[], int n, double nu)
+{
+   Regularized_Incomplete_Gamma_P_Array(x, g, n, nu);
 }
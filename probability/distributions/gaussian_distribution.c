@@ -2,6 +2,7 @@
 // File: gaussian_distribution.c                                              //
 // Routine(s):                                                                //
 //    Gaussian_Distribution                                                   //
+//    Gaussian_Distribution_Array                                             //
 ////////////////////////////////////////////////////////////////////////////////
 
 #include <math.h>              // required for erf() and M_SQRT1_2
@@ -30,3 +31,36 @@ double Gaussian_Distribution( double x )
 {
    return  0.5 * ( 1.0 + erf( M_SQRT1_2 * x ) );
 }
+
+
+////////////////////////////////////////////////////////////////////////////////
+// void Gaussian_Distribution_Array( double x[], double p[], int n )          //
+//                                                                            //
+//  Description:                                                              //
+//     This function evaluates the standard Gaussian distribution at each of  //
+//     the n points x[0],...,x[n-1].  The result is the same as that of       //
+//     calling Gaussian_Distribution() for each point.                        //
+//                                                                            //
+//  Arguments:                                                                //
+//     double x[] Array of n upper limits of the integral of the density.     //
+//     double p[] Array of n elements, p[i] is set to the Gaussian            //
+//                distribution evaluated at x[i].  p may be the same array as //
+//                x.                                                          //
+//     int    n   The number of points.                                       //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     #define N 100                                                          //
+//     double p[N], x[N];                                                     //
+//                                                                            //
+//     Gaussian_Distribution_Array(x, p, N);                                  //
+////////////////////////////////////////////////////////////////////////////////
+
+void Gaussian_Distribution_Array( double x[], double p[], int n )
+{
+   int i;
+
+   for (i = 0; i < n; i++) p[i] = 0.5 * ( 1.0 + erf( M_SQRT1_2 * x[i] ) );
+}
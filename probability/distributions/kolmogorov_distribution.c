@@ -0,0 +1,488 @@
+////////////////////////////////////////////////////////////////////////////////
+// File: kolmogorov_distribution.c                                            //
+// Routine(s):                                                                //
+//    Kolmogorov_Distribution                                                 //
+//    Kolmogorov_Distribution_Complement                                      //
+////////////////////////////////////////////////////////////////////////////////
+
+#include <stdlib.h>                         // required for malloc(), free()
+#include <math.h>        // required for exp(), pow(), sqrt(), log(), log1p()
+
+//                    Required Externally Defined Routines                    //
+
+extern double Ln_Factorial( int n );
+
+//                    Required Internally Defined Routines                    //
+
+double Kolmogorov_Distribution( double dn, int sample_size );
+static double Durbin_Matrix( double dn, int sample_size );
+static double Smirnov_Upper_Tail( double dn, int sample_size );
+static double Pelz_Good( double dn, int sample_size );
+static void Matrix_Multiply( const double *a, const double *b, double *c,
+                                                                      int m );
+
+//                         Internally Defined Constants                       //
+
+static const int exact_sample_size = 140;
+static const int durbin_sample_size = 100000;
+static const double durbin_cutoff = 7.0;
+static const double upper_cutoff = 18.0;
+static const double complement_cutoff = 370.0;
+static const double exact_one_sided_cutoff = 4.0;
+static const double one_sided_cutoff = 2.65;
+static const int smirnov_sample_size = 200000;
+
+////////////////////////////////////////////////////////////////////////////////
+//  double Kolmogorov_Distribution( double dn, int sample_size )              //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns the probability Pr[Dn <= dn] where               //
+//           Dn = sup {|FN(x) - F(x)| : for all x}                            //
+//     is the Kolmogorov-Smirnov statistic of a sample of size n =            //
+//     sample_size, FN being the empirical distribution function              //
+//              FN(x) = #{sample[i]: sample[i] <= x } / sample_size           //
+//     and F the continuous theoretical distribution function F(x) = Pr[X <=  //
+//     x] from which the sample is drawn.  Unlike                             //
+//     Kolmogorov_Asymptotic_Distribution(), which returns the limit as the   //
+//     sample size tends to infinity, this is the distribution for the given  //
+//     sample size.                                                           //
+//                                                                            //
+//     The method follows Simard and L'Ecuyer, "Computing the Two-Sided       //
+//     Kolmogorov-Smirnov Distribution", J. Statistical Software 39 (2011):   //
+//     dn <= 1/(2n)           Pr = 0,                                         //
+//     1/(2n) < dn <= 1/n     Pr = n! (2 dn - 1/n)^n,                         //
+//     1 - 1/n <= dn < 1      Pr = 1 - 2 (1 - dn)^n,                          //
+//     dn >= 1 or                                                             //
+//     n dn^2 >= 18           Pr = 1 to within 5.0e-16,                       //
+//     otherwise, if n <= 140, or n <= 100000 and n^2 dn^3 <= 7, Pr is the    //
+//     exact value given by the matrix formula of Durbin, see Durbin_Matrix() //
+//     below, and for the remaining large samples Pr is given by the          //
+//     asymptotic expansion of Pelz and Good, see Pelz_Good() below, whose    //
+//     absolute error is then less than about 5.0e-6 and decreases rapidly    //
+//     with the sample size.  The matrix formula is always exact but its cost //
+//     grows as (n dn)^3 log(n), which the switch keeps below a few           //
+//     milliseconds.                                                          //
+//                                                                            //
+//  Arguments:                                                                //
+//     double dn                                                              //
+//        The supremum of the absolute difference between the empirical       //
+//        distribution function and the continuous theoretical distribution   //
+//        function.                                                           //
+//     int sample_size                                                        //
+//        The number of observations, sample_size >= 1.                       //
+//                                                                            //
+//  Return Values:                                                            //
+//     The probability that the Kolmogorov-Smirnov statistic of a sample of   //
+//     size sample_size is less than or equal to dn.  If sample_size <= 0, 0  //
+//     is returned.                                                           //
+//                                                                            //
+//  Example:                                                                  //
+//     #define N 25                                                           //
+//     double dn, pr;                                                         //
+//                                                                            //
+//     (your code to calculate dn )                                           //
+//                                                                            //
+//     pr = Kolmogorov_Distribution(dn, N);                                   //
+////////////////////////////////////////////////////////////////////////////////
+
+double Kolmogorov_Distribution( double dn, int sample_size )
+{
+   double n = (double) sample_size;
+   double u = n * dn * dn;
+   double pr;
+   int i;
+
+   if ( sample_size <= 0 ) return 0.0;
+   if ( dn <= 0.5 / n ) return 0.0;
+   if ( dn >= 1.0 || u >= upper_cutoff ) return 1.0;
+
+                 // Use the closed forms at either end of the range. //
+
+   if ( dn <= 1.0 / n ) {
+      pr = 1.0;
+      u = 2.0 * dn - 1.0 / n;
+      for (i = 1; i <= sample_size; i++) pr *= (double) i * u;
+      return pr;
+   }
+   if ( dn >= 1.0 - 1.0 / n ) return 1.0 - 2.0 * pow(1.0 - dn, n);
+
+   if ( sample_size <= exact_sample_size )
+      return Durbin_Matrix(dn, sample_size);
+   if ( sample_size <= durbin_sample_size && u * dn * n <= durbin_cutoff )
+      return Durbin_Matrix(dn, sample_size);
+   return Pelz_Good(dn, sample_size);
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+//  double Kolmogorov_Distribution_Complement( double dn, int sample_size )   //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns the probability Pr[Dn > dn] = 1 -                //
+//     Kolmogorov_Distribution(dn, sample_size), the p-value of the           //
+//     Kolmogorov-Smirnov statistic Dn.  In the upper tail it is calculated   //
+//     directly rather than by subtraction, so that small probabilities keep  //
+//     their relative accuracy.                                               //
+//                                                                            //
+//     The method follows Simard and L'Ecuyer (see Kolmogorov_Distribution()) //
+//     with n = sample_size:                                                  //
+//     dn <= 1/(2n)           Pr = 1,                                         //
+//     1/(2n) < dn <= 1/n     Pr = 1 - n! (2 dn - 1/n)^n,                     //
+//     1 - 1/n <= dn < 1      Pr = 2 (1 - dn)^n,                              //
+//     dn >= 1 or                                                             //
+//     n dn^2 >= 370          Pr = 0 to within 1.0e-160,                      //
+//     otherwise, if n dn^2 >= 4 for n <= 140 or n dn^2 >= 2.65 for larger n, //
+//     Pr = 2 Pr[Dn+ > dn], twice the one-sided probability given by          //
+//     Smirnov's formula, see Smirnov_Upper_Tail() below, the neglected       //
+//     probability that both one-sided statistics exceed dn being less than   //
+//     5.0e-16 relative to Pr, and in the remaining central range, where Pr   //
+//     is not small, Pr = 1 - Kolmogorov_Distribution(dn, n).                 //
+//                                                                            //
+//  Arguments:                                                                //
+//     double dn                                                              //
+//        The value of the Kolmogorov-Smirnov statistic.                      //
+//     int sample_size                                                        //
+//        The number of observations, sample_size >= 1.                       //
+//                                                                            //
+//  Return Values:                                                            //
+//     The probability that the Kolmogorov-Smirnov statistic of a sample of   //
+//     size sample_size is greater than dn.  If sample_size <= 0, 1 is        //
+//     returned.                                                              //
+//                                                                            //
+//  Example:                                                                  //
+//     #define N 25                                                           //
+//     double dn, pr;                                                         //
+//                                                                            //
+//     (your code to calculate dn )                                           //
+//                                                                            //
+//     pr = Kolmogorov_Distribution_Complement(dn, N);                        //
+////////////////////////////////////////////////////////////////////////////////
+
+double Kolmogorov_Distribution_Complement( double dn, int sample_size )
+{
+   double n = (double) sample_size;
+   double u = n * dn * dn;
+
+   if ( sample_size <= 0 ) return 1.0;
+   if ( dn <= 0.5 / n ) return 1.0;
+   if ( dn >= 1.0 || u >= complement_cutoff ) return 0.0;
+   if ( dn <= 1.0 / n ) return 1.0 - Kolmogorov_Distribution(dn, sample_size);
+   if ( dn >= 1.0 - 1.0 / n ) return 2.0 * pow(1.0 - dn, n);
+
+   if ( sample_size <= exact_sample_size ) {
+      if ( u < exact_one_sided_cutoff )
+         return 1.0 - Durbin_Matrix(dn, sample_size);
+   }
+   else if ( u < one_sided_cutoff )
+      return 1.0 - Kolmogorov_Distribution(dn, sample_size);
+   return 2.0 * Smirnov_Upper_Tail(dn, sample_size);
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+//  static double Durbin_Matrix( double dn, int sample_size )                 //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns Pr[Dn <= dn] by the method of Marsaglia, Tsang   //
+//     and Wang, "Evaluating Kolmogorov's Distribution", J. Statistical       //
+//     Software 8 (2003).  With k = [n dn] + 1, m = 2k - 1 and h = k - n dn,  //
+//     Durbin's formula is                                                    //
+//                 Pr[Dn <= dn] = (n! / n^n) T[k-1][k-1]                      //
+//     where T = H^n and H is the m x m matrix with H[i][j] = 1 / (i - j +    //
+//     1)! for i - j + 1 >= 0 and 0 elsewhere, except for the first column    //
+//     and last row, which are corrected by subtracting h^(i+1) / (i+1)! and  //
+//     h^(m-j) / (m-j)! respectively and, if 2h > 1, adding (2h - 1)^m / m!   //
+//     to the lower left corner.  H^n is calculated by repeated squaring, the //
+//     matrix being scaled by 10^-140 whenever its central element exceeds    //
+//     10^140 and the product by n!/n^n being accumulated with the same       //
+//     scaling, so that neither overflows nor underflows.                     //
+//                                                                            //
+//  Arguments:                                                                //
+//     double dn                                                              //
+//        The value of the statistic, 1/n < dn < 1 - 1/n.                     //
+//     int sample_size                                                        //
+//        The number of observations.                                         //
+//                                                                            //
+//  Return Values:                                                            //
+//     Pr[Dn <= dn].  If memory for the matrices cannot be allocated, the     //
+//     asymptotic expansion of Pelz and Good is returned instead.             //
+////////////////////////////////////////////////////////////////////////////////
+
+static double Durbin_Matrix( double dn, int sample_size )
+{
+   int n = sample_size;
+   int k = (int) (n * dn) + 1;
+   int m = k + k - 1;
+   double h = (double) k - n * dn;
+   double *memory, *H, *Q, *T, *swap;
+   double s;
+   int i, j, g, bit, exponent;
+
+   memory = (double *) malloc( 3 * m * m * sizeof(double) );
+   if ( memory == NULL ) return Pelz_Good(dn, sample_size);
+   H = memory;
+   Q = H + m * m;
+   T = Q + m * m;
+
+                       // Set up the matrix H. //
+
+   for (i = 0; i < m; i++)
+      for (j = 0; j < m; j++) H[i * m + j] = ( i - j + 1 < 0 ) ? 0.0 : 1.0;
+   for (i = 0; i < m; i++) {
+      H[i * m] -= pow(h, i + 1);
+      H[(m - 1) * m + i] -= pow(h, m - i);
+   }
+   if ( 2.0 * h - 1.0 > 0.0 ) H[(m - 1) * m] += pow(2.0 * h - 1.0, m);
+   for (i = 0; i < m; i++)
+      for (j = 0; j <= i && j < m; j++)
+         for (g = 2; g <= i - j + 1; g++) H[i * m + j] /= (double) g;
+
+             // Raise H to the n-th power, scanning the bits of n //
+             // from the most significant.                         //
+
+   for (bit = 0; (n >> bit) > 1; bit++);
+   for (i = 0; i < m * m; i++) Q[i] = H[i];
+   exponent = 0;
+   for (bit--; bit >= 0; bit--) {
+      Matrix_Multiply(Q, Q, T, m);
+      swap = Q; Q = T; T = swap;
+      exponent += exponent;
+      if ( (n >> bit) & 1 ) {
+         Matrix_Multiply(Q, H, T, m);
+         swap = Q; Q = T; T = swap;
+      }
+      if ( Q[(k - 1) * m + k - 1] > 1.0e140 ) {
+         for (i = 0; i < m * m; i++) Q[i] *= 1.0e-140;
+         exponent += 140;
+      }
+   }
+
+                       // Multiply by n! / n^n. //
+
+   s = Q[(k - 1) * m + k - 1];
+   for (i = 1; i <= n; i++) {
+      s *= (double) i / (double) n;
+      if ( s < 1.0e-140 ) {
+         s *= 1.0e140;
+         exponent -= 140;
+      }
+   }
+   free(memory);
+
+   s *= pow(10.0, exponent);
+   return ( s < 1.0 ) ? s : 1.0;
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+//  static double Pelz_Good( double dn, int sample_size )                     //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns the asymptotic expansion of Pr[Dn <= dn] of Pelz //
+//     and Good, "Approximating the Lower Tail-Areas of the Kolmogorov-       //
+//     Smirnov One-Sample Statistic", J. Royal Statistical Society B 38       //
+//     (1976), in the form given by Simard and L'Ecuyer.  With z = sqrt(n) dn //
+//     the leading term is the limiting distribution                          //
+//             [sqrt(2 pi) / z] Sum[exp(-pi^2 (2j+1)^2 / 8 z^2)]              //
+//     of Kolmogorov_Asymptotic_Distribution() and the following terms, each  //
+//     a similar series in j, are corrections of order n^(-1/2), n^(-1) and   //
+//     n^(-3/2).  The series are summed until their terms are less than       //
+//     1.0e-10 relative to the sum.                                           //
+//                                                                            //
+//  Arguments:                                                                //
+//     double dn                                                              //
+//        The value of the statistic, dn > 0.                                 //
+//     int sample_size                                                        //
+//        The number of observations.                                         //
+//                                                                            //
+//  Return Values:                                                            //
+//     The approximation to Pr[Dn <= dn].                                     //
+////////////////////////////////////////////////////////////////////////////////
+
+static double Pelz_Good( double dn, int sample_size )
+{
+   const double sqrt_2pi = 2.506628274631000502415765;
+   const double sqrt_halfpi = 1.253314137315500251207883;
+   const double pi2 = 9.869604401089358618834491;
+   const double pi4 = pi2 * pi2;
+   const double eps = 1.0e-10;
+   const int max_terms = 20;
+   double n = (double) sample_size;
+   double sqrt_n = sqrt(n);
+   double z = sqrt_n * dn;
+   double z2 = z * z;
+   double z4 = z2 * z2;
+   double z6 = z4 * z2;
+   double w = pi2 / (2.0 * z2);
+   double t, term, tail, sum;
+   int j;
+
+   sum = 0.0;
+   term = 1.0;
+   for (j = 0; j <= max_terms && term > eps * sum; j++) {
+      t = j + 0.5;
+      term = exp(-t * t * w);
+      sum += term;
+   }
+   sum *= sqrt_2pi / z;
+
+   tail = 0.0;
+   term = 1.0;
+   for (j = 0; j <= max_terms && fabs(term) > eps * fabs(tail); j++) {
+      t = (j + 0.5) * (j + 0.5);
+      term = (pi2 * t - z2) * exp(-t * w);
+      tail += term;
+   }
+   sum += tail * sqrt_halfpi / (sqrt_n * 3.0 * z4);
+
+   tail = 0.0;
+   term = 1.0;
+   for (j = 0; j <= max_terms && fabs(term) > eps * fabs(tail); j++) {
+      t = (j + 0.5) * (j + 0.5);
+      term = 6.0 * z6 + 2.0 * z4 + pi2 * (2.0 * z4 - 5.0 * z2) * t
+                                               + pi4 * (1.0 - 2.0 * z2) * t * t;
+      term *= exp(-t * w);
+      tail += term;
+   }
+   sum += tail * sqrt_halfpi / (n * 36.0 * z * z6);
+
+   tail = 0.0;
+   term = 1.0;
+   for (j = 1; j <= max_terms && term > eps * tail; j++) {
+      t = (double) j * (double) j;
+      term = pi2 * t * exp(-t * w);
+      tail += term;
+   }
+   sum -= tail * sqrt_halfpi / (n * 18.0 * z * z2);
+
+   tail = 0.0;
+   term = 1.0;
+   for (j = 0; j <= max_terms && fabs(term) > eps * fabs(tail); j++) {
+      t = (j + 0.5) * (j + 0.5);
+      term = -30.0 * z6 - 90.0 * z6 * z2 + pi2 * (135.0 * z4 - 96.0 * z6) * t
+               + pi4 * (212.0 * z4 - 60.0 * z2) * t * t
+               + pi2 * pi4 * (5.0 - 30.0 * z2) * t * t * t;
+      term *= exp(-t * w);
+      tail += term;
+   }
+   sum += tail * sqrt_halfpi / (sqrt_n * n * 3240.0 * z4 * z6);
+
+   tail = 0.0;
+   term = 1.0;
+   for (j = 1; j <= max_terms && fabs(term) > eps * fabs(tail); j++) {
+      t = (double) j * (double) j;
+      term = (3.0 * pi2 * t * z2 - pi4 * t * t) * exp(-t * w);
+      tail += term;
+   }
+   sum += tail * sqrt_halfpi / (sqrt_n * n * 108.0 * z6);
+
+   if ( sum < 0.0 ) return 0.0;
+   return ( sum < 1.0 ) ? sum : 1.0;
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+//  static double Smirnov_Upper_Tail( double dn, int sample_size )            //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns the probability Pr[Dn+ > dn] that the one-sided  //
+//     Kolmogorov-Smirnov statistic Dn+ = sup {FN(x) - F(x)} exceeds dn,      //
+//     given by Smirnov's formula                                             //
+//        Pr = (1-dn)^n + dn Sum C(n,j) (j/n + dn)^(j-1) (1 - dn - j/n)^(n-j) //
+//     summed over j = 1,...,[n (1 - dn)], all of whose terms are positive.   //
+//     As in Simard and L'Ecuyer, the summation starts near the largest term, //
+//     at j = [n (1 - dn)] / 3 + 1, and proceeds upward and then downward     //
+//     from there until the terms are less than 1.0e-12 relative to the sum,  //
+//     each term being calculated in log space.  For n > 200000 the           //
+//     asymptotic approximation                                               //
+//             Pr ~ exp(-z) [1 - (2z^2 - 4z - 1) / (18n)],                    //
+//     where z = (6n dn + 1)^2 / (18n), is used instead.                      //
+//                                                                            //
+//  Arguments:                                                                //
+//     double dn                                                              //
+//        The value of the statistic, 0 < dn < 1.                             //
+//     int sample_size                                                        //
+//        The number of observations.                                         //
+//                                                                            //
+//  Return Values:                                                            //
+//     Pr[Dn+ > dn].                                                          //
+////////////////////////////////////////////////////////////////////////////////
+
+static double Smirnov_Upper_Tail( double dn, int sample_size )
+{
+   const double eps = 1.0e-12;
+   int n = sample_size;
+   int jmax = (int) (n * (1.0 - dn));
+   double ln_c, ln_c0, q, t, z, sum;
+   int j, j0;
+
+   if ( n > smirnov_sample_size ) {
+      t = 6.0 * n * dn + 1.0;
+      z = t * t / (18.0 * n);
+      t = 1.0 - (2.0 * z * z - 4.0 * z - 1.0) / (18.0 * n);
+      return ( t > 0.0 ) ? t * exp(-z) : 0.0;
+   }
+
+                 // The term j = jmax vanishes if 1 - dn = jmax / n. //
+
+   if ( 1.0 - dn - (double) jmax / (double) n <= 0.0 ) jmax--;
+
+   j0 = jmax / 3 + 1;
+   ln_c0 = Ln_Factorial(n) - Ln_Factorial(j0) - Ln_Factorial(n - j0);
+   sum = 0.0;
+   ln_c = ln_c0;
+   for (j = j0; j <= jmax; j++) {
+      q = (double) j / (double) n + dn;
+      t = exp( ln_c + (j - 1) * log(q) + (n - j) * log1p(-q) );
+      sum += t;
+      if ( t <= eps * sum ) break;
+      ln_c += log( (double) (n - j) / (double) (j + 1) );
+   }
+   ln_c = ln_c0;
+   for (j = j0 - 1; j > 0; j--) {
+      ln_c += log( (double) (j + 1) / (double) (n - j) );
+      q = (double) j / (double) n + dn;
+      t = exp( ln_c + (j - 1) * log(q) + (n - j) * log1p(-q) );
+      sum += t;
+      if ( t <= eps * sum ) break;
+   }
+   return dn * sum + exp( n * log1p(-dn) );
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// static void Matrix_Multiply( const double *a, const double *b, double *c,  //
+//                                                                 int m )    //
+//                                                                            //
+//  Description:                                                              //
+//     This function sets c to the product of the m x m matrices a and b, all //
+//     three stored by rows.  c must not be the same matrix as a or b.        //
+//                                                                            //
+//  Arguments:                                                                //
+//     const double *a                                                        //
+//        The left factor.                                                    //
+//     const double *b                                                        //
+//        The right factor.                                                   //
+//     double *c                                                              //
+//        The product ab.                                                     //
+//     int m                                                                  //
+//        The order of the matrices.                                          //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+////////////////////////////////////////////////////////////////////////////////
+
+static void Matrix_Multiply( const double *a, const double *b, double *c,
+                                                                       int m )
+{
+   double x;
+   int i, j, l;
+
+   for (i = 0; i < m * m; i++) c[i] = 0.0;
+   for (i = 0; i < m; i++)
+      for (l = 0; l < m; l++) {
+         x = a[i * m + l];
+         if ( x == 0.0 ) continue;
+         for (j = 0; j < m; j++) c[i * m + j] += x * b[l * m + j];
+      }
+}
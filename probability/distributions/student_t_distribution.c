@@ -2,10 +2,13 @@
 // File: student_t_distribution.c                                             //
 // Routine(s):                                                                //
 //    Student_t__Distribution                                                 //
+//    Student_t_Distribution_Array                                            //
 ////////////////////////////////////////////////////////////////////////////////
 
 //                         Externally Defined Routines                        //
-extern double Beta_Distribution(double x, double a, double b);
+extern double Regularized_Incomplete_Beta(double x, double a, double b);
+extern void Regularized_Incomplete_Beta_Array(double x[], double p[], int n,
+                                                          double a, double b);
 
 ////////////////////////////////////////////////////////////////////////////////
 // double Student_t_Distribution( double x, int n )                           //
@@ -23,7 +26,8 @@ extern double Beta_Distribution(double x, double a, double b);
 //                                                                            //
 //     By making the change of variables: g = n / (n + x^2),                  //
 //                   t(x,n) = 1 - B(n / (n + x^2), n/2, 1/2) / 2              //
-//     where B(,,) is the incomplete beta function.                           //
+//     where B(,,) is the regularized incomplete beta function, evaluated by  //
+//     Regularized_Incomplete_Beta().                                         //
 //                                                                            //
 //  Arguments:                                                                //
 //     double x   The upper limit of the integral of the density given above. //
@@ -42,9 +46,61 @@ extern double Beta_Distribution(double x, double a, double b);
 double Student_t_Distribution(double x, int n)
 {
    double a = (double) n / 2.0;
-   double beta = Beta_Distribution( 1.0 / (1.0 + x * x / n), a, 0.5);
+   double beta = Regularized_Incomplete_Beta( 1.0 / (1.0 + x * x / n), a, 0.5);
 
    if ( x > 0.0 ) return 1.0 - 0.5 * beta;
    else if ( x < 0.0) return 0.5 * beta;
    return 0.5;
 }
+
+
+////////////////////////////////////////////////////////////////////////////////
+// void Student_t_Distribution_Array( double x[], double p[], int size,       //
+//                                                                    int n ) //
+//                                                                            //
+//  Description:                                                              //
+//     This function evaluates the Student-t distribution with n degrees of   //
+//     freedom at each of the size points x[0],...,x[size-1].  The points are //
+//     transformed to g = n / (n + x^2) a block at a time and passed to       //
+//     Regularized_Incomplete_Beta_Array() so that the part of the prefactor  //
+//     depending only on the shape parameters n/2 and 1/2 is not              //
+//     recalculated for every point.                                          //
+//                                                                            //
+//  Arguments:                                                                //
+//     double x[]  Array of size upper limits of the integral of the density. //
+//     double p[]  Array of size elements, p[i] is set to the Student-t       //
+//                 distribution evaluated at x[i].  p may be the same array   //
+//                 as x.                                                      //
+//     int    size The number of points.                                      //
+//     int    n    The number of degrees of freedom.                          //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     #define N 100                                                          //
+//     double p[N], x[N];                                                     //
+//     int    n;                                                              //
+//                                                                            //
+//     Student_t_Distribution_Array(x, p, N, n);                              //
+////////////////////////////////////////////////////////////////////////////////
+
+#define BLOCK 256
+
+void Student_t_Distribution_Array(double x[], double p[], int size, int n)
+{
+   double a = (double) n / 2.0;
+   double beta[BLOCK];
+   int i, j, m;
+
+   for (j = 0; j < size; j += m) {
+      m = (size - j < BLOCK) ? size - j : BLOCK;
+      for (i = 0; i < m; i++)
+         beta[i] = 1.0 / (1.0 + x[j + i] * x[j + i] / n);
+      Regularized_Incomplete_Beta_Array(beta, beta, m, a, 0.5);
+      for (i = 0; i < m; i++)
+         if ( x[j + i] > 0.0 ) p[j + i] = 1.0 - 0.5 * beta[i];
+         else if ( x[j + i] < 0.0) p[j + i] = 0.5 * beta[i];
+         else p[j + i] = 0.5;
+   }
+}
@@ -0,0 +1,473 @@
+////////////////////////////////////////////////////////////////////////////////
+// File: frozen_beta.c                                                        //
+// Routine(s):                                                                //
+//    Frozen_Beta_Init                                                        //
+//    Frozen_Beta_Density                                                     //
+//    Frozen_Beta_Distribution                                                //
+//    Frozen_Beta_Survival                                                    //
+//    Frozen_Beta_Quantile                                                    //
+//    Frozen_Beta_Variate                                                     //
+//    Frozen_Beta_Variate_r                                                   //
+//    Frozen_Beta_Density_Array                                               //
+//    Frozen_Beta_Distribution_Array                                          //
+//    Frozen_Beta_Survival_Array                                              //
+//    Frozen_Beta_Quantile_Array                                              //
+//    Frozen_Beta_Variate_Array                                               //
+////////////////////////////////////////////////////////////////////////////////
+
+#include <math.h>                    // required for exp(), log(), log1p(), NAN
+
+#include "frozen_beta.h"
+
+//                    Required Externally Defined Routines                    //
+
+extern Random_State* Uniform_0_1_Default_State( void );
+extern double Ln_Beta_Function( double a, double b );
+extern long double xBeta_Function( long double a, long double b );
+extern double Beta_Distribution_Prepared( double x, double a, double b,
+                                                            long double beta );
+extern double Beta_Quantile_Prepared( double p, double a, double b,
+                                       double ln_beta_ab, long double beta );
+extern void Gamma_Sampler_Init( Gamma_Sampler *sampler, double shape );
+extern double Gamma_Sampler_Variate_r( Random_State *state,
+                                                const Gamma_Sampler *sampler );
+extern void Gamma_Sampler_Variate_Array( Random_State *state, double x[],
+                                         int n, const Gamma_Sampler *sampler );
+
+#define BLOCK 256
+
+//                    Required Internally Defined Routines                    //
+
+double Frozen_Beta_Density( double x, const Frozen_Beta *frozen );
+double Frozen_Beta_Distribution( double x, const Frozen_Beta *frozen );
+double Frozen_Beta_Survival( double x, const Frozen_Beta *frozen );
+double Frozen_Beta_Quantile( double p, const Frozen_Beta *frozen );
+double Frozen_Beta_Variate_r( Random_State *state, const Frozen_Beta *frozen );
+
+////////////////////////////////////////////////////////////////////////////////
+// void Frozen_Beta_Init( Frozen_Beta *frozen, double a, double b )           //
+//                                                                            //
+//  Description:                                                              //
+//     This function initializes frozen to the Beta distribution with shape   //
+//     parameters a and b, with density x^(a-1) (1-x)^(b-1) / B(a,b), 0 < x < //
+//     1.  ln(B(a,b)), B(a,b) in extended precision and the constants of the  //
+//     Gamma variate generators for shapes a and b are computed here once, so //
+//     that the other Frozen_Beta routines only evaluate the parts which      //
+//     depend on their argument.                                              //
+//                                                                            //
+//  Arguments:                                                                //
+//     Frozen_Beta *frozen                                                    //
+//        The object to initialize.                                           //
+//     double a                                                               //
+//        The shape parameter associated with x, a > 0.                       //
+//     double b                                                               //
+//        The shape parameter associated with 1 - x, b > 0.                   //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     Frozen_Beta frozen;                                                    //
+//                                                                            //
+//     Frozen_Beta_Init( &frozen, 2.0, 5.0 );                                 //
+////////////////////////////////////////////////////////////////////////////////
+
+void Frozen_Beta_Init( Frozen_Beta *frozen, double a, double b )
+{
+   frozen->a = a;
+   frozen->b = b;
+   frozen->ln_beta = Ln_Beta_Function(a, b);
+   frozen->beta = xBeta_Function(a, b);
+   Gamma_Sampler_Init(&frozen->ga, a);
+   Gamma_Sampler_Init(&frozen->gb, b);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// double Frozen_Beta_Density( double x, const Frozen_Beta *frozen )          //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns the density x^(a-1) (1-x)^(b-1) / B(a,b) of the  //
+//     Beta distribution for 0 < x < 1 and 0 otherwise, evaluated as exp((a - //
+//     1) ln(x) + (b - 1) ln(1 - x) - ln(B(a,b))).                            //
+//                                                                            //
+//  Arguments:                                                                //
+//     double x                                                               //
+//        The argument of the density.                                        //
+//     const Frozen_Beta *frozen                                              //
+//        A distribution initialized by Frozen_Beta_Init().                   //
+//                                                                            //
+//  Return Values:                                                            //
+//     The density of the Beta distribution evaluated at x.                   //
+//                                                                            //
+//  Example:                                                                  //
+//     Frozen_Beta frozen;                                                    //
+//     double x, p;                                                           //
+//                                                                            //
+//     p = Frozen_Beta_Density( x, &frozen );                                 //
+////////////////////////////////////////////////////////////////////////////////
+
+double Frozen_Beta_Density( double x, const Frozen_Beta *frozen )
+{
+   if ( x <= 0.0 || x >= 1.0 ) return 0.0;
+   return exp( (frozen->a - 1.0) * log(x) + (frozen->b - 1.0) * log1p(-x)
+                                                          - frozen->ln_beta );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// double Frozen_Beta_Distribution( double x, const Frozen_Beta *frozen )     //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns the Beta distribution function, as               //
+//     Beta_Distribution() but by Beta_Distribution_Prepared() with B(a,b)    //
+//     computed by Frozen_Beta_Init().                                        //
+//                                                                            //
+//  Arguments:                                                                //
+//     double x                                                               //
+//        The argument of the distribution function.                          //
+//     const Frozen_Beta *frozen                                              //
+//        A distribution initialized by Frozen_Beta_Init().                   //
+//                                                                            //
+//  Return Values:                                                            //
+//     Pr[X <= x] where X has the Beta distribution, a real number between 0  //
+//     and 1.                                                                 //
+//                                                                            //
+//  Example:                                                                  //
+//     Frozen_Beta frozen;                                                    //
+//     double x, p;                                                           //
+//                                                                            //
+//     p = Frozen_Beta_Distribution( x, &frozen );                            //
+////////////////////////////////////////////////////////////////////////////////
+
+double Frozen_Beta_Distribution( double x, const Frozen_Beta *frozen )
+{
+   return Beta_Distribution_Prepared(x, frozen->a, frozen->b, frozen->beta);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// double Frozen_Beta_Survival( double x, const Frozen_Beta *frozen )         //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns the survival function of the Beta distribution,  //
+//     evaluated by the symmetry 1 - P(x; a, b) = P(1 - x; b, a) so that it   //
+//     keeps its relative precision where it is small.                        //
+//                                                                            //
+//  Arguments:                                                                //
+//     double x                                                               //
+//        The argument of the survival function.                              //
+//     const Frozen_Beta *frozen                                              //
+//        A distribution initialized by Frozen_Beta_Init().                   //
+//                                                                            //
+//  Return Values:                                                            //
+//     Pr[X > x] where X has the Beta distribution, a real number between 0   //
+//     and 1.                                                                 //
+//                                                                            //
+//  Example:                                                                  //
+//     Frozen_Beta frozen;                                                    //
+//     double x, p;                                                           //
+//                                                                            //
+//     p = Frozen_Beta_Survival( x, &frozen );                                //
+////////////////////////////////////////////////////////////////////////////////
+
+double Frozen_Beta_Survival( double x, const Frozen_Beta *frozen )
+{
+   return Beta_Distribution_Prepared(1.0 - x, frozen->b, frozen->a,
+                                                                frozen->beta);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// double Frozen_Beta_Quantile( double p, const Frozen_Beta *frozen )         //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns the quantile of the Beta distribution, as        //
+//     Beta_Quantile(), by Beta_Quantile_Prepared() with the constants        //
+//     computed by Frozen_Beta_Init().                                        //
+//                                                                            //
+//  Arguments:                                                                //
+//     double p                                                               //
+//        The probability, 0 < p < 1.                                         //
+//     const Frozen_Beta *frozen                                              //
+//        A distribution initialized by Frozen_Beta_Init().                   //
+//                                                                            //
+//  Return Values:                                                            //
+//     The quantile x such that Pr[X < x] = p.  If p = 0, then 0 is returned  //
+//     and if p = 1, then 1 is returned.  If p is NaN or outside [0,1], or if //
+//     a or b is not positive, NaN is returned.                               //
+//                                                                            //
+//  Example:                                                                  //
+//     Frozen_Beta frozen;                                                    //
+//     double p, x;                                                           //
+//                                                                            //
+//     x = Frozen_Beta_Quantile( p, &frozen );                                //
+////////////////////////////////////////////////////////////////////////////////
+
+double Frozen_Beta_Quantile( double p, const Frozen_Beta *frozen )
+{
+   if ( !(p >= 0.0 && p <= 1.0) || !(frozen->a > 0.0) || !(frozen->b > 0.0) )
+      return NAN;
+   if ( p <= 0.0 ) return 0.0;
+   if ( p >= 1.0 ) return 1.0;
+   return Beta_Quantile_Prepared(p, frozen->a, frozen->b, frozen->ln_beta,
+                                                                frozen->beta);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// double Frozen_Beta_Variate( const Frozen_Beta *frozen )                    //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns a random variate with the Beta distribution,     //
+//     drawn from the library's default generator state, see                  //
+//     Frozen_Beta_Variate_r().                                               //
+//                                                                            //
+//  Arguments:                                                                //
+//     const Frozen_Beta *frozen                                              //
+//        A distribution initialized by Frozen_Beta_Init().                   //
+//                                                                            //
+//  Return Values:                                                            //
+//     A random number with the Beta distribution.                            //
+//                                                                            //
+//  Example:                                                                  //
+//     Frozen_Beta frozen;                                                    //
+//     double x;                                                              //
+//                                                                            //
+//     x = Frozen_Beta_Variate( &frozen );                                    //
+////////////////////////////////////////////////////////////////////////////////
+
+double Frozen_Beta_Variate( const Frozen_Beta *frozen )
+{
+   return Frozen_Beta_Variate_r( Uniform_0_1_Default_State(), frozen );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// double Frozen_Beta_Variate_r( Random_State *state,                         //
+//                               const Frozen_Beta *frozen )                  //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns a Beta distributed random variate Ga / (Ga +     //
+//     Gb), where Ga and Gb are independent Gamma(a) and Gamma(b) variates    //
+//     generated by Gamma_Sampler_Variate_r() using the samplers prepared by  //
+//     Frozen_Beta_Init().                                                    //
+//                                                                            //
+//  Arguments:                                                                //
+//     Random_State *state                                                    //
+//        The generator state from which the variates are drawn.              //
+//     const Frozen_Beta *frozen                                              //
+//        A distribution initialized by Frozen_Beta_Init().                   //
+//                                                                            //
+//  Return Values:                                                            //
+//     A random number with the Beta distribution.                            //
+//                                                                            //
+//  Example:                                                                  //
+//     Frozen_Beta frozen;                                                    //
+//     Random_State state;                                                    //
+//     double x;                                                              //
+//                                                                            //
+//     Random_State_Init( &state, 12345 );                                    //
+//     x = Frozen_Beta_Variate_r( &state, &frozen );                          //
+////////////////////////////////////////////////////////////////////////////////
+
+double Frozen_Beta_Variate_r( Random_State *state, const Frozen_Beta *frozen )
+{
+   double ga = Gamma_Sampler_Variate_r(state, &frozen->ga);
+   double gb = Gamma_Sampler_Variate_r(state, &frozen->gb);
+
+   return ga / (ga + gb);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// void Frozen_Beta_Density_Array( double x[], double p[], int n,             //
+//                                 const Frozen_Beta *frozen )                //
+//                                                                            //
+//  Description:                                                              //
+//     This function evaluates the density of the Beta distribution at each   //
+//     of the n points x[0],...,x[n-1], setting p[i] =                        //
+//     Frozen_Beta_Density(x[i], frozen).  p may be the same array as x.      //
+//                                                                            //
+//  Arguments:                                                                //
+//     double x[]                                                             //
+//        Array of n arguments.                                               //
+//     double p[]                                                             //
+//        Array of n elements which is set to the values.                     //
+//     int n                                                                  //
+//        The number of points.                                               //
+//     const Frozen_Beta *frozen                                              //
+//        A distribution initialized by Frozen_Beta_Init().                   //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     #define N 100                                                          //
+//     Frozen_Beta frozen;                                                    //
+//     double x[N], p[N];                                                     //
+//                                                                            //
+//     Frozen_Beta_Density_Array( x, p, N, &frozen );                         //
+////////////////////////////////////////////////////////////////////////////////
+
+void Frozen_Beta_Density_Array( double x[], double p[], int n,
+                                                    const Frozen_Beta *frozen )
+{
+   int i;
+
+   for (i = 0; i < n; i++) p[i] = Frozen_Beta_Density(x[i], frozen);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// void Frozen_Beta_Distribution_Array( double x[], double p[], int n,        //
+//                                      const Frozen_Beta *frozen )           //
+//                                                                            //
+//  Description:                                                              //
+//     This function evaluates the distribution function of the Beta          //
+//     distribution at each of the n points x[0],...,x[n-1], setting p[i] =   //
+//     Frozen_Beta_Distribution(x[i], frozen).  p may be the same array as x. //
+//                                                                            //
+//  Arguments:                                                                //
+//     double x[]                                                             //
+//        Array of n arguments.                                               //
+//     double p[]                                                             //
+//        Array of n elements which is set to the values.                     //
+//     int n                                                                  //
+//        The number of points.                                               //
+//     const Frozen_Beta *frozen                                              //
+//        A distribution initialized by Frozen_Beta_Init().                   //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     #define N 100                                                          //
+//     Frozen_Beta frozen;                                                    //
+//     double x[N], p[N];                                                     //
+//                                                                            //
+//     Frozen_Beta_Distribution_Array( x, p, N, &frozen );                    //
+////////////////////////////////////////////////////////////////////////////////
+
+void Frozen_Beta_Distribution_Array( double x[], double p[], int n,
+                                                    const Frozen_Beta *frozen )
+{
+   int i;
+
+   for (i = 0; i < n; i++) p[i] = Frozen_Beta_Distribution(x[i], frozen);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// void Frozen_Beta_Survival_Array( double x[], double p[], int n,            //
+//                                  const Frozen_Beta *frozen )               //
+//                                                                            //
+//  Description:                                                              //
+//     This function evaluates the survival function of the Beta distribution //
+//     at each of the n points x[0],...,x[n-1], setting p[i] =                //
+//     Frozen_Beta_Survival(x[i], frozen).  p may be the same array as x.     //
+//                                                                            //
+//  Arguments:                                                                //
+//     double x[]                                                             //
+//        Array of n arguments.                                               //
+//     double p[]                                                             //
+//        Array of n elements which is set to the values.                     //
+//     int n                                                                  //
+//        The number of points.                                               //
+//     const Frozen_Beta *frozen                                              //
+//        A distribution initialized by Frozen_Beta_Init().                   //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     #define N 100                                                          //
+//     Frozen_Beta frozen;                                                    //
+//     double x[N], p[N];                                                     //
+//                                                                            //
+//     Frozen_Beta_Survival_Array( x, p, N, &frozen );                        //
+////////////////////////////////////////////////////////////////////////////////
+
+void Frozen_Beta_Survival_Array( double x[], double p[], int n,
+                                                    const Frozen_Beta *frozen )
+{
+   int i;
+
+   for (i = 0; i < n; i++) p[i] = Frozen_Beta_Survival(x[i], frozen);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// void Frozen_Beta_Quantile_Array( double p[], double x[], int n,            //
+//                                  const Frozen_Beta *frozen )               //
+//                                                                            //
+//  Description:                                                              //
+//     This function evaluates the quantile function of the Beta distribution //
+//     at each of the n points p[0],...,p[n-1], setting x[i] =                //
+//     Frozen_Beta_Quantile(p[i], frozen).  x may be the same array as p.     //
+//                                                                            //
+//  Arguments:                                                                //
+//     double p[]                                                             //
+//        Array of n arguments.                                               //
+//     double x[]                                                             //
+//        Array of n elements which is set to the values.                     //
+//     int n                                                                  //
+//        The number of points.                                               //
+//     const Frozen_Beta *frozen                                              //
+//        A distribution initialized by Frozen_Beta_Init().                   //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     #define N 100                                                          //
+//     Frozen_Beta frozen;                                                    //
+//     double p[N], x[N];                                                     //
+//                                                                            //
+//     Frozen_Beta_Quantile_Array( p, x, N, &frozen );                        //
+////////////////////////////////////////////////////////////////////////////////
+
+void Frozen_Beta_Quantile_Array( double p[], double x[], int n,
+                                                    const Frozen_Beta *frozen )
+{
+   int i;
+
+   for (i = 0; i < n; i++) x[i] = Frozen_Beta_Quantile(p[i], frozen);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// void Frozen_Beta_Variate_Array( Random_State *state, double x[], int n,    //
+//                                 const Frozen_Beta *frozen )                //
+//                                                                            //
+//  Description:                                                              //
+//     This function fills the array x[] with n Beta distributed random       //
+//     variates Ga / (Ga + Gb), the Gamma variates being generated a block at //
+//     a time by Gamma_Sampler_Variate_Array() using the samplers prepared by //
+//     Frozen_Beta_Init().                                                    //
+//                                                                            //
+//  Arguments:                                                                //
+//     Random_State *state                                                    //
+//        The generator state from which the variates are drawn.              //
+//     double x[]                                                             //
+//        The array of at least n elements which is set to the variates.      //
+//     int n                                                                  //
+//        The number of variates to generate.                                 //
+//     const Frozen_Beta *frozen                                              //
+//        A distribution initialized by Frozen_Beta_Init().                   //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     #define N 1000                                                         //
+//     Frozen_Beta frozen;                                                    //
+//     Random_State state;                                                    //
+//     double x[N];                                                           //
+//                                                                            //
+//     Random_State_Init( &state, 12345 );                                    //
+//     Frozen_Beta_Variate_Array( &state, x, N, &frozen );                    //
+////////////////////////////////////////////////////////////////////////////////
+
+void Frozen_Beta_Variate_Array( Random_State *state, double x[], int n,
+                                                    const Frozen_Beta *frozen )
+{
+   double gb[BLOCK];
+   int i, j, m;
+
+   for (j = 0; j < n; j += m) {
+      m = (n - j < BLOCK) ? n - j : BLOCK;
+      Gamma_Sampler_Variate_Array(state, &x[j], m, &frozen->ga);
+      Gamma_Sampler_Variate_Array(state, gb, m, &frozen->gb);
+      for (i = 0; i < m; i++) x[j + i] = x[j + i] / (x[j + i] + gb[i]);
+   }
+}
@@ -0,0 +1,33 @@
+////////////////////////////////////////////////////////////////////////////////
+// File: frozen_beta.h                                                        //
+// Type(s):                                                                   //
+//    Frozen_Beta                                                             //
+////////////////////////////////////////////////////////////////////////////////
+#ifndef FROZEN_BETA_H
+#define FROZEN_BETA_H
+
+#include "../variates/random_state.h"
+#include "../variates/gamma_sampler.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Frozen_Beta                                                                //
+//                                                                            //
+//  Description:                                                              //
+//     A Beta distribution with shape parameters a and b together with the    //
+//     constants which its density, distribution, quantile and variate        //
+//     routines would otherwise recalculate on each call, computed once by    //
+//     Frozen_Beta_Init().                                                    //
+//                                                                            //
+//     ln_beta = ln(B(a,b)), beta = B(a,b) in extended precision as required  //
+//     by Beta_Distribution_Prepared(), and ga, gb the Gamma samplers for     //
+//     shapes a and b.                                                        //
+////////////////////////////////////////////////////////////////////////////////
+
+typedef struct {
+   double a, b;
+   double ln_beta;
+   long double beta;
+   Gamma_Sampler ga, gb;
+} Frozen_Beta;
+
+#endif
@@ -0,0 +1,460 @@
+////////////////////////////////////////////////////////////////////////////////
+// File: frozen_chi_square.c                                                  //
+// Routine(s):                                                                //
+//    Frozen_Chi_Square_Init                                                  //
+//    Frozen_Chi_Square_Density                                               //
+//    Frozen_Chi_Square_Distribution                                          //
+//    Frozen_Chi_Square_Survival                                              //
+//    Frozen_Chi_Square_Quantile                                              //
+//    Frozen_Chi_Square_Variate                                               //
+//    Frozen_Chi_Square_Variate_r                                             //
+//    Frozen_Chi_Square_Density_Array                                         //
+//    Frozen_Chi_Square_Distribution_Array                                    //
+//    Frozen_Chi_Square_Survival_Array                                        //
+//    Frozen_Chi_Square_Quantile_Array                                        //
+//    Frozen_Chi_Square_Variate_Array                                         //
+////////////////////////////////////////////////////////////////////////////////
+
+#include <math.h>                    // required for NAN
+#include <float.h>                   // required for DBL_MAX
+
+#include "frozen_chi_square.h"
+
+//                    Required Externally Defined Routines                    //
+
+extern Random_State* Uniform_0_1_Default_State( void );
+extern void Frozen_Gamma_Init( Frozen_Gamma *frozen, double nu );
+extern double Frozen_Gamma_Density( double x, const Frozen_Gamma *frozen );
+extern double Frozen_Gamma_Distribution( double x,
+                                                  const Frozen_Gamma *frozen );
+extern double Frozen_Gamma_Survival( double x, const Frozen_Gamma *frozen );
+extern double Frozen_Gamma_Quantile( double p, const Frozen_Gamma *frozen );
+extern double Frozen_Gamma_Variate_r( Random_State *state,
+                                                  const Frozen_Gamma *frozen );
+extern void Frozen_Gamma_Variate_Array( Random_State *state, double x[], int n,
+                                                  const Frozen_Gamma *frozen );
+
+//                    Required Internally Defined Routines                    //
+
+double Frozen_Chi_Square_Density( double x, const Frozen_Chi_Square *frozen );
+double Frozen_Chi_Square_Distribution( double x,
+                                             const Frozen_Chi_Square *frozen );
+double Frozen_Chi_Square_Survival( double x, const Frozen_Chi_Square *frozen );
+double Frozen_Chi_Square_Quantile( double p, const Frozen_Chi_Square *frozen );
+double Frozen_Chi_Square_Variate_r( Random_State *state,
+                                             const Frozen_Chi_Square *frozen );
+
+////////////////////////////////////////////////////////////////////////////////
+// void Frozen_Chi_Square_Init( Frozen_Chi_Square *frozen, double nu )        //
+//                                                                            //
+//  Description:                                                              //
+//     This function initializes frozen to the chi-square distribution with   //
+//     nu degrees of freedom, the distribution of 2 X where X has the Gamma   //
+//     distribution with shape parameter nu / 2, by initializing that Gamma   //
+//     distribution with Frozen_Gamma_Init().                                 //
+//                                                                            //
+//  Arguments:                                                                //
+//     Frozen_Chi_Square *frozen                                              //
+//        The object to initialize.                                           //
+//     double nu                                                              //
+//        The number of degrees of freedom, nu > 0, which need not be an      //
+//        integer.                                                            //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     Frozen_Chi_Square frozen;                                              //
+//                                                                            //
+//     Frozen_Chi_Square_Init( &frozen, 7.0 );                                //
+////////////////////////////////////////////////////////////////////////////////
+
+void Frozen_Chi_Square_Init( Frozen_Chi_Square *frozen, double nu )
+{
+   frozen->nu = nu;
+   Frozen_Gamma_Init(&frozen->gamma, 0.5 * nu);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// double Frozen_Chi_Square_Density( double x,                                //
+//                                   const Frozen_Chi_Square *frozen )        //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns the density of the chi-square distribution, f(x) //
+//     = g(x/2) / 2 where g is the density of the Gamma distribution with     //
+//     shape parameter nu / 2.                                                //
+//                                                                            //
+//  Arguments:                                                                //
+//     double x                                                               //
+//        The argument of the density.                                        //
+//     const Frozen_Chi_Square *frozen                                        //
+//        A distribution initialized by Frozen_Chi_Square_Init().             //
+//                                                                            //
+//  Return Values:                                                            //
+//     The density of the chi-square distribution evaluated at x.             //
+//                                                                            //
+//  Example:                                                                  //
+//     Frozen_Chi_Square frozen;                                              //
+//     double x, p;                                                           //
+//                                                                            //
+//     p = Frozen_Chi_Square_Density( x, &frozen );                           //
+////////////////////////////////////////////////////////////////////////////////
+
+double Frozen_Chi_Square_Density( double x, const Frozen_Chi_Square *frozen )
+{
+   return 0.5 * Frozen_Gamma_Density(0.5 * x, &frozen->gamma);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// double Frozen_Chi_Square_Distribution( double x,                           //
+//                                        const Frozen_Chi_Square *frozen )   //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns the chi-square distribution function, the Gamma  //
+//     distribution function with shape parameter nu / 2 evaluated at x / 2.  //
+//                                                                            //
+//  Arguments:                                                                //
+//     double x                                                               //
+//        The argument of the distribution function.                          //
+//     const Frozen_Chi_Square *frozen                                        //
+//        A distribution initialized by Frozen_Chi_Square_Init().             //
+//                                                                            //
+//  Return Values:                                                            //
+//     Pr[X <= x] where X has the chi-square distribution, a real number      //
+//     between 0 and 1.                                                       //
+//                                                                            //
+//  Example:                                                                  //
+//     Frozen_Chi_Square frozen;                                              //
+//     double x, p;                                                           //
+//                                                                            //
+//     p = Frozen_Chi_Square_Distribution( x, &frozen );                      //
+////////////////////////////////////////////////////////////////////////////////
+
+double Frozen_Chi_Square_Distribution( double x,
+                                              const Frozen_Chi_Square *frozen )
+{
+   return Frozen_Gamma_Distribution(0.5 * x, &frozen->gamma);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// double Frozen_Chi_Square_Survival( double x,                               //
+//                                    const Frozen_Chi_Square *frozen )       //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns the survival function of the chi-square          //
+//     distribution, the Gamma survival function with shape parameter nu / 2  //
+//     evaluated at x / 2.                                                    //
+//                                                                            //
+//  Arguments:                                                                //
+//     double x                                                               //
+//        The argument of the survival function.                              //
+//     const Frozen_Chi_Square *frozen                                        //
+//        A distribution initialized by Frozen_Chi_Square_Init().             //
+//                                                                            //
+//  Return Values:                                                            //
+//     Pr[X > x] where X has the chi-square distribution, a real number       //
+//     between 0 and 1.                                                       //
+//                                                                            //
+//  Example:                                                                  //
+//     Frozen_Chi_Square frozen;                                              //
+//     double x, p;                                                           //
+//                                                                            //
+//     p = Frozen_Chi_Square_Survival( x, &frozen );                          //
+////////////////////////////////////////////////////////////////////////////////
+
+double Frozen_Chi_Square_Survival( double x, const Frozen_Chi_Square *frozen )
+{
+   return Frozen_Gamma_Survival(0.5 * x, &frozen->gamma);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// double Frozen_Chi_Square_Quantile( double p,                               //
+//                                    const Frozen_Chi_Square *frozen )       //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns the quantile of the chi-square distribution,     //
+//     twice the quantile of the Gamma distribution with shape parameter nu / //
+//     2.                                                                     //
+//                                                                            //
+//  Arguments:                                                                //
+//     double p                                                               //
+//        The probability, 0 < p < 1.                                         //
+//     const Frozen_Chi_Square *frozen                                        //
+//        A distribution initialized by Frozen_Chi_Square_Init().             //
+//                                                                            //
+//  Return Values:                                                            //
+//     The quantile x such that Pr[X < x] = p.  If p = 0, then 0 is returned  //
+//     and if p = 1, then DBL_MAX is returned.  If p is NaN or outside [0,1], //
+//     or if nu is not positive, NaN is returned.                             //
+//                                                                            //
+//  Example:                                                                  //
+//     Frozen_Chi_Square frozen;                                              //
+//     double p, x;                                                           //
+//                                                                            //
+//     x = Frozen_Chi_Square_Quantile( p, &frozen );                          //
+////////////////////////////////////////////////////////////////////////////////
+
+double Frozen_Chi_Square_Quantile( double p, const Frozen_Chi_Square *frozen )
+{
+   if ( !(p >= 0.0 && p <= 1.0) || !(frozen->nu > 0.0) ) return NAN;
+   if ( p >= 1.0 ) return DBL_MAX;
+   return 2.0 * Frozen_Gamma_Quantile(p, &frozen->gamma);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// double Frozen_Chi_Square_Variate( const Frozen_Chi_Square *frozen )        //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns a random variate with the chi-square             //
+//     distribution, drawn from the library's default generator state, see    //
+//     Frozen_Chi_Square_Variate_r().                                         //
+//                                                                            //
+//  Arguments:                                                                //
+//     const Frozen_Chi_Square *frozen                                        //
+//        A distribution initialized by Frozen_Chi_Square_Init().             //
+//                                                                            //
+//  Return Values:                                                            //
+//     A random number with the chi-square distribution.                      //
+//                                                                            //
+//  Example:                                                                  //
+//     Frozen_Chi_Square frozen;                                              //
+//     double x;                                                              //
+//                                                                            //
+//     x = Frozen_Chi_Square_Variate( &frozen );                              //
+////////////////////////////////////////////////////////////////////////////////
+
+double Frozen_Chi_Square_Variate( const Frozen_Chi_Square *frozen )
+{
+   return Frozen_Chi_Square_Variate_r( Uniform_0_1_Default_State(), frozen );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// double Frozen_Chi_Square_Variate_r( Random_State *state,                   //
+//                                     const Frozen_Chi_Square *frozen )      //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns a chi-square distributed random variate, twice a //
+//     Gamma(nu/2) variate generated by Frozen_Gamma_Variate_r().             //
+//                                                                            //
+//  Arguments:                                                                //
+//     Random_State *state                                                    //
+//        The generator state from which the variates are drawn.              //
+//     const Frozen_Chi_Square *frozen                                        //
+//        A distribution initialized by Frozen_Chi_Square_Init().             //
+//                                                                            //
+//  Return Values:                                                            //
+//     A random number with the chi-square distribution.                      //
+//                                                                            //
+//  Example:                                                                  //
+//     Frozen_Chi_Square frozen;                                              //
+//     Random_State state;                                                    //
+//     double x;                                                              //
+//                                                                            //
+//     Random_State_Init( &state, 12345 );                                    //
+//     x = Frozen_Chi_Square_Variate_r( &state, &frozen );                    //
+////////////////////////////////////////////////////////////////////////////////
+
+double Frozen_Chi_Square_Variate_r( Random_State *state,
+                                              const Frozen_Chi_Square *frozen )
+{
+   return 2.0 * Frozen_Gamma_Variate_r(state, &frozen->gamma);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// void Frozen_Chi_Square_Density_Array( double x[], double p[], int n,       //
+//                                       const Frozen_Chi_Square *frozen )    //
+//                                                                            //
+//  Description:                                                              //
+//     This function evaluates the density of the chi-square distribution at  //
+//     each of the n points x[0],...,x[n-1], setting p[i] =                   //
+//     Frozen_Chi_Square_Density(x[i], frozen).  p may be the same array as   //
+//     x.                                                                     //
+//                                                                            //
+//  Arguments:                                                                //
+//     double x[]                                                             //
+//        Array of n arguments.                                               //
+//     double p[]                                                             //
+//        Array of n elements which is set to the values.                     //
+//     int n                                                                  //
+//        The number of points.                                               //
+//     const Frozen_Chi_Square *frozen                                        //
+//        A distribution initialized by Frozen_Chi_Square_Init().             //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     #define N 100                                                          //
+//     Frozen_Chi_Square frozen;                                              //
+//     double x[N], p[N];                                                     //
+//                                                                            //
+//     Frozen_Chi_Square_Density_Array( x, p, N, &frozen );                   //
+////////////////////////////////////////////////////////////////////////////////
+
+void Frozen_Chi_Square_Density_Array( double x[], double p[], int n,
+                                              const Frozen_Chi_Square *frozen )
+{
+   int i;
+
+   for (i = 0; i < n; i++) p[i] = Frozen_Chi_Square_Density(x[i], frozen);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// void Frozen_Chi_Square_Distribution_Array( double x[], double p[], int n,  //
+//                                            const Frozen_Chi_Square         //
+//                                            *frozen )                       //
+//                                                                            //
+//  Description:                                                              //
+//     This function evaluates the distribution function of the chi-square    //
+//     distribution at each of the n points x[0],...,x[n-1], setting p[i] =   //
+//     Frozen_Chi_Square_Distribution(x[i], frozen).  p may be the same array //
+//     as x.                                                                  //
+//                                                                            //
+//  Arguments:                                                                //
+//     double x[]                                                             //
+//        Array of n arguments.                                               //
+//     double p[]                                                             //
+//        Array of n elements which is set to the values.                     //
+//     int n                                                                  //
+//        The number of points.                                               //
+//     const Frozen_Chi_Square *frozen                                        //
+//        A distribution initialized by Frozen_Chi_Square_Init().             //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     #define N 100                                                          //
+//     Frozen_Chi_Square frozen;                                              //
+//     double x[N], p[N];                                                     //
+//                                                                            //
+//     Frozen_Chi_Square_Distribution_Array( x, p, N, &frozen );              //
+////////////////////////////////////////////////////////////////////////////////
+
+void Frozen_Chi_Square_Distribution_Array( double x[], double p[], int n,
+                                              const Frozen_Chi_Square *frozen )
+{
+   int i;
+
+   for (i = 0; i < n; i++) p[i] = Frozen_Chi_Square_Distribution(x[i], frozen);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// void Frozen_Chi_Square_Survival_Array( double x[], double p[], int n,      //
+//                                        const Frozen_Chi_Square *frozen )   //
+//                                                                            //
+//  Description:                                                              //
+//     This function evaluates the survival function of the chi-square        //
+//     distribution at each of the n points x[0],...,x[n-1], setting p[i] =   //
+//     Frozen_Chi_Square_Survival(x[i], frozen).  p may be the same array as  //
+//     x.                                                                     //
+//                                                                            //
+//  Arguments:                                                                //
+//     double x[]                                                             //
+//        Array of n arguments.                                               //
+//     double p[]                                                             //
+//        Array of n elements which is set to the values.                     //
+//     int n                                                                  //
+//        The number of points.                                               //
+//     const Frozen_Chi_Square *frozen                                        //
+//        A distribution initialized by Frozen_Chi_Square_Init().             //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     #define N 100                                                          //
+//     Frozen_Chi_Square frozen;                                              //
+//     double x[N], p[N];                                                     //
+//                                                                            //
+//     Frozen_Chi_Square_Survival_Array( x, p, N, &frozen );                  //
+////////////////////////////////////////////////////////////////////////////////
+
+void Frozen_Chi_Square_Survival_Array( double x[], double p[], int n,
+                                              const Frozen_Chi_Square *frozen )
+{
+   int i;
+
+   for (i = 0; i < n; i++) p[i] = Frozen_Chi_Square_Survival(x[i], frozen);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// void Frozen_Chi_Square_Quantile_Array( double p[], double x[], int n,      //
+//                                        const Frozen_Chi_Square *frozen )   //
+//                                                                            //
+//  Description:                                                              //
+//     This function evaluates the quantile function of the chi-square        //
+//     distribution at each of the n points p[0],...,p[n-1], setting x[i] =   //
+//     Frozen_Chi_Square_Quantile(p[i], frozen).  x may be the same array as  //
+//     p.                                                                     //
+//                                                                            //
+//  Arguments:                                                                //
+//     double p[]                                                             //
+//        Array of n arguments.                                               //
+//     double x[]                                                             //
+//        Array of n elements which is set to the values.                     //
+//     int n                                                                  //
+//        The number of points.                                               //
+//     const Frozen_Chi_Square *frozen                                        //
+//        A distribution initialized by Frozen_Chi_Square_Init().             //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     #define N 100                                                          //
+//     Frozen_Chi_Square frozen;                                              //
+//     double p[N], x[N];                                                     //
+//                                                                            //
+//     Frozen_Chi_Square_Quantile_Array( p, x, N, &frozen );                  //
+////////////////////////////////////////////////////////////////////////////////
+
+void Frozen_Chi_Square_Quantile_Array( double p[], double x[], int n,
+                                              const Frozen_Chi_Square *frozen )
+{
+   int i;
+
+   for (i = 0; i < n; i++) x[i] = Frozen_Chi_Square_Quantile(p[i], frozen);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// void Frozen_Chi_Square_Variate_Array( Random_State *state, double x[],     //
+//                                       int n,                               //
+//                                       const Frozen_Chi_Square *frozen )    //
+//                                                                            //
+//  Description:                                                              //
+//     This function fills the array x[] with n chi-square distributed random //
+//     variates, twice the Gamma(nu/2) variates generated by                  //
+//     Frozen_Gamma_Variate_Array().                                          //
+//                                                                            //
+//  Arguments:                                                                //
+//     Random_State *state                                                    //
+//        The generator state from which the variates are drawn.              //
+//     double x[]                                                             //
+//        The array of at least n elements which is set to the variates.      //
+//     int n                                                                  //
+//        The number of variates to generate.                                 //
+//     const Frozen_Chi_Square *frozen                                        //
+//        A distribution initialized by Frozen_Chi_Square_Init().             //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     #define N 1000                                                         //
+//     Frozen_Chi_Square frozen;                                              //
+//     Random_State state;                                                    //
+//     double x[N];                                                           //
+//                                                                            //
+//     Random_State_Init( &state, 12345 );                                    //
+//     Frozen_Chi_Square_Variate_Array( &state, x, N, &frozen );              //
+////////////////////////////////////////////////////////////////////////////////
+
+void Frozen_Chi_Square_Variate_Array( Random_State *state, double x[], int n,
+                                              const Frozen_Chi_Square *frozen )
+{
+   int i;
+
+   Frozen_Gamma_Variate_Array(state, x, n, &frozen->gamma);
+   for (i = 0; i < n; i++) x[i] += x[i];
+}
@@ -0,0 +1,26 @@
+////////////////////////////////////////////////////////////////////////////////
+// File: frozen_chi_square.h                                                  //
+// Type(s):                                                                   //
+//    Frozen_Chi_Square                                                       //
+////////////////////////////////////////////////////////////////////////////////
+#ifndef FROZEN_CHI_SQUARE_H
+#define FROZEN_CHI_SQUARE_H
+
+#include "frozen_gamma.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Frozen_Chi_Square                                                          //
+//                                                                            //
+//  Description:                                                              //
+//     A chi-square distribution with nu degrees of freedom, held as the      //
+//     Gamma distribution with shape parameter nu / 2 of which it is the      //
+//     distribution of twice the variate, initialized once by                 //
+//     Frozen_Chi_Square_Init().                                              //
+////////////////////////////////////////////////////////////////////////////////
+
+typedef struct {
+   double nu;
+   Frozen_Gamma gamma;
+} Frozen_Chi_Square;
+
+#endif
@@ -0,0 +1,479 @@
+////////////////////////////////////////////////////////////////////////////////
+// File: frozen_f.c                                                           //
+// Routine(s):                                                                //
+//    Frozen_F_Init                                                           //
+//    Frozen_F_Density                                                        //
+//    Frozen_F_Distribution                                                   //
+//    Frozen_F_Survival                                                       //
+//    Frozen_F_Quantile                                                       //
+//    Frozen_F_Variate                                                        //
+//    Frozen_F_Variate_r                                                      //
+//    Frozen_F_Density_Array                                                  //
+//    Frozen_F_Distribution_Array                                             //
+//    Frozen_F_Survival_Array                                                 //
+//    Frozen_F_Quantile_Array                                                 //
+//    Frozen_F_Variate_Array                                                  //
+////////////////////////////////////////////////////////////////////////////////
+
+#include <math.h>                    // required for exp(), log(), NAN
+#include <float.h>                   // required for DBL_MAX
+
+#include "frozen_f.h"
+
+//                    Required Externally Defined Routines                    //
+
+extern Random_State* Uniform_0_1_Default_State( void );
+extern double Ln_Beta_Function( double a, double b );
+extern long double xBeta_Function( long double a, long double b );
+extern double Beta_Distribution_Prepared( double x, double a, double b,
+                                                            long double beta );
+extern double Beta_Quantile_Prepared( double p, double a, double b,
+                                       double ln_beta_ab, long double beta );
+extern void F_Sampler_Init( F_Sampler *sampler, double nu1, double nu2 );
+extern double F_Sampler_Variate_r( Random_State *state,
+                                                    const F_Sampler *sampler );
+extern void F_Sampler_Variate_Array( Random_State *state, double x[], int n,
+                                                    const F_Sampler *sampler );
+
+//                    Required Internally Defined Routines                    //
+
+double Frozen_F_Density( double x, const Frozen_F *frozen );
+double Frozen_F_Distribution( double x, const Frozen_F *frozen );
+double Frozen_F_Survival( double x, const Frozen_F *frozen );
+double Frozen_F_Quantile( double p, const Frozen_F *frozen );
+double Frozen_F_Variate_r( Random_State *state, const Frozen_F *frozen );
+
+////////////////////////////////////////////////////////////////////////////////
+// void Frozen_F_Init( Frozen_F *frozen, double nu1, double nu2 )             //
+//                                                                            //
+//  Description:                                                              //
+//     This function initializes frozen to the F-distribution with nu1 and    //
+//     nu2 degrees of freedom, with density nu1^(nu1/2) nu2^(nu2/2)           //
+//     x^(nu1/2-1) / (B(nu1/2,nu2/2) (nu2 + nu1 x)^((nu1+nu2)/2)), x > 0.     //
+//     ln(B(nu1/2,nu2/2)), B(nu1/2,nu2/2) in extended precision, the constant //
+//     of the density and the constants of the variate generator are computed //
+//     here once, so that the other Frozen_F routines only evaluate the parts //
+//     which depend on their argument.                                        //
+//                                                                            //
+//  Arguments:                                                                //
+//     Frozen_F *frozen                                                       //
+//        The object to initialize.                                           //
+//     double nu1                                                             //
+//        The number of degrees of freedom of the numerator, nu1 > 0.         //
+//     double nu2                                                             //
+//        The number of degrees of freedom of the denominator, nu2 > 0.       //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     Frozen_F frozen;                                                       //
+//                                                                            //
+//     Frozen_F_Init( &frozen, 5.0, 12.0 );                                   //
+////////////////////////////////////////////////////////////////////////////////
+
+void Frozen_F_Init( Frozen_F *frozen, double nu1, double nu2 )
+{
+   frozen->nu1 = nu1;
+   frozen->nu2 = nu2;
+   frozen->a = 0.5 * nu1;
+   frozen->b = 0.5 * nu2;
+   frozen->ln_beta = Ln_Beta_Function(frozen->a, frozen->b);
+   frozen->beta = xBeta_Function(frozen->a, frozen->b);
+   frozen->ln_constant = frozen->a * log(nu1) + frozen->b * log(nu2)
+                                                           - frozen->ln_beta;
+   F_Sampler_Init(&frozen->sampler, nu1, nu2);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// double Frozen_F_Density( double x, const Frozen_F *frozen )                //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns the density of the F-distribution for x > 0 and  //
+//     0 otherwise, exp(ln_constant + (a - 1) ln(x) - (a + b) ln(nu2 + nu1    //
+//     x)), a = nu1 / 2, b = nu2 / 2.                                         //
+//                                                                            //
+//  Arguments:                                                                //
+//     double x                                                               //
+//        The argument of the density.                                        //
+//     const Frozen_F *frozen                                                 //
+//        A distribution initialized by Frozen_F_Init().                      //
+//                                                                            //
+//  Return Values:                                                            //
+//     The density of the F-distribution evaluated at x.                      //
+//                                                                            //
+//  Example:                                                                  //
+//     Frozen_F frozen;                                                       //
+//     double x, p;                                                           //
+//                                                                            //
+//     p = Frozen_F_Density( x, &frozen );                                    //
+////////////////////////////////////////////////////////////////////////////////
+
+double Frozen_F_Density( double x, const Frozen_F *frozen )
+{
+   if ( x <= 0.0 ) return 0.0;
+   return exp( frozen->ln_constant + (frozen->a - 1.0) * log(x)
+               - (frozen->a + frozen->b) * log(frozen->nu2 + frozen->nu1 * x) );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// double Frozen_F_Distribution( double x, const Frozen_F *frozen )           //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns the F-distribution function, as                  //
+//     F_Distribution(), the Beta distribution with shape parameters a =      //
+//     nu1/2 and b = nu2/2 evaluated at a x / (b + a x) by                    //
+//     Beta_Distribution_Prepared() with B(a,b) computed by Frozen_F_Init().  //
+//                                                                            //
+//  Arguments:                                                                //
+//     double x                                                               //
+//        The argument of the distribution function.                          //
+//     const Frozen_F *frozen                                                 //
+//        A distribution initialized by Frozen_F_Init().                      //
+//                                                                            //
+//  Return Values:                                                            //
+//     Pr[X <= x] where X has the F-distribution, a real number between 0 and //
+//     1.                                                                     //
+//                                                                            //
+//  Example:                                                                  //
+//     Frozen_F frozen;                                                       //
+//     double x, p;                                                           //
+//                                                                            //
+//     p = Frozen_F_Distribution( x, &frozen );                               //
+////////////////////////////////////////////////////////////////////////////////
+
+double Frozen_F_Distribution( double x, const Frozen_F *frozen )
+{
+   double g = frozen->a * x;
+
+   if ( x <= 0.0 ) return 0.0;
+   return Beta_Distribution_Prepared(g / (frozen->b + g), frozen->a, frozen->b,
+                                                                frozen->beta);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// double Frozen_F_Survival( double x, const Frozen_F *frozen )               //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns the survival function of the F-distribution, the //
+//     Beta distribution with shape parameters b and a evaluated at b / (b +  //
+//     a x), which keeps its relative precision where it is small.            //
+//                                                                            //
+//  Arguments:                                                                //
+//     double x                                                               //
+//        The argument of the survival function.                              //
+//     const Frozen_F *frozen                                                 //
+//        A distribution initialized by Frozen_F_Init().                      //
+//                                                                            //
+//  Return Values:                                                            //
+//     Pr[X > x] where X has the F-distribution, a real number between 0 and  //
+//     1.                                                                     //
+//                                                                            //
+//  Example:                                                                  //
+//     Frozen_F frozen;                                                       //
+//     double x, p;                                                           //
+//                                                                            //
+//     p = Frozen_F_Survival( x, &frozen );                                   //
+////////////////////////////////////////////////////////////////////////////////
+
+double Frozen_F_Survival( double x, const Frozen_F *frozen )
+{
+   double g = frozen->a * x;
+
+   if ( x <= 0.0 ) return 1.0;
+   return Beta_Distribution_Prepared(frozen->b / (frozen->b + g), frozen->b,
+                                                     frozen->a, frozen->beta);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// double Frozen_F_Quantile( double p, const Frozen_F *frozen )               //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns the quantile of the F-distribution, as           //
+//     F_Quantile(), from the quantile of the Beta distribution evaluated by  //
+//     Beta_Quantile_Prepared() with the constants computed by                //
+//     Frozen_F_Init().                                                       //
+//                                                                            //
+//  Arguments:                                                                //
+//     double p                                                               //
+//        The probability, 0 < p < 1.                                         //
+//     const Frozen_F *frozen                                                 //
+//        A distribution initialized by Frozen_F_Init().                      //
+//                                                                            //
+//  Return Values:                                                            //
+//     The quantile x such that Pr[X < x] = p.  If p = 0, then 0 is returned  //
+//     and if p = 1, then DBL_MAX is returned.  If p is NaN or outside [0,1], //
+//     or if nu1 or nu2 is not positive, NaN is returned.                     //
+//                                                                            //
+//  Example:                                                                  //
+//     Frozen_F frozen;                                                       //
+//     double p, x;                                                           //
+//                                                                            //
+//     x = Frozen_F_Quantile( p, &frozen );                                   //
+////////////////////////////////////////////////////////////////////////////////
+
+double Frozen_F_Quantile( double p, const Frozen_F *frozen )
+{
+   double a = frozen->a;
+   double b = frozen->b;
+   double y;
+
+   if ( !(p >= 0.0 && p <= 1.0) || !(frozen->nu1 > 0.0)
+                                 || !(frozen->nu2 > 0.0) ) return NAN;
+   if ( p <= 0.0 ) return 0.0;
+   if ( p >= 1.0 ) return DBL_MAX;
+
+   if ( p > 0.5 ) {
+      y = Beta_Quantile_Prepared(1.0 - p, b, a, frozen->ln_beta, frozen->beta);
+      return b * (1.0 - y) / (a * y);
+   }
+   y = Beta_Quantile_Prepared(p, a, b, frozen->ln_beta, frozen->beta);
+   return b * y / (a * (1.0 - y));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// double Frozen_F_Variate( const Frozen_F *frozen )                          //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns a random variate with the F-distribution, drawn  //
+//     from the library's default generator state, see Frozen_F_Variate_r().  //
+//                                                                            //
+//  Arguments:                                                                //
+//     const Frozen_F *frozen                                                 //
+//        A distribution initialized by Frozen_F_Init().                      //
+//                                                                            //
+//  Return Values:                                                            //
+//     A random number with the F-distribution.                               //
+//                                                                            //
+//  Example:                                                                  //
+//     Frozen_F frozen;                                                       //
+//     double x;                                                              //
+//                                                                            //
+//     x = Frozen_F_Variate( &frozen );                                       //
+////////////////////////////////////////////////////////////////////////////////
+
+double Frozen_F_Variate( const Frozen_F *frozen )
+{
+   return Frozen_F_Variate_r( Uniform_0_1_Default_State(), frozen );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// double Frozen_F_Variate_r( Random_State *state, const Frozen_F *frozen )   //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns a random variate with the F-distribution         //
+//     generated by F_Sampler_Variate_r() using the sampler prepared by       //
+//     Frozen_F_Init().                                                       //
+//                                                                            //
+//  Arguments:                                                                //
+//     Random_State *state                                                    //
+//        The generator state from which the variates are drawn.              //
+//     const Frozen_F *frozen                                                 //
+//        A distribution initialized by Frozen_F_Init().                      //
+//                                                                            //
+//  Return Values:                                                            //
+//     A random number with the F-distribution.                               //
+//                                                                            //
+//  Example:                                                                  //
+//     Frozen_F frozen;                                                       //
+//     Random_State state;                                                    //
+//     double x;                                                              //
+//                                                                            //
+//     Random_State_Init( &state, 12345 );                                    //
+//     x = Frozen_F_Variate_r( &state, &frozen );                             //
+////////////////////////////////////////////////////////////////////////////////
+
+double Frozen_F_Variate_r( Random_State *state, const Frozen_F *frozen )
+{
+   return F_Sampler_Variate_r(state, &frozen->sampler);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// void Frozen_F_Density_Array( double x[], double p[], int n,                //
+//                              const Frozen_F *frozen )                      //
+//                                                                            //
+//  Description:                                                              //
+//     This function evaluates the density of the F-distribution at each of   //
+//     the n points x[0],...,x[n-1], setting p[i] = Frozen_F_Density(x[i],    //
+//     frozen).  p may be the same array as x.                                //
+//                                                                            //
+//  Arguments:                                                                //
+//     double x[]                                                             //
+//        Array of n arguments.                                               //
+//     double p[]                                                             //
+//        Array of n elements which is set to the values.                     //
+//     int n                                                                  //
+//        The number of points.                                               //
+//     const Frozen_F *frozen                                                 //
+//        A distribution initialized by Frozen_F_Init().                      //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     #define N 100                                                          //
+//     Frozen_F frozen;                                                       //
+//     double x[N], p[N];                                                     //
+//                                                                            //
+//     Frozen_F_Density_Array( x, p, N, &frozen );                            //
+////////////////////////////////////////////////////////////////////////////////
+
+void Frozen_F_Density_Array( double x[], double p[], int n,
+                                                       const Frozen_F *frozen )
+{
+   int i;
+
+   for (i = 0; i < n; i++) p[i] = Frozen_F_Density(x[i], frozen);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// void Frozen_F_Distribution_Array( double x[], double p[], int n,           //
+//                                   const Frozen_F *frozen )                 //
+//                                                                            //
+//  Description:                                                              //
+//     This function evaluates the distribution function of the               //
+//     F-distribution at each of the n points x[0],...,x[n-1], setting p[i] = //
+//     Frozen_F_Distribution(x[i], frozen).  p may be the same array as x.    //
+//                                                                            //
+//  Arguments:                                                                //
+//     double x[]                                                             //
+//        Array of n arguments.                                               //
+//     double p[]                                                             //
+//        Array of n elements which is set to the values.                     //
+//     int n                                                                  //
+//        The number of points.                                               //
+//     const Frozen_F *frozen                                                 //
+//        A distribution initialized by Frozen_F_Init().                      //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     #define N 100                                                          //
+//     Frozen_F frozen;                                                       //
+//     double x[N], p[N];                                                     //
+//                                                                            //
+//     Frozen_F_Distribution_Array( x, p, N, &frozen );                       //
+////////////////////////////////////////////////////////////////////////////////
+
+void Frozen_F_Distribution_Array( double x[], double p[], int n,
+                                                       const Frozen_F *frozen )
+{
+   int i;
+
+   for (i = 0; i < n; i++) p[i] = Frozen_F_Distribution(x[i], frozen);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// void Frozen_F_Survival_Array( double x[], double p[], int n,               //
+//                               const Frozen_F *frozen )                     //
+//                                                                            //
+//  Description:                                                              //
+//     This function evaluates the survival function of the F-distribution at //
+//     each of the n points x[0],...,x[n-1], setting p[i] =                   //
+//     Frozen_F_Survival(x[i], frozen).  p may be the same array as x.        //
+//                                                                            //
+//  Arguments:                                                                //
+//     double x[]                                                             //
+//        Array of n arguments.                                               //
+//     double p[]                                                             //
+//        Array of n elements which is set to the values.                     //
+//     int n                                                                  //
+//        The number of points.                                               //
+//     const Frozen_F *frozen                                                 //
+//        A distribution initialized by Frozen_F_Init().                      //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     #define N 100                                                          //
+//     Frozen_F frozen;                                                       //
+//     double x[N], p[N];                                                     //
+//                                                                            //
+//     Frozen_F_Survival_Array( x, p, N, &frozen );                           //
+////////////////////////////////////////////////////////////////////////////////
+
+void Frozen_F_Survival_Array( double x[], double p[], int n,
+                                                       const Frozen_F *frozen )
+{
+   int i;
+
+   for (i = 0; i < n; i++) p[i] = Frozen_F_Survival(x[i], frozen);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// void Frozen_F_Quantile_Array( double p[], double x[], int n,               //
+//                               const Frozen_F *frozen )                     //
+//                                                                            //
+//  Description:                                                              //
+//     This function evaluates the quantile function of the F-distribution at //
+//     each of the n points p[0],...,p[n-1], setting x[i] =                   //
+//     Frozen_F_Quantile(p[i], frozen).  x may be the same array as p.        //
+//                                                                            //
+//  Arguments:                                                                //
+//     double p[]                                                             //
+//        Array of n arguments.                                               //
+//     double x[]                                                             //
+//        Array of n elements which is set to the values.                     //
+//     int n                                                                  //
+//        The number of points.                                               //
+//     const Frozen_F *frozen                                                 //
+//        A distribution initialized by Frozen_F_Init().                      //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     #define N 100                                                          //
+//     Frozen_F frozen;                                                       //
+//     double p[N], x[N];                                                     //
+//                                                                            //
+//     Frozen_F_Quantile_Array( p, x, N, &frozen );                           //
+////////////////////////////////////////////////////////////////////////////////
+
+void Frozen_F_Quantile_Array( double p[], double x[], int n,
+                                                       const Frozen_F *frozen )
+{
+   int i;
+
+   for (i = 0; i < n; i++) x[i] = Frozen_F_Quantile(p[i], frozen);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// void Frozen_F_Variate_Array( Random_State *state, double x[], int n,       //
+//                              const Frozen_F *frozen )                      //
+//                                                                            //
+//  Description:                                                              //
+//     This function fills the array x[] with n random variates with the      //
+//     F-distribution generated by F_Sampler_Variate_Array() using the        //
+//     sampler prepared by Frozen_F_Init().                                   //
+//                                                                            //
+//  Arguments:                                                                //
+//     Random_State *state                                                    //
+//        The generator state from which the variates are drawn.              //
+//     double x[]                                                             //
+//        The array of at least n elements which is set to the variates.      //
+//     int n                                                                  //
+//        The number of variates to generate.                                 //
+//     const Frozen_F *frozen                                                 //
+//        A distribution initialized by Frozen_F_Init().                      //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     #define N 1000                                                         //
+//     Frozen_F frozen;                                                       //
+//     Random_State state;                                                    //
+//     double x[N];                                                           //
+//                                                                            //
+//     Random_State_Init( &state, 12345 );                                    //
+//     Frozen_F_Variate_Array( &state, x, N, &frozen );                       //
+////////////////////////////////////////////////////////////////////////////////
+
+void Frozen_F_Variate_Array( Random_State *state, double x[], int n,
+                                                       const Frozen_F *frozen )
+{
+   F_Sampler_Variate_Array(state, x, n, &frozen->sampler);
+}
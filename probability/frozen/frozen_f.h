@@ -0,0 +1,37 @@
+////////////////////////////////////////////////////////////////////////////////
+// File: frozen_f.h                                                           //
+// Type(s):                                                                   //
+//    Frozen_F                                                                //
+////////////////////////////////////////////////////////////////////////////////
+#ifndef FROZEN_F_H
+#define FROZEN_F_H
+
+#include "../variates/random_state.h"
+#include "../variates/f_sampler.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Frozen_F                                                                   //
+//                                                                            //
+//  Description:                                                              //
+//     An F-distribution with nu1 and nu2 degrees of freedom together with    //
+//     the constants which its density, distribution, quantile and variate    //
+//     routines would otherwise recalculate on each call, computed once by    //
+//     Frozen_F_Init().                                                       //
+//                                                                            //
+//     a = nu1 / 2, b = nu2 / 2, ln_beta = ln(B(a,b)), beta = B(a,b) in       //
+//     extended precision and ln_constant = a ln(nu1) + b ln(nu2) - ln_beta,  //
+//     so that the density is exp(ln_constant + (a - 1) ln(x) - (a + b)       //
+//     ln(nu2 + nu1 x)).  sampler holds the Gamma samplers for shapes a and   //
+//     b.                                                                     //
+////////////////////////////////////////////////////////////////////////////////
+
+typedef struct {
+   double nu1, nu2;
+   double a, b;
+   double ln_beta;
+   long double beta;
+   double ln_constant;
+   F_Sampler sampler;
+} Frozen_F;
+
+#endif
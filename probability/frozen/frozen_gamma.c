@@ -0,0 +1,464 @@
+////////////////////////////////////////////////////////////////////////////////
+// File: frozen_gamma.c                                                       //
+// Routine(s):                                                                //
+//    Frozen_Gamma_Init                                                       //
+//    Frozen_Gamma_Density                                                    //
+//    Frozen_Gamma_Distribution                                               //
+//    Frozen_Gamma_Survival                                                   //
+//    Frozen_Gamma_Quantile                                                   //
+//    Frozen_Gamma_Variate                                                    //
+//    Frozen_Gamma_Variate_r                                                  //
+//    Frozen_Gamma_Density_Array                                              //
+//    Frozen_Gamma_Distribution_Array                                         //
+//    Frozen_Gamma_Survival_Array                                             //
+//    Frozen_Gamma_Quantile_Array                                             //
+//    Frozen_Gamma_Variate_Array                                              //
+////////////////////////////////////////////////////////////////////////////////
+
+#include <float.h>                   // required for DBL_MAX
+#include <math.h>                    // required for exp(), log(), NAN
+
+#include "frozen_gamma.h"
+
+//                    Required Externally Defined Routines                    //
+
+extern Random_State* Uniform_0_1_Default_State( void );
+extern double Ln_Gamma_Function( double x );
+extern long double xRegularized_Incomplete_Gamma_Normalizer( long double nu );
+extern double Regularized_Incomplete_Gamma_P_Prepared( double x, double nu,
+                                                   long double ln_gamma_star );
+extern double Regularized_Incomplete_Gamma_Q_Prepared( double x, double nu,
+                                                   long double ln_gamma_star );
+extern double Gamma_Quantile_Prepared( double p, double nu, double ln_gamma_nu,
+                                                   long double ln_gamma_star );
+extern void Gamma_Sampler_Init( Gamma_Sampler *sampler, double shape );
+extern double Gamma_Sampler_Variate_r( Random_State *state,
+                                                const Gamma_Sampler *sampler );
+extern void Gamma_Sampler_Variate_Array( Random_State *state, double x[],
+                                         int n, const Gamma_Sampler *sampler );
+
+//                    Required Internally Defined Routines                    //
+
+double Frozen_Gamma_Density( double x, const Frozen_Gamma *frozen );
+double Frozen_Gamma_Distribution( double x, const Frozen_Gamma *frozen );
+double Frozen_Gamma_Survival( double x, const Frozen_Gamma *frozen );
+double Frozen_Gamma_Quantile( double p, const Frozen_Gamma *frozen );
+double Frozen_Gamma_Variate_r( Random_State *state,
+                                                  const Frozen_Gamma *frozen );
+
+////////////////////////////////////////////////////////////////////////////////
+// void Frozen_Gamma_Init( Frozen_Gamma *frozen, double nu )                  //
+//                                                                            //
+//  Description:                                                              //
+//     This function initializes frozen to the Gamma distribution with shape  //
+//     parameter nu, with density x^(nu-1) exp(-x) / gamma(nu), x > 0.  The   //
+//     logarithm of gamma(nu), the scaled logarithm ln(gamma*(nu)) used by    //
+//     the regularized incomplete gamma function and the constants of the     //
+//     Gamma variate generator are computed here once, so that the other      //
+//     Frozen_Gamma routines only evaluate the parts which depend on their    //
+//     argument.                                                              //
+//                                                                            //
+//  Arguments:                                                                //
+//     Frozen_Gamma *frozen                                                   //
+//        The object to initialize.                                           //
+//     double nu                                                              //
+//        The shape parameter of the Gamma distribution, nu > 0.              //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     Frozen_Gamma frozen;                                                   //
+//                                                                            //
+//     Frozen_Gamma_Init( &frozen, 2.5 );                                     //
+////////////////////////////////////////////////////////////////////////////////
+
+void Frozen_Gamma_Init( Frozen_Gamma *frozen, double nu )
+{
+   frozen->nu = nu;
+   frozen->ln_gamma_nu = Ln_Gamma_Function(nu);
+   frozen->ln_gamma_star = xRegularized_Incomplete_Gamma_Normalizer(nu);
+   Gamma_Sampler_Init(&frozen->sampler, nu);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// double Frozen_Gamma_Density( double x, const Frozen_Gamma *frozen )        //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns the density x^(nu-1) exp(-x) / gamma(nu) of the  //
+//     Gamma distribution for x > 0 and 0 otherwise, evaluated as exp((nu -   //
+//     1) ln(x) - x - ln(gamma(nu))).                                         //
+//                                                                            //
+//  Arguments:                                                                //
+//     double x                                                               //
+//        The argument of the density.                                        //
+//     const Frozen_Gamma *frozen                                             //
+//        A distribution initialized by Frozen_Gamma_Init().                  //
+//                                                                            //
+//  Return Values:                                                            //
+//     The density of the Gamma distribution evaluated at x.                  //
+//                                                                            //
+//  Example:                                                                  //
+//     Frozen_Gamma frozen;                                                   //
+//     double x, p;                                                           //
+//                                                                            //
+//     p = Frozen_Gamma_Density( x, &frozen );                                //
+////////////////////////////////////////////////////////////////////////////////
+
+double Frozen_Gamma_Density( double x, const Frozen_Gamma *frozen )
+{
+   if ( x <= 0.0 ) return 0.0;
+   return exp( (frozen->nu - 1.0) * log(x) - x - frozen->ln_gamma_nu );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// double Frozen_Gamma_Distribution( double x, const Frozen_Gamma *frozen )   //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns the Gamma distribution function, the regularized //
+//     incomplete gamma function P(nu,x), as Gamma_Distribution() but by      //
+//     Regularized_Incomplete_Gamma_P_Prepared() with ln(gamma*(nu))          //
+//     computed by Frozen_Gamma_Init().                                       //
+//                                                                            //
+//  Arguments:                                                                //
+//     double x                                                               //
+//        The argument of the distribution function.                          //
+//     const Frozen_Gamma *frozen                                             //
+//        A distribution initialized by Frozen_Gamma_Init().                  //
+//                                                                            //
+//  Return Values:                                                            //
+//     Pr[X <= x] where X has the Gamma distribution, a real number between 0 //
+//     and 1.                                                                 //
+//                                                                            //
+//  Example:                                                                  //
+//     Frozen_Gamma frozen;                                                   //
+//     double x, p;                                                           //
+//                                                                            //
+//     p = Frozen_Gamma_Distribution( x, &frozen );                           //
+////////////////////////////////////////////////////////////////////////////////
+
+double Frozen_Gamma_Distribution( double x, const Frozen_Gamma *frozen )
+{
+   if ( x <= 0.0 ) return 0.0;
+   return Regularized_Incomplete_Gamma_P_Prepared(x, frozen->nu,
+                                                       frozen->ln_gamma_star);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// double Frozen_Gamma_Survival( double x, const Frozen_Gamma *frozen )       //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns the survival function 1 -                        //
+//     Frozen_Gamma_Distribution(x, frozen) of the Gamma distribution, the    //
+//     regularized incomplete gamma function Q(nu,x) calculated directly by   //
+//     Regularized_Incomplete_Gamma_Q_Prepared() rather than by subtraction,  //
+//     so that small upper tail probabilities keep their relative accuracy.   //
+//                                                                            //
+//  Arguments:                                                                //
+//     double x                                                               //
+//        The argument of the survival function.                              //
+//     const Frozen_Gamma *frozen                                             //
+//        A distribution initialized by Frozen_Gamma_Init().                  //
+//                                                                            //
+//  Return Values:                                                            //
+//     Pr[X > x] where X has the Gamma distribution, a real number between 0  //
+//     and 1.                                                                 //
+//                                                                            //
+//  Example:                                                                  //
+//     Frozen_Gamma frozen;                                                   //
+//     double x, p;                                                           //
+//                                                                            //
+//     p = Frozen_Gamma_Survival( x, &frozen );                               //
+////////////////////////////////////////////////////////////////////////////////
+
+double Frozen_Gamma_Survival( double x, const Frozen_Gamma *frozen )
+{
+   if ( x <= 0.0 ) return 1.0;
+   return Regularized_Incomplete_Gamma_Q_Prepared(x, frozen->nu,
+                                                       frozen->ln_gamma_star);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// double Frozen_Gamma_Quantile( double p, const Frozen_Gamma *frozen )       //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns the quantile of the Gamma distribution, as       //
+//     Gamma_Quantile(), by Gamma_Quantile_Prepared() with the constants      //
+//     computed by Frozen_Gamma_Init().                                       //
+//                                                                            //
+//  Arguments:                                                                //
+//     double p                                                               //
+//        The probability, 0 < p < 1.                                         //
+//     const Frozen_Gamma *frozen                                             //
+//        A distribution initialized by Frozen_Gamma_Init().                  //
+//                                                                            //
+//  Return Values:                                                            //
+//     The quantile x such that Pr[X < x] = p.  If p = 0, then 0 is returned  //
+//     and if p = 1, then DBL_MAX is returned.  If p is NaN or outside [0,1], //
+//     or if nu is not positive, NaN is returned.                             //
+//                                                                            //
+//  Example:                                                                  //
+//     Frozen_Gamma frozen;                                                   //
+//     double p, x;                                                           //
+//                                                                            //
+//     x = Frozen_Gamma_Quantile( p, &frozen );                               //
+////////////////////////////////////////////////////////////////////////////////
+
+double Frozen_Gamma_Quantile( double p, const Frozen_Gamma *frozen )
+{
+   if ( !(p >= 0.0 && p <= 1.0) || !(frozen->nu > 0.0) ) return NAN;
+   if ( p <= 0.0 ) return 0.0;
+   if ( p >= 1.0 ) return DBL_MAX;
+   return Gamma_Quantile_Prepared(p, frozen->nu, frozen->ln_gamma_nu,
+                                                      frozen->ln_gamma_star);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// double Frozen_Gamma_Variate( const Frozen_Gamma *frozen )                  //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns a random variate with the Gamma distribution,    //
+//     drawn from the library's default generator state, see                  //
+//     Frozen_Gamma_Variate_r().                                              //
+//                                                                            //
+//  Arguments:                                                                //
+//     const Frozen_Gamma *frozen                                             //
+//        A distribution initialized by Frozen_Gamma_Init().                  //
+//                                                                            //
+//  Return Values:                                                            //
+//     A random number with the Gamma distribution.                           //
+//                                                                            //
+//  Example:                                                                  //
+//     Frozen_Gamma frozen;                                                   //
+//     double x;                                                              //
+//                                                                            //
+//     x = Frozen_Gamma_Variate( &frozen );                                   //
+////////////////////////////////////////////////////////////////////////////////
+
+double Frozen_Gamma_Variate( const Frozen_Gamma *frozen )
+{
+   return Frozen_Gamma_Variate_r( Uniform_0_1_Default_State(), frozen );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// double Frozen_Gamma_Variate_r( Random_State *state,                        //
+//                                const Frozen_Gamma *frozen )                //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns a Gamma distributed random variate generated by  //
+//     Gamma_Sampler_Variate_r() using the sampler prepared by                //
+//     Frozen_Gamma_Init().                                                   //
+//                                                                            //
+//  Arguments:                                                                //
+//     Random_State *state                                                    //
+//        The generator state from which the variates are drawn.              //
+//     const Frozen_Gamma *frozen                                             //
+//        A distribution initialized by Frozen_Gamma_Init().                  //
+//                                                                            //
+//  Return Values:                                                            //
+//     A random number with the Gamma distribution.                           //
+//                                                                            //
+//  Example:                                                                  //
+//     Frozen_Gamma frozen;                                                   //
+//     Random_State state;                                                    //
+//     double x;                                                              //
+//                                                                            //
+//     Random_State_Init( &state, 12345 );                                    //
+//     x = Frozen_Gamma_Variate_r( &state, &frozen );                         //
+////////////////////////////////////////////////////////////////////////////////
+
+double Frozen_Gamma_Variate_r( Random_State *state, const Frozen_Gamma *frozen )
+{
+   return Gamma_Sampler_Variate_r(state, &frozen->sampler);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// void Frozen_Gamma_Density_Array( double x[], double p[], int n,            //
+//                                  const Frozen_Gamma *frozen )              //
+//                                                                            //
+//  Description:                                                              //
+//     This function evaluates the density of the Gamma distribution at each  //
+//     of the n points x[0],...,x[n-1], setting p[i] =                        //
+//     Frozen_Gamma_Density(x[i], frozen).  p may be the same array as x.     //
+//                                                                            //
+//  Arguments:                                                                //
+//     double x[]                                                             //
+//        Array of n arguments.                                               //
+//     double p[]                                                             //
+//        Array of n elements which is set to the values.                     //
+//     int n                                                                  //
+//        The number of points.                                               //
+//     const Frozen_Gamma *frozen                                             //
+//        A distribution initialized by Frozen_Gamma_Init().                  //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     #define N 100                                                          //
+//     Frozen_Gamma frozen;                                                   //
+//     double x[N], p[N];                                                     //
+//                                                                            //
+//     Frozen_Gamma_Density_Array( x, p, N, &frozen );                        //
+////////////////////////////////////////////////////////////////////////////////
+
+void Frozen_Gamma_Density_Array( double x[], double p[], int n,
+                                                   const Frozen_Gamma *frozen )
+{
+   int i;
+
+   for (i = 0; i < n; i++) p[i] = Frozen_Gamma_Density(x[i], frozen);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// void Frozen_Gamma_Distribution_Array( double x[], double p[], int n,       //
+//                                       const Frozen_Gamma *frozen )         //
+//                                                                            //
+//  Description:                                                              //
+//     This function evaluates the distribution function of the Gamma         //
+//     distribution at each of the n points x[0],...,x[n-1], setting p[i] =   //
+//     Frozen_Gamma_Distribution(x[i], frozen).  p may be the same array as   //
+//     x.                                                                     //
+//                                                                            //
+//  Arguments:                                                                //
+//     double x[]                                                             //
+//        Array of n arguments.                                               //
+//     double p[]                                                             //
+//        Array of n elements which is set to the values.                     //
+//     int n                                                                  //
+//        The number of points.                                               //
+//     const Frozen_Gamma *frozen                                             //
+//        A distribution initialized by Frozen_Gamma_Init().                  //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     #define N 100                                                          //
+//     Frozen_Gamma frozen;                                                   //
+//     double x[N], p[N];                                                     //
+//                                                                            //
+//     Frozen_Gamma_Distribution_Array( x, p, N, &frozen );                   //
+////////////////////////////////////////////////////////////////////////////////
+
+void Frozen_Gamma_Distribution_Array( double x[], double p[], int n,
+                                                   const Frozen_Gamma *frozen )
+{
+   int i;
+
+   for (i = 0; i < n; i++) p[i] = Frozen_Gamma_Distribution(x[i], frozen);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// void Frozen_Gamma_Survival_Array( double x[], double p[], int n,           //
+//                                   const Frozen_Gamma *frozen )             //
+//                                                                            //
+//  Description:                                                              //
+//     This function evaluates the survival function of the Gamma             //
+//     distribution at each of the n points x[0],...,x[n-1], setting p[i] =   //
+//     Frozen_Gamma_Survival(x[i], frozen).  p may be the same array as x.    //
+//                                                                            //
+//  Arguments:                                                                //
+//     double x[]                                                             //
+//        Array of n arguments.                                               //
+//     double p[]                                                             //
+//        Array of n elements which is set to the values.                     //
+//     int n                                                                  //
+//        The number of points.                                               //
+//     const Frozen_Gamma *frozen                                             //
+//        A distribution initialized by Frozen_Gamma_Init().                  //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     #define N 100                                                          //
+//     Frozen_Gamma frozen;                                                   //
+//     double x[N], p[N];                                                     //
+//                                                                            //
+//     Frozen_Gamma_Survival_Array( x, p, N, &frozen );                       //
+////////////////////////////////////////////////////////////////////////////////
+
+void Frozen_Gamma_Survival_Array( double x[], double p[], int n,
+                                                   const Frozen_Gamma *frozen )
+{
+   int i;
+
+   for (i = 0; i < n; i++) p[i] = Frozen_Gamma_Survival(x[i], frozen);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// void Frozen_Gamma_Quantile_Array( double p[], double x[], int n,           //
+//                                   const Frozen_Gamma *frozen )             //
+//                                                                            //
+//  Description:                                                              //
+//     This function evaluates the quantile function of the Gamma             //
+//     distribution at each of the n points p[0],...,p[n-1], setting x[i] =   //
+//     Frozen_Gamma_Quantile(p[i], frozen).  x may be the same array as p.    //
+//                                                                            //
+//  Arguments:                                                                //
+//     double p[]                                                             //
+//        Array of n arguments.                                               //
+//     double x[]                                                             //
+//        Array of n elements which is set to the values.                     //
+//     int n                                                                  //
+//        The number of points.                                               //
+//     const Frozen_Gamma *frozen                                             //
+//        A distribution initialized by Frozen_Gamma_Init().                  //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     #define N 100                                                          //
+//     Frozen_Gamma frozen;                                                   //
+//     double p[N], x[N];                                                     //
+//                                                                            //
+//     Frozen_Gamma_Quantile_Array( p, x, N, &frozen );                       //
+////////////////////////////////////////////////////////////////////////////////
+
+void Frozen_Gamma_Quantile_Array( double p[], double x[], int n,
+                                                   const Frozen_Gamma *frozen )
+{
+   int i;
+
+   for (i = 0; i < n; i++) x[i] = Frozen_Gamma_Quantile(p[i], frozen);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// void Frozen_Gamma_Variate_Array( Random_State *state, double x[], int n,   //
+//                                  const Frozen_Gamma *frozen )              //
+//                                                                            //
+//  Description:                                                              //
+//     This function fills the array x[] with n Gamma distributed random      //
+//     variates generated by Gamma_Sampler_Variate_Array() using the sampler  //
+//     prepared by Frozen_Gamma_Init().                                       //
+//                                                                            //
+//  Arguments:                                                                //
+//     Random_State *state                                                    //
+//        The generator state from which the variates are drawn.              //
+//     double x[]                                                             //
+//        The array of at least n elements which is set to the variates.      //
+//     int n                                                                  //
+//        The number of variates to generate.                                 //
+//     const Frozen_Gamma *frozen                                             //
+//        A distribution initialized by Frozen_Gamma_Init().                  //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     #define N 1000                                                         //
+//     Frozen_Gamma frozen;                                                   //
+//     Random_State state;                                                    //
+//     double x[N];                                                           //
+//                                                                            //
+//     Random_State_Init( &state, 12345 );                                    //
+//     Frozen_Gamma_Variate_Array( &state, x, N, &frozen );                   //
+////////////////////////////////////////////////////////////////////////////////
+
+void Frozen_Gamma_Variate_Array( Random_State *state, double x[], int n,
+                                                   const Frozen_Gamma *frozen )
+{
+   Gamma_Sampler_Variate_Array(state, x, n, &frozen->sampler);
+}
@@ -0,0 +1,34 @@
+////////////////////////////////////////////////////////////////////////////////
+// File: frozen_gamma.h                                                       //
+// Type(s):                                                                   //
+//    Frozen_Gamma                                                            //
+////////////////////////////////////////////////////////////////////////////////
+#ifndef FROZEN_GAMMA_H
+#define FROZEN_GAMMA_H
+
+#include "../variates/random_state.h"
+#include "../variates/gamma_sampler.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Frozen_Gamma                                                               //
+//                                                                            //
+//  Description:                                                              //
+//     A Gamma distribution with shape parameter nu together with the         //
+//     constants which its density, distribution, quantile and variate        //
+//     routines would otherwise recalculate on each call, computed once by    //
+//     Frozen_Gamma_Init().                                                   //
+//                                                                            //
+//     ln_gamma_nu = ln(gamma(nu)), ln_gamma_star = ln(gamma*(nu)) is the     //
+//     scaled logarithm of the gamma function returned by                     //
+//     xRegularized_Incomplete_Gamma_Normalizer(nu), and sampler holds the    //
+//     constants of the method of Marsaglia and Tsang.                        //
+////////////////////////////////////////////////////////////////////////////////
+
+typedef struct {
+   double nu;
+   double ln_gamma_nu;
+   long double ln_gamma_star;
+   Gamma_Sampler sampler;
+} Frozen_Gamma;
+
+#endif
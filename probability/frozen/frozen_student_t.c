@@ -0,0 +1,494 @@
+////////////////////////////////////////////////////////////////////////////////
+// File: frozen_student_t.c                                                   //
+// Routine(s):                                                                //
+//    Frozen_Student_t_Init                                                   //
+//    Frozen_Student_t_Density                                                //
+//    Frozen_Student_t_Distribution                                           //
+//    Frozen_Student_t_Survival                                               //
+//    Frozen_Student_t_Quantile                                               //
+//    Frozen_Student_t_Variate                                                //
+//    Frozen_Student_t_Variate_r                                              //
+//    Frozen_Student_t_Density_Array                                          //
+//    Frozen_Student_t_Distribution_Array                                     //
+//    Frozen_Student_t_Survival_Array                                         //
+//    Frozen_Student_t_Quantile_Array                                         //
+//    Frozen_Student_t_Variate_Array                                          //
+////////////////////////////////////////////////////////////////////////////////
+
+#include <math.h>                    // required for exp(), log(), log1p(),
+                                     //              sqrt(), NAN
+#include <float.h>                   // required for DBL_MAX
+
+#include "frozen_student_t.h"
+
+//                    Required Externally Defined Routines                    //
+
+extern Random_State* Uniform_0_1_Default_State( void );
+extern double Ln_Beta_Function( double a, double b );
+extern long double xBeta_Function( long double a, long double b );
+extern double Beta_Distribution_Prepared( double x, double a, double b,
+                                                            long double beta );
+extern double Beta_Quantile_Prepared( double p, double a, double b,
+                                       double ln_beta_ab, long double beta );
+extern double Cauchy_Quantile( double p );
+extern double t2_Quantile( double p );
+extern void Student_t_Sampler_Init( Student_t_Sampler *sampler, double nu );
+extern double Student_t_Sampler_Variate_r( Random_State *state,
+                                            const Student_t_Sampler *sampler );
+extern void Student_t_Sampler_Variate_Array( Random_State *state, double x[],
+                                     int n, const Student_t_Sampler *sampler );
+
+//                    Required Internally Defined Routines                    //
+
+double Frozen_Student_t_Density( double x, const Frozen_Student_t *frozen );
+double Frozen_Student_t_Distribution( double x,
+                                              const Frozen_Student_t *frozen );
+double Frozen_Student_t_Survival( double x, const Frozen_Student_t *frozen );
+double Frozen_Student_t_Quantile( double p, const Frozen_Student_t *frozen );
+double Frozen_Student_t_Variate_r( Random_State *state,
+                                              const Frozen_Student_t *frozen );
+
+////////////////////////////////////////////////////////////////////////////////
+// void Frozen_Student_t_Init( Frozen_Student_t *frozen, double nu )          //
+//                                                                            //
+//  Description:                                                              //
+//     This function initializes frozen to Student's t-distribution with nu   //
+//     degrees of freedom, with density (1 + x^2/nu)^(-(nu+1)/2) / (sqrt(nu)  //
+//     B(nu/2,1/2)).  ln(B(nu/2,1/2)), B(nu/2,1/2) in extended precision, the //
+//     constant of the density and the constant of the variate generator are  //
+//     computed here once, so that the other Frozen_Student_t routines only   //
+//     evaluate the parts which depend on their argument.                     //
+//                                                                            //
+//  Arguments:                                                                //
+//     Frozen_Student_t *frozen                                               //
+//        The object to initialize.                                           //
+//     double nu                                                              //
+//        The number of degrees of freedom, nu > 0, which need not be an      //
+//        integer.                                                            //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     Frozen_Student_t frozen;                                               //
+//                                                                            //
+//     Frozen_Student_t_Init( &frozen, 4.0 );                                 //
+////////////////////////////////////////////////////////////////////////////////
+
+void Frozen_Student_t_Init( Frozen_Student_t *frozen, double nu )
+{
+   frozen->nu = nu;
+   frozen->a = 0.5 * nu;
+   frozen->ln_beta = Ln_Beta_Function(frozen->a, 0.5);
+   frozen->beta = xBeta_Function(frozen->a, 0.5);
+   frozen->exponent = -0.5 * (nu + 1.0);
+   frozen->ln_constant = -0.5 * log(nu) - frozen->ln_beta;
+   Student_t_Sampler_Init(&frozen->sampler, nu);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// double Frozen_Student_t_Density( double x,                                 //
+//                                  const Frozen_Student_t *frozen )          //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns the density of the t-distribution,               //
+//     exp(ln_constant + exponent ln(1 + x^2/nu)).                            //
+//                                                                            //
+//  Arguments:                                                                //
+//     double x                                                               //
+//        The argument of the density.                                        //
+//     const Frozen_Student_t *frozen                                         //
+//        A distribution initialized by Frozen_Student_t_Init().              //
+//                                                                            //
+//  Return Values:                                                            //
+//     The density of the t-distribution evaluated at x.                      //
+//                                                                            //
+//  Example:                                                                  //
+//     Frozen_Student_t frozen;                                               //
+//     double x, p;                                                           //
+//                                                                            //
+//     p = Frozen_Student_t_Density( x, &frozen );                            //
+////////////////////////////////////////////////////////////////////////////////
+
+double Frozen_Student_t_Density( double x, const Frozen_Student_t *frozen )
+{
+   return exp( frozen->ln_constant
+                          + frozen->exponent * log1p(x * x / frozen->nu) );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// double Frozen_Student_t_Distribution( double x,                            //
+//                                       const Frozen_Student_t *frozen )     //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns the t-distribution function, as                  //
+//     Student_t_Distribution(), from the Beta distribution with shape        //
+//     parameters nu/2 and 1/2 evaluated at nu / (nu + x^2) by                //
+//     Beta_Distribution_Prepared() with the B(nu/2,1/2) computed by          //
+//     Frozen_Student_t_Init().                                               //
+//                                                                            //
+//  Arguments:                                                                //
+//     double x                                                               //
+//        The argument of the distribution function.                          //
+//     const Frozen_Student_t *frozen                                         //
+//        A distribution initialized by Frozen_Student_t_Init().              //
+//                                                                            //
+//  Return Values:                                                            //
+//     Pr[X <= x] where X has the t-distribution, a real number between 0 and //
+//     1.                                                                     //
+//                                                                            //
+//  Example:                                                                  //
+//     Frozen_Student_t frozen;                                               //
+//     double x, p;                                                           //
+//                                                                            //
+//     p = Frozen_Student_t_Distribution( x, &frozen );                       //
+////////////////////////////////////////////////////////////////////////////////
+
+double Frozen_Student_t_Distribution( double x, const Frozen_Student_t *frozen )
+{
+   double beta = Beta_Distribution_Prepared( frozen->nu / (frozen->nu + x * x),
+                                         frozen->a, 0.5, frozen->beta );
+
+   if ( x > 0.0 ) return 1.0 - 0.5 * beta;
+   else if ( x < 0.0 ) return 0.5 * beta;
+   return 0.5;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// double Frozen_Student_t_Survival( double x,                                //
+//                                   const Frozen_Student_t *frozen )         //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns the survival function of the t-distribution,     //
+//     which by symmetry is the distribution function evaluated at -x.        //
+//                                                                            //
+//  Arguments:                                                                //
+//     double x                                                               //
+//        The argument of the survival function.                              //
+//     const Frozen_Student_t *frozen                                         //
+//        A distribution initialized by Frozen_Student_t_Init().              //
+//                                                                            //
+//  Return Values:                                                            //
+//     Pr[X > x] where X has the t-distribution, a real number between 0 and  //
+//     1.                                                                     //
+//                                                                            //
+//  Example:                                                                  //
+//     Frozen_Student_t frozen;                                               //
+//     double x, p;                                                           //
+//                                                                            //
+//     p = Frozen_Student_t_Survival( x, &frozen );                           //
+////////////////////////////////////////////////////////////////////////////////
+
+double Frozen_Student_t_Survival( double x, const Frozen_Student_t *frozen )
+{
+   return Frozen_Student_t_Distribution(-x, frozen);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// double Frozen_Student_t_Quantile( double p,                                //
+//                                   const Frozen_Student_t *frozen )         //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns the quantile of the t-distribution, as           //
+//     Student_t_Quantile(), from the quantile of the Beta distribution with  //
+//     shape parameters nu/2 and 1/2 evaluated by Beta_Quantile_Prepared()    //
+//     with the constants computed by Frozen_Student_t_Init(); B(nu/2,1/2) =  //
+//     B(1/2,nu/2), so the same constants serve for either order of the shape //
+//     parameters.  For 1 and 2 degrees of freedom the closed forms           //
+//     Cauchy_Quantile() and t2_Quantile() are used.                          //
+//                                                                            //
+//  Arguments:                                                                //
+//     double p                                                               //
+//        The probability, 0 < p < 1.                                         //
+//     const Frozen_Student_t *frozen                                         //
+//        A distribution initialized by Frozen_Student_t_Init().              //
+//                                                                            //
+//  Return Values:                                                            //
+//     The quantile x such that Pr[X < x] = p.  If p = 0, then -DBL_MAX is    //
+//     returned and if p = 1, then DBL_MAX is returned.  If p is NaN or       //
+//     outside [0,1], or if nu is not positive, NaN is returned.              //
+//                                                                            //
+//  Example:                                                                  //
+//     Frozen_Student_t frozen;                                               //
+//     double p, x;                                                           //
+//                                                                            //
+//     x = Frozen_Student_t_Quantile( p, &frozen );                           //
+////////////////////////////////////////////////////////////////////////////////
+
+double Frozen_Student_t_Quantile( double p, const Frozen_Student_t *frozen )
+{
+   double q = (p < 0.5) ? p : 1.0 - p;
+   double x, y;
+
+   if ( !(p >= 0.0 && p <= 1.0) || !(frozen->nu > 0.0) ) return NAN;
+   if ( p <= 0.0 ) return -DBL_MAX;
+   if ( p >= 1.0 ) return DBL_MAX;
+   if ( frozen->nu == 1.0 ) return Cauchy_Quantile(p);
+   if ( frozen->nu == 2.0 ) return t2_Quantile(p);
+
+   if ( q < 0.25 ) {
+      y = Beta_Quantile_Prepared(q + q, frozen->a, 0.5, frozen->ln_beta,
+                                                                frozen->beta);
+      x = sqrt( frozen->nu * (1.0 - y) / y );
+   }
+   else {
+      y = Beta_Quantile_Prepared(1.0 - (q + q), 0.5, frozen->a,
+                                               frozen->ln_beta, frozen->beta);
+      x = sqrt( frozen->nu * y / (1.0 - y) );
+   }
+   return (p < 0.5) ? -x : x;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// double Frozen_Student_t_Variate( const Frozen_Student_t *frozen )          //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns a random variate with the t-distribution, drawn  //
+//     from the library's default generator state, see                        //
+//     Frozen_Student_t_Variate_r().                                          //
+//                                                                            //
+//  Arguments:                                                                //
+//     const Frozen_Student_t *frozen                                         //
+//        A distribution initialized by Frozen_Student_t_Init().              //
+//                                                                            //
+//  Return Values:                                                            //
+//     A random number with the t-distribution.                               //
+//                                                                            //
+//  Example:                                                                  //
+//     Frozen_Student_t frozen;                                               //
+//     double x;                                                              //
+//                                                                            //
+//     x = Frozen_Student_t_Variate( &frozen );                               //
+////////////////////////////////////////////////////////////////////////////////
+
+double Frozen_Student_t_Variate( const Frozen_Student_t *frozen )
+{
+   return Frozen_Student_t_Variate_r( Uniform_0_1_Default_State(), frozen );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// double Frozen_Student_t_Variate_r( Random_State *state,                    //
+//                                    const Frozen_Student_t *frozen )        //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns a random variate with the t-distribution         //
+//     generated by Bailey's polar method, Student_t_Sampler_Variate_r(),     //
+//     using the sampler prepared by Frozen_Student_t_Init().                 //
+//                                                                            //
+//  Arguments:                                                                //
+//     Random_State *state                                                    //
+//        The generator state from which the variates are drawn.              //
+//     const Frozen_Student_t *frozen                                         //
+//        A distribution initialized by Frozen_Student_t_Init().              //
+//                                                                            //
+//  Return Values:                                                            //
+//     A random number with the t-distribution.                               //
+//                                                                            //
+//  Example:                                                                  //
+//     Frozen_Student_t frozen;                                               //
+//     Random_State state;                                                    //
+//     double x;                                                              //
+//                                                                            //
+//     Random_State_Init( &state, 12345 );                                    //
+//     x = Frozen_Student_t_Variate_r( &state, &frozen );                     //
+////////////////////////////////////////////////////////////////////////////////
+
+double Frozen_Student_t_Variate_r( Random_State *state,
+                                               const Frozen_Student_t *frozen )
+{
+   return Student_t_Sampler_Variate_r(state, &frozen->sampler);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// void Frozen_Student_t_Density_Array( double x[], double p[], int n,        //
+//                                      const Frozen_Student_t *frozen )      //
+//                                                                            //
+//  Description:                                                              //
+//     This function evaluates the density of the t-distribution at each of   //
+//     the n points x[0],...,x[n-1], setting p[i] =                           //
+//     Frozen_Student_t_Density(x[i], frozen).  p may be the same array as x. //
+//                                                                            //
+//  Arguments:                                                                //
+//     double x[]                                                             //
+//        Array of n arguments.                                               //
+//     double p[]                                                             //
+//        Array of n elements which is set to the values.                     //
+//     int n                                                                  //
+//        The number of points.                                               //
+//     const Frozen_Student_t *frozen                                         //
+//        A distribution initialized by Frozen_Student_t_Init().              //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     #define N 100                                                          //
+//     Frozen_Student_t frozen;                                               //
+//     double x[N], p[N];                                                     //
+//                                                                            //
+//     Frozen_Student_t_Density_Array( x, p, N, &frozen );                    //
+////////////////////////////////////////////////////////////////////////////////
+
+void Frozen_Student_t_Density_Array( double x[], double p[], int n,
+                                               const Frozen_Student_t *frozen )
+{
+   int i;
+
+   for (i = 0; i < n; i++) p[i] = Frozen_Student_t_Density(x[i], frozen);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// void Frozen_Student_t_Distribution_Array( double x[], double p[], int n,   //
+//                                           const Frozen_Student_t *frozen ) //
+//                                                                            //
+//  Description:                                                              //
+//     This function evaluates the distribution function of the               //
+//     t-distribution at each of the n points x[0],...,x[n-1], setting p[i] = //
+//     Frozen_Student_t_Distribution(x[i], frozen).  p may be the same array  //
+//     as x.                                                                  //
+//                                                                            //
+//  Arguments:                                                                //
+//     double x[]                                                             //
+//        Array of n arguments.                                               //
+//     double p[]                                                             //
+//        Array of n elements which is set to the values.                     //
+//     int n                                                                  //
+//        The number of points.                                               //
+//     const Frozen_Student_t *frozen                                         //
+//        A distribution initialized by Frozen_Student_t_Init().              //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     #define N 100                                                          //
+//     Frozen_Student_t frozen;                                               //
+//     double x[N], p[N];                                                     //
+//                                                                            //
+//     Frozen_Student_t_Distribution_Array( x, p, N, &frozen );               //
+////////////////////////////////////////////////////////////////////////////////
+
+void Frozen_Student_t_Distribution_Array( double x[], double p[], int n,
+                                               const Frozen_Student_t *frozen )
+{
+   int i;
+
+   for (i = 0; i < n; i++) p[i] = Frozen_Student_t_Distribution(x[i], frozen);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// void Frozen_Student_t_Survival_Array( double x[], double p[], int n,       //
+//                                       const Frozen_Student_t *frozen )     //
+//                                                                            //
+//  Description:                                                              //
+//     This function evaluates the survival function of the t-distribution at //
+//     each of the n points x[0],...,x[n-1], setting p[i] =                   //
+//     Frozen_Student_t_Survival(x[i], frozen).  p may be the same array as   //
+//     x.                                                                     //
+//                                                                            //
+//  Arguments:                                                                //
+//     double x[]                                                             //
+//        Array of n arguments.                                               //
+//     double p[]                                                             //
+//        Array of n elements which is set to the values.                     //
+//     int n                                                                  //
+//        The number of points.                                               //
+//     const Frozen_Student_t *frozen                                         //
+//        A distribution initialized by Frozen_Student_t_Init().              //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     #define N 100                                                          //
+//     Frozen_Student_t frozen;                                               //
+//     double x[N], p[N];                                                     //
+//                                                                            //
+//     Frozen_Student_t_Survival_Array( x, p, N, &frozen );                   //
+////////////////////////////////////////////////////////////////////////////////
+
+void Frozen_Student_t_Survival_Array( double x[], double p[], int n,
+                                               const Frozen_Student_t *frozen )
+{
+   int i;
+
+   for (i = 0; i < n; i++) p[i] = Frozen_Student_t_Survival(x[i], frozen);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// void Frozen_Student_t_Quantile_Array( double p[], double x[], int n,       //
+//                                       const Frozen_Student_t *frozen )     //
+//                                                                            //
+//  Description:                                                              //
+//     This function evaluates the quantile function of the t-distribution at //
+//     each of the n points p[0],...,p[n-1], setting x[i] =                   //
+//     Frozen_Student_t_Quantile(p[i], frozen).  x may be the same array as   //
+//     p.                                                                     //
+//                                                                            //
+//  Arguments:                                                                //
+//     double p[]                                                             //
+//        Array of n arguments.                                               //
+//     double x[]                                                             //
+//        Array of n elements which is set to the values.                     //
+//     int n                                                                  //
+//        The number of points.                                               //
+//     const Frozen_Student_t *frozen                                         //
+//        A distribution initialized by Frozen_Student_t_Init().              //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     #define N 100                                                          //
+//     Frozen_Student_t frozen;                                               //
+//     double p[N], x[N];                                                     //
+//                                                                            //
+//     Frozen_Student_t_Quantile_Array( p, x, N, &frozen );                   //
+////////////////////////////////////////////////////////////////////////////////
+
+void Frozen_Student_t_Quantile_Array( double p[], double x[], int n,
+                                               const Frozen_Student_t *frozen )
+{
+   int i;
+
+   for (i = 0; i < n; i++) x[i] = Frozen_Student_t_Quantile(p[i], frozen);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// void Frozen_Student_t_Variate_Array( Random_State *state, double x[],      //
+//                                      int n,                                //
+//                                      const Frozen_Student_t *frozen )      //
+//                                                                            //
+//  Description:                                                              //
+//     This function fills the array x[] with n random variates with the      //
+//     t-distribution generated by Student_t_Sampler_Variate_Array() using    //
+//     the sampler prepared by Frozen_Student_t_Init().                       //
+//                                                                            //
+//  Arguments:                                                                //
+//     Random_State *state                                                    //
+//        The generator state from which the variates are drawn.              //
+//     double x[]                                                             //
+//        The array of at least n elements which is set to the variates.      //
+//     int n                                                                  //
+//        The number of variates to generate.                                 //
+//     const Frozen_Student_t *frozen                                         //
+//        A distribution initialized by Frozen_Student_t_Init().              //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     #define N 1000                                                         //
+//     Frozen_Student_t frozen;                                               //
+//     Random_State state;                                                    //
+//     double x[N];                                                           //
+//                                                                            //
+//     Random_State_Init( &state, 12345 );                                    //
+//     Frozen_Student_t_Variate_Array( &state, x, N, &frozen );               //
+////////////////////////////////////////////////////////////////////////////////
+
+void Frozen_Student_t_Variate_Array( Random_State *state, double x[], int n,
+                                               const Frozen_Student_t *frozen )
+{
+   Student_t_Sampler_Variate_Array(state, x, n, &frozen->sampler);
+}
@@ -0,0 +1,36 @@
+////////////////////////////////////////////////////////////////////////////////
+// File: frozen_student_t.h                                                   //
+// Type(s):                                                                   //
+//    Frozen_Student_t                                                        //
+////////////////////////////////////////////////////////////////////////////////
+#ifndef FROZEN_STUDENT_T_H
+#define FROZEN_STUDENT_T_H
+
+#include "../variates/random_state.h"
+#include "../variates/student_t_sampler.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Frozen_Student_t                                                           //
+//                                                                            //
+//  Description:                                                              //
+//     A Student's t-distribution with nu degrees of freedom together with    //
+//     the constants which its density, distribution, quantile and variate    //
+//     routines would otherwise recalculate on each call, computed once by    //
+//     Frozen_Student_t_Init().                                               //
+//                                                                            //
+//     a = nu / 2, ln_beta = ln(B(a,1/2)), beta = B(a,1/2) in extended        //
+//     precision, exponent = -(nu + 1) / 2 and ln_constant = -ln(sqrt(nu)) -  //
+//     ln_beta, so that the density is exp(ln_constant + exponent ln(1 +      //
+//     x^2/nu)).  sampler holds the constant of Bailey's polar method.        //
+////////////////////////////////////////////////////////////////////////////////
+
+typedef struct {
+   double nu;
+   double a;
+   double ln_beta;
+   long double beta;
+   double exponent, ln_constant;
+   Student_t_Sampler sampler;
+} Frozen_Student_t;
+
+#endif
@@ -0,0 +1,441 @@
+////////////////////////////////////////////////////////////////////////////////
+// File: fisher_exact_test.c                                                  //
+// Routine(s):                                                                //
+//    Fisher_Exact_Cache_Init                                                 //
+//    Fisher_Exact_Cache_Reserve                                              //
+//    Fisher_Exact_Cache_Free                                                 //
+//    Fisher_Exact_Test                                                       //
+//    Fisher_Exact_Test_Array                                                 //
+////////////////////////////////////////////////////////////////////////////////
+
+#include <stdlib.h>                  // required for malloc(), realloc(), free()
+#include <math.h>                    // required for exp(), NAN
+#include <float.h>                   // required for DBL_EPSILON
+#include <limits.h>                  // required for INT_MAX
+
+#include "fisher_exact_test.h"
+
+//                    Required Externally Defined Routines                    //
+
+extern double Ln_Factorial( int n );
+
+//                    Required Internally Defined Routines                    //
+
+int Fisher_Exact_Cache_Reserve( Fisher_Exact_Cache *cache, int size );
+void Fisher_Exact_Test( int a, int b, int c, int d,
+          const Fisher_Exact_Cache *cache, double *less, double *greater,
+                                                          double *two_sided );
+static double Lower_Tail( int k, double p, int n1, int n2, int n, int minimum );
+static double Upper_Tail( int k, double p, int n1, int n2, int n, int maximum );
+
+//                         Internally Defined Constants                       //
+
+static const double ln_tie_tolerance = 1.0e-7;
+
+////////////////////////////////////////////////////////////////////////////////
+// int Fisher_Exact_Cache_Init( Fisher_Exact_Cache *cache, int size )         //
+//                                                                            //
+//                                                                            //
+//  Description:                                                              //
+//     This function sets up cache to hold ln(i!) for i = 0,...,size, so that //
+//     it serves Fisher_Exact_Test() for all 2 x 2 tables whose entries sum   //
+//     to at most size.                                                       //
+//                                                                            //
+//  Arguments:                                                                //
+//     Fisher_Exact_Cache *cache                                              //
+//        The cache to set up.  Its storage is allocated here and must be     //
+//        released by Fisher_Exact_Cache_Free().                              //
+//     int size                                                               //
+//        The largest total of the tables to be tested, size >= 0.            //
+//                                                                            //
+//  Return Values:                                                            //
+//     0 on success, -1 if size < 0 and -2 if memory could not be allocated.  //
+//                                                                            //
+//  Example:                                                                  //
+//     Fisher_Exact_Cache cache;                                              //
+//                                                                            //
+//     Fisher_Exact_Cache_Init( &cache, 10000 );                              //
+////////////////////////////////////////////////////////////////////////////////
+
+int Fisher_Exact_Cache_Init( Fisher_Exact_Cache *cache, int size )
+{
+   cache->size = -1;
+   cache->ln_factorial = NULL;
+   if ( size < 0 ) return -1;
+   return Fisher_Exact_Cache_Reserve( cache, size );
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// int Fisher_Exact_Cache_Reserve( Fisher_Exact_Cache *cache, int size )      //
+//                                                                            //
+//                                                                            //
+//  Description:                                                              //
+//     This function extends cache, if necessary, so that it holds ln(i!) for //
+//     i = 0,...,size.  The values already in the cache are kept and only the //
+//     new ones are calculated.                                               //
+//                                                                            //
+//  Arguments:                                                                //
+//     Fisher_Exact_Cache *cache                                              //
+//        A cache set up by Fisher_Exact_Cache_Init().                        //
+//     int size                                                               //
+//        The largest total of the tables to be tested.                       //
+//                                                                            //
+//  Return Values:                                                            //
+//     0 on success and -2 if memory could not be allocated, in which case    //
+//     the cache is unchanged.                                                //
+//                                                                            //
+//  Example:                                                                  //
+//     Fisher_Exact_Cache cache;                                              //
+//                                                                            //
+//     Fisher_Exact_Cache_Reserve( &cache, 20000 );                           //
+////////////////////////////////////////////////////////////////////////////////
+
+int Fisher_Exact_Cache_Reserve( Fisher_Exact_Cache *cache, int size )
+{
+   double *ln_factorial;
+   int i;
+
+   if ( size <= cache->size ) return 0;
+   ln_factorial = (double *) realloc( cache->ln_factorial,
+                                     ((size_t) size + 1) * sizeof(double) );
+   if ( ln_factorial == NULL ) return -2;
+   for (i = cache->size + 1; i <= size; i++)
+      ln_factorial[i] = Ln_Factorial(i);
+   cache->ln_factorial = ln_factorial;
+   cache->size = size;
+   return 0;
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// void Fisher_Exact_Cache_Free( Fisher_Exact_Cache *cache )                  //
+//                                                                            //
+//  Description:                                                              //
+//     This function releases the storage allocated by                        //
+//     Fisher_Exact_Cache_Init() and Fisher_Exact_Cache_Reserve().            //
+//                                                                            //
+//  Arguments:                                                                //
+//     Fisher_Exact_Cache *cache                                              //
+//        A cache set up by Fisher_Exact_Cache_Init().                        //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     Fisher_Exact_Cache cache;                                              //
+//                                                                            //
+//     Fisher_Exact_Cache_Free( &cache );                                     //
+////////////////////////////////////////////////////////////////////////////////
+
+void Fisher_Exact_Cache_Free( Fisher_Exact_Cache *cache )
+{
+   free( cache->ln_factorial );
+   cache->ln_factorial = NULL;
+   cache->size = -1;
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// void Fisher_Exact_Test( int a, int b, int c, int d,                        //
+//                        const Fisher_Exact_Cache *cache, double *less,      //
+//                        double *greater, double *two_sided )                //
+//                                                                            //
+//  Description:                                                              //
+//     This function performs Fisher's exact test of independence on the 2 x  //
+//     2 table                                                                //
+//                            a  b                                            //
+//                            c  d                                            //
+//     Conditional on the margins n1 = a + c, n2 = b + d and n = a + b, the   //
+//     entry a has the hypergeometric distribution of the number of 1's among //
+//     n objects drawn without replacement from n1 objects labeled 1 and n2   //
+//     objects labeled 0,                                                     //
+//     Pr[X = k] = C(n1,k) C(n2,n-k) / C(n1 + n2,n),                          //
+//     and the p-values are                                                   //
+//     less       Pr[X <= a],                                                 //
+//     greater    Pr[X >= a],                                                 //
+//     two_sided  the sum of Pr[X = k] over those k with                      //
+//                Pr[X = k] <= Pr[X = a].                                     //
+//     A relative tolerance of 1.0e-7 is allowed in the comparison of the     //
+//     two-sided p-value for rounding errors.                                 //
+//                                                                            //
+//     Pr[X = k] is calculated in constant time from the cached logarithms of //
+//     the factorials.  Each tail is summed from its boundary away from the   //
+//     mode using the recurrence between consecutive terms, stopping once the //
+//     terms no longer change the sum, so that only the terms which           //
+//     contribute to the p-values are evaluated.  A tail which would have to  //
+//     be summed through the mode is instead calculated as one minus the      //
+//     complementary tail.  The boundaries of the two-sided p-value, the last //
+//     k below the mode and the first k above it with Pr[X = k] <= Pr[X = a], //
+//     are found by bisection on the logarithms of the probabilities.  The    //
+//     relative error of the p-values is then dominated by that of ln Pr[X =  //
+//     a], roughly (a + b + c + d) DBL_EPSILON times the logarithm of the     //
+//     total.                                                                 //
+//                                                                            //
+//     If an entry is negative or a + b + c + d exceeds the size of the       //
+//     cache, the p-values are set to NaN rather than read past the end of    //
+//     the cache.                                                             //
+//                                                                            //
+//  Arguments:                                                                //
+//     int a                                                                  //
+//        The entry in the first row and first column, a >= 0.                //
+//     int b                                                                  //
+//        The entry in the first row and second column, b >= 0.               //
+//     int c                                                                  //
+//        The entry in the second row and first column, c >= 0.               //
+//     int d                                                                  //
+//        The entry in the second row and second column, d >= 0.              //
+//     const Fisher_Exact_Cache *cache                                        //
+//        A cache whose size is at least a + b + c + d, see                   //
+//        Fisher_Exact_Cache_Init() and Fisher_Exact_Cache_Reserve().         //
+//     double *less                                                           //
+//        If not NULL, set to the p-value for the alternative that the odds   //
+//        ratio is less than 1.                                               //
+//     double *greater                                                        //
+//        If not NULL, set to the p-value for the alternative that the odds   //
+//        ratio is greater than 1.                                            //
+//     double *two_sided                                                      //
+//        If not NULL, set to the two-sided p-value.                          //
+//                                                                            //
+//  Return Values:                                                            //
+//     None.  The p-values are NaN if an entry is negative or the cache is    //
+//     too small for the table.                                               //
+//                                                                            //
+//  Example:                                                                  //
+//     Fisher_Exact_Cache cache;                                              //
+//     double less, greater, two_sided;                                       //
+//                                                                            //
+//     Fisher_Exact_Cache_Init( &cache, 100 );                                //
+//     Fisher_Exact_Test( 3, 1, 1, 3, &cache, &less, &greater, &two_sided );  //
+////////////////////////////////////////////////////////////////////////////////
+
+void Fisher_Exact_Test( int a, int b, int c, int d,
+          const Fisher_Exact_Cache *cache, double *less, double *greater,
+                                                          double *two_sided )
+{
+   const double *lnf = cache->ln_factorial;
+   int n1, n2, n, minimum, maximum, mode;
+   double ln_norm, ln_p, threshold, p, sum;
+   int low, high, middle, left, right;
+
+   if ( a < 0 || b < 0 || c < 0 || d < 0 || lnf == NULL
+        || (long long) a + b + c + d > (long long) cache->size ) {
+      if ( less != NULL ) *less = NAN;
+      if ( greater != NULL ) *greater = NAN;
+      if ( two_sided != NULL ) *two_sided = NAN;
+      return;
+   }
+
+   n1 = a + c;
+   n2 = b + d;
+   n = a + b;
+   minimum = (n <= n2) ? 0 : n - n2;
+   maximum = (n <= n1) ? n : n1;
+   mode = (int) ( ((double)(n + 1) * (double)(n1 + 1))
+                                                   / (double)(n1 + n2 + 2) );
+   ln_norm = lnf[n1] + lnf[n2] + lnf[n] + lnf[c + d] - lnf[n1 + n2];
+
+#define LN_PMF(k) (ln_norm - lnf[k] - lnf[n1 - (k)] - lnf[n - (k)] \
+                                                     - lnf[n2 - n + (k)])
+
+   if ( mode > maximum ) mode = maximum;
+   ln_p = LN_PMF(a);
+   p = exp(ln_p);
+
+   if ( less != NULL ) {
+      if ( a <= mode ) sum = Lower_Tail(a, p, n1, n2, n, minimum);
+      else if ( a >= maximum ) sum = 1.0;
+      else sum = 1.0 - Upper_Tail(a + 1, exp(LN_PMF(a + 1)), n1, n2, n,
+                                                                    maximum);
+      *less = ( sum < 1.0 ) ? ( (sum > 0.0) ? sum : 0.0 ) : 1.0;
+   }
+
+   if ( greater != NULL ) {
+      if ( a >= mode ) sum = Upper_Tail(a, p, n1, n2, n, maximum);
+      else if ( a <= minimum ) sum = 1.0;
+      else sum = 1.0 - Lower_Tail(a - 1, exp(LN_PMF(a - 1)), n1, n2, n,
+                                                                    minimum);
+      *greater = ( sum < 1.0 ) ? ( (sum > 0.0) ? sum : 0.0 ) : 1.0;
+   }
+
+   if ( two_sided == NULL ) return;
+   threshold = ln_p + ln_tie_tolerance;
+   if ( LN_PMF(mode) <= threshold ) { *two_sided = 1.0; return; }
+
+              // Find the last k < mode and the first k > mode whose //
+              // probabilities do not exceed Pr[X = a].              //
+
+   low = minimum - 1;
+   high = mode;
+   while ( high - low > 1 ) {
+      middle = low + (high - low) / 2;
+      if ( LN_PMF(middle) <= threshold ) low = middle; else high = middle;
+   }
+   left = low;
+   low = mode;
+   high = maximum + 1;
+   while ( high - low > 1 ) {
+      middle = low + (high - low) / 2;
+      if ( LN_PMF(middle) <= threshold ) high = middle; else low = middle;
+   }
+   right = high;
+
+   sum = 0.0;
+   if ( left >= minimum )
+      sum += Lower_Tail(left, exp(LN_PMF(left)), n1, n2, n, minimum);
+   if ( right <= maximum )
+      sum += Upper_Tail(right, exp(LN_PMF(right)), n1, n2, n, maximum);
+   *two_sided = ( sum < 1.0 ) ? sum : 1.0;
+
+#undef LN_PMF
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// int Fisher_Exact_Test_Array( const int a[], const int b[], const int c[],  //
+//                           const int d[], double less[], double greater[],  //
+//                  double two_sided[], int n, Fisher_Exact_Cache *cache )    //
+//                                                                            //
+//  Description:                                                              //
+//     This function performs Fisher's exact test, see Fisher_Exact_Test(),   //
+//     on each of the n 2 x 2 tables                                          //
+//                        a[i]  b[i]                                          //
+//                        c[i]  d[i]                                          //
+//     i = 0,...,n-1.  The cache is first extended, if necessary, to the      //
+//     largest total of the tables, after which the tests share the cached    //
+//     logarithms of the factorials and no further memory is allocated.  The  //
+//     same cache can be passed to successive calls, so that the logarithms   //
+//     of the factorials are calculated only once for a sequence of batches.  //
+//                                                                            //
+//  Arguments:                                                                //
+//     const int a[], b[], c[], d[]                                           //
+//        Arrays of n elements holding the entries of the tables, all >= 0.   //
+//     double less[]                                                          //
+//        If not NULL, an array of n elements which is set to the p-values    //
+//        for the alternative that the odds ratio is less than 1.             //
+//     double greater[]                                                       //
+//        If not NULL, an array of n elements which is set to the p-values    //
+//        for the alternative that the odds ratio is greater than 1.          //
+//     double two_sided[]                                                     //
+//        If not NULL, an array of n elements which is set to the two-sided   //
+//        p-values.                                                           //
+//     int n                                                                  //
+//        The number of tables.                                               //
+//     Fisher_Exact_Cache *cache                                              //
+//        A cache set up by Fisher_Exact_Cache_Init().                        //
+//                                                                            //
+//  Return Values:                                                            //
+//     0 on success, -1 if an entry is negative or the total of a table       //
+//     exceeds INT_MAX, and -2 if the cache could not be extended.  In either //
+//     case of failure no tests are performed.                                //
+//                                                                            //
+//  Example:                                                                  //
+//     #define N 1000                                                         //
+//     Fisher_Exact_Cache cache;                                              //
+//     int a[N], b[N], c[N], d[N];                                            //
+//     double p[N];                                                           //
+//                                                                            //
+//     Fisher_Exact_Cache_Init( &cache, 0 );                                  //
+//     Fisher_Exact_Test_Array( a, b, c, d, NULL, NULL, p, N, &cache );       //
+//     Fisher_Exact_Cache_Free( &cache );                                     //
+////////////////////////////////////////////////////////////////////////////////
+
+int Fisher_Exact_Test_Array( const int a[], const int b[], const int c[],
+           const int d[], double less[], double greater[], double two_sided[],
+                                         int n, Fisher_Exact_Cache *cache )
+{
+   long long total;
+   int size = 0;
+   int i;
+
+   for (i = 0; i < n; i++) {
+      if ( a[i] < 0 || b[i] < 0 || c[i] < 0 || d[i] < 0 ) return -1;
+      total = (long long) a[i] + b[i] + c[i] + d[i];
+      if ( total > INT_MAX ) return -1;
+      if ( total > size ) size = (int) total;
+   }
+   if ( Fisher_Exact_Cache_Reserve( cache, size ) != 0 ) return -2;
+
+   for (i = 0; i < n; i++)
+      Fisher_Exact_Test( a[i], b[i], c[i], d[i], cache,
+                                         (less != NULL) ? &less[i] : NULL,
+                                   (greater != NULL) ? &greater[i] : NULL,
+                                (two_sided != NULL) ? &two_sided[i] : NULL );
+   return 0;
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// static double Lower_Tail( int k, double p, int n1, int n2, int n,          //
+//                                                          int minimum )     //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns Pr[X <= k] given p = Pr[X = k], where k is at    //
+//     most the mode, by summing the terms Pr[X = j], j = k, k-1, ...,        //
+//     minimum, until they no longer change the sum.                          //
+//                                                                            //
+//  Arguments:                                                                //
+//     int k                                                                  //
+//        The upper limit of the sum, minimum <= k <= mode.                   //
+//     double p                                                               //
+//        Pr[X = k].                                                          //
+//     int n1, n2, n                                                          //
+//        The parameters of the hypergeometric distribution.                  //
+//     int minimum                                                            //
+//        max(0, n - n2), the smallest possible value of X.                   //
+//                                                                            //
+//  Return Values:                                                            //
+//     Pr[X <= k].                                                            //
+////////////////////////////////////////////////////////////////////////////////
+
+static double Lower_Tail( int k, double p, int n1, int n2, int n, int minimum )
+{
+   double sum = p;
+   int i;
+
+   for (i = k; i > minimum; i--) {
+      p *= (double) i * (double)(n2 - n + i)
+                              / ((double)(n1 - i + 1) * (double)(n - i + 1));
+      if ( p <= DBL_EPSILON * sum ) break;
+      sum += p;
+   }
+   return sum;
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// static double Upper_Tail( int k, double p, int n1, int n2, int n,          //
+//                                                          int maximum )     //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns Pr[X >= k] given p = Pr[X = k], where k is at    //
+//     least the mode, by summing the terms Pr[X = j], j = k, k+1, ...,       //
+//     maximum, until they no longer change the sum.                          //
+//                                                                            //
+//  Arguments:                                                                //
+//     int k                                                                  //
+//        The lower limit of the sum, mode <= k <= maximum.                   //
+//     double p                                                               //
+//        Pr[X = k].                                                          //
+//     int n1, n2, n                                                          //
+//        The parameters of the hypergeometric distribution.                  //
+//     int maximum                                                            //
+//        min(n, n1), the largest possible value of X.                        //
+//                                                                            //
+//  Return Values:                                                            //
+//     Pr[X >= k].                                                            //
+////////////////////////////////////////////////////////////////////////////////
+
+static double Upper_Tail( int k, double p, int n1, int n2, int n, int maximum )
+{
+   double sum = p;
+   int i;
+
+   for (i = k; i < maximum; i++) {
+      p *= (double)(n1 - i) * (double)(n - i)
+                                / ((double)(i + 1) * (double)(n2 - n + i + 1));
+      if ( p <= DBL_EPSILON * sum ) break;
+      sum += p;
+   }
+   return sum;
+}
@@ -0,0 +1,29 @@
+////////////////////////////////////////////////////////////////////////////////
+// File: fisher_exact_test.h                                                  //
+// Type(s):                                                                   //
+//    Fisher_Exact_Cache                                                      //
+////////////////////////////////////////////////////////////////////////////////
+#ifndef FISHER_EXACT_TEST_H
+#define FISHER_EXACT_TEST_H
+
+////////////////////////////////////////////////////////////////////////////////
+// Fisher_Exact_Cache                                                         //
+//                                                                            //
+//  Description:                                                              //
+//     A table of the logarithms of the factorials, ln_factorial[i] = ln(i!)  //
+//     as returned by Ln_Factorial(i) for i = 0,...,size, from which the      //
+//     hypergeometric probabilities of a 2 x 2 table with at most size        //
+//     entries are calculated by Fisher_Exact_Test() without calling          //
+//     Ln_Factorial().                                                        //
+//                                                                            //
+//     The table is allocated by Fisher_Exact_Cache_Init(), extended by       //
+//     Fisher_Exact_Cache_Reserve() and released by                           //
+//     Fisher_Exact_Cache_Free().                                             //
+////////////////////////////////////////////////////////////////////////////////
+
+typedef struct {
+   int size;
+   double *ln_factorial;
+} Fisher_Exact_Cache;
+
+#endif
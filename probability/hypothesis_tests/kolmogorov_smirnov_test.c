@@ -0,0 +1,192 @@
+////////////////////////////////////////////////////////////////////////////////
+// File: kolmogorov_smirnov_test.c                                            //
+// Routine(s):                                                                //
+//    Kolmogorov_Smirnov_Statistic                                            //
+//    Kolmogorov_Smirnov_Test                                                 //
+//    Kolmogorov_Smirnov_Test_Array                                           //
+////////////////////////////////////////////////////////////////////////////////
+
+#include <stdlib.h>                                  // required for qsort()
+
+//                    Required Externally Defined Routines                    //
+
+extern double Kolmogorov_Distribution_Complement( double dn, int sample_size );
+
+//                    Required Internally Defined Routines                    //
+
+double Kolmogorov_Smirnov_Statistic( double x[], int n, double (*F)(double) );
+static int Compare( const void *a, const void *b );
+
+////////////////////////////////////////////////////////////////////////////////
+// double Kolmogorov_Smirnov_Statistic( double x[], int n,                    //
+//                                                      double (*F)(double) ) //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns the Kolmogorov-Smirnov statistic                 //
+//             Dn = sup {|FN(x) - F(x)| : for all x}                          //
+//     of the sample x[0],...,x[n-1], where FN is the empirical distribution  //
+//     function of the sample and F the continuous distribution function      //
+//     under test.  The sample is sorted in place, after which F is evaluated //
+//     once at each point in a single pass, Dn being the maximum of i/n -     //
+//     F(x[i-1]) and F(x[i-1]) - (i-1)/n over i = 1,...,n.                    //
+//                                                                            //
+//  Arguments:                                                                //
+//     double x[]                                                             //
+//        The sample.  On return it is sorted in increasing order.            //
+//     int n                                                                  //
+//        The sample size, n >= 1.                                            //
+//     double (*F)(double)                                                    //
+//        The distribution function under test, e.g. Gaussian_Distribution(). //
+//                                                                            //
+//  Return Values:                                                            //
+//     The Kolmogorov-Smirnov statistic Dn.                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     #define N 50                                                           //
+//     extern double Gaussian_Distribution(double x);                         //
+//     double x[N], dn;                                                       //
+//                                                                            //
+//     dn = Kolmogorov_Smirnov_Statistic( x, N, Gaussian_Distribution );      //
+////////////////////////////////////////////////////////////////////////////////
+
+double Kolmogorov_Smirnov_Statistic( double x[], int n, double (*F)(double) )
+{
+   double dn = 0.0;
+   double f, d;
+   int i;
+
+   qsort(x, n, sizeof(double), Compare);
+   for (i = 0; i < n; i++) {
+      f = F(x[i]);
+      d = (double)(i + 1) / (double) n - f;
+      if ( d > dn ) dn = d;
+      d = f - (double) i / (double) n;
+      if ( d > dn ) dn = d;
+   }
+   return dn;
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// double Kolmogorov_Smirnov_Test( double x[], int n, double (*F)(double),    //
+//                                                               double *dn ) //
+//                                                                            //
+//  Description:                                                              //
+//     This function tests the hypothesis that the sample x[0],...,x[n-1] is  //
+//     drawn from the continuous distribution F.  It returns the p-value      //
+//     Kolmogorov_Distribution_Complement(Dn, n) of the Kolmogorov-Smirnov    //
+//     statistic Dn, see Kolmogorov_Smirnov_Statistic(), using the exact      //
+//     distribution for the sample size rather than the limiting one.  The    //
+//     upper tail is calculated directly, so that small p-values keep their   //
+//     relative accuracy.                                                     //
+//                                                                            //
+//  Arguments:                                                                //
+//     double x[]                                                             //
+//        The sample.  On return it is sorted in increasing order.            //
+//     int n                                                                  //
+//        The sample size, n >= 1.                                            //
+//     double (*F)(double)                                                    //
+//        The distribution function under test.                               //
+//     double *dn                                                             //
+//        If not NULL, set to the statistic Dn.                               //
+//                                                                            //
+//  Return Values:                                                            //
+//     The probability, under the hypothesis, of a statistic at least as      //
+//     large as Dn.                                                           //
+//                                                                            //
+//  Example:                                                                  //
+//     #define N 50                                                           //
+//     extern double Gaussian_Distribution(double x);                         //
+//     double x[N], dn, p;                                                    //
+//                                                                            //
+//     p = Kolmogorov_Smirnov_Test( x, N, Gaussian_Distribution, &dn );       //
+////////////////////////////////////////////////////////////////////////////////
+
+double Kolmogorov_Smirnov_Test( double x[], int n, double (*F)(double),
+                                                                   double *dn )
+{
+   double d = Kolmogorov_Smirnov_Statistic(x, n, F);
+
+   if ( dn != NULL ) *dn = d;
+   return Kolmogorov_Distribution_Complement(d, n);
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// void Kolmogorov_Smirnov_Test_Array( double x[], int n, int samples,        //
+//                   double (*F)(double), double dn[], double p_value[] )     //
+//                                                                            //
+//  Description:                                                              //
+//     This function performs the Kolmogorov-Smirnov test of                  //
+//     Kolmogorov_Smirnov_Test() on each of the samples                       //
+//     x[s*n],...,x[s*n+n-1], s = 0,...,samples-1, stored one after the other //
+//     in x[].  Each sample is sorted once in place and its statistic         //
+//     evaluated in a single pass, see Kolmogorov_Smirnov_Statistic().  The   //
+//     p-value of sample s is Kolmogorov_Distribution_Complement(dn[s], n).   //
+//                                                                            //
+//  Arguments:                                                                //
+//     double x[]                                                             //
+//        The samples, samples * n elements.  On return each sample is sorted //
+//        in increasing order.                                                //
+//     int n                                                                  //
+//        The common sample size, n >= 1.                                     //
+//     int samples                                                            //
+//        The number of samples.                                              //
+//     double (*F)(double)                                                    //
+//        The distribution function under test.                               //
+//     double dn[]                                                            //
+//        If not NULL, an array of samples elements which is set to the       //
+//        statistics.                                                         //
+//     double p_value[]                                                       //
+//        An array of samples elements which is set to the p-values.          //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     #define N 50                                                           //
+//     #define SAMPLES 1000                                                   //
+//     extern double Gaussian_Distribution(double x);                         //
+//     double x[SAMPLES * N], p[SAMPLES];                                     //
+//                                                                            //
+//     Kolmogorov_Smirnov_Test_Array( x, N, SAMPLES, Gaussian_Distribution,   //
+//                                                                 NULL, p ); //
+////////////////////////////////////////////////////////////////////////////////
+
+void Kolmogorov_Smirnov_Test_Array( double x[], int n, int samples,
+                    double (*F)(double), double dn[], double p_value[] )
+{
+   double d;
+   int s;
+
+   for (s = 0; s < samples; s++) {
+      d = Kolmogorov_Smirnov_Statistic(&x[s * n], n, F);
+      if ( dn != NULL ) dn[s] = d;
+      p_value[s] = Kolmogorov_Distribution_Complement(d, n);
+   }
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+//  static int Compare( const void *a, const void *b )                        //
+//                                                                            //
+//  Description:                                                              //
+//     The comparison function for qsort() ordering doubles increasingly.     //
+//                                                                            //
+//  Arguments:                                                                //
+//     const void *a                                                          //
+//        Pointer to the first double.                                        //
+//     const void *b                                                          //
+//        Pointer to the second double.                                       //
+//                                                                            //
+//  Return Values:                                                            //
+//     -1, 0 or 1 as *a is less than, equal to or greater than *b.            //
+////////////////////////////////////////////////////////////////////////////////
+
+static int Compare( const void *a, const void *b )
+{
+   double x = *(const double *) a;
+   double y = *(const double *) b;
+
+   return ( x < y ) ? -1 : ( x > y );
+}
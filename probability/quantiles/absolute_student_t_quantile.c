@@ -0,0 +1,58 @@
+////////////////////////////////////////////////////////////////////////////////
+// File: absolute_student_t_quantile.c                                        //
+// Routine(s):                                                                //
+//    Absolute_Student_t_Quantile                                             //
+////////////////////////////////////////////////////////////////////////////////
+
+#include <math.h>                 // required for sqrt(), NAN
+#include <float.h>                // required for DBL_MAX
+
+//                         Externally Defined Routines                        //
+
+extern double Beta_Quantile(double p, double a, double b);
+
+////////////////////////////////////////////////////////////////////////////////
+// double Absolute_Student_t_Quantile( double p, int n )                      //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns the quantile x of the absolute value of a random //
+//     variable with Student's t-distribution with n degrees of freedom, the  //
+//     solution of Absolute_Student_t_Distribution(x, n) = p.  Since          //
+//     1 - p = B(n/(n+x^2), n/2, 1/2) where B(,,) is the incomplete beta      //
+//     function, x^2 = n (1 - z) / z where z = Beta_Quantile(1 - p, n/2, 1/2) //
+//     for p > 1/2, and x^2 = n y / (1 - y) where                             //
+//     y = Beta_Quantile(p, 1/2, n/2) for p <= 1/2.                           //
+//                                                                            //
+//  Arguments:                                                                //
+//     double p   The probability, 0 < p < 1.                                 //
+//     int    n   The number of degrees of freedom, n >= 1.                   //
+//                                                                            //
+//  Return Values:                                                            //
+//     The quantile x such that Pr[|X| < x] = p where X has a t-distribution  //
+//     with n degrees of freedom.  If p = 0, then 0 is returned and if p = 1, //
+//     then DBL_MAX is returned.  If p is NaN or outside [0,1], or if n < 1,  //
+//     NaN is returned.                                                       //
+//                                                                            //
+//  Example:                                                                  //
+//     double p, x;                                                           //
+//     int    n;                                                              //
+//                                                                            //
+//     x = Absolute_Student_t_Quantile(p, n);                                 //
+////////////////////////////////////////////////////////////////////////////////
+
+double Absolute_Student_t_Quantile( double p, int n )
+{
+   double a = 0.5 * (double) n;
+   double y;
+
+   if ( !(p >= 0.0 && p <= 1.0) || n < 1 ) return NAN;
+   if ( p <= 0.0 ) return 0.0;
+   if ( p >= 1.0 ) return DBL_MAX;
+
+   if ( p > 0.5 ) {
+      y = Beta_Quantile(1.0 - p, a, 0.5);
+      return sqrt( n * (1.0 - y) / y );
+   }
+   y = Beta_Quantile(p, 0.5, a);
+   return sqrt( n * y / (1.0 - y) );
+}
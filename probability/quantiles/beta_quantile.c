@@ -0,0 +1,230 @@
+////////////////////////////////////////////////////////////////////////////////
+// File: beta_quantile.c                                                      //
+// Routine(s):                                                                //
+//    Beta_Quantile                                                           //
+//    Beta_Quantile_Prepared                                                  //
+////////////////////////////////////////////////////////////////////////////////
+
+#include <math.h>                 // required for exp(), expm1(), log(),
+                                  //              log1p(), sqrt(), fabs(), NAN
+#include <float.h>                // required for DBL_MIN, DBL_EPSILON, DBL_MAX
+
+//                         Externally Defined Routines                        //
+
+extern double Beta_Distribution_Prepared(double x, double a, double b,
+                                                             long double beta);
+extern double Regularized_Incomplete_Beta_Complement_Prepared( double x,
+                                        double a, double b, long double beta );
+extern double Gaussian_Quantile(double p);
+extern double Ln_Beta_Function(double a, double b);
+extern long double xBeta_Function(long double a, long double b);
+
+//                         Internally Defined Routines                        //
+
+double Beta_Quantile_Prepared( double p, double a, double b,
+                                      double ln_beta_ab, long double beta );
+
+//                         Internally Defined Constants                       //
+
+static const int max_iterations = 128;
+static const double halley_tolerance = 1.0e-6;
+
+////////////////////////////////////////////////////////////////////////////////
+// double Beta_Quantile( double p, double a, double b )                       //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns the quantile x of the Beta distribution with     //
+//     shape parameters a and b, the solution of Beta_Distribution(x, a, b)   //
+//     = p.                                                                   //
+//                                                                            //
+//     The starting value is the leading term of the distribution at          //
+//     whichever end of (0,1) the quantile lies, P(x) ~ x^a / (a B(a,b)) or   //
+//     1 - P(x) ~ (1-x)^b / (b B(a,b)).  If the next term of that expansion   //
+//     is not small and a >= 1 and b >= 1, the approximation 26.5.22 of       //
+//     Abramowitz and Stegun is used instead,                                 //
+//                      x = a / (a + b exp(2w)),                              //
+//     where w = y sqrt(h + L) / h - (1/(2b-1) - 1/(2a-1)) (L + 5/6 - 2/(3h)) //
+//     with y = -z, z the standard Gaussian quantile of p, L = (y^2 - 3) / 6  //
+//     and h = 2 / (1/(2a-1) + 1/(2b-1)).  The starting value is refined by   //
+//     Halley's method applied to ln P(x) - ln p as a function of ln x if     //
+//     p <= 1/2, and to ln(1-p) - ln(1-P(x)) as a function of -ln(1-x)        //
+//     otherwise, where P(x) is the Beta distribution, with 1 - P(x)          //
+//     calculated directly rather than by subtraction.  In these variables    //
+//     the distribution is close to linear far into either tail, so that a    //
+//     distant starting value costs only a few more steps, and the relative   //
+//     accuracy of p is kept even for very small tail probabilities.  The     //
+//     solution is kept bracketed in (0,1) and a step which leaves the        //
+//     bracket or fails to halve the error is replaced by bisection, which is //
+//     geometric if the bracket lies within (0,1/2) or (1/2,1).  The          //
+//     iteration stops once a correction is less than 1.0e-6 min(x,1-x) and   //
+//     the Halley term is small, and usually takes two or three evaluations   //
+//     of the distribution.  B(a,b) is calculated once for all of them, see   //
+//     Beta_Quantile_Prepared().                                              //
+//                                                                            //
+//  Arguments:                                                                //
+//     double p   The probability, 0 < p < 1.                                 //
+//     double a   The shape parameter of the Beta distribution associated     //
+//                with x, a > 0.                                              //
+//     double b   The shape parameter of the Beta distribution associated     //
+//                with 1 - x, b > 0.                                          //
+//                                                                            //
+//  Return Values:                                                            //
+//     The quantile x such that Pr[X < x] = p where X has a Beta distribution //
+//     with shape parameters a and b.  If p = 0, then 0 is returned and if    //
+//     p = 1, then 1 is returned.  If p is NaN or outside [0,1], or if a or b //
+//     is not positive, NaN is returned, and if the iteration fails to        //
+//     converge, NaN is returned rather than an unconverged value.            //
+//                                                                            //
+//  Example:                                                                  //
+//     double p, a, b, x;                                                     //
+//                                                                            //
+//     x = Beta_Quantile(p, a, b);                                            //
+////////////////////////////////////////////////////////////////////////////////
+
+double Beta_Quantile( double p, double a, double b )
+{
+   if ( !(p >= 0.0 && p <= 1.0) || !(a > 0.0) || !(b > 0.0) ) return NAN;
+   if ( p <= 0.0 ) return 0.0;
+   if ( p >= 1.0 ) return 1.0;
+   return Beta_Quantile_Prepared(p, a, b, Ln_Beta_Function(a, b),
+                                                        xBeta_Function(a, b));
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// double Beta_Quantile_Prepared( double p, double a, double b,               //
+//                                double ln_beta_ab, long double beta )       //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns the quantile of the Beta distribution with shape //
+//     parameters a and b by the method of Beta_Quantile(), but with          //
+//     ln(B(a,b)) and B(a,b) supplied by the caller rather than recalculated. //
+//     Callers who evaluate many quantiles of the same distribution calculate //
+//     them once.                                                             //
+//                                                                            //
+//  Arguments:                                                                //
+//     double p                                                               //
+//        The probability, 0 < p < 1.                                         //
+//     double a                                                               //
+//        The shape parameter of the Beta distribution associated with x, a > //
+//        0.                                                                  //
+//     double b                                                               //
+//        The shape parameter of the Beta distribution associated with 1 - x, //
+//        b > 0.                                                              //
+//     double ln_beta_ab                                                      //
+//        ln(B(a,b)), as returned by Ln_Beta_Function(a,b).                   //
+//     long double beta                                                       //
+//        B(a,b), as returned by xBeta_Function(a,b).                         //
+//                                                                            //
+//  Return Values:                                                            //
+//     As for Beta_Quantile().                                                //
+//                                                                            //
+//  Example:                                                                  //
+//     long double beta;                                                      //
+//     double p, a, b, x, ln_beta_ab;                                         //
+//                                                                            //
+//     ln_beta_ab = Ln_Beta_Function(a, b);                                   //
+//     beta = xBeta_Function(a, b);                                           //
+//     x = Beta_Quantile_Prepared(p, a, b, ln_beta_ab, beta);                 //
+////////////////////////////////////////////////////////////////////////////////
+
+double Beta_Quantile_Prepared( double p, double a, double b,
+                                       double ln_beta_ab, long double beta )
+{
+   double lower = 0.0;
+   double upper = 1.0;
+   double last_error = DBL_MAX;
+   double x, y, h, w, r, s, t, g, cdf, target, error, u, dx;
+   int lower_tail, small;
+   int i;
+
+   if ( !(p >= 0.0 && p <= 1.0) || !(a > 0.0) || !(b > 0.0) ) return NAN;
+   if ( p <= 0.0 ) return 0.0;
+   if ( p >= 1.0 ) return 1.0;
+
+               // Start from the leading term of the distribution //
+               // near the end of (0,1) where the quantile lies.  //
+
+   r = exp( a * log(a / (a + b)) - ln_beta_ab ) / a;
+   s = exp( b * log(b / (a + b)) - ln_beta_ab ) / b;
+   if ( p < r / (r + s) ) {
+      x = exp( (log(a * p) + ln_beta_ab) / a );
+      w = fabs(b - 1.0) * x;
+   }
+   else {
+      x = 1.0 - exp( (log(b * (1.0 - p)) + ln_beta_ab) / b );
+      w = fabs(a - 1.0) * (1.0 - x);
+   }
+
+              // If the next term is not small and a, b >= 1, use //
+              // Abramowitz and Stegun 26.5.22 instead.            //
+
+   if ( w > 0.1 && a >= 1.0 && b >= 1.0 ) {
+      y = -Gaussian_Quantile(p);
+      r = 1.0 / (a + a - 1.0);
+      s = 1.0 / (b + b - 1.0);
+      h = 2.0 / (r + s);
+      t = (y * y - 3.0) / 6.0;
+      w = y * sqrt(h + t) / h - (s - r) * (t + 5.0 / 6.0 - 2.0 / (3.0 * h));
+      x = a / (a + b * exp(w + w));
+   }
+   if ( !(x > 0.0) ) x = DBL_MIN;
+   if ( x >= 1.0 ) x = 1.0 - 0.5 * DBL_EPSILON;
+
+             // Refine x by Halley's method applied to ln P(x) - ln p //
+             // as a function of ln x if p <= 1/2, and otherwise to  //
+             // ln(1-p) - ln(1-P(x)) as a function of -ln(1-x),      //
+             // keeping the root in the interval (lower, upper).     //
+
+   lower_tail = ( p <= 0.5 );
+   target = ( lower_tail ) ? log(p) : log1p(-p);
+   for (i = 0; i < max_iterations; i++) {
+      if ( lower_tail ) cdf = Beta_Distribution_Prepared(x, a, b, beta);
+      else cdf = Regularized_Incomplete_Beta_Complement_Prepared(x, a, b,
+                                                                        beta);
+      if ( cdf > 0.0 ) error = log(cdf) - target;
+      else error = -DBL_MAX;
+      if ( !lower_tail ) error = -error;
+      if ( error == 0.0 ) return x;
+      if ( error < 0.0 ) lower = x; else upper = x;
+      if ( cdf > 0.0 ) {
+         w = log1p(-x);
+         if ( lower_tail ) {
+            g = exp( a * log(x) + (b - 1.0) * w - ln_beta_ab - log(cdf) );
+            u = error / g;
+            t = u * ( a - (b - 1.0) * x / (1.0 - x) - g );
+         }
+         else {
+            g = exp( (a - 1.0) * log(x) + b * w - ln_beta_ab - log(cdf) );
+            u = error / g;
+            t = u * ( (a - 1.0) * (1.0 - x) / x - b + g );
+         }
+         if ( t > 1.0 ) t = 1.0; else if ( t < -1.0 ) t = -1.0;
+         dx = u / (1.0 - 0.5 * t);
+         if ( lower_tail ) dx = x - x * exp(-dx);
+         else dx = (1.0 - x) * expm1(dx);
+         if ( x - dx == x ) return x;
+         r = ( x < 0.5 ) ? x : 1.0 - x;
+         small = ( fabs(dx) <= halley_tolerance * r && fabs(t) < 0.01 );
+         if ( x - dx > lower && x - dx < upper
+                            && ( small || fabs(error) <= 0.5 * last_error ) ) {
+            x -= dx;
+            if ( small ) return x;
+            last_error = fabs(error);
+            continue;
+         }
+      }
+      last_error = fabs(error);
+
+                // Bisect, geometrically if the root is near an end //
+
+      if ( upper <= 0.5 )
+         x = ( lower > 0.0 ) ? sqrt(lower * upper) : upper * upper;
+      else if ( lower >= 0.5 )
+         x = ( upper < 1.0 ) ? 1.0 - sqrt( (1.0 - lower) * (1.0 - upper) )
+                             : lower + lower * (1.0 - lower);
+      else x = 0.5 * (lower + upper);
+      if ( x <= lower || x >= upper ) return x;
+   }
+   return NAN;
+}
@@ -0,0 +1,42 @@
+////////////////////////////////////////////////////////////////////////////////
+// File: cauchy_quantile.c                                                    //
+// Routine(s):                                                                //
+//    Cauchy_Quantile                                                         //
+////////////////////////////////////////////////////////////////////////////////
+
+#include <math.h>                 // required for tan(), M_PI, NAN
+#include <float.h>                // required for DBL_MAX
+
+////////////////////////////////////////////////////////////////////////////////
+// double Cauchy_Quantile( double p )                                         //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns the quantile x of the standard Cauchy            //
+//     distribution, the solution of Cauchy_Distribution(x) = p.  Since       //
+//     F(x) = 1/2 + arctan(x) / pi, x = tan(pi (p - 1/2)).  The result is     //
+//     calculated as -1 / tan(pi p) for p < 1/4 and as 1 / tan(pi (1-p)) for  //
+//     p > 3/4 so that it is accurate in the tails.                           //
+//                                                                            //
+//  Arguments:                                                                //
+//     double p   The probability, 0 < p < 1.                                 //
+//                                                                            //
+//  Return Values:                                                            //
+//     The quantile x such that Pr[X < x] = p where X has a Cauchy            //
+//     distribution.  If p = 0, then -DBL_MAX is returned and if p = 1, then  //
+//     DBL_MAX is returned.  If p is NaN or outside [0,1], NaN is returned.   //
+//                                                                            //
+//  Example:                                                                  //
+//     double p, x;                                                           //
+//                                                                            //
+//     x = Cauchy_Quantile(p);                                                //
+////////////////////////////////////////////////////////////////////////////////
+
+double Cauchy_Quantile( double p )
+{
+   if ( !(p >= 0.0 && p <= 1.0) ) return NAN;
+   if ( p <= 0.0 ) return -DBL_MAX;
+   if ( p >= 1.0 ) return DBL_MAX;
+   if ( p < 0.25 ) return -1.0 / tan(M_PI * p);
+   if ( p > 0.75 ) return 1.0 / tan(M_PI * (1.0 - p));
+   return tan(M_PI * (p - 0.5));
+}
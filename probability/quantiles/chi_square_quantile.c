@@ -0,0 +1,47 @@
+////////////////////////////////////////////////////////////////////////////////
+// File: chi_square_quantile.c                                                //
+// Routine(s):                                                                //
+//    Chi_Square_Quantile                                                     //
+////////////////////////////////////////////////////////////////////////////////
+
+#include <math.h>                 // required for NAN
+#include <float.h>                // required for DBL_MAX
+
+//                         Externally Defined Routines                        //
+
+extern double Gamma_Quantile(double p, double nu);
+
+////////////////////////////////////////////////////////////////////////////////
+// double Chi_Square_Quantile( double p, int n )                              //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns the quantile x of the Chi-square distribution    //
+//     with n degrees of freedom, the solution of                             //
+//     Chi_Square_Distribution(x, n) = p.  Since the Chi-square distribution  //
+//     with n degrees of freedom is the Gamma distribution with shape         //
+//     parameter n/2 evaluated at x/2, x = 2 Gamma_Quantile(p, n/2).          //
+//                                                                            //
+//  Arguments:                                                                //
+//     double p   The probability, 0 < p < 1.                                 //
+//     int    n   The number of degrees of freedom, n >= 1.                   //
+//                                                                            //
+//  Return Values:                                                            //
+//     The quantile x such that Pr[X < x] = p where X has a Chi-square        //
+//     distribution with n degrees of freedom.  If p = 0, then 0 is returned  //
+//     and if p = 1, then DBL_MAX is returned.  If p is NaN or outside [0,1], //
+//     or if n < 1, NaN is returned.                                          //
+//                                                                            //
+//  Example:                                                                  //
+//     double p, x;                                                           //
+//     int    n;                                                              //
+//                                                                            //
+//     x = Chi_Square_Quantile(p, n);                                         //
+////////////////////////////////////////////////////////////////////////////////
+
+double Chi_Square_Quantile( double p, int n )
+{
+   if ( !(p >= 0.0 && p <= 1.0) || n < 1 ) return NAN;
+   if ( p <= 0.0 ) return 0.0;
+   if ( p >= 1.0 ) return DBL_MAX;
+   return 2.0 * Gamma_Quantile(p, 0.5 * (double) n);
+}
@@ -0,0 +1,39 @@
+////////////////////////////////////////////////////////////////////////////////
+// File: exponential_quantile.c                                               //
+// Routine(s):                                                                //
+//    Exponential_Quantile                                                    //
+////////////////////////////////////////////////////////////////////////////////
+
+#include <math.h>                 // required for log1p(), NAN
+#include <float.h>                // required for DBL_MAX
+
+////////////////////////////////////////////////////////////////////////////////
+// double Exponential_Quantile( double p )                                    //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns the quantile x of the exponential distribution,  //
+//     the solution of Exponential_Distribution(x) = p.  Since                //
+//     F(x) = 1 - exp(-x), x = -ln(1 - p), which is calculated using log1p()  //
+//     so that the result is accurate for small p.                            //
+//                                                                            //
+//  Arguments:                                                                //
+//     double p   The probability, 0 < p < 1.                                 //
+//                                                                            //
+//  Return Values:                                                            //
+//     The quantile x such that Pr[X < x] = p where X has an exponential      //
+//     distribution.  If p = 0, then 0 is returned and if p = 1, then DBL_MAX //
+//     is returned.  If p is NaN or outside [0,1], NaN is returned.           //
+//                                                                            //
+//  Example:                                                                  //
+//     double p, x;                                                           //
+//                                                                            //
+//     x = Exponential_Quantile(p);                                           //
+////////////////////////////////////////////////////////////////////////////////
+
+double Exponential_Quantile( double p )
+{
+   if ( !(p >= 0.0 && p <= 1.0) ) return NAN;
+   if ( p <= 0.0 ) return 0.0;
+   if ( p >= 1.0 ) return DBL_MAX;
+   return -log1p(-p);
+}
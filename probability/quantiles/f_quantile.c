@@ -0,0 +1,61 @@
+////////////////////////////////////////////////////////////////////////////////
+// File: f_quantile.c                                                         //
+// Routine(s):                                                                //
+//    F_Quantile                                                              //
+////////////////////////////////////////////////////////////////////////////////
+
+#include <math.h>                 // required for NAN
+#include <float.h>                // required for DBL_MAX
+
+//                         Externally Defined Routines                        //
+
+extern double Beta_Quantile(double p, double a, double b);
+
+////////////////////////////////////////////////////////////////////////////////
+// double F_Quantile( double p, int v1, int v2 )                              //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns the quantile x of the F-distribution with v1 and //
+//     v2 degrees of freedom, the solution of F_Distribution(x, v1, v2) = p.  //
+//     Since p = B(v1 x / (v2 + v1 x), v1/2, v2/2) where B(,,) is the         //
+//     incomplete beta function, x = v2 z / (v1 (1 - z)) where                //
+//     z = Beta_Quantile(p, v1/2, v2/2).  For p > 1/2 the quantile is         //
+//     calculated from y = 1 - z = Beta_Quantile(1 - p, v2/2, v1/2) instead,  //
+//     so that the upper critical values do not lose accuracy when z is close //
+//     to 1.                                                                  //
+//                                                                            //
+//  Arguments:                                                                //
+//     double p   The probability, 0 < p < 1.                                 //
+//     int    v1  The numerator degrees of freedom, v1 >= 1.                  //
+//     int    v2  The denominator degrees of freedom, v2 >= 1.                //
+//                                                                            //
+//  Return Values:                                                            //
+//     The quantile x such that Pr[F < x] = p where F has an F-distribution   //
+//     with v1 and v2 degrees of freedom.  If p = 0, then 0 is returned and   //
+//     if p = 1, then DBL_MAX is returned.  If p is NaN or outside [0,1], or  //
+//     if v1 < 1 or v2 < 1, NaN is returned.                                  //
+//                                                                            //
+//  Example:                                                                  //
+//     double p, x;                                                           //
+//     int    v1, v2;                                                         //
+//                                                                            //
+//     x = F_Quantile(p, v1, v2);                                             //
+////////////////////////////////////////////////////////////////////////////////
+
+double F_Quantile( double p, int v1, int v2 )
+{
+   double a = 0.5 * (double) v1;
+   double b = 0.5 * (double) v2;
+   double y;
+
+   if ( !(p >= 0.0 && p <= 1.0) || v1 < 1 || v2 < 1 ) return NAN;
+   if ( p <= 0.0 ) return 0.0;
+   if ( p >= 1.0 ) return DBL_MAX;
+
+   if ( p > 0.5 ) {
+      y = Beta_Quantile(1.0 - p, b, a);
+      return b * (1.0 - y) / (a * y);
+   }
+   y = Beta_Quantile(p, a, b);
+   return b * y / (a * (1.0 - y));
+}
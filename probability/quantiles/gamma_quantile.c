@@ -0,0 +1,208 @@
+////////////////////////////////////////////////////////////////////////////////
+// File: gamma_quantile.c                                                     //
+// Routine(s):                                                                //
+//    Gamma_Quantile                                                          //
+//    Gamma_Quantile_Prepared                                                 //
+////////////////////////////////////////////////////////////////////////////////
+
+#include <math.h>                 // required for exp(), log(), log1p(), sqrt(),
+                                  //              fabs(), NAN
+#include <float.h>                // required for DBL_MAX, DBL_MIN
+
+//                         Externally Defined Routines                        //
+
+extern double Regularized_Incomplete_Gamma_P_Prepared(double x, double nu,
+                                                  long double ln_gamma_star);
+extern double Regularized_Incomplete_Gamma_Q_Prepared(double x, double nu,
+                                                  long double ln_gamma_star);
+extern long double xRegularized_Incomplete_Gamma_Normalizer(long double nu);
+extern double Gaussian_Quantile(double p);
+extern double Ln_Gamma_Function(double x);
+
+//                         Internally Defined Routines                        //
+
+double Gamma_Quantile_Prepared( double p, double nu, double ln_gamma_nu,
+                                                   long double ln_gamma_star );
+
+//                         Internally Defined Constants                       //
+
+static const int max_iterations = 128;
+static const double halley_tolerance = 1.0e-6;
+
+////////////////////////////////////////////////////////////////////////////////
+// double Gamma_Quantile( double p, double nu )                               //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns the quantile x of the Gamma distribution with    //
+//     shape parameter nu, the solution of Gamma_Distribution(x, nu) = p.     //
+//                                                                            //
+//     The starting value for nu > 1 is the Wilson-Hilferty approximation     //
+//              x = nu (1 - 1/(9 nu) + z / sqrt(9 nu))^3,                     //
+//     where z is the standard Gaussian quantile of p.  For nu <= 1, or if    //
+//     the Wilson-Hilferty approximation is too small to be trusted, x is     //
+//     started from the leading term of either the series for small x,        //
+//     P(x) ~ x^nu / Gamma(nu+1), or the expansion for large x,               //
+//     1 - P(x) ~ x^(nu-1) exp(-x) / Gamma(nu).  The starting value is then   //
+//     refined by Halley's method applied to ln P(x) - ln p as a function of  //
+//     ln x if p <= 1/2, and to ln(1-p) - ln(1-P(x)) as a function of x       //
+//     otherwise, where P(x) is the Gamma distribution and both P(x) and      //
+//     1 - P(x) are calculated directly by the regularized incomplete gamma   //
+//     functions, with a cost which does not grow with nu.  In these          //
+//     variables the distribution is close to linear far into either tail,    //
+//     so that the relative accuracy of p is kept even for very small tail    //
+//     probabilities.  The solution is kept bracketed and a step which leaves //
+//     the bracket or fails to halve the error is replaced by bisection.      //
+//     Since Halley's method converges cubically, the iteration stops once a  //
+//     correction is less than 1.0e-6 x and the Halley term is small.  From   //
+//     these starting values it usually takes two or three evaluations of     //
+//     the distribution, for which the part of the normalizing factor         //
+//     depending on nu is calculated once, see Gamma_Quantile_Prepared().     //
+//                                                                            //
+//  Arguments:                                                                //
+//     double p   The probability, 0 < p < 1.                                 //
+//     double nu  The shape parameter of the Gamma distribution, nu > 0.      //
+//                                                                            //
+//  Return Values:                                                            //
+//     The quantile x such that Pr[X < x] = p where X has a Gamma             //
+//     distribution with shape parameter nu.  If p = 0, then 0 is returned    //
+//     and if p = 1, then DBL_MAX is returned.  If p is NaN or outside [0,1], //
+//     or if nu is not positive, NaN is returned, and if the iteration fails  //
+//     to converge, NaN is returned rather than an unconverged value.         //
+//                                                                            //
+//  Example:                                                                  //
+//     double p, nu, x;                                                       //
+//                                                                            //
+//     x = Gamma_Quantile(p, nu);                                             //
+////////////////////////////////////////////////////////////////////////////////
+
+double Gamma_Quantile( double p, double nu )
+{
+   if ( !(p >= 0.0 && p <= 1.0) || !(nu > 0.0) ) return NAN;
+   if ( p <= 0.0 ) return 0.0;
+   if ( p >= 1.0 ) return DBL_MAX;
+   return Gamma_Quantile_Prepared(p, nu, Ln_Gamma_Function(nu),
+                                 xRegularized_Incomplete_Gamma_Normalizer(nu));
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// double Gamma_Quantile_Prepared( double p, double nu, double ln_gamma_nu,   //
+//                                 long double ln_gamma_star )                //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns the quantile of the Gamma distribution with      //
+//     shape parameter nu by the method of Gamma_Quantile(), but with         //
+//     ln(gamma(nu)) and the part ln_gamma_star of the normalizing factor of  //
+//     the regularized incomplete gamma functions supplied by the caller      //
+//     rather than recalculated.                                              //
+//     Callers who evaluate many quantiles of the same distribution calculate //
+//     them once.                                                             //
+//                                                                            //
+//  Arguments:                                                                //
+//     double p                                                               //
+//        The probability, 0 < p < 1.                                         //
+//     double nu                                                              //
+//        The shape parameter of the Gamma distribution, nu > 0.              //
+//     double ln_gamma_nu                                                     //
+//        ln(gamma(nu)), as returned by Ln_Gamma_Function(nu).                //
+//     long double ln_gamma_star                                              //
+//        As returned by xRegularized_Incomplete_Gamma_Normalizer(nu).        //
+//                                                                            //
+//  Return Values:                                                            //
+//     As for Gamma_Quantile().                                               //
+//                                                                            //
+//  Example:                                                                  //
+//     long double ln_gamma_star;                                             //
+//     double p, nu, x, ln_gamma_nu;                                          //
+//                                                                            //
+//     ln_gamma_nu = Ln_Gamma_Function(nu);                                   //
+//     ln_gamma_star = xRegularized_Incomplete_Gamma_Normalizer(nu);          //
+//     x = Gamma_Quantile_Prepared(p, nu, ln_gamma_nu, ln_gamma_star);        //
+////////////////////////////////////////////////////////////////////////////////
+
+double Gamma_Quantile_Prepared( double p, double nu, double ln_gamma_nu,
+                                                    long double ln_gamma_star )
+{
+   double lower = 0.0;
+   double upper = DBL_MAX;
+   double last_error = DBL_MAX;
+   double x = 0.0;
+   double s, t, z, g, cdf, target, error, u, dx;
+   int lower_tail, small;
+   int i;
+
+   if ( !(p >= 0.0 && p <= 1.0) || !(nu > 0.0) ) return NAN;
+   if ( p <= 0.0 ) return 0.0;
+   if ( p >= 1.0 ) return DBL_MAX;
+
+               // Use the Wilson-Hilferty approximation for nu > 1. //
+
+   if ( nu > 1.0 ) {
+      s = 1.0 / (9.0 * nu);
+      z = 1.0 - s + Gaussian_Quantile(p) * sqrt(s);
+      x = nu * z * z * z;
+   }
+
+               // Otherwise, or if x is too small, use the small or //
+               // large x behaviour of the distribution.            //
+
+   if ( x < 0.01 * nu ) {
+      t = 1.0 - nu * (0.253 + 0.12 * nu);
+      if ( nu > 1.0 || p < t )
+         x = exp( (log(p) + ln_gamma_nu + log(nu)) / nu );
+      else x = 1.0 - log(1.0 - (p - t) / (1.0 - t));
+   }
+   if ( !(x > 0.0) ) x = DBL_MIN;
+
+             // Refine x by Halley's method applied to ln P(x) - ln p //
+             // as a function of ln x if p <= 1/2, and otherwise to  //
+             // ln(1-p) - ln(1-P(x)) as a function of x, keeping the //
+             // root in the interval (lower, upper).                 //
+
+   lower_tail = ( p <= 0.5 );
+   target = ( lower_tail ) ? log(p) : log1p(-p);
+   for (i = 0; i < max_iterations; i++) {
+      if ( lower_tail )
+         cdf = Regularized_Incomplete_Gamma_P_Prepared(x, nu, ln_gamma_star);
+      else cdf = Regularized_Incomplete_Gamma_Q_Prepared(x, nu, ln_gamma_star);
+      if ( cdf > 0.0 ) error = log(cdf) - target;
+      else error = -DBL_MAX;
+      if ( !lower_tail ) error = -error;
+      if ( error == 0.0 ) return x;
+      if ( error < 0.0 ) lower = x; else upper = x;
+      if ( cdf > 0.0 ) {
+         s = (nu - 1.0) * log(x) - x - ln_gamma_nu - log(cdf);
+         if ( lower_tail ) {
+            g = exp( s + log(x) );
+            u = error / g;
+            t = u * ( nu - x - g );
+         }
+         else {
+            g = exp( s );
+            u = error / g;
+            t = u * ( (nu - 1.0) / x - 1.0 + g );
+         }
+         if ( t > 1.0 ) t = 1.0; else if ( t < -1.0 ) t = -1.0;
+         dx = u / (1.0 - 0.5 * t);
+         if ( lower_tail ) dx = x - x * exp(-dx);
+         if ( x - dx == x ) return x;
+         small = ( fabs(dx) <= halley_tolerance * x && fabs(t) < 0.01 );
+         if ( x - dx > lower && x - dx < upper
+                            && ( small || fabs(error) <= 0.5 * last_error ) ) {
+            x -= dx;
+            if ( small ) return x;
+            last_error = fabs(error);
+            continue;
+         }
+      }
+      last_error = fabs(error);
+
+                // Bisect, geometrically once the root is bracketed //
+
+      if ( upper == DBL_MAX ) x = x + x;
+      else if ( lower > 0.0 ) x = sqrt(lower) * sqrt(upper);
+      else x = 0.5 * upper;
+      if ( x <= lower || x >= upper ) return x;
+   }
+   return NAN;
+}
@@ -0,0 +1,137 @@
+////////////////////////////////////////////////////////////////////////////////
+// File: gaussian_quantile.c                                                  //
+// Routine(s):                                                                //
+//    Gaussian_Quantile                                                       //
+////////////////////////////////////////////////////////////////////////////////
+
+#include <math.h>                    // required for fabs(), sqrt(), log(), NAN
+#include <float.h>                   // required for DBL_MAX
+
+//                         Internally Defined Constants                       //
+
+static const double a[] = {
+   3.3871328727963666080e+0, 1.3314166789178437745e+2,
+   1.9715909503065514427e+3, 1.3731693765509461125e+4,
+   4.5921953931549871457e+4, 6.7265770927008700853e+4,
+   3.3430575583588128105e+4, 2.5090809287301226727e+3
+};
+static const double b[] = {
+   1.0,                      4.2313330701600911252e+1,
+   6.8718700749205790830e+2, 5.3941960214247511077e+3,
+   2.1213794301586595867e+4, 3.9307895800092710610e+4,
+   2.8729085735721942674e+4, 5.2264952788528545610e+3
+};
+static const double c[] = {
+   1.42343711074968357734e+0, 4.63033784615654529590e+0,
+   5.76949722146069140550e+0, 3.64784832476320460504e+0,
+   1.27045825245236838258e+0, 2.41780725177450611770e-1,
+   2.27238449892691845833e-2, 7.74545014278341407640e-4
+};
+static const double d[] = {
+   1.0,                       2.05319162663775882187e+0,
+   1.67638483018380384940e+0, 6.89767334985100004550e-1,
+   1.48103976427480074590e-1, 1.51986665636164571966e-2,
+   5.47593808499534494600e-4, 1.05075007164441684324e-9
+};
+static const double e[] = {
+   6.65790464350110377720e+0, 5.46378491116411436990e+0,
+   1.78482653991729133580e+0, 2.96560571828504891230e-1,
+   2.65321895265761230930e-2, 1.24266094738807843860e-3,
+   2.71155556874348757815e-5, 2.01033439929228813265e-7
+};
+static const double f[] = {
+   1.0,                       5.99832206555887937690e-1,
+   1.36929880922735805310e-1, 1.48753612908506148525e-2,
+   7.86869131145613259100e-4, 1.84631831751005468180e-5,
+   1.42151175831644588870e-7, 2.04426310338993978564e-15
+};
+
+//                         Internally Defined Routines                        //
+
+static double Rational(double x, const double p[], const double q[]);
+
+////////////////////////////////////////////////////////////////////////////////
+// double Gaussian_Quantile( double p )                                       //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns the quantile x of the standard Normal (Gaussian) //
+//     distribution, the solution of Gaussian_Distribution(x) = p.            //
+//                                                                            //
+//     The quantile is calculated using Wichura's algorithm AS 241 (PPND16),  //
+//     which approximates x by a ratio of two polynomials of degree 7 in      //
+//     (p - 1/2)^2 for |p - 1/2| <= 0.425, and in r - 1.6 for r <= 5 or r - 5 //
+//     for r > 5 where r = sqrt(-ln(min(p, 1-p))).  The error is at most 7    //
+//     ulp for all p.  Refining x by Newton's method against                  //
+//     Gaussian_Distribution() would not make it more accurate, since the     //
+//     rounding error of Gaussian_Distribution() near p = 1/2 is larger than  //
+//     that of the rational approximation.                                    //
+//                                                                            //
+//  Arguments:                                                                //
+//     double p   The probability, 0 < p < 1.                                 //
+//                                                                            //
+//  Return Values:                                                            //
+//     The quantile x such that Pr[X < x] = p where X ~ N(0,1).  If p = 0,    //
+//     then -DBL_MAX is returned and if p = 1, then DBL_MAX is returned.  If  //
+//     p is NaN or outside [0,1], NaN is returned.                            //
+//                                                                            //
+//  Example:                                                                  //
+//     double p, x;                                                           //
+//                                                                            //
+//     x = Gaussian_Quantile(p);                                              //
+////////////////////////////////////////////////////////////////////////////////
+
+double Gaussian_Quantile( double p )
+{
+   double q = p - 0.5;
+   double r;
+   double x;
+
+   if ( !(p >= 0.0 && p <= 1.0) ) return NAN;
+   if ( p <= 0.0 ) return -DBL_MAX;
+   if ( p >= 1.0 ) return DBL_MAX;
+
+   if ( fabs(q) <= 0.425 ) {
+      r = 0.180625 - q * q;
+      return q * Rational(r, a, b);
+   }
+
+   r = sqrt( -log( (q < 0.0) ? p : 1.0 - p ) );
+   if ( r <= 5.0 ) x = Rational(r - 1.6, c, d);
+   else x = Rational(r - 5.0, e, f);
+   return (q < 0.0) ? -x : x;
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// static double Rational( double x, const double p[], const double q[] )     //
+//                                                                            //
+//  Description:                                                              //
+//     Evaluate the ratio of the two polynomials of degree 7,                 //
+//            (p[7] x^7 + ... + p[0]) / (q[7] x^7 + ... + q[0]).              //
+//                                                                            //
+//  Arguments:                                                                //
+//     double x     The argument of the polynomials.                          //
+//     double p[]   The coefficients of the numerator.                        //
+//     double q[]   The coefficients of the denominator.                      //
+//                                                                            //
+//  Return Values:                                                            //
+//     The ratio of the two polynomials evaluated at x.                       //
+//                                                                            //
+//  Example:                                                                  //
+//     double x, y;                                                           //
+//                                                                            //
+//     y = Rational(x, a, b);                                                 //
+////////////////////////////////////////////////////////////////////////////////
+
+static double Rational(double x, const double p[], const double q[])
+{
+   double numerator = p[7];
+   double denominator = q[7];
+   int i;
+
+   for (i = 6; i >= 0; i--) {
+      numerator = numerator * x + p[i];
+      denominator = denominator * x + q[i];
+   }
+   return numerator / denominator;
+}
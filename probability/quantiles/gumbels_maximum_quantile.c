@@ -0,0 +1,38 @@
+////////////////////////////////////////////////////////////////////////////////
+// File: gumbels_maximum_quantile.c                                           //
+// Routine(s):                                                                //
+//    Gumbels_Maximum_Quantile                                                //
+////////////////////////////////////////////////////////////////////////////////
+
+#include <math.h>                 // required for log(), NAN
+#include <float.h>                // required for DBL_MAX
+
+////////////////////////////////////////////////////////////////////////////////
+// double Gumbels_Maximum_Quantile( double p )                                //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns the quantile x of Gumbel's maximum distribution, //
+//     the solution of Gumbels_Maximum_Distribution(x) = p.  Since            //
+//     F(x) = exp(-exp(-x)), x = -ln(-ln(p)).                                 //
+//                                                                            //
+//  Arguments:                                                                //
+//     double p   The probability, 0 < p < 1.                                 //
+//                                                                            //
+//  Return Values:                                                            //
+//     The quantile x such that Pr[X < x] = p where X has Gumbel's maximum    //
+//     distribution.  If p = 0, then -DBL_MAX is returned and if p = 1, then  //
+//     DBL_MAX is returned.  If p is NaN or outside [0,1], NaN is returned.   //
+//                                                                            //
+//  Example:                                                                  //
+//     double p, x;                                                           //
+//                                                                            //
+//     x = Gumbels_Maximum_Quantile(p);                                       //
+////////////////////////////////////////////////////////////////////////////////
+
+double Gumbels_Maximum_Quantile( double p )
+{
+   if ( !(p >= 0.0 && p <= 1.0) ) return NAN;
+   if ( p <= 0.0 ) return -DBL_MAX;
+   if ( p >= 1.0 ) return DBL_MAX;
+   return -log( -log(p) );
+}
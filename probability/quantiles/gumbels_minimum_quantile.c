@@ -0,0 +1,38 @@
+////////////////////////////////////////////////////////////////////////////////
+// File: gumbels_minimum_quantile.c                                           //
+// Routine(s):                                                                //
+//    Gumbels_Minimum_Quantile                                                //
+////////////////////////////////////////////////////////////////////////////////
+
+#include <math.h>                 // required for log(), log1p(), NAN
+#include <float.h>                // required for DBL_MAX
+
+////////////////////////////////////////////////////////////////////////////////
+// double Gumbels_Minimum_Quantile( double p )                                //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns the quantile x of Gumbel's minimum distribution, //
+//     the solution of Gumbels_Minimum_Distribution(x) = p.  Since            //
+//     F(x) = 1 - exp(-exp(x)), x = ln(-ln(1 - p)).                           //
+//                                                                            //
+//  Arguments:                                                                //
+//     double p   The probability, 0 < p < 1.                                 //
+//                                                                            //
+//  Return Values:                                                            //
+//     The quantile x such that Pr[X < x] = p where X has Gumbel's minimum    //
+//     distribution.  If p = 0, then -DBL_MAX is returned and if p = 1, then  //
+//     DBL_MAX is returned.  If p is NaN or outside [0,1], NaN is returned.   //
+//                                                                            //
+//  Example:                                                                  //
+//     double p, x;                                                           //
+//                                                                            //
+//     x = Gumbels_Minimum_Quantile(p);                                       //
+////////////////////////////////////////////////////////////////////////////////
+
+double Gumbels_Minimum_Quantile( double p )
+{
+   if ( !(p >= 0.0 && p <= 1.0) ) return NAN;
+   if ( p <= 0.0 ) return -DBL_MAX;
+   if ( p >= 1.0 ) return DBL_MAX;
+   return log( -log1p(-p) );
+}
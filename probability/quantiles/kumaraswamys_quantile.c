@@ -0,0 +1,43 @@
+////////////////////////////////////////////////////////////////////////////////
+// File: kumaraswamys_quantile.c                                              //
+// Routine(s):                                                                //
+//    Kumaraswamys_Quantile                                                   //
+////////////////////////////////////////////////////////////////////////////////
+
+#include <math.h>                 // required for exp(), log(), log1p(),
+                                  //              expm1(), NAN
+
+////////////////////////////////////////////////////////////////////////////////
+// double Kumaraswamys_Quantile( double p, double a, double b )               //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns the quantile x of Kumaraswamy's distribution     //
+//     with shape parameters a and b, the solution of                         //
+//     Kumaraswamys_Distribution(x, a, b) = p.  Since F(x) = 1 - (1 - x^a)^b  //
+//     for 0 <= x <= 1, x = (1 - (1 - p)^(1/b))^(1/a), which is calculated    //
+//     using log1p() and expm1() so that it is accurate for small p.          //
+//                                                                            //
+//  Arguments:                                                                //
+//     double p   The probability, 0 < p < 1.                                 //
+//     double a   The exponent of x in the distribution, a > 0.               //
+//     double b   The exponent of (1 - x^a) in the distribution, b > 0.       //
+//                                                                            //
+//  Return Values:                                                            //
+//     The quantile x such that Pr[X < x] = p where X has Kumaraswamy's       //
+//     distribution with shape parameters a and b.  If p = 0, then 0 is       //
+//     returned and if p = 1, then 1 is returned.  If p is NaN or outside     //
+//     [0,1], or if a or b is not positive, NaN is returned.                  //
+//                                                                            //
+//  Example:                                                                  //
+//     double a, b, p, x;                                                     //
+//                                                                            //
+//     x = Kumaraswamys_Quantile(p, a, b);                                    //
+////////////////////////////////////////////////////////////////////////////////
+
+double Kumaraswamys_Quantile( double p, double a, double b )
+{
+   if ( !(p >= 0.0 && p <= 1.0) || !(a > 0.0) || !(b > 0.0) ) return NAN;
+   if ( p <= 0.0 ) return 0.0;
+   if ( p >= 1.0 ) return 1.0;
+   return exp( log( -expm1( log1p(-p) / b ) ) / a );
+}
@@ -0,0 +1,40 @@
+////////////////////////////////////////////////////////////////////////////////
+// File: laplace_quantile.c                                                   //
+// Routine(s):                                                                //
+//    Laplace_Quantile                                                        //
+////////////////////////////////////////////////////////////////////////////////
+
+#include <math.h>                 // required for log(), log1p(), NAN
+#include <float.h>                // required for DBL_MAX
+
+////////////////////////////////////////////////////////////////////////////////
+// double Laplace_Quantile( double p )                                        //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns the quantile x of the standard Laplace           //
+//     distribution, the solution of Laplace_Distribution(x) = p.  Since      //
+//     F(x) = exp(x) / 2 for x <= 0 and F(x) = 1 - exp(-x) / 2 for x > 0, x = //
+//     ln(2p) for p <= 1/2 and x = -ln(2 (1-p)) for p > 1/2.                  //
+//                                                                            //
+//  Arguments:                                                                //
+//     double p   The probability, 0 < p < 1.                                 //
+//                                                                            //
+//  Return Values:                                                            //
+//     The quantile x such that Pr[X < x] = p where X has a Laplace           //
+//     distribution.  If p = 0, then -DBL_MAX is returned and if p = 1, then  //
+//     DBL_MAX is returned.  If p is NaN or outside [0,1], NaN is returned.   //
+//                                                                            //
+//  Example:                                                                  //
+//     double p, x;                                                           //
+//                                                                            //
+//     x = Laplace_Quantile(p);                                               //
+////////////////////////////////////////////////////////////////////////////////
+
+double Laplace_Quantile( double p )
+{
+   if ( !(p >= 0.0 && p <= 1.0) ) return NAN;
+   if ( p <= 0.0 ) return -DBL_MAX;
+   if ( p >= 1.0 ) return DBL_MAX;
+   if ( p <= 0.5 ) return log(p + p);
+   return -log1p(1.0 - (p + p));
+}
@@ -0,0 +1,38 @@
+////////////////////////////////////////////////////////////////////////////////
+// File: logistic_quantile.c                                                  //
+// Routine(s):                                                                //
+//    Logistic_Quantile                                                       //
+////////////////////////////////////////////////////////////////////////////////
+
+#include <math.h>                 // required for log(), NAN
+#include <float.h>                // required for DBL_MAX
+
+////////////////////////////////////////////////////////////////////////////////
+// double Logistic_Quantile( double p )                                       //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns the quantile x of the standard logistic          //
+//     distribution, the solution of Logistic_Distribution(x) = p.  Since     //
+//     F(x) = 1 / (1 + exp(-x)), the quantile is the logit x = ln(p / (1-p)). //
+//                                                                            //
+//  Arguments:                                                                //
+//     double p   The probability, 0 < p < 1.                                 //
+//                                                                            //
+//  Return Values:                                                            //
+//     The quantile x such that Pr[X < x] = p where X has a logistic          //
+//     distribution.  If p = 0, then -DBL_MAX is returned and if p = 1, then  //
+//     DBL_MAX is returned.  If p is NaN or outside [0,1], NaN is returned.   //
+//                                                                            //
+//  Example:                                                                  //
+//     double p, x;                                                           //
+//                                                                            //
+//     x = Logistic_Quantile(p);                                              //
+////////////////////////////////////////////////////////////////////////////////
+
+double Logistic_Quantile( double p )
+{
+   if ( !(p >= 0.0 && p <= 1.0) ) return NAN;
+   if ( p <= 0.0 ) return -DBL_MAX;
+   if ( p >= 1.0 ) return DBL_MAX;
+   return log( p / (1.0 - p) );
+}
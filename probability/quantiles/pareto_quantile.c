@@ -0,0 +1,41 @@
+////////////////////////////////////////////////////////////////////////////////
+// File: pareto_quantile.c                                                    //
+// Routine(s):                                                                //
+//    Pareto_Quantile                                                         //
+////////////////////////////////////////////////////////////////////////////////
+
+#include <math.h>                 // required for exp(), log1p(), NAN
+#include <float.h>                // required for DBL_MAX
+
+////////////////////////////////////////////////////////////////////////////////
+// double Pareto_Quantile( double p, double a )                               //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns the quantile x of the Pareto distribution with   //
+//     shape parameter a, the solution of Pareto_Distribution(x, a) = p.      //
+//     Since F(x) = 1 - x^(-a) for x >= 1, x = (1 - p)^(-1/a) which is        //
+//     calculated as exp(-ln(1 - p) / a).                                     //
+//                                                                            //
+//  Arguments:                                                                //
+//     double p   The probability, 0 < p < 1.                                 //
+//     double a   The shape parameter of the Pareto distribution, a > 0.      //
+//                                                                            //
+//  Return Values:                                                            //
+//     The quantile x such that Pr[X < x] = p where X has a Pareto            //
+//     distribution with shape parameter a.  If p = 0, then 1 is returned and //
+//     if p = 1, then DBL_MAX is returned.  If p is NaN or outside [0,1], or  //
+//     if a is not positive, NaN is returned.                                 //
+//                                                                            //
+//  Example:                                                                  //
+//     double a, p, x;                                                        //
+//                                                                            //
+//     x = Pareto_Quantile(p, a);                                             //
+////////////////////////////////////////////////////////////////////////////////
+
+double Pareto_Quantile( double p, double a )
+{
+   if ( !(p >= 0.0 && p <= 1.0) || !(a > 0.0) ) return NAN;
+   if ( p <= 0.0 ) return 1.0;
+   if ( p >= 1.0 ) return DBL_MAX;
+   return exp( -log1p(-p) / a );
+}
@@ -0,0 +1,70 @@
+////////////////////////////////////////////////////////////////////////////////
+// File: student_t_quantile.c                                                 //
+// Routine(s):                                                                //
+//    Student_t_Quantile                                                      //
+////////////////////////////////////////////////////////////////////////////////
+
+#include <math.h>                 // required for sqrt(), NAN
+#include <float.h>                // required for DBL_MAX
+
+//                         Externally Defined Routines                        //
+
+extern double Beta_Quantile(double p, double a, double b);
+extern double Cauchy_Quantile(double p);
+extern double t2_Quantile(double p);
+
+////////////////////////////////////////////////////////////////////////////////
+// double Student_t_Quantile( double p, int n )                               //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns the quantile x of Student's t-distribution with  //
+//     n degrees of freedom, the solution of                                  //
+//     Student_t_Distribution(x, n) = p.  For n = 1 and n = 2 the quantile is //
+//     given in closed form by Cauchy_Quantile() and t2_Quantile().           //
+//                                                                            //
+//     For n > 2, let q = min(p, 1-p).  Since 2q = B(n/(n+x^2), n/2, 1/2)     //
+//     where B(,,) is the incomplete beta function, x^2 = n (1 - z) / z where //
+//     z = Beta_Quantile(2q, n/2, 1/2).  For q >= 1/4, z is close to 1, so    //
+//     instead x^2 = n y / (1 - y) where                                      //
+//     y = 1 - z = Beta_Quantile(1 - 2q, 1/2, n/2).  The sign of x is that of //
+//     p - 1/2.                                                               //
+//                                                                            //
+//  Arguments:                                                                //
+//     double p   The probability, 0 < p < 1.                                 //
+//     int    n   The number of degrees of freedom, n >= 1.                   //
+//                                                                            //
+//  Return Values:                                                            //
+//     The quantile x such that Pr[X < x] = p where X has a t-distribution    //
+//     with n degrees of freedom.  If p = 0, then -DBL_MAX is returned and if //
+//     p = 1, then DBL_MAX is returned.  If p is NaN or outside [0,1], or if  //
+//     n < 1, NaN is returned.                                                //
+//                                                                            //
+//  Example:                                                                  //
+//     double p, x;                                                           //
+//     int    n;                                                              //
+//                                                                            //
+//     x = Student_t_Quantile(p, n);                                          //
+////////////////////////////////////////////////////////////////////////////////
+
+double Student_t_Quantile( double p, int n )
+{
+   double q = (p < 0.5) ? p : 1.0 - p;
+   double a = 0.5 * (double) n;
+   double x, y;
+
+   if ( !(p >= 0.0 && p <= 1.0) || n < 1 ) return NAN;
+   if ( p <= 0.0 ) return -DBL_MAX;
+   if ( p >= 1.0 ) return DBL_MAX;
+   if ( n == 1 ) return Cauchy_Quantile(p);
+   if ( n == 2 ) return t2_Quantile(p);
+
+   if ( q < 0.25 ) {
+      y = Beta_Quantile(q + q, a, 0.5);
+      x = sqrt( n * (1.0 - y) / y );
+   }
+   else {
+      y = Beta_Quantile(1.0 - (q + q), 0.5, a);
+      x = sqrt( n * y / (1.0 - y) );
+   }
+   return (p < 0.5) ? -x : x;
+}
@@ -0,0 +1,40 @@
+////////////////////////////////////////////////////////////////////////////////
+// File: t2_quantile.c                                                        //
+// Routine(s):                                                                //
+//    t2_Quantile                                                             //
+////////////////////////////////////////////////////////////////////////////////
+
+#include <math.h>                 // required for sqrt(), M_SQRT2, NAN
+#include <float.h>                // required for DBL_MAX
+
+////////////////////////////////////////////////////////////////////////////////
+// double t2_Quantile( double p )                                             //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns the quantile x of Student's t-distribution with  //
+//     two degrees of freedom, the solution of t2_Distribution(x) = p.  Since //
+//     T2(x) = (1 + x / sqrt(2 + x^2)) / 2,                                   //
+//     x = sqrt(2) (p - 1/2) / sqrt(p (1 - p)).                               //
+//                                                                            //
+//  Arguments:                                                                //
+//     double p   The probability, 0 < p < 1.                                 //
+//                                                                            //
+//  Return Values:                                                            //
+//     The quantile x such that Pr[X < x] = p where X has a t-distribution    //
+//     with two degrees of freedom.  If p = 0, then -DBL_MAX is returned and  //
+//     if p = 1, then DBL_MAX is returned.  If p is NaN or outside [0,1], NaN //
+//     is returned.                                                           //
+//                                                                            //
+//  Example:                                                                  //
+//     double p, x;                                                           //
+//                                                                            //
+//     x = t2_Quantile(p);                                                    //
+////////////////////////////////////////////////////////////////////////////////
+
+double t2_Quantile( double p )
+{
+   if ( !(p >= 0.0 && p <= 1.0) ) return NAN;
+   if ( p <= 0.0 ) return -DBL_MAX;
+   if ( p >= 1.0 ) return DBL_MAX;
+   return M_SQRT2 * (p - 0.5) / sqrt( p * (1.0 - p) );
+}
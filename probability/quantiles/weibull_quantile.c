@@ -0,0 +1,40 @@
+////////////////////////////////////////////////////////////////////////////////
+// File: weibull_quantile.c                                                   //
+// Routine(s):                                                                //
+//    Weibull_Quantile                                                        //
+////////////////////////////////////////////////////////////////////////////////
+
+#include <math.h>                 // required for pow(), log1p(), NAN
+#include <float.h>                // required for DBL_MAX
+
+////////////////////////////////////////////////////////////////////////////////
+// double Weibull_Quantile( double p, double a )                              //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns the quantile x of the Weibull distribution with  //
+//     shape parameter a, the solution of Weibull_Distribution(x, a) = p.     //
+//     Since F(x) = 1 - exp(-x^a) for x >= 0, x = (-ln(1 - p))^(1/a).         //
+//                                                                            //
+//  Arguments:                                                                //
+//     double p   The probability, 0 < p < 1.                                 //
+//     double a   The shape parameter of the Weibull distribution, a > 0.     //
+//                                                                            //
+//  Return Values:                                                            //
+//     The quantile x such that Pr[X < x] = p where X has a Weibull           //
+//     distribution with shape parameter a.  If p = 0, then 0 is returned and //
+//     if p = 1, then DBL_MAX is returned.  If p is NaN or outside [0,1], or  //
+//     if a is not positive, NaN is returned.                                 //
+//                                                                            //
+//  Example:                                                                  //
+//     double a, p, x;                                                        //
+//                                                                            //
+//     x = Weibull_Quantile(p, a);                                            //
+////////////////////////////////////////////////////////////////////////////////
+
+double Weibull_Quantile( double p, double a )
+{
+   if ( !(p >= 0.0 && p <= 1.0) || !(a > 0.0) ) return NAN;
+   if ( p <= 0.0 ) return 0.0;
+   if ( p >= 1.0 ) return DBL_MAX;
+   return pow( -log1p(-p), 1.0 / a );
+}
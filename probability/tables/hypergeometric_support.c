@@ -0,0 +1,335 @@
+////////////////////////////////////////////////////////////////////////////////
+// File: hypergeometric_support.c                                             //
+// Routine(s):                                                                //
+//    Hypergeometric_Support_Init                                             //
+//    Hypergeometric_Support_Probability                                      //
+//    Hypergeometric_Support_Lower_Tail                                       //
+//    Hypergeometric_Support_Upper_Tail                                       //
+//    Hypergeometric_Support_Two_Sided                                        //
+//    Hypergeometric_Support_Free                                             //
+////////////////////////////////////////////////////////////////////////////////
+
+#include <stdlib.h>                         // required for malloc(), free()
+
+#include "hypergeometric_support.h"
+
+//                    Required Internally Defined Routines                    //
+
+void Hypergeometric_Support_Free( Hypergeometric_Support *table );
+
+//                         Internally Defined Constants                       //
+
+static const double tie_tolerance = 1.0 + 1.0e-7;
+
+////////////////////////////////////////////////////////////////////////////////
+// int Hypergeometric_Support_Init( Hypergeometric_Support *table, int n1,    //
+//                                                            int n2, int n ) //
+//                                                                            //
+//  Description:                                                              //
+//     This function tabulates the probabilities Pr[X = k], the tails Pr[X <= //
+//     k] and Pr[X >= k] and the two-sided p-values of the hypergeometric     //
+//     distribution with parameters n1, n2 and n over its whole support,      //
+//     after which each of them is returned in constant time by the routines  //
+//     below.  This is the way to evaluate the distribution for many values   //
+//     of k with the same parameters, for example for many 2 x 2 tables with  //
+//     the same margins.                                                      //
+//                                                                            //
+//     The probabilities are calculated outward from the mode m = [(n + 1)(n1 //
+//     + 1) / (n1 + n2 + 2)] by the recurrence                                //
+//     Pr[X = k+1] = Pr[X = k] (n1 - k)(n - k) / ((k + 1)(n2 - n + k + 1))    //
+//     starting with 1 at the mode, and are then divided by their sum.        //
+//     Starting at the largest term the recurrence never overflows, the terms //
+//     that underflow are negligible, and no factorials or binomial           //
+//     coefficients are needed.  The lower tails are summed upward from the   //
+//     minimum and the upper tails downward from the maximum, so that each    //
+//     tail is accumulated starting with its smallest terms and is accurate   //
+//     even when it is tiny.                                                  //
+//                                                                            //
+//     The two-sided p-value of k is the sum of Pr[X = j] over all j for      //
+//     which Pr[X = j] <= Pr[X = k], a relative tolerance of 1.0e-7 being     //
+//     allowed in the comparison for rounding errors as in the usual          //
+//     definition of Fisher's exact test.  Since the probabilities increase   //
+//     up to the mode and decrease after it, the values j which are counted   //
+//     form the two tails j <= l and j >= r, the boundaries l and r being     //
+//     found by bisection, and the p-value is lower[l] + upper[r].            //
+//                                                                            //
+//  Arguments:                                                                //
+//     Hypergeometric_Support *table                                          //
+//        The table to set up.  Its storage is allocated here and must be     //
+//        released by Hypergeometric_Support_Free().                          //
+//     int n1                                                                 //
+//        The number of objects labeled 1, n1 >= 0.                           //
+//     int n2                                                                 //
+//        The number of objects labeled 0, n2 >= 0.                           //
+//     int n                                                                  //
+//        The number of objects drawn without replacement, 0 <= n <= n1 + n2. //
+//                                                                            //
+//  Return Values:                                                            //
+//     0 on success, -1 if the parameters are invalid and -2 if memory could  //
+//     not be allocated.                                                      //
+//                                                                            //
+//  Example:                                                                  //
+//     Hypergeometric_Support table;                                          //
+//     int n1 = 20, n2 = 30, n = 15;                                          //
+//                                                                            //
+//     Hypergeometric_Support_Init( &table, n1, n2, n );                      //
+////////////////////////////////////////////////////////////////////////////////
+
+int Hypergeometric_Support_Init( Hypergeometric_Support *table, int n1,
+                                                                int n2, int n )
+{
+   double *p;
+   double sum, threshold;
+   int size, k, low, high, middle, left, right;
+
+   table->pmf = NULL;
+   table->lower = NULL;
+   table->upper = NULL;
+   table->two_sided = NULL;
+   if ( n1 < 0 || n2 < 0 || n < 0 || n > n1 + n2 ) return -1;
+
+   table->n1 = n1;
+   table->n2 = n2;
+   table->n = n;
+   table->minimum = (n <= n2) ? 0 : n - n2;
+   table->maximum = (n <= n1) ? n : n1;
+   table->mode = (int) ( ((double)(n + 1) * (double)(n1 + 1))
+                                                   / (double)(n1 + n2 + 2) );
+   if ( table->mode > table->maximum ) table->mode = table->maximum;
+   if ( table->mode < table->minimum ) table->mode = table->minimum;
+   size = table->maximum - table->minimum + 1;
+
+   table->pmf = (double *) malloc( 4 * size * sizeof(double) );
+   if ( table->pmf == NULL ) return -2;
+   table->lower = table->pmf + size;
+   table->upper = table->lower + size;
+   table->two_sided = table->upper + size;
+
+              // Run the recurrence outward from the mode, p[i] being //
+              // the unnormalized probability of k = minimum + i.     //
+
+   p = table->pmf - table->minimum;
+   p[table->mode] = 1.0;
+   for (k = table->mode; k < table->maximum; k++)
+      p[k+1] = p[k] * (double)(n1 - k) * (double)(n - k)
+                                / ((double)(k + 1) * (double)(n2 - n + k + 1));
+   for (k = table->mode; k > table->minimum; k--)
+      p[k-1] = p[k] * (double) k * (double)(n2 - n + k)
+                              / ((double)(n1 - k + 1) * (double)(n - k + 1));
+
+   sum = 0.0;
+   for (k = 0; k < size; k++) sum += table->pmf[k];
+   for (k = 0; k < size; k++) table->pmf[k] /= sum;
+
+                     // Accumulate each tail from its far end. //
+
+   table->lower[0] = table->pmf[0];
+   for (k = 1; k < size; k++)
+      table->lower[k] = table->lower[k-1] + table->pmf[k];
+   table->upper[size-1] = table->pmf[size-1];
+   for (k = size - 2; k >= 0; k--)
+      table->upper[k] = table->upper[k+1] + table->pmf[k];
+   for (k = 0; k < size; k++) {
+      if ( table->lower[k] > 1.0 ) table->lower[k] = 1.0;
+      if ( table->upper[k] > 1.0 ) table->upper[k] = 1.0;
+   }
+
+         // For each k find the last index left <= mode and the first //
+         // index right >= mode whose probabilities do not exceed     //
+         // Pr[X = k].  pmf[] is nondecreasing up to the mode and     //
+         // nonincreasing after it.                                   //
+
+   p = table->pmf;
+   for (k = 0; k < size; k++) {
+      threshold = p[k] * tie_tolerance;
+      if ( p[table->mode - table->minimum] <= threshold ) {
+         table->two_sided[k] = 1.0;
+         continue;
+      }
+      low = -1;
+      high = table->mode - table->minimum;
+      while ( high - low > 1 ) {
+         middle = (low + high) / 2;
+         if ( p[middle] <= threshold ) low = middle; else high = middle;
+      }
+      left = low;
+      low = table->mode - table->minimum;
+      high = size;
+      while ( high - low > 1 ) {
+         middle = (low + high) / 2;
+         if ( p[middle] <= threshold ) high = middle; else low = middle;
+      }
+      right = high;
+      sum = ( (left >= 0) ? table->lower[left] : 0.0 )
+                               + ( (right < size) ? table->upper[right] : 0.0 );
+      table->two_sided[k] = ( sum < 1.0 ) ? sum : 1.0;
+   }
+
+   return 0;
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// double Hypergeometric_Support_Probability( int k,                          //
+//                                      const Hypergeometric_Support *table ) //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns Pr[X = k], where X has the hypergeometric        //
+//     distribution tabulated by Hypergeometric_Support_Init().               //
+//                                                                            //
+//  Arguments:                                                                //
+//     int k                                                                  //
+//        The number of 1's drawn.                                            //
+//     const Hypergeometric_Support *table                                    //
+//        A table set up by Hypergeometric_Support_Init().                    //
+//                                                                            //
+//  Return Values:                                                            //
+//     Pr[X = k], 0 if k lies outside the support.                            //
+//                                                                            //
+//  Example:                                                                  //
+//     Hypergeometric_Support table;                                          //
+//     double p;                                                              //
+//     int k;                                                                 //
+//                                                                            //
+//     p = Hypergeometric_Support_Probability( k, &table );                   //
+////////////////////////////////////////////////////////////////////////////////
+
+double Hypergeometric_Support_Probability( int k,
+                                          const Hypergeometric_Support *table )
+{
+   if ( k < table->minimum || k > table->maximum ) return 0.0;
+   return table->pmf[k - table->minimum];
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// double Hypergeometric_Support_Lower_Tail( int k,                           //
+//                                      const Hypergeometric_Support *table ) //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns Pr[X <= k], where X has the hypergeometric       //
+//     distribution tabulated by Hypergeometric_Support_Init().               //
+//     This is the one-sided p-value of k when the alternative is that X is   //
+//     small, and Hypergeometric_Cumulative_Distribution(n1, n2, n, k).       //
+//                                                                            //
+//  Arguments:                                                                //
+//     int k                                                                  //
+//        The number of 1's drawn.                                            //
+//     const Hypergeometric_Support *table                                    //
+//        A table set up by Hypergeometric_Support_Init().                    //
+//                                                                            //
+//  Return Values:                                                            //
+//     Pr[X <= k], a real number between 0 and 1.                             //
+//                                                                            //
+//  Example:                                                                  //
+//     Hypergeometric_Support table;                                          //
+//     double p;                                                              //
+//     int k;                                                                 //
+//                                                                            //
+//     p = Hypergeometric_Support_Lower_Tail( k, &table );                    //
+////////////////////////////////////////////////////////////////////////////////
+
+double Hypergeometric_Support_Lower_Tail( int k,
+                                          const Hypergeometric_Support *table )
+{
+   if ( k < table->minimum ) return 0.0;
+   if ( k >= table->maximum ) return 1.0;
+   return table->lower[k - table->minimum];
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// double Hypergeometric_Support_Upper_Tail( int k,                           //
+//                                      const Hypergeometric_Support *table ) //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns Pr[X >= k], where X has the hypergeometric       //
+//     distribution tabulated by Hypergeometric_Support_Init().               //
+//     This is the one-sided p-value of k when the alternative is that X is   //
+//     large.                                                                 //
+//                                                                            //
+//  Arguments:                                                                //
+//     int k                                                                  //
+//        The number of 1's drawn.                                            //
+//     const Hypergeometric_Support *table                                    //
+//        A table set up by Hypergeometric_Support_Init().                    //
+//                                                                            //
+//  Return Values:                                                            //
+//     Pr[X >= k], a real number between 0 and 1.                             //
+//                                                                            //
+//  Example:                                                                  //
+//     Hypergeometric_Support table;                                          //
+//     double p;                                                              //
+//     int k;                                                                 //
+//                                                                            //
+//     p = Hypergeometric_Support_Upper_Tail( k, &table );                    //
+////////////////////////////////////////////////////////////////////////////////
+
+double Hypergeometric_Support_Upper_Tail( int k,
+                                          const Hypergeometric_Support *table )
+{
+   if ( k <= table->minimum ) return 1.0;
+   if ( k > table->maximum ) return 0.0;
+   return table->upper[k - table->minimum];
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// double Hypergeometric_Support_Two_Sided( int k,                            //
+//                                      const Hypergeometric_Support *table ) //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns the two-sided p-value of the observation X = k,  //
+//     where X has the hypergeometric distribution tabulated by               //
+//     Hypergeometric_Support_Init().                                         //
+//                                                                            //
+//  Arguments:                                                                //
+//     int k                                                                  //
+//        The number of 1's drawn.                                            //
+//     const Hypergeometric_Support *table                                    //
+//        A table set up by Hypergeometric_Support_Init().                    //
+//                                                                            //
+//  Return Values:                                                            //
+//     The sum of Pr[X = j] over those j with Pr[X = j] <= Pr[X = k], a real  //
+//     number between 0 and 1, or 0 if k lies outside the support.            //
+//                                                                            //
+//  Example:                                                                  //
+//     Hypergeometric_Support table;                                          //
+//     double p;                                                              //
+//     int k;                                                                 //
+//                                                                            //
+//     p = Hypergeometric_Support_Two_Sided( k, &table );                     //
+////////////////////////////////////////////////////////////////////////////////
+
+double Hypergeometric_Support_Two_Sided( int k,
+                                          const Hypergeometric_Support *table )
+{
+   if ( k < table->minimum || k > table->maximum ) return 0.0;
+   return table->two_sided[k - table->minimum];
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// void Hypergeometric_Support_Free( Hypergeometric_Support *table )          //
+//                                                                            //
+//  Description:                                                              //
+//     This function releases the storage allocated by                        //
+//     Hypergeometric_Support_Init().  The table may then be set up again.    //
+//                                                                            //
+//  Arguments:                                                                //
+//     Hypergeometric_Support *table                                          //
+//        A table set up by Hypergeometric_Support_Init().                    //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     Hypergeometric_Support table;                                          //
+//                                                                            //
+//     Hypergeometric_Support_Free( &table );                                 //
+////////////////////////////////////////////////////////////////////////////////
+
+void Hypergeometric_Support_Free( Hypergeometric_Support *table )
+{
+   free( table->pmf );
+   table->pmf = NULL;
+   table->lower = NULL;
+   table->upper = NULL;
+   table->two_sided = NULL;
+}
@@ -0,0 +1,44 @@
+////////////////////////////////////////////////////////////////////////////////
+// File: hypergeometric_support.h                                             //
+// Type(s):                                                                   //
+//    Hypergeometric_Support                                                  //
+////////////////////////////////////////////////////////////////////////////////
+#ifndef HYPERGEOMETRIC_SUPPORT_H
+#define HYPERGEOMETRIC_SUPPORT_H
+
+////////////////////////////////////////////////////////////////////////////////
+// Hypergeometric_Support                                                     //
+//                                                                            //
+//  Description:                                                              //
+//     The hypergeometric distribution of the number X of 1's among n objects //
+//     drawn without replacement from n1 objects labeled 1 and n2 objects     //
+//     labeled 0, tabulated over its support by                               //
+//     Hypergeometric_Support_Init().                                         //
+//                                                                            //
+//     minimum = max(0, n - n2) and maximum = min(n, n1) are the smallest and //
+//     largest possible values of X, and mode is a value at which Pr[X = k]   //
+//     is largest.  For minimum <= k <= maximum, element k - minimum of       //
+//     pmf        is Pr[X = k],                                               //
+//     lower      is Pr[X <= k],                                              //
+//     upper      is Pr[X >= k],                                              //
+//     two_sided  is the two-sided p-value of k, the sum of Pr[X = j]         //
+//                over those j for which Pr[X = j] <= Pr[X = k].              //
+//     The arrays share a single block of memory which is allocated by        //
+//     Hypergeometric_Support_Init() and released by                          //
+//     Hypergeometric_Support_Free().                                         //
+////////////////////////////////////////////////////////////////////////////////
+
+typedef struct {
+   int n1;
+   int n2;
+   int n;
+   int minimum;
+   int maximum;
+   int mode;
+   double *pmf;
+   double *lower;
+   double *upper;
+   double *two_sided;
+} Hypergeometric_Support;
+
+#endif
@@ -2,12 +2,20 @@
 // File: bernoulli_random_variate.c                                           //
 // Routine(s):                                                                //
 //    Bernoulli_Random_Variate                                                //
+//    Bernoulli_Random_Variate_r                                              //
 ////////////////////////////////////////////////////////////////////////////////
 
+#include "random_state.h"
+
 //                    Required Externally Defined Routines                    //
 
-double Uniform_0_1_Random_Variate( void );
-        
+extern Random_State* Uniform_0_1_Default_State( void );
+double Uniform_0_1_Random_Variate_r( Random_State *state );
+
+//                    Required Internally Defined Routines                    //
+
+int Bernoulli_Random_Variate_r( Random_State *state, double p );
+
 ////////////////////////////////////////////////////////////////////////////////
 // int Bernoulli_Random_Variate( double p )                                   //
 //                                                                            //
@@ -28,7 +36,39 @@ double Uniform_0_1_Random_Variate( void );
 //     x = Bernoulli_Random_Variate( p );                                     //
 ////////////////////////////////////////////////////////////////////////////////
 
-int Bernoulli_Random_Variate(double p)
+int Bernoulli_Random_Variate( double p )
+{
+   return Bernoulli_Random_Variate_r( Uniform_0_1_Default_State(), p );
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// int Bernoulli_Random_Variate_r( Random_State *state, double p )            //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns a Bernoulli random variate, 1 with probability p //
+//     and 0 with probability 1-p, drawing the uniform variate from the       //
+//     caller's generator state.                                              //
+//                                                                            //
+//  Arguments:                                                                //
+//     Random_State *state                                                    //
+//        The generator state from which the uniform variates are drawn.      //
+//     double p                                                               //
+//        As for Bernoulli_Random_Variate().                                  //
+//                                                                            //
+//  Return Values:                                                            //
+//     As for Bernoulli_Random_Variate().                                     //
+//                                                                            //
+//  Example:                                                                  //
+//     Random_State state;                                                    //
+//     int x;                                                                 //
+//     double p;                                                              //
+//                                                                            //
+//     Random_State_Init( &state, 12345 );                                    //
+//     x = Bernoulli_Random_Variate_r( &state, p );                           //
+////////////////////////////////////////////////////////////////////////////////
+
+int Bernoulli_Random_Variate_r( Random_State *state, double p )
 {
-   return ( Uniform_0_1_Random_Variate() <= p ) ? 1 : 0;
+   return ( Uniform_0_1_Random_Variate_r(state) <= p ) ? 1 : 0;
 }
@@ -2,13 +2,24 @@
 // File: beta_random_variate.c                                                //
 // Routine(s):                                                                //
 //    Beta_Random_Variate                                                     //
+//    Beta_Random_Variate_r                                                   //
+//    Beta_Random_Variate_Array                                               //
 ////////////////////////////////////////////////////////////////////////////////
 
 #include <math.h>                    // required for sqrt(), log(), and pow()
 
+#include "random_state.h"
+
 //                    Required Externally Defined Routines                    //
 
-extern double Gamma_Random_Variate( double a );
+extern Random_State* Uniform_0_1_Default_State( void );
+extern double Gamma_Random_Variate_r( Random_State *state, double a );
+extern void Gamma_Random_Variate_Array( Random_State *state, double x[], int n,
+                                                                double shape );
+
+//                    Required Internally Defined Routines                    //
+
+double Beta_Random_Variate_r( Random_State *state, double a, double b );
 
 ////////////////////////////////////////////////////////////////////////////////
 // double Beta_Random_Variate( double a, double b)                            //
@@ -47,10 +58,95 @@ extern double Gamma_Random_Variate( double a );
 //     x = Beta_Random_Variate( a, b );                                       //
 ////////////////////////////////////////////////////////////////////////////////
         
-double Beta_Random_Variate( double a, double b)
+double Beta_Random_Variate( double a, double b )
+{
+   return Beta_Random_Variate_r( Uniform_0_1_Default_State(), a, b );
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// double Beta_Random_Variate_r( Random_State *state, double a, double b )    //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns a beta(a,b) distributed random variate, Ga / (Ga //
+//     + Gb), where the gamma variates Ga and Gb are both drawn from state.   //
+//                                                                            //
+//  Arguments:                                                                //
+//     Random_State *state                                                    //
+//        The generator state from which the uniform variates are drawn.      //
+//     double a                                                               //
+//        As for Beta_Random_Variate().                                       //
+//     double b                                                               //
+//        As for Beta_Random_Variate().                                       //
+//                                                                            //
+//  Return Values:                                                            //
+//     As for Beta_Random_Variate().                                          //
+//                                                                            //
+//  Example:                                                                  //
+//     Random_State state;                                                    //
+//     double x, a, b;                                                        //
+//                                                                            //
+//     Random_State_Init( &state, 12345 );                                    //
+//     x = Beta_Random_Variate_r( &state, a, b );                             //
+////////////////////////////////////////////////////////////////////////////////
+
+double Beta_Random_Variate_r( Random_State *state, double a, double b )
 {
-   double ga = Gamma_Random_Variate(a);
-   double gb = Gamma_Random_Variate(b);
+   double ga = Gamma_Random_Variate_r(state, a);
+   double gb = Gamma_Random_Variate_r(state, b);
 
    return ga / (ga + gb);
 }
+
+
+////////////////////////////////////////////////////////////////////////////////
+// void Beta_Random_Variate_Array( Random_State *state, double x[], int n,    //
+//                                                       double a, double b ) //
+//                                                                            //
+//  Description:                                                              //
+//     This function fills the array x[] with n beta(a,b) distributed random  //
+//     variates, Ga / (Ga + Gb).  The gamma(a) and gamma(b) variates are      //
+//     generated a block at a time by Gamma_Random_Variate_Array() so that    //
+//     the setup for each shape parameter is done once per block rather than  //
+//     once per variate.                                                      //
+//                                                                            //
+//  Arguments:                                                                //
+//     Random_State *state                                                    //
+//            The generator state from which the uniform variates are drawn.  //
+//     double x[]                                                             //
+//            The array of at least n elements which is set to the variates.  //
+//     int    n                                                               //
+//            The number of variates to generate.                             //
+//     double a                                                               //
+//            The shape parameter corresponding to the exponent of x, a > 0.  //
+//     double b                                                               //
+//            The shape parameter corresponding to the exponent of 1-x, b > 0.//
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     #define N 1000                                                         //
+//     Random_State state;                                                    //
+//     double x[N];                                                           //
+//     double a, b;                                                           //
+//                                                                            //
+//     Random_State_Init( &state, 12345 );                                    //
+//     Beta_Random_Variate_Array( &state, x, N, a, b );                       //
+////////////////////////////////////////////////////////////////////////////////
+
+#define BLOCK 256
+
+void Beta_Random_Variate_Array( Random_State *state, double x[], int n,
+                                                           double a, double b )
+{
+   double gb[BLOCK];
+   int i, j, m;
+
+   for (j = 0; j < n; j += m) {
+      m = (n - j < BLOCK) ? n - j : BLOCK;
+      Gamma_Random_Variate_Array(state, &x[j], m, a);
+      Gamma_Random_Variate_Array(state, gb, m, b);
+      for (i = 0; i < m; i++) x[j + i] = x[j + i] / (x[j + i] + gb[i]);
+   }
+}
@@ -0,0 +1,136 @@
+////////////////////////////////////////////////////////////////////////////////
+// File: beta_variate_inversion.c                                             //
+// Routine(s):                                                                //
+//    Beta_Variate_Inversion                                                  //
+//    Beta_Variate_Inversion_r                                                //
+//    Beta_Variate_Inversion_Array                                            //
+////////////////////////////////////////////////////////////////////////////////
+
+#include "random_state.h"
+
+//                    Required Externally Defined Routines                    //
+
+extern Random_State* Uniform_0_1_Default_State( void );
+extern double Uniform_0_1_Random_Variate_r( Random_State *state );
+extern double Beta_Quantile(double p, double a, double b);
+
+//                    Required Internally Defined Routines                    //
+
+double Beta_Variate_Inversion_r( Random_State *state, double a, double b );
+
+////////////////////////////////////////////////////////////////////////////////
+// double Beta_Variate_Inversion( double a, double b )                        //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns a Beta distributed random variate with shape     //
+//     parameters a and b using the inversion method, i.e.                    //
+//     x = Beta_Quantile(u, a, b) where u is a uniform(0,1) random variate.   //
+//     In contrast to Beta_Random_Variate(), which forms the ratio of two     //
+//     Gamma variates, each variate uses a single uniform variate and is an   //
+//     increasing function of it.                                             //
+//                                                                            //
+//  Arguments:                                                                //
+//     double a                                                               //
+//        The shape parameter associated with x, a > 0.                       //
+//     double b                                                               //
+//        The shape parameter associated with 1 - x, b > 0.                   //
+//                                                                            //
+//  Return Values:                                                            //
+//     A random number with a Beta distribution with shape parameters a and   //
+//     b.  The value returned is in the interval [0, 1].                      //
+//                                                                            //
+//  Example:                                                                  //
+//     double x;                                                              //
+//     double a;                                                              //
+//     double b;                                                              //
+//                                                                            //
+//                    (* Set the shape parameters a > 0 and b > 0 *)          //
+//                                                                            //
+//     x = Beta_Variate_Inversion(a, b);                                      //
+////////////////////////////////////////////////////////////////////////////////
+
+double Beta_Variate_Inversion( double a, double b )
+{
+   return Beta_Variate_Inversion_r( Uniform_0_1_Default_State(), a, b );
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// double Beta_Variate_Inversion_r( Random_State *state, double a,            //
+//                                                                 double b ) //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns Beta_Quantile(u, a, b) where the uniform variate //
+//     u is drawn from state.                                                 //
+//                                                                            //
+//  Arguments:                                                                //
+//     Random_State *state                                                    //
+//        The generator state from which the uniform variate is drawn.        //
+//     double a                                                               //
+//        As for Beta_Variate_Inversion().                                    //
+//     double b                                                               //
+//        As for Beta_Variate_Inversion().                                    //
+//                                                                            //
+//  Return Values:                                                            //
+//     As for Beta_Variate_Inversion().                                       //
+//                                                                            //
+//  Example:                                                                  //
+//     Random_State state;                                                    //
+//     double x;                                                              //
+//     double a;                                                              //
+//     double b;                                                              //
+//                                                                            //
+//     Random_State_Init( &state, 12345 );                                    //
+//     x = Beta_Variate_Inversion_r( &state, a, b );                          //
+////////////////////////////////////////////////////////////////////////////////
+
+double Beta_Variate_Inversion_r( Random_State *state, double a, double b )
+{
+   return Beta_Quantile( Uniform_0_1_Random_Variate_r(state), a, b );
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// void Beta_Variate_Inversion_Array( double u[], double x[], int n,          //
+//                                                       double a, double b ) //
+//                                                                            //
+//  Description:                                                              //
+//     This function sets x[i] to Beta_Quantile(u[i], a, b) for i = 0,...,n-1 //
+//     where the uniform variates u[] are supplied by the caller, one per     //
+//     variate.                                                               //
+//                                                                            //
+//  Arguments:                                                                //
+//     double u[]                                                             //
+//        The array of n uniform variates, 0 <= u[i] <= 1.                    //
+//     double x[]                                                             //
+//        The array of at least n elements which is set to the variates,      //
+//        x[i] = Beta_Quantile(u[i], a, b).  x may be the same array as u.    //
+//     int n                                                                  //
+//        The number of variates.                                             //
+//     double a                                                               //
+//        As for Beta_Variate_Inversion().                                    //
+//     double b                                                               //
+//        As for Beta_Variate_Inversion().                                    //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     #define N 1000                                                         //
+//     Random_State state;                                                    //
+//     double u[N], x[N];                                                     //
+//     double a;                                                              //
+//     double b;                                                              //
+//                                                                            //
+//     Random_State_Init( &state, 12345 );                                    //
+//     Uniform_0_1_Random_Variate_Array( &state, u, N );                      //
+//     Beta_Variate_Inversion_Array( u, x, N, a, b );                         //
+////////////////////////////////////////////////////////////////////////////////
+
+void Beta_Variate_Inversion_Array( double u[], double x[], int n, double a,
+                                                                     double b )
+{
+   int i;
+
+   for (i = 0; i < n; i++) x[i] = Beta_Quantile(u[i], a, b);
+}
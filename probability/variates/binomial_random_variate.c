@@ -2,18 +2,30 @@
 // File: binomial_random_variate.c                                            //
 // Routine(s):                                                                //
 //    Binomial_Random_Variate                                                 //
+//    Binomial_Random_Variate_r                                               //
+//    Binomial_Random_Variate_Array                                           //
 ////////////////////////////////////////////////////////////////////////////////
 
 #include <math.h>                    // required for log()
 
+#include "random_state.h"
+#include "binomial_sampler.h"
+
 //                    Required Externally Defined Routines                    //
 
-extern double Beta_Random_Variate( double a, double b );
-extern double Exponential_Random_Variate( void );
+extern Random_State* Uniform_0_1_Default_State( void );
+extern double Beta_Random_Variate_r( Random_State *state, double a, double b );
+extern double Exponential_Random_Variate_r( Random_State *state );
+extern void Binomial_Sampler_Init( Binomial_Sampler *sampler, int n, double p );
+extern int Binomial_Sampler_Variate_r( Random_State *state,
+                                             const Binomial_Sampler *sampler );
+extern void Binomial_Sampler_Variate_Array( Random_State *state, int x[],
+                                 int size, const Binomial_Sampler *sampler );
 
 //                    Required Internally Defined Routines                    //
 
-static int Waiting_Time_Variate( int n, double p);
+int Binomial_Random_Variate_r( Random_State *state, int n, double p );
+static int Waiting_Time_Variate( Random_State *state, int n, double p );
 
 ////////////////////////////////////////////////////////////////////////////////
 // int Binomial_Random_Variate( int n, double p )                             //
@@ -45,14 +57,57 @@ static int Waiting_Time_Variate( int n, double p);
 ////////////////////////////////////////////////////////////////////////////////
         
 int Binomial_Random_Variate( int n, double p )
+{
+   return Binomial_Random_Variate_r( Uniform_0_1_Default_State(), n, p );
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// int Binomial_Random_Variate_r( Random_State *state, int n, double p )      //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns a Binomial(n,p) distributed random variate by    //
+//     the same recursive and waiting time algorithms as                      //
+//     Binomial_Random_Variate(), drawing the beta and exponential variates   //
+//     from state.  If n min(p, 1-p) >= BINOMIAL_BTPE_THRESHOLD the BTPE      //
+//     algorithm of Binomial_Sampler_Variate_r() is used instead, its         //
+//     constants being computed for this call only; use a Binomial_Sampler to //
+//     generate many variates with the same n and p.                          //
+//                                                                            //
+//  Arguments:                                                                //
+//     Random_State *state                                                    //
+//        The generator state from which the uniform variates are drawn.      //
+//     int n                                                                  //
+//        As for Binomial_Random_Variate().                                   //
+//     double p                                                               //
+//        As for Binomial_Random_Variate().                                   //
+//                                                                            //
+//  Return Values:                                                            //
+//     As for Binomial_Random_Variate().                                      //
+//                                                                            //
+//  Example:                                                                  //
+//     Random_State state;                                                    //
+//     int x, n;                                                              //
+//     double p;                                                              //
+//                                                                            //
+//     Random_State_Init( &state, 12345 );                                    //
+//     x = Binomial_Random_Variate_r( &state, n, p );                         //
+////////////////////////////////////////////////////////////////////////////////
+
+int Binomial_Random_Variate_r( Random_State *state, int n, double p )
 {
    double dp;
    int x = 0;
    int i = 0;
 
+   if ( n * ((p <= 0.5) ? p : 1.0 - p) >= BINOMIAL_BTPE_THRESHOLD ) {
+      Binomial_Sampler sampler;
+      Binomial_Sampler_Init(&sampler, n, p);
+      return Binomial_Sampler_Variate_r(state, &sampler);
+   }
    while ( n * p >= 3) {
       i = (int)((n+1) * p);
-      dp = Beta_Random_Variate((double)i,(double)(n-i+1));
+      dp = Beta_Random_Variate_r(state, (double)i,(double)(n-i+1));
       if (dp <= p) {
          x += i;
          n -= i;
@@ -65,13 +120,13 @@ int Binomial_Random_Variate( int n, double p )
    }
    if (n == 0) return x;
    if (p <= 0.0) return x;
-   x += Waiting_Time_Variate(n,p);
+   x += Waiting_Time_Variate(state, n,p);
    return x;
 }
 
 
 ////////////////////////////////////////////////////////////////////////////////
-// static int Waiting_Time_Variate( int n, double p )                         //
+// static int Waiting_Time_Variate( Random_State *state, int n, double p )    //
 //                                                                            //
 //  Description:                                                              //
 //     This function returns a Binomial(n,p) distributed random variate using //
@@ -81,6 +136,8 @@ int Binomial_Random_Variate( int n, double p )
 //     binomial(n,p) distribution.                                            //
 //                                                                            //
 //  Arguments:                                                                //
+//     Random_State *state                                                    //
+//            The generator state from which the variates are drawn.          //
 //     int    n                                                               //
 //            The total number of trials, n >= 1.                             //
 //     double p                                                               //
@@ -96,9 +153,9 @@ int Binomial_Random_Variate( int n, double p )
 //                  (* Set the probability p, 0 < p < 1 *)                    //
 //                  (* Set the total number of trials n *)                    //
 //                                                                            //
-//     x = Waiting_Time_Variate( n, p );                                      //
+//     x = Waiting_Time_Variate( state, n, p );                               //
 ////////////////////////////////////////////////////////////////////////////////
-static int Waiting_Time_Variate( int n, double p)
+static int Waiting_Time_Variate( Random_State *state, int n, double p )
 {
    double ln = -log(1.0 - p);
    double sum = 0.0;
@@ -106,9 +163,83 @@ static int Waiting_Time_Variate( int n, double p)
    
    while (sum <= ln) {
       if (x < n)
-         sum += (Exponential_Random_Variate() / (double)(n - x));
+         sum += (Exponential_Random_Variate_r(state) / (double)(n - x));
       else return n;
       x++;
    }
    return x - 1;
 }
+
+
+////////////////////////////////////////////////////////////////////////////////
+// void Binomial_Random_Variate_Array( Random_State *state, int x[],          //
+//                                                 int size, int n, double p )//
+//                                                                            //
+//  Description:                                                              //
+//     This function fills the array x[] with "size" Binomial(n,p)            //
+//     distributed random variates.  If n p < 3, where                        //
+//     Binomial_Random_Variate_r() goes straight to the waiting time          //
+//     algorithm, -ln(1-p) is computed once for the whole array and the       //
+//     waiting time loop is run inline.  If n min(p, 1-p) >=                  //
+//     BINOMIAL_BTPE_THRESHOLD the constants of the BTPE algorithm are        //
+//     computed once and the array is filled by                               //
+//     Binomial_Sampler_Variate_Array().  Otherwise each variate is generated //
+//     by Binomial_Random_Variate_r().                                        //
+//                                                                            //
+//  Arguments:                                                                //
+//     Random_State *state                                                    //
+//            The generator state from which the variates are drawn.          //
+//     int    x[]                                                             //
+//            The array of at least "size" elements which is set to the       //
+//            variates.                                                       //
+//     int    size                                                            //
+//            The number of variates to generate.                             //
+//     int    n                                                               //
+//            The total number of trials, n >= 0.                             //
+//     double p                                                               //
+//            The probability of a success, 0 <= p < 1.                       //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     #define N 1000                                                         //
+//     Random_State state;                                                    //
+//     int x[N], n;                                                           //
+//     double p;                                                              //
+//                                                                            //
+//     Random_State_Init( &state, 12345 );                                    //
+//     Binomial_Random_Variate_Array( &state, x, N, n, p );                   //
+////////////////////////////////////////////////////////////////////////////////
+
+void Binomial_Random_Variate_Array( Random_State *state, int x[], int size,
+                                                              int n, double p )
+{
+   double ln;
+   double sum;
+   int i, k;
+
+   if ( n * ((p <= 0.5) ? p : 1.0 - p) >= BINOMIAL_BTPE_THRESHOLD ) {
+      Binomial_Sampler sampler;
+      Binomial_Sampler_Init(&sampler, n, p);
+      Binomial_Sampler_Variate_Array(state, x, size, &sampler);
+      return;
+   }
+   if ( n * p >= 3 ) {
+      for (i = 0; i < size; i++) x[i] = Binomial_Random_Variate_r(state, n, p);
+      return;
+   }
+   if ( n == 0 || p <= 0.0 ) {
+      for (i = 0; i < size; i++) x[i] = 0;
+      return;
+   }
+   ln = -log(1.0 - p);
+   for (i = 0; i < size; i++) {
+      sum = 0.0;
+      for (k = 0; k < n; k++) {
+         sum += Exponential_Random_Variate_r(state) / (double)(n - k);
+         if (sum > ln) break;
+      }
+      x[i] = k;
+   }
+}
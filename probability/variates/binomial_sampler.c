@@ -0,0 +1,329 @@
+////////////////////////////////////////////////////////////////////////////////
+// File: binomial_sampler.c                                                   //
+// Routine(s):                                                                //
+//    Binomial_Sampler_Init                                                   //
+//    Binomial_Sampler_Variate                                                //
+//    Binomial_Sampler_Variate_r                                              //
+//    Binomial_Sampler_Variate_Array                                          //
+////////////////////////////////////////////////////////////////////////////////
+
+#include <math.h>                    // required for floor(), log(), sqrt()
+
+#include "random_state.h"
+#include "binomial_sampler.h"
+
+//                    Required Externally Defined Routines                    //
+
+extern Random_State* Uniform_0_1_Default_State( void );
+extern double Uniform_0_1_Random_Variate_r( Random_State *state );
+extern int Binomial_Random_Variate_r( Random_State *state, int n, double p );
+
+//                    Required Internally Defined Routines                    //
+
+int Binomial_Sampler_Variate_r( Random_State *state,
+                                             const Binomial_Sampler *sampler );
+static int BTPE( Random_State *state, const Binomial_Sampler *s );
+
+////////////////////////////////////////////////////////////////////////////////
+// void Binomial_Sampler_Init( Binomial_Sampler *sampler, int n, double p )   //
+//                                                                            //
+//  Description:                                                              //
+//     This function prepares sampler to generate Binomial(n,p) distributed   //
+//     variates.  If n min(p, 1-p) >= BINOMIAL_BTPE_THRESHOLD the constants   //
+//     of the BTPE algorithm are computed, otherwise the sampler defers to    //
+//     Binomial_Random_Variate_r(), whose recursive and waiting time          //
+//     algorithms are faster for small means.  The threshold was chosen by    //
+//     timing both methods.  At n r = 10 BTPE, whose expected number of       //
+//     uniform variates is bounded independently of n and p, is already more  //
+//     than twice as fast as the recursive algorithm, and the gap widens with //
+//     n r; below about n r = 8 the majorizing function fits poorly and BTPE  //
+//     loses its advantage.                                                   //
+//                                                                            //
+//  Arguments:                                                                //
+//     Binomial_Sampler *sampler                                              //
+//        The sampler to prepare.                                             //
+//     int n                                                                  //
+//        The total number of trials, n >= 0.                                 //
+//     double p                                                               //
+//        The probability of a success, 0 <= p <= 1.                          //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     Binomial_Sampler sampler;                                              //
+//     int n;                                                                 //
+//     double p;                                                              //
+//                                                                            //
+//     Binomial_Sampler_Init( &sampler, n, p );                               //
+////////////////////////////////////////////////////////////////////////////////
+
+void Binomial_Sampler_Init( Binomial_Sampler *sampler, int n, double p )
+{
+   double r = (p <= 0.5) ? p : 1.0 - p;
+   double q = 1.0 - r;
+   double fm, a;
+
+   sampler->n = n;
+   sampler->p = p;
+   sampler->btpe = ( (double) n * r >= BINOMIAL_BTPE_THRESHOLD );
+   if ( !sampler->btpe ) return;
+
+   sampler->r = r;
+   sampler->q = q;
+   sampler->nrq = (double) n * r * q;
+   fm = (double) n * r + r;
+   sampler->m = (int) floor(fm);
+   sampler->p1 = floor(2.195 * sqrt(sampler->nrq) - 4.6 * q) + 0.5;
+   sampler->xm = (double) sampler->m + 0.5;
+   sampler->xl = sampler->xm - sampler->p1;
+   sampler->xr = sampler->xm + sampler->p1;
+   sampler->c = 0.134 + 20.5 / (15.3 + (double) sampler->m);
+   a = (fm - sampler->xl) / (fm - sampler->xl * r);
+   sampler->laml = a * (1.0 + 0.5 * a);
+   a = (sampler->xr - fm) / (sampler->xr * q);
+   sampler->lamr = a * (1.0 + 0.5 * a);
+   sampler->p2 = sampler->p1 * (1.0 + 2.0 * sampler->c);
+   sampler->p3 = sampler->p2 + sampler->c / sampler->laml;
+   sampler->p4 = sampler->p3 + sampler->c / sampler->lamr;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// int Binomial_Sampler_Variate( const Binomial_Sampler *sampler )            //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns a Binomial(n,p) distributed random variate,      //
+//     where n and p are the parameters given to Binomial_Sampler_Init(),     //
+//     drawing from the library's default generator state.                    //
+//                                                                            //
+//  Arguments:                                                                //
+//     const Binomial_Sampler *sampler                                        //
+//        A sampler prepared by Binomial_Sampler_Init().                      //
+//                                                                            //
+//  Return Values:                                                            //
+//     A random number distributed as a Binomial(n,p) distribution.           //
+//                                                                            //
+//  Example:                                                                  //
+//     Binomial_Sampler sampler;                                              //
+//     int x;                                                                 //
+//                                                                            //
+//     x = Binomial_Sampler_Variate( &sampler );                              //
+////////////////////////////////////////////////////////////////////////////////
+
+int Binomial_Sampler_Variate( const Binomial_Sampler *sampler )
+{
+   return Binomial_Sampler_Variate_r( Uniform_0_1_Default_State(), sampler );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// int Binomial_Sampler_Variate_r( Random_State *state,                       //
+//                                 const Binomial_Sampler *sampler )          //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns a Binomial(n,p) distributed random variate,      //
+//     where n and p are the parameters given to Binomial_Sampler_Init(),     //
+//     using the BTPE algorithm if the sampler was prepared for it and        //
+//     Binomial_Random_Variate_r() otherwise.  All uniform variates are drawn //
+//     from state.                                                            //
+//                                                                            //
+//  Arguments:                                                                //
+//     Random_State *state                                                    //
+//        The generator state from which the uniform variates are drawn.      //
+//     const Binomial_Sampler *sampler                                        //
+//        A sampler prepared by Binomial_Sampler_Init().                      //
+//                                                                            //
+//  Return Values:                                                            //
+//     A random number distributed as a Binomial(n,p) distribution.           //
+//                                                                            //
+//  Example:                                                                  //
+//     Binomial_Sampler sampler;                                              //
+//     Random_State state;                                                    //
+//     int x;                                                                 //
+//                                                                            //
+//     Random_State_Init( &state, 12345 );                                    //
+//     x = Binomial_Sampler_Variate_r( &state, &sampler );                    //
+////////////////////////////////////////////////////////////////////////////////
+
+int Binomial_Sampler_Variate_r( Random_State *state,
+                                              const Binomial_Sampler *sampler )
+{
+   int x;
+
+   if ( !sampler->btpe )
+      return Binomial_Random_Variate_r(state, sampler->n, sampler->p);
+   x = BTPE(state, sampler);
+   return ( sampler->p > 0.5 ) ? sampler->n - x : x;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// static int BTPE( Random_State *state, const Binomial_Sampler *s )          //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns a Binomial(n,r) distributed random variate, r =  //
+//     min(p, 1-p), using the BTPE (triangle, parallelogram, exponential)     //
+//     algorithm of Kachitvichyanukul and Schmeiser.  A pair of uniform       //
+//     variates selects a point under a majorizing function made of a         //
+//     triangle about the mode, two parallelograms and two exponential tails. //
+//     Points in the triangle are accepted at once.  Otherwise, if the        //
+//     candidate is within 20 of the mode or far in the tails, the ratio of   //
+//     the density to its value at the mode is evaluated by the recursion     //
+//     f(k+1)/f(k) = (n-k) r / ((k+1) q), and if not it is first compared     //
+//     with a squeeze and then with Stirling's approximation to the logarithm //
+//     of the density.                                                        //
+//                                                                            //
+//  Arguments:                                                                //
+//     Random_State *state                                                    //
+//        The generator state from which the uniform variates are drawn.      //
+//     const Binomial_Sampler *s                                              //
+//        A sampler prepared by Binomial_Sampler_Init() for the BTPE          //
+//        algorithm.                                                          //
+//                                                                            //
+//  Return Values:                                                            //
+//     A random number distributed as a Binomial(n,r) distribution.           //
+//                                                                            //
+//  Example:                                                                  //
+//     x = BTPE( state, sampler );                                            //
+////////////////////////////////////////////////////////////////////////////////
+
+static int BTPE( Random_State *state, const Binomial_Sampler *s )
+{
+   double u, v, x, f, a, t, rho, lnv;
+   double x1, f1, z, w, x2, f2, z2, w2;
+   int y, k, i;
+
+   for (;;) {
+      u = Uniform_0_1_Random_Variate_r(state) * s->p4;
+      v = Uniform_0_1_Random_Variate_r(state);
+
+                            // The triangular region. //
+
+      if ( u <= s->p1 ) return (int) floor(s->xm - s->p1 * v + u);
+
+                          // The parallelogram regions. //
+
+      if ( u <= s->p2 ) {
+         x = s->xl + (u - s->p1) / s->c;
+         v = v * s->c + 1.0 - fabs((double) s->m - x + 0.5) / s->p1;
+         if ( v > 1.0 ) continue;
+         y = (int) floor(x);
+      }
+
+                         // The left exponential tail. //
+
+      else if ( u <= s->p3 ) {
+         if ( v == 0.0 ) continue;
+         x = floor(s->xl + log(v) / s->laml);
+         if ( x < 0.0 ) continue;
+         y = (int) x;
+         v *= (u - s->p2) * s->laml;
+      }
+
+                         // The right exponential tail. //
+
+      else {
+         if ( v == 0.0 ) continue;
+         x = floor(s->xr - log(v) / s->lamr);
+         if ( x > (double) s->n ) continue;
+         y = (int) x;
+         v *= (u - s->p3) * s->lamr;
+      }
+
+           // Near the mode, or far out, evaluate f(y)/f(m) directly. //
+
+      k = (y > s->m) ? y - s->m : s->m - y;
+      if ( k <= 20 || (double) k >= 0.5 * s->nrq - 1.0 ) {
+         a = s->r / s->q;
+         t = a * (double) (s->n + 1);
+         f = 1.0;
+         if ( s->m < y )
+            for (i = s->m + 1; i <= y; i++) f *= t / (double) i - a;
+         else
+            for (i = y + 1; i <= s->m; i++) f /= t / (double) i - a;
+         if ( v <= f ) return y;
+         continue;
+      }
+
+             // Otherwise try the squeeze and then compare ln(v) with //
+             // Stirling's approximation to ln(f(y)/f(m)).            //
+
+      rho = ((double) k / s->nrq) * (((double) k * ((double) k / 3.0 + 0.625)
+                              + 0.1666666666666667) / s->nrq + 0.5);
+      t = -(double) k * (double) k / (2.0 * s->nrq);
+      lnv = log(v);
+      if ( lnv < t - rho ) return y;
+      if ( lnv > t + rho ) continue;
+
+      x1 = (double) (y + 1);
+      f1 = (double) (s->m + 1);
+      z = (double) (s->n + 1 - s->m);
+      w = (double) (s->n - y + 1);
+      x2 = x1 * x1;
+      f2 = f1 * f1;
+      z2 = z * z;
+      w2 = w * w;
+      if ( lnv <= s->xm * log(f1 / x1)
+                  + ((double) (s->n - s->m) + 0.5) * log(z / w)
+                  + (double) (y - s->m) * log(w * s->r / (x1 * s->q))
+                  + (13860.0 - (462.0 - (132.0 - (99.0 - 140.0 / f2) / f2)
+                                               / f2) / f2) / f1 / 166320.0
+                  + (13860.0 - (462.0 - (132.0 - (99.0 - 140.0 / z2) / z2)
+                                               / z2) / z2) / z / 166320.0
+                  + (13860.0 - (462.0 - (132.0 - (99.0 - 140.0 / x2) / x2)
+                                               / x2) / x2) / x1 / 166320.0
+                  + (13860.0 - (462.0 - (132.0 - (99.0 - 140.0 / w2) / w2)
+                                               / w2) / w2) / w / 166320.0 )
+         return y;
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// void Binomial_Sampler_Variate_Array( Random_State *state, int x[],         //
+//                                      int size,                             //
+//                                      const Binomial_Sampler *sampler )     //
+//                                                                            //
+//  Description:                                                              //
+//     This function fills the array x[] with "size" Binomial(n,p)            //
+//     distributed random variates, where n and p are the parameters given to //
+//     Binomial_Sampler_Init().  The result is the same as "size" successive  //
+//     calls to Binomial_Sampler_Variate_r( state, sampler ).                 //
+//                                                                            //
+//  Arguments:                                                                //
+//     Random_State *state                                                    //
+//        The generator state from which the uniform variates are drawn.      //
+//     int x[]                                                                //
+//        The array of at least "size" elements which is set to the variates. //
+//     int size                                                               //
+//        The number of variates to generate.                                 //
+//     const Binomial_Sampler *sampler                                        //
+//        A sampler prepared by Binomial_Sampler_Init().                      //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     #define N 1000                                                         //
+//     Binomial_Sampler sampler;                                              //
+//     Random_State state;                                                    //
+//     int x[N], n;                                                           //
+//     double p;                                                              //
+//                                                                            //
+//     Random_State_Init( &state, 12345 );                                    //
+//     Binomial_Sampler_Init( &sampler, n, p );                               //
+//     Binomial_Sampler_Variate_Array( &state, x, N, &sampler );              //
+////////////////////////////////////////////////////////////////////////////////
+
+void Binomial_Sampler_Variate_Array( Random_State *state, int x[], int size,
+                                              const Binomial_Sampler *sampler )
+{
+   int i;
+
+   if ( !sampler->btpe ) {
+      for (i = 0; i < size; i++)
+         x[i] = Binomial_Random_Variate_r(state, sampler->n, sampler->p);
+      return;
+   }
+   if ( sampler->p > 0.5 )
+      for (i = 0; i < size; i++) x[i] = sampler->n - BTPE(state, sampler);
+   else
+      for (i = 0; i < size; i++) x[i] = BTPE(state, sampler);
+}
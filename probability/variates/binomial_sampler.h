@@ -0,0 +1,42 @@
+////////////////////////////////////////////////////////////////////////////////
+// File: binomial_sampler.h                                                   //
+// Type(s):                                                                   //
+//    Binomial_Sampler                                                        //
+////////////////////////////////////////////////////////////////////////////////
+#ifndef BINOMIAL_SAMPLER_H
+#define BINOMIAL_SAMPLER_H
+
+////////////////////////////////////////////////////////////////////////////////
+// Binomial_Sampler                                                           //
+//                                                                            //
+//  Description:                                                              //
+//     The parameters of a Binomial(n,p) distribution together with the       //
+//     constants of the BTPE algorithm of Kachitvichyanukul and Schmeiser,    //
+//     computed once by Binomial_Sampler_Init() so that repeated variates     //
+//     with the same n and p do not recompute them.                           //
+//                                                                            //
+//     r = min(p, 1-p) and q = 1 - r.  If btpe is zero, n r is below the      //
+//     crossover BINOMIAL_BTPE_THRESHOLD, also used by                        //
+//     Binomial_Random_Variate_r() and Binomial_Random_Variate_Array(), and   //
+//     the variates are generated by Binomial_Random_Variate_r(); the         //
+//     remaining fields are then unused.  Otherwise m is the mode of          //
+//     Binomial(n,r), p1, ..., p4 are the cumulative areas of the triangular, //
+//     parallelogram and left and right exponential regions of the majorizing //
+//     function, xl, xm and xr the abscissae which bound them, c the height   //
+//     of the parallelograms and laml, lamr the rates of the exponential      //
+//     tails.                                                                 //
+////////////////////////////////////////////////////////////////////////////////
+
+#define BINOMIAL_BTPE_THRESHOLD 10
+
+typedef struct {
+   int n;
+   double p;
+   int btpe;
+   int m;
+   double r, q, nrq;
+   double xm, xl, xr, c, laml, lamr;
+   double p1, p2, p3, p4;
+} Binomial_Sampler;
+
+#endif
@@ -2,16 +2,25 @@
 // File: box_muller.c                                                         //
 // Routine(s):                                                                //
 //    Gaussian_Variate_Box_Muller                                             //
+//    Gaussian_Variate_Box_Muller_r                                           //
 ////////////////////////////////////////////////////////////////////////////////
 
 #include <math.h>              // required for sqrt(), log(), cos(), and sin()
                                // and M_PI
 #include <float.h>             // required for DBL_MIN
+
+#include "random_state.h"
 #define M_2PI (M_PI+M_PI)
 
 //                    Required Externally Defined Routines                    //
+
+extern Random_State* Uniform_0_1_Default_State( void );
         
-extern double Uniform_0_1_Random_Variate( void );
+extern double Uniform_0_1_Random_Variate_r( Random_State *state );
+
+//                    Required Internally Defined Routines                    //
+
+double Gaussian_Variate_Box_Muller_r( Random_State *state );
 
 ////////////////////////////////////////////////////////////////////////////////
 // double Gaussian_Variate_Box_Muller( void )                                 //
@@ -38,20 +47,48 @@ extern double Uniform_0_1_Random_Variate( void );
 
 double Gaussian_Variate_Box_Muller( void )
 {
-   static double next_variate;
-   static int use_next_variate = 0;
+   return Gaussian_Variate_Box_Muller_r( Uniform_0_1_Default_State() );
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// double Gaussian_Variate_Box_Muller_r( Random_State *state )                //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns a standard Gaussian variate using the Box-Muller //
+//     method with the uniform variates drawn from state.  The second variate //
+//     of each pair is kept in the state rather than in a static variable, so //
+//     separate states may be used concurrently.                              //
+//                                                                            //
+//  Arguments:                                                                //
+//     Random_State *state                                                    //
+//        The generator state from which the uniform variates are drawn.      //
+//                                                                            //
+//  Return Values:                                                            //
+//     As for Gaussian_Variate_Box_Muller().                                  //
+//                                                                            //
+//  Example:                                                                  //
+//     Random_State state;                                                    //
+//     double x;                                                              //
+//                                                                            //
+//     Random_State_Init( &state, 12345 );                                    //
+//     x = Gaussian_Variate_Box_Muller_r( &state );                           //
+////////////////////////////////////////////////////////////////////////////////
+
+double Gaussian_Variate_Box_Muller_r( Random_State *state )
+{
    double u, v;
    double variate;
    
-   if (use_next_variate) variate = next_variate;
+   if (state->gaussian_saved) variate = state->gaussian_next;
    else {
-      u = Uniform_0_1_Random_Variate();
+      u = Uniform_0_1_Random_Variate_r(state);
       if (u == 0.0) u = DBL_MIN;
       u = sqrt(-2.0 * log(u) );
-      v = Uniform_0_1_Random_Variate();
+      v = Uniform_0_1_Random_Variate_r(state);
       variate = u * cos(M_2PI * v);
-      next_variate = u * sin(M_2PI * v);
+      state->gaussian_next = u * sin(M_2PI * v);
    }
-   use_next_variate = !use_next_variate;
+   state->gaussian_saved = !state->gaussian_saved;
    return variate;
 }
@@ -2,14 +2,22 @@
 // File: cauchy_random_variate.c                                              //
 // Routine(s):                                                                //
 //    Cauchy_Random_Variate                                                   //
+//    Cauchy_Random_Variate_r                                                 //
 ////////////////////////////////////////////////////////////////////////////////
 
 #include <float.h>             // required for DBL_MIN
 
+#include "random_state.h"
+
 //                    Required Externally Defined Routines                    //
 
-double Uniform_0_1_Random_Variate( void );
-        
+extern Random_State* Uniform_0_1_Default_State( void );
+double Uniform_0_1_Random_Variate_r( Random_State *state );
+
+//                    Required Internally Defined Routines                    //
+
+double Cauchy_Random_Variate_r( Random_State *state );
+
 ////////////////////////////////////////////////////////////////////////////////
 // double Cauchy_Random_Variate( void )                                       //
 //                                                                            //
@@ -34,6 +42,35 @@ double Uniform_0_1_Random_Variate( void );
 ////////////////////////////////////////////////////////////////////////////////
 
 double Cauchy_Random_Variate( void )
+{
+   return Cauchy_Random_Variate_r( Uniform_0_1_Default_State() );
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// double Cauchy_Random_Variate_r( Random_State *state )                      //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns a Cauchy distributed random variate using the    //
+//     same ratio of uniforms method as Cauchy_Random_Variate() but with the  //
+//     uniform variates drawn from state.                                     //
+//                                                                            //
+//  Arguments:                                                                //
+//     Random_State *state                                                    //
+//        The generator state from which the uniform variates are drawn.      //
+//                                                                            //
+//  Return Values:                                                            //
+//     As for Cauchy_Random_Variate().                                        //
+//                                                                            //
+//  Example:                                                                  //
+//     Random_State state;                                                    //
+//     double x;                                                              //
+//                                                                            //
+//     Random_State_Init( &state, 12345 );                                    //
+//     x = Cauchy_Random_Variate_r( &state );                                 //
+////////////////////////////////////////////////////////////////////////////////
+
+double Cauchy_Random_Variate_r( Random_State *state )
 {
    double u, v;
   
@@ -41,8 +78,8 @@ double Cauchy_Random_Variate( void )
 //   until u^2 + v^2 <= 1.                                                    //
 
    do { 
-      u = 2.0 * Uniform_0_1_Random_Variate() - 1.0;
-      v = 2.0 * Uniform_0_1_Random_Variate() - 1.0;
+      u = 2.0 * Uniform_0_1_Random_Variate_r(state) - 1.0;
+      v = 2.0 * Uniform_0_1_Random_Variate_r(state) - 1.0;
    } while ( (u * u + v * v) > 1.0 );
 
 //   In the unlikely event that v = 0 in order to avoid division by zero      //
@@ -0,0 +1,134 @@
+////////////////////////////////////////////////////////////////////////////////
+// File: chi_square_random_variate.c                                          //
+// Routine(s):                                                                //
+//    Chi_Square_Random_Variate                                               //
+//    Chi_Square_Random_Variate_r                                             //
+//    Chi_Square_Random_Variate_Array                                         //
+////////////////////////////////////////////////////////////////////////////////
+
+#include "random_state.h"
+#include "chi_square_sampler.h"
+
+//                    Required Externally Defined Routines                    //
+
+extern Random_State* Uniform_0_1_Default_State( void );
+extern void Chi_Square_Sampler_Init( Chi_Square_Sampler *sampler, double nu );
+extern double Chi_Square_Sampler_Variate_r( Random_State *state,
+                                           const Chi_Square_Sampler *sampler );
+extern void Chi_Square_Sampler_Variate_Array( Random_State *state, double x[],
+                                    int n, const Chi_Square_Sampler *sampler );
+
+//                    Required Internally Defined Routines                    //
+
+double Chi_Square_Random_Variate_r( Random_State *state, double nu );
+
+////////////////////////////////////////////////////////////////////////////////
+// double Chi_Square_Random_Variate( double nu )                              //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns a random variate with the chi-square             //
+//     distribution with nu degrees of freedom, twice a Gamma(nu/2) variate   //
+//     generated by the squeeze method of Marsaglia and Tsang, see            //
+//     Gamma_Sampler_Variate_r().  Unlike Chi_Square_Variate_Inversion(), nu  //
+//     need not be an integer and no quantile function is evaluated.          //
+//                                                                            //
+//  Arguments:                                                                //
+//     double nu                                                              //
+//        The number of degrees of freedom, nu > 0.                           //
+//                                                                            //
+//  Return Values:                                                            //
+//     A random number with a chi-square distribution with nu degrees of      //
+//     freedom.                                                               //
+//                                                                            //
+//  Example:                                                                  //
+//     double x;                                                              //
+//     double nu;                                                             //
+//                                                                            //
+//     x = Chi_Square_Random_Variate( nu );                                   //
+////////////////////////////////////////////////////////////////////////////////
+
+double Chi_Square_Random_Variate( double nu )
+{
+   return Chi_Square_Random_Variate_r( Uniform_0_1_Default_State(), nu );
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// double Chi_Square_Random_Variate_r( Random_State *state, double nu )       //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns a random variate as for                          //
+//     Chi_Square_Random_Variate(), drawing from state.  The constants of the //
+//     method are computed by Chi_Square_Sampler_Init() on each call; callers //
+//     who generate many variates with the same parameters should prepare a   //
+//     Chi_Square_Sampler once and call Chi_Square_Sampler_Variate_r().       //
+//                                                                            //
+//  Arguments:                                                                //
+//     Random_State *state                                                    //
+//        The generator state from which the variates are drawn.              //
+//     double nu                                                              //
+//        As for Chi_Square_Random_Variate().                                 //
+//                                                                            //
+//  Return Values:                                                            //
+//     A random number with a chi-square distribution with nu degrees of      //
+//     freedom.                                                               //
+//                                                                            //
+//  Example:                                                                  //
+//     double x;                                                              //
+//     Random_State state;                                                    //
+//     double nu;                                                             //
+//                                                                            //
+//     Random_State_Init( &state, 12345 );                                    //
+//     x = Chi_Square_Random_Variate_r( &state, nu );                         //
+////////////////////////////////////////////////////////////////////////////////
+
+double Chi_Square_Random_Variate_r( Random_State *state, double nu )
+{
+   Chi_Square_Sampler sampler;
+
+   Chi_Square_Sampler_Init(&sampler, nu);
+   return Chi_Square_Sampler_Variate_r(state, &sampler);
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// void Chi_Square_Random_Variate_Array( Random_State *state, double x[],     //
+//                                       int n, double nu )                   //
+//                                                                            //
+//  Description:                                                              //
+//     This function fills the array x[] with n random variates as for        //
+//     Chi_Square_Random_Variate().  The constants of the method are computed //
+//     once for the whole array, which is then filled by                      //
+//     Chi_Square_Sampler_Variate_Array() from blocks of Gaussian and uniform //
+//     variates.                                                              //
+//                                                                            //
+//  Arguments:                                                                //
+//     Random_State *state                                                    //
+//        The generator state from which the variates are drawn.              //
+//     double x[]                                                             //
+//        The array of at least n elements which is set to the variates.      //
+//     int n                                                                  //
+//        The number of variates to generate.                                 //
+//     double nu                                                              //
+//        As for Chi_Square_Random_Variate().                                 //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     #define N 1000                                                         //
+//     Random_State state;                                                    //
+//     double x[N];                                                           //
+//                                                                            //
+//     Random_State_Init( &state, 12345 );                                    //
+//     Chi_Square_Random_Variate_Array( &state, x, N, 3.5 );                  //
+////////////////////////////////////////////////////////////////////////////////
+
+void Chi_Square_Random_Variate_Array( Random_State *state, double x[], int n,
+                                                                    double nu )
+{
+   Chi_Square_Sampler sampler;
+
+   Chi_Square_Sampler_Init(&sampler, nu);
+   Chi_Square_Sampler_Variate_Array(state, x, n, &sampler);
+}
@@ -0,0 +1,160 @@
+////////////////////////////////////////////////////////////////////////////////
+// File: chi_square_sampler.c                                                 //
+// Routine(s):                                                                //
+//    Chi_Square_Sampler_Init                                                 //
+//    Chi_Square_Sampler_Variate                                              //
+//    Chi_Square_Sampler_Variate_r                                            //
+//    Chi_Square_Sampler_Variate_Array                                        //
+////////////////////////////////////////////////////////////////////////////////
+
+#include "random_state.h"
+#include "chi_square_sampler.h"
+
+//                    Required Externally Defined Routines                    //
+
+extern Random_State* Uniform_0_1_Default_State( void );
+extern void Gamma_Sampler_Init( Gamma_Sampler *sampler, double shape );
+extern double Gamma_Sampler_Variate_r( Random_State *state,
+                                                const Gamma_Sampler *sampler );
+extern void Gamma_Sampler_Variate_Array( Random_State *state, double x[],
+                                         int n, const Gamma_Sampler *sampler );
+
+//                    Required Internally Defined Routines                    //
+
+double Chi_Square_Sampler_Variate_r( Random_State *state,
+                                           const Chi_Square_Sampler *sampler );
+
+////////////////////////////////////////////////////////////////////////////////
+// void Chi_Square_Sampler_Init( Chi_Square_Sampler *sampler, double nu )     //
+//                                                                            //
+//  Description:                                                              //
+//     This function prepares sampler to generate chi-square distributed      //
+//     variates with nu degrees of freedom by preparing the Gamma_Sampler for //
+//     shape nu / 2.  nu need not be an integer.                              //
+//                                                                            //
+//  Arguments:                                                                //
+//     Chi_Square_Sampler *sampler                                            //
+//        The sampler to prepare.                                             //
+//     double nu                                                              //
+//        The number of degrees of freedom, nu > 0.                           //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     Chi_Square_Sampler sampler;                                            //
+//     double nu;                                                             //
+//                                                                            //
+//     Chi_Square_Sampler_Init( &sampler, nu );                               //
+////////////////////////////////////////////////////////////////////////////////
+
+void Chi_Square_Sampler_Init( Chi_Square_Sampler *sampler, double nu )
+{
+   sampler->nu = nu;
+   Gamma_Sampler_Init(&sampler->gamma, 0.5 * nu);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// double Chi_Square_Sampler_Variate( const Chi_Square_Sampler *sampler )     //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns a chi-square distributed random variate with the //
+//     number of degrees of freedom given to Chi_Square_Sampler_Init().  The  //
+//     variates are drawn from the library's default generator state.         //
+//                                                                            //
+//  Arguments:                                                                //
+//     const Chi_Square_Sampler *sampler                                      //
+//        A sampler prepared by Chi_Square_Sampler_Init().                    //
+//                                                                            //
+//  Return Values:                                                            //
+//     A random number with a chi-square distribution with the number of      //
+//     degrees of freedom of sampler.                                         //
+//                                                                            //
+//  Example:                                                                  //
+//     Chi_Square_Sampler sampler;                                            //
+//     double x;                                                              //
+//                                                                            //
+//     x = Chi_Square_Sampler_Variate( &sampler );                            //
+////////////////////////////////////////////////////////////////////////////////
+
+double Chi_Square_Sampler_Variate( const Chi_Square_Sampler *sampler )
+{
+   return Chi_Square_Sampler_Variate_r( Uniform_0_1_Default_State(), sampler );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// double Chi_Square_Sampler_Variate_r( Random_State *state,                  //
+//                                        const Chi_Square_Sampler *sampler ) //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns a chi-square distributed random variate with the //
+//     number of degrees of freedom given to Chi_Square_Sampler_Init(), twice //
+//     a Gamma(nu/2) variate generated by Gamma_Sampler_Variate_r().          //
+//                                                                            //
+//  Arguments:                                                                //
+//     Random_State *state                                                    //
+//        The generator state from which the variates are drawn.              //
+//     const Chi_Square_Sampler *sampler                                      //
+//        A sampler prepared by Chi_Square_Sampler_Init().                    //
+//                                                                            //
+//  Return Values:                                                            //
+//     A random number with a chi-square distribution with the number of      //
+//     degrees of freedom of sampler.                                         //
+//                                                                            //
+//  Example:                                                                  //
+//     Chi_Square_Sampler sampler;                                            //
+//     Random_State state;                                                    //
+//     double x;                                                              //
+//                                                                            //
+//     Random_State_Init( &state, 12345 );                                    //
+//     x = Chi_Square_Sampler_Variate_r( &state, &sampler );                  //
+////////////////////////////////////////////////////////////////////////////////
+
+double Chi_Square_Sampler_Variate_r( Random_State *state,
+                                            const Chi_Square_Sampler *sampler )
+{
+   return 2.0 * Gamma_Sampler_Variate_r(state, &sampler->gamma);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// void Chi_Square_Sampler_Variate_Array( Random_State *state, double x[],    //
+//                                 int n, const Chi_Square_Sampler *sampler ) //
+//                                                                            //
+//  Description:                                                              //
+//     This function fills the array x[] with n chi-square distributed random //
+//     variates with the number of degrees of freedom given to                //
+//     Chi_Square_Sampler_Init().  The array is filled with Gamma(nu/2)       //
+//     variates by Gamma_Sampler_Variate_Array(), which are then doubled.     //
+//                                                                            //
+//  Arguments:                                                                //
+//     Random_State *state                                                    //
+//        The generator state from which the variates are drawn.              //
+//     double x[]                                                             //
+//        The array of at least n elements which is set to the variates.      //
+//     int n                                                                  //
+//        The number of variates to generate.                                 //
+//     const Chi_Square_Sampler *sampler                                      //
+//        A sampler prepared by Chi_Square_Sampler_Init().                    //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     #define N 1000                                                         //
+//     Chi_Square_Sampler sampler;                                            //
+//     Random_State state;                                                    //
+//     double x[N];                                                           //
+//                                                                            //
+//     Random_State_Init( &state, 12345 );                                    //
+//     Chi_Square_Sampler_Init( &sampler, 3.5 );                              //
+//     Chi_Square_Sampler_Variate_Array( &state, x, N, &sampler );            //
+////////////////////////////////////////////////////////////////////////////////
+
+void Chi_Square_Sampler_Variate_Array( Random_State *state, double x[], int n,
+                                            const Chi_Square_Sampler *sampler )
+{
+   int i;
+
+   Gamma_Sampler_Variate_Array(state, x, n, &sampler->gamma);
+   for (i = 0; i < n; i++) x[i] += x[i];
+}
@@ -0,0 +1,28 @@
+////////////////////////////////////////////////////////////////////////////////
+// File: chi_square_sampler.h                                                 //
+// Type(s):                                                                   //
+//    Chi_Square_Sampler                                                      //
+////////////////////////////////////////////////////////////////////////////////
+#ifndef CHI_SQUARE_SAMPLER_H
+#define CHI_SQUARE_SAMPLER_H
+
+#include "gamma_sampler.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Chi_Square_Sampler                                                         //
+//                                                                            //
+//  Description:                                                              //
+//     The number of degrees of freedom of a chi-square distribution together //
+//     with the Gamma_Sampler for shape nu / 2, prepared once by              //
+//     Chi_Square_Sampler_Init() so that repeated variates with the same      //
+//     number of degrees of freedom do not recompute its constants.  A chi-   //
+//     square variate with nu degrees of freedom is twice a Gamma(nu/2)       //
+//     variate.                                                               //
+////////////////////////////////////////////////////////////////////////////////
+
+typedef struct {
+   double nu;
+   Gamma_Sampler gamma;
+} Chi_Square_Sampler;
+
+#endif
@@ -0,0 +1,122 @@
+////////////////////////////////////////////////////////////////////////////////
+// File: chi_square_variate_inversion.c                                       //
+// Routine(s):                                                                //
+//    Chi_Square_Variate_Inversion                                            //
+//    Chi_Square_Variate_Inversion_r                                          //
+//    Chi_Square_Variate_Inversion_Array                                      //
+////////////////////////////////////////////////////////////////////////////////
+
+#include "random_state.h"
+
+//                    Required Externally Defined Routines                    //
+
+extern Random_State* Uniform_0_1_Default_State( void );
+extern double Uniform_0_1_Random_Variate_r( Random_State *state );
+extern double Chi_Square_Quantile(double p, int n);
+
+//                    Required Internally Defined Routines                    //
+
+double Chi_Square_Variate_Inversion_r( Random_State *state, int n );
+
+////////////////////////////////////////////////////////////////////////////////
+// double Chi_Square_Variate_Inversion( int n )                               //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns a Chi-square distributed random variate with n   //
+//     degrees of freedom using the inversion method, i.e.                    //
+//     x = Chi_Square_Quantile(u, n) where u is a uniform(0,1) random         //
+//     variate.                                                               //
+//                                                                            //
+//  Arguments:                                                                //
+//     int n                                                                  //
+//        The number of degrees of freedom, n >= 1.                           //
+//                                                                            //
+//  Return Values:                                                            //
+//     A random number with a Chi-square distribution with n degrees of       //
+//     freedom.  The value returned is in the interval [0, DBL_MAX].          //
+//                                                                            //
+//  Example:                                                                  //
+//     double x;                                                              //
+//     int n;                                                                 //
+//                                                                            //
+//     x = Chi_Square_Variate_Inversion(n);                                   //
+////////////////////////////////////////////////////////////////////////////////
+
+double Chi_Square_Variate_Inversion( int n )
+{
+   return Chi_Square_Variate_Inversion_r( Uniform_0_1_Default_State(), n );
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// double Chi_Square_Variate_Inversion_r( Random_State *state, int n )        //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns Chi_Square_Quantile(u, n) where the uniform      //
+//     variate u is drawn from state.                                         //
+//                                                                            //
+//  Arguments:                                                                //
+//     Random_State *state                                                    //
+//        The generator state from which the uniform variate is drawn.        //
+//     int n                                                                  //
+//        As for Chi_Square_Variate_Inversion().                              //
+//                                                                            //
+//  Return Values:                                                            //
+//     As for Chi_Square_Variate_Inversion().                                 //
+//                                                                            //
+//  Example:                                                                  //
+//     Random_State state;                                                    //
+//     double x;                                                              //
+//     int n;                                                                 //
+//                                                                            //
+//     Random_State_Init( &state, 12345 );                                    //
+//     x = Chi_Square_Variate_Inversion_r( &state, n );                       //
+////////////////////////////////////////////////////////////////////////////////
+
+double Chi_Square_Variate_Inversion_r( Random_State *state, int n )
+{
+   return Chi_Square_Quantile( Uniform_0_1_Random_Variate_r(state), n );
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// void Chi_Square_Variate_Inversion_Array( double u[], double x[],           //
+//                                                          int size, int n ) //
+//                                                                            //
+//  Description:                                                              //
+//     This function sets x[i] to Chi_Square_Quantile(u[i], n) for            //
+//     i = 0,...,size-1 where the uniform variates u[] are supplied by the    //
+//     caller, one per variate.                                               //
+//                                                                            //
+//  Arguments:                                                                //
+//     double u[]                                                             //
+//        The array of size uniform variates, 0 <= u[i] <= 1.                 //
+//     double x[]                                                             //
+//        The array of at least size elements which is set to the variates,   //
+//        x[i] = Chi_Square_Quantile(u[i], n).  x may be the same array as u. //
+//     int size                                                               //
+//        The number of variates.                                             //
+//     int n                                                                  //
+//        As for Chi_Square_Variate_Inversion().                              //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     #define N 1000                                                         //
+//     Random_State state;                                                    //
+//     double u[N], x[N];                                                     //
+//     int n;                                                                 //
+//                                                                            //
+//     Random_State_Init( &state, 12345 );                                    //
+//     Uniform_0_1_Random_Variate_Array( &state, u, N );                      //
+//     Chi_Square_Variate_Inversion_Array( u, x, N, n );                      //
+////////////////////////////////////////////////////////////////////////////////
+
+void Chi_Square_Variate_Inversion_Array( double u[], double x[], int size,
+                                                                        int n )
+{
+   int i;
+
+   for (i = 0; i < size; i++) x[i] = Chi_Square_Quantile(u[i], n);
+}
@@ -0,0 +1,223 @@
+////////////////////////////////////////////////////////////////////////////////
+// File: dirichlet_random_variate.c                                           //
+// Routine(s):                                                                //
+//    Dirichlet_Random_Variate                                                //
+//    Dirichlet_Random_Variate_r                                              //
+//    Dirichlet_Random_Variate_Array                                          //
+////////////////////////////////////////////////////////////////////////////////
+
+#include <math.h>                    // required for exp(), log()
+
+#include "random_state.h"
+#include "gamma_sampler.h"
+
+//                    Required Externally Defined Routines                    //
+
+extern Random_State* Uniform_0_1_Default_State( void );
+extern double Gamma_Random_Variate_r( Random_State *state, double a );
+extern double Exponential_Random_Variate_r( Random_State *state );
+extern void Exponential_Variate_Ziggurat_Array( Random_State *state,
+                                                          double x[], int n );
+extern void Gamma_Sampler_Init( Gamma_Sampler *sampler, double shape );
+extern void Gamma_Sampler_Variate_Array( Random_State *state, double x[],
+                                         int n, const Gamma_Sampler *sampler );
+
+//                    Required Internally Defined Routines                    //
+
+void Dirichlet_Random_Variate_r( Random_State *state, double x[],
+                                                     double alpha[], int k );
+static void Normalize_Log_Components( double x[], int k );
+
+#define BLOCK 256
+
+////////////////////////////////////////////////////////////////////////////////
+// void Dirichlet_Random_Variate( double x[], double alpha[], int k )         //
+//                                                                            //
+//  Description:                                                              //
+//     This function sets x[] to a Dirichlet(alpha[0], ..., alpha[k-1])       //
+//     distributed random vector:  If G0, ..., G(k-1) are independent, Gi     //
+//     having a gamma(alpha[i]) distribution, then the vector with components //
+//     Gi / (G0 + ... + G(k-1)) has a Dirichlet distribution.  The components //
+//     are nonnegative and sum to 1.                                          //
+//                                                                            //
+//     For small alpha[i] every Gi may underflow to 0, so the Gi are formed   //
+//     in log space, ln Gi = ln G(alpha[i]+1) - E / alpha[i] for alpha[i] < 1 //
+//     where E is exponentially distributed, as ln(u^(1/alpha[i])) = -E /     //
+//     alpha[i].  The largest ln Gi is subtracted from each before they are   //
+//     exponentiated and normalized, so that the sum is at least 1.           //
+//                                                                            //
+//  Arguments:                                                                //
+//     double x[]                                                             //
+//        The vector of at least k elements which is set to the variate.      //
+//     double alpha[]                                                         //
+//        The concentration parameters, alpha[i] > 0 for i = 0, ..., k-1.     //
+//     int k                                                                  //
+//        The number of components, k >= 1.                                   //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     #define K 3                                                            //
+//     double x[K], alpha[K];                                                 //
+//                                                                            //
+//     Dirichlet_Random_Variate( x, alpha, K );                               //
+////////////////////////////////////////////////////////////////////////////////
+
+void Dirichlet_Random_Variate( double x[], double alpha[], int k )
+{
+   Dirichlet_Random_Variate_r( Uniform_0_1_Default_State(), x, alpha, k );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// void Dirichlet_Random_Variate_r( Random_State *state, double x[],          //
+//                                  double alpha[], int k )                   //
+//                                                                            //
+//  Description:                                                              //
+//     This function sets x[] to a Dirichlet(alpha[0], ..., alpha[k-1])       //
+//     distributed random vector by the same method as                        //
+//     Dirichlet_Random_Variate(), drawing the gamma variates from state with //
+//     Gamma_Random_Variate_r().                                              //
+//                                                                            //
+//  Arguments:                                                                //
+//     Random_State *state                                                    //
+//        The generator state from which the variates are drawn.              //
+//     double x[]                                                             //
+//        As for Dirichlet_Random_Variate().                                  //
+//     double alpha[]                                                         //
+//        As for Dirichlet_Random_Variate().                                  //
+//     int k                                                                  //
+//        As for Dirichlet_Random_Variate().                                  //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     #define K 3                                                            //
+//     Random_State state;                                                    //
+//     double x[K], alpha[K];                                                 //
+//                                                                            //
+//     Random_State_Init( &state, 12345 );                                    //
+//     Dirichlet_Random_Variate_r( &state, x, alpha, K );                     //
+////////////////////////////////////////////////////////////////////////////////
+
+void Dirichlet_Random_Variate_r( Random_State *state, double x[],
+                                                      double alpha[], int k )
+{
+   int i;
+
+   for (i = 0; i < k; i++)
+      if ( alpha[i] < 1.0 )
+         x[i] = log( Gamma_Random_Variate_r(state, alpha[i] + 1.0) )
+                              - Exponential_Random_Variate_r(state) / alpha[i];
+      else x[i] = log( Gamma_Random_Variate_r(state, alpha[i]) );
+   Normalize_Log_Components(x, k);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// void Dirichlet_Random_Variate_Array( Random_State *state, double x[],      //
+//                                      int size, double alpha[], int k )     //
+//                                                                            //
+//  Description:                                                              //
+//     This function fills x[] with "size" Dirichlet(alpha[0], ...,           //
+//     alpha[k-1]) distributed random vectors, stored by rows: vector i       //
+//     occupies x[i*k], ..., x[i*k + k - 1].  The rows are generated BLOCK at //
+//     a time.  For each component j a Gamma_Sampler is prepared once and     //
+//     Gamma_Sampler_Variate_Array() fills column j of the block with the     //
+//     logarithms of the gamma variates, formed as in                         //
+//     Dirichlet_Random_Variate(), after which each row of the block is       //
+//     exponentiated relative to its largest element and divided by its sum.  //
+//                                                                            //
+//  Arguments:                                                                //
+//     Random_State *state                                                    //
+//        The generator state from which the variates are drawn.              //
+//     double x[]                                                             //
+//        The row-major "size" x k array which is set to the variates.        //
+//     int size                                                               //
+//        The number of vectors to generate.                                  //
+//     double alpha[]                                                         //
+//        The concentration parameters, alpha[i] > 0 for i = 0, ..., k-1.     //
+//     int k                                                                  //
+//        The number of components, k >= 1.                                   //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     #define M 1000                                                         //
+//     #define K 3                                                            //
+//     Random_State state;                                                    //
+//     double x[M][K], alpha[K];                                              //
+//                                                                            //
+//     Random_State_Init( &state, 12345 );                                    //
+//     Dirichlet_Random_Variate_Array( &state, &x[0][0], M, alpha, K );       //
+////////////////////////////////////////////////////////////////////////////////
+
+void Dirichlet_Random_Variate_Array( Random_State *state, double x[], int size,
+                                                      double alpha[], int k )
+{
+   Gamma_Sampler sampler;
+   double g[BLOCK];
+   double e[BLOCK];
+   double *row;
+   int i, j, m, start;
+
+   for (start = 0; start < size; start += BLOCK) {
+      m = (size - start < BLOCK) ? size - start : BLOCK;
+      row = &x[start * k];
+      for (j = 0; j < k; j++) {
+         if ( alpha[j] < 1.0 ) {
+            Gamma_Sampler_Init(&sampler, alpha[j] + 1.0);
+            Gamma_Sampler_Variate_Array(state, g, m, &sampler);
+            Exponential_Variate_Ziggurat_Array(state, e, m);
+            for (i = 0; i < m; i++)
+               row[i * k + j] = log(g[i]) - e[i] / alpha[j];
+         }
+         else {
+            Gamma_Sampler_Init(&sampler, alpha[j]);
+            Gamma_Sampler_Variate_Array(state, g, m, &sampler);
+            for (i = 0; i < m; i++) row[i * k + j] = log(g[i]);
+         }
+      }
+      for (i = 0; i < m; i++, row += k) Normalize_Log_Components(row, k);
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// static void Normalize_Log_Components( double x[], int k )                  //
+//                                                                            //
+//  Description:                                                              //
+//     This function replaces the logarithms x[0], ..., x[k-1] of k numbers   //
+//     by the numbers divided by their sum.  The largest logarithm is         //
+//     subtracted before exponentiating, so that the largest term is 1 and    //
+//     neither the terms nor their sum underflow to 0.                        //
+//                                                                            //
+//  Arguments:                                                                //
+//     double x[]                                                             //
+//        The k logarithms, replaced by the normalized components.            //
+//     int k                                                                  //
+//        The number of components, k >= 1.                                   //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     #define K 3                                                            //
+//     double x[K];                                                           //
+//                                                                            //
+//     Normalize_Log_Components( x, K );                                      //
+////////////////////////////////////////////////////////////////////////////////
+
+static void Normalize_Log_Components( double x[], int k )
+{
+   double max = x[0];
+   double sum = 0.0;
+   int i;
+
+   for (i = 1; i < k; i++) if ( x[i] > max ) max = x[i];
+   for (i = 0; i < k; i++) {
+      x[i] = exp(x[i] - max);
+      sum += x[i];
+   }
+   for (i = 0; i < k; i++) x[i] /= sum;
+}
@@ -0,0 +1,295 @@
+////////////////////////////////////////////////////////////////////////////////
+// File: discrete_sampler.c                                                   //
+// Routine(s):                                                                //
+//    Discrete_Sampler_Init                                                   //
+//    Discrete_Sampler_Variate                                                //
+//    Discrete_Sampler_Variate_r                                              //
+//    Discrete_Sampler_Variate_Array                                          //
+//    Discrete_Sampler_Free                                                   //
+////////////////////////////////////////////////////////////////////////////////
+
+#include <stdlib.h>                         // required for malloc(), free()
+#include <float.h>                          // required for DBL_MAX
+
+#include "random_state.h"
+#include "discrete_sampler.h"
+
+//                    Required Externally Defined Routines                    //
+
+extern Random_State* Uniform_0_1_Default_State( void );
+extern double Uniform_0_1_Random_Variate_r( Random_State *state );
+extern void Uniform_0_1_Random_Variate_Array( Random_State *state, double u[],
+                                                                       int n );
+
+//                    Required Internally Defined Routines                    //
+
+int Discrete_Sampler_Variate_r( Random_State *state,
+                                            const Discrete_Sampler *sampler );
+void Discrete_Sampler_Free( Discrete_Sampler *sampler );
+
+#define BLOCK 256
+
+////////////////////////////////////////////////////////////////////////////////
+// int Discrete_Sampler_Init( Discrete_Sampler *sampler, double pr[],         //
+//                            int size )                                      //
+//                                                                            //
+//  Description:                                                              //
+//     This function builds a Walker alias table for the discrete             //
+//     distribution with Pr[X = i] proportional to pr[i], i = 0, ..., size -  //
+//     1, using Vose's O(size) construction.  pr[] is typically the first     //
+//     array returned by one of the *_Distribution_Tables() routines, e.g.    //
+//     Binomial_Distribution_Tables() or                                      //
+//     Hypergeometric_Distribution_Tables(), whose support is finite.  For a  //
+//     distribution with infinite support, such as the Poisson, geometric,    //
+//     negative binomial or log series distributions, size must be chosen so  //
+//     that the omitted tail is negligible, e.g. size = mu + 12 sqrt(mu) + 24 //
+//     for the Poisson distribution with mean mu; the probabilities are       //
+//     divided by their sum, so the tail is in effect redistributed over the  //
+//     table.                                                                 //
+//                                                                            //
+//     The table is built once and thereafter each variate takes constant     //
+//     time, independent of size and of the parameters of the distribution.   //
+//     The resolution of the probabilities is that of the uniform variates,   //
+//     2^-53.                                                                 //
+//                                                                            //
+//  Arguments:                                                                //
+//     Discrete_Sampler *sampler                                              //
+//        The sampler to build.  Its storage is allocated here and must be    //
+//        released by Discrete_Sampler_Free().                                //
+//     double pr[]                                                            //
+//        The probabilities, or any nonnegative weights proportional to them, //
+//        pr[i] for i = 0, ..., size - 1.                                     //
+//     int size                                                               //
+//        The number of values, size >= 1.                                    //
+//                                                                            //
+//  Return Values:                                                            //
+//     0 on success, -1 if size < 1 or a weight is negative or not finite or  //
+//     the weights sum to 0, and -2 if memory could not be allocated.  After  //
+//     a return of -1 or -2 the sampler is empty and Discrete_Sampler_Free()  //
+//     may still be called.                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     #define N 100                                                          //
+//     Discrete_Sampler sampler;                                              //
+//     double pr[N+1], cumulative[N+1];                                       //
+//     double p;                                                              //
+//     int x;                                                                 //
+//                                                                            //
+//     Binomial_Distribution_Tables( N, p, pr, cumulative );                  //
+//     Discrete_Sampler_Init( &sampler, pr, N + 1 );                          //
+//     x = Discrete_Sampler_Variate( &sampler );                              //
+//     Discrete_Sampler_Free( &sampler );                                     //
+////////////////////////////////////////////////////////////////////////////////
+
+int Discrete_Sampler_Init( Discrete_Sampler *sampler, double pr[], int size )
+{
+   double sum = 0.0;
+   double *q;
+   int *small, *large;
+   int n_small = 0;
+   int n_large = 0;
+   int i, s, l;
+
+   sampler->size = 0;
+   sampler->threshold = NULL;
+   sampler->alias = NULL;
+
+   if ( size < 1 ) return -1;
+   for (i = 0; i < size; i++) {
+      if ( !(pr[i] >= 0.0 && pr[i] <= DBL_MAX) ) return -1;
+      sum += pr[i];
+   }
+   if ( !(sum > 0.0 && sum <= DBL_MAX) ) return -1;
+
+   sampler->threshold = (double*) malloc( size * sizeof(double) );
+   sampler->alias = (int*) malloc( size * sizeof(int) );
+   small = (int*) malloc( 2 * size * sizeof(int) );
+   if ( sampler->threshold == NULL || sampler->alias == NULL
+                                                         || small == NULL ) {
+      free( small );
+      Discrete_Sampler_Free( sampler );
+      return -2;
+   }
+   large = small + size;
+   sampler->size = size;
+   q = sampler->threshold;
+
+        // Scale the probabilities to have mean 1 and split the values //
+        // into those below and those at or above the mean.            //
+
+   for (i = 0; i < size; i++) {
+      q[i] = pr[i] / sum * (double) size;
+      sampler->alias[i] = i;
+      if ( q[i] < 1.0 ) small[n_small++] = i;
+      else large[n_large++] = i;
+   }
+
+         // Fill each column of a small value with a large value, which //
+         // loses what it gives and may itself become small.            //
+
+   while ( n_small > 0 && n_large > 0 ) {
+      s = small[--n_small];
+      l = large[n_large - 1];
+      sampler->alias[s] = l;
+      q[l] -= 1.0 - q[s];
+      if ( q[l] < 1.0 ) {
+         n_large--;
+         small[n_small++] = l;
+      }
+   }
+
+       // What is left is 1 up to rounding errors and fills its column. //
+
+   while ( n_large > 0 ) q[large[--n_large]] = 1.0;
+   while ( n_small > 0 ) q[small[--n_small]] = 1.0;
+   free( small );
+   return 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// int Discrete_Sampler_Variate( const Discrete_Sampler *sampler )            //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns a variate with the distribution of sampler, see  //
+//     Discrete_Sampler_Variate_r(), drawing from the library's default       //
+//     generator state.                                                       //
+//                                                                            //
+//  Arguments:                                                                //
+//     const Discrete_Sampler *sampler                                        //
+//        A sampler built by Discrete_Sampler_Init().                         //
+//                                                                            //
+//  Return Values:                                                            //
+//     A random integer i, 0 <= i < sampler->size.                            //
+//                                                                            //
+//  Example:                                                                  //
+//     Discrete_Sampler sampler;                                              //
+//     int x;                                                                 //
+//                                                                            //
+//     x = Discrete_Sampler_Variate( &sampler );                              //
+////////////////////////////////////////////////////////////////////////////////
+
+int Discrete_Sampler_Variate( const Discrete_Sampler *sampler )
+{
+   return Discrete_Sampler_Variate_r( Uniform_0_1_Default_State(), sampler );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// int Discrete_Sampler_Variate_r( Random_State *state,                       //
+//                                 const Discrete_Sampler *sampler )          //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns a variate with the distribution of sampler.  A   //
+//     uniform variate u on [0,1) is drawn from state and v = u * size is     //
+//     formed; the integer part j of v selects a column of the table and the  //
+//     fractional part is compared with threshold[j] to choose between j and  //
+//     alias[j].                                                              //
+//                                                                            //
+//  Arguments:                                                                //
+//     Random_State *state                                                    //
+//        The generator state from which the uniform variate is drawn.        //
+//     const Discrete_Sampler *sampler                                        //
+//        A sampler built by Discrete_Sampler_Init().                         //
+//                                                                            //
+//  Return Values:                                                            //
+//     A random integer i, 0 <= i < sampler->size.                            //
+//                                                                            //
+//  Example:                                                                  //
+//     Discrete_Sampler sampler;                                              //
+//     Random_State state;                                                    //
+//     int x;                                                                 //
+//                                                                            //
+//     Random_State_Init( &state, 12345 );                                    //
+//     x = Discrete_Sampler_Variate_r( &state, &sampler );                    //
+////////////////////////////////////////////////////////////////////////////////
+
+int Discrete_Sampler_Variate_r( Random_State *state,
+                                             const Discrete_Sampler *sampler )
+{
+   double v = Uniform_0_1_Random_Variate_r(state) * (double) sampler->size;
+   int j = (int) v;
+
+   return ( v - (double) j < sampler->threshold[j] ) ? j : sampler->alias[j];
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// void Discrete_Sampler_Variate_Array( Random_State *state, int x[], int n,  //
+//                                      const Discrete_Sampler *sampler )     //
+//                                                                            //
+//  Description:                                                              //
+//     This function fills the array x[] with n variates with the             //
+//     distribution of sampler.  The uniform variates are generated in blocks //
+//     by Uniform_0_1_Random_Variate_Array() and the table is then applied to //
+//     the block, so the result is the same as n successive calls to          //
+//     Discrete_Sampler_Variate_r( state, sampler ).                          //
+//                                                                            //
+//  Arguments:                                                                //
+//     Random_State *state                                                    //
+//        The generator state from which the uniform variates are drawn.      //
+//     int x[]                                                                //
+//        The array of at least n elements which is set to the variates.      //
+//     int n                                                                  //
+//        The number of variates to generate.                                 //
+//     const Discrete_Sampler *sampler                                        //
+//        A sampler built by Discrete_Sampler_Init().                         //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     #define N 1000                                                         //
+//     Discrete_Sampler sampler;                                              //
+//     Random_State state;                                                    //
+//     int x[N];                                                              //
+//                                                                            //
+//     Random_State_Init( &state, 12345 );                                    //
+//     Discrete_Sampler_Variate_Array( &state, x, N, &sampler );              //
+////////////////////////////////////////////////////////////////////////////////
+
+void Discrete_Sampler_Variate_Array( Random_State *state, int x[], int n,
+                                             const Discrete_Sampler *sampler )
+{
+   double u[BLOCK];
+   double size = (double) sampler->size;
+   double v;
+   int i, j, m, start;
+
+   for (start = 0; start < n; start += BLOCK) {
+      m = (n - start < BLOCK) ? n - start : BLOCK;
+      Uniform_0_1_Random_Variate_Array(state, u, m);
+      for (i = 0; i < m; i++) {
+         v = u[i] * size;
+         j = (int) v;
+         x[start + i] = ( v - (double) j < sampler->threshold[j] )
+                                                      ? j : sampler->alias[j];
+      }
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// void Discrete_Sampler_Free( Discrete_Sampler *sampler )                    //
+//                                                                            //
+//  Description:                                                              //
+//     This function releases the storage of a sampler built by               //
+//     Discrete_Sampler_Init() and leaves it empty.                           //
+//                                                                            //
+//  Arguments:                                                                //
+//     Discrete_Sampler *sampler                                              //
+//        The sampler to release.                                             //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     Discrete_Sampler sampler;                                              //
+//                                                                            //
+//     Discrete_Sampler_Free( &sampler );                                     //
+////////////////////////////////////////////////////////////////////////////////
+
+void Discrete_Sampler_Free( Discrete_Sampler *sampler )
+{
+   free( sampler->threshold );
+   free( sampler->alias );
+   sampler->threshold = NULL;
+   sampler->alias = NULL;
+   sampler->size = 0;
+}
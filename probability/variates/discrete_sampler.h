@@ -0,0 +1,27 @@
+////////////////////////////////////////////////////////////////////////////////
+// File: discrete_sampler.h                                                   //
+// Type(s):                                                                   //
+//    Discrete_Sampler                                                        //
+////////////////////////////////////////////////////////////////////////////////
+#ifndef DISCRETE_SAMPLER_H
+#define DISCRETE_SAMPLER_H
+
+////////////////////////////////////////////////////////////////////////////////
+// Discrete_Sampler                                                           //
+//                                                                            //
+//  Description:                                                              //
+//     A Walker alias table for sampling a discrete distribution on {0, 1,    //
+//     ..., size - 1}, built by Discrete_Sampler_Init() and released by       //
+//     Discrete_Sampler_Free().  Column j of the table is chosen uniformly;   //
+//     within it the variate is j with probability threshold[j] and alias[j]  //
+//     otherwise, so that every variate costs one uniform variate and one     //
+//     comparison whatever the distribution.                                  //
+////////////////////////////////////////////////////////////////////////////////
+
+typedef struct {
+   int size;
+   double *threshold;
+   int *alias;
+} Discrete_Sampler;
+
+#endif
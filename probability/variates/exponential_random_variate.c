@@ -3,9 +3,26 @@
 // Routine(s):                                                                //
 //    Init_Exponential_Random_Variate                                         //
 //    Exponential_Random_Variate                                              //
+//    Init_Exponential_Random_Variate_r                                       //
+//    Exponential_Random_Variate_r                                            //
 ////////////////////////////////////////////////////////////////////////////////
 
+#include <stddef.h>                                     // required for NULL
+
+#include "random_state.h"
+
+//                    Required Externally Defined Routines                    //
+
+extern Random_State* Uniform_0_1_Default_State( void );
+extern double Exponential_Variate_Ziggurat_r( Random_State *state );
+
+//                    Required Internally Defined Routines                    //
+
+double Exponential_Random_Variate_r( Random_State *state );
+
 static double (*rn)(void);
+static double (*rn_r)(Random_State *) = Exponential_Variate_Ziggurat_r;
+static Random_State *rn_state = NULL;
 
 ////////////////////////////////////////////////////////////////////////////////
 // void Init_Exponential_Random_Variate( double (*r_generator)(void) )        //
@@ -13,7 +30,12 @@ static double (*rn)(void);
 //  Description:                                                              //
 //     This function saves the pointer to an exponential random number        //
 //     generator.  Subsequent calls to Exponential_Random_Variate (below)     //
-//     will call this routine.                                                //
+//     will call this routine, as will the generators without a state         //
+//     argument which draw exponential variates, such as                      //
+//     Gamma_Random_Variate() and Geometric_Random_Variate(), since they draw //
+//     from the library's default state.  Variates drawn from any other state //
+//     use the routine set by Init_Exponential_Random_Variate_r().  Passing   //
+//     NULL restores the default.                                             //
 //                                                                            //
 //  Arguments:                                                                //
 //     double (*r_generator)(void)                                            //
@@ -31,6 +53,7 @@ static double (*rn)(void);
 void Init_Exponential_Random_Variate( double (*r_generator)(void) )
 {
    rn = r_generator;
+   rn_state = ( rn != NULL ) ? Uniform_0_1_Default_State() : NULL;
 }
 
 
@@ -39,7 +62,9 @@ void Init_Exponential_Random_Variate( double (*r_generator)(void) )
 //                                                                            //
 //  Description:                                                              //
 //     This function returns an exponentially distributed random variate on   //
-//     [0, DBL_MAX]                                                           //
+//     [0, DBL_MAX], by the routine set with                                  //
+//     Init_Exponential_Random_Variate() if it has been called and otherwise  //
+//     by Exponential_Random_Variate_r() with the library's default state.    //
 //                                                                            //
 //  Arguments:                                                                //
 //     None                                                                   //
@@ -53,4 +78,71 @@ void Init_Exponential_Random_Variate( double (*r_generator)(void) )
 //     x = Exponential_Random_Variate();                                      //
 ////////////////////////////////////////////////////////////////////////////////
         
-double Exponential_Random_Variate( void ) { return (*rn)(); }
+double Exponential_Random_Variate( void )
+{
+   return Exponential_Random_Variate_r( Uniform_0_1_Default_State() );
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// void Init_Exponential_Random_Variate_r(                                    //
+//                           double (*r_generator)(Random_State*) )           //
+//                                                                            //
+//  Description:                                                              //
+//     This function saves the pointer to an exponential random number        //
+//     generator which draws its uniform variates from a caller supplied      //
+//     state.  Subsequent calls to Exponential_Random_Variate_r (below) will  //
+//     call this routine.  The default is Exponential_Variate_Ziggurat().     //
+//     The pointer is shared by all threads, so it should be set before any   //
+//     thread calls Exponential_Random_Variate_r().                           //
+//                                                                            //
+//  Arguments:                                                                //
+//     double (*r_generator)(Random_State*)                                   //
+//        The user supplied random number generator generating an exponential //
+//        distributed random number on [0,inf].                               //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     extern double exponential_rng( Random_State *state );                  //
+//                                                                            //
+//     Init_Exponential_Random_Variate_r( exponential_rng );                  //
+////////////////////////////////////////////////////////////////////////////////
+        
+void Init_Exponential_Random_Variate_r( double (*r_generator)(Random_State*) )
+{
+   rn_r = r_generator;
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// double Exponential_Random_Variate_r( Random_State *state )                 //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns an exponentially distributed random variate on   //
+//     [0, DBL_MAX] drawn from the generator state "state" by the routine set //
+//     with Init_Exponential_Random_Variate_r(), or, if state is the          //
+//     library's default state and Init_Exponential_Random_Variate() has been //
+//     called, by the routine set with it.                                    //
+//                                                                            //
+//  Arguments:                                                                //
+//     Random_State *state                                                    //
+//        The generator state.                                                //
+//                                                                            //
+//  Return Values:                                                            //
+//     A random number with an exponential distribution.                      //
+//                                                                            //
+//  Example:                                                                  //
+//     Random_State state;                                                    //
+//     double x;                                                              //
+//                                                                            //
+//     Random_State_Init( &state, 12345 );                                    //
+//     x = Exponential_Random_Variate_r( &state );                            //
+////////////////////////////////////////////////////////////////////////////////
+        
+double Exponential_Random_Variate_r( Random_State *state )
+{
+   if ( state == rn_state ) return (*rn)();
+   return (*rn_r)(state);
+}
@@ -2,14 +2,23 @@
 // File: exponential_variate_inversion.c                                      //
 // Routine(s):                                                                //
 //    Exponential_Variate_Inversion                                           //
+//    Exponential_Variate_Inversion_r                                         //
+//    Exponential_Variate_Inversion_Array                                     //
 ////////////////////////////////////////////////////////////////////////////////
 
 #include <math.h>                             // required for log()
 #include <float.h>                            // required for DBL_MAX
 
+#include "random_state.h"
+
 //                    Required Externally Defined Routines                    //
 
-extern double Uniform_0_1_Random_Variate( void );
+extern Random_State* Uniform_0_1_Default_State( void );
+extern double Uniform_0_1_Random_Variate_r( Random_State *state );
+
+//                    Required Internally Defined Routines                    //
+
+double Exponential_Variate_Inversion_r( Random_State *state );
 
 ////////////////////////////////////////////////////////////////////////////////
 // double Exponential_Variate_Inversion( void )                               //
@@ -37,8 +46,75 @@ extern double Uniform_0_1_Random_Variate( void );
         
 double Exponential_Variate_Inversion( void )
 {
-   double u = Uniform_0_1_Random_Variate();
+   return Exponential_Variate_Inversion_r( Uniform_0_1_Default_State() );
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// double Exponential_Variate_Inversion_r( Random_State *state )              //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns an exponential variate, -ln(u), where the        //
+//     uniform variate u is drawn from state.                                 //
+//                                                                            //
+//  Arguments:                                                                //
+//     Random_State *state                                                    //
+//        The generator state from which the uniform variates are drawn.      //
+//                                                                            //
+//  Return Values:                                                            //
+//     As for Exponential_Variate_Inversion().                                //
+//                                                                            //
+//  Example:                                                                  //
+//     Random_State state;                                                    //
+//     double x;                                                              //
+//                                                                            //
+//     Random_State_Init( &state, 12345 );                                    //
+//     x = Exponential_Variate_Inversion_r( &state );                         //
+////////////////////////////////////////////////////////////////////////////////
+
+double Exponential_Variate_Inversion_r( Random_State *state )
+{
+   double u = Uniform_0_1_Random_Variate_r(state);
    if (u == 0.0) return DBL_MAX;
    if (u == 1.0) return 0.0;
    return -log(u);
 }
+
+
+////////////////////////////////////////////////////////////////////////////////
+// void Exponential_Variate_Inversion_Array( double u[], double x[], int n )  //
+//                                                                            //
+//  Description:                                                              //
+//     This function sets x[i] to the exponential variate -ln(u[i]) for       //
+//     i = 0,...,n-1 where the uniform variates u[] are supplied by the       //
+//     caller, one per variate, as in Exponential_Variate_Inversion_r().      //
+//                                                                            //
+//  Arguments:                                                                //
+//     double u[]                                                             //
+//        The array of n uniform variates, 0 <= u[i] <= 1.                    //
+//     double x[]                                                             //
+//        The array of at least n elements which is set to the variates.  x   //
+//        may be the same array as u.                                         //
+//     int n                                                                  //
+//        The number of variates.                                             //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     #define N 1000                                                         //
+//     Random_State state;                                                    //
+//     double u[N], x[N];                                                     //
+//                                                                            //
+//     Random_State_Init( &state, 12345 );                                    //
+//     Uniform_0_1_Random_Variate_Array( &state, u, N );                      //
+//     Exponential_Variate_Inversion_Array( u, x, N );                        //
+////////////////////////////////////////////////////////////////////////////////
+
+void Exponential_Variate_Inversion_Array( double u[], double x[], int n )
+{
+   int i;
+
+   for (i = 0; i < n; i++)
+      x[i] = (u[i] == 0.0) ? DBL_MAX : (u[i] == 1.0) ? 0.0 : -log(u[i]);
+}
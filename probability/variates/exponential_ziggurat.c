@@ -2,15 +2,41 @@
 // File: exponential_ziggarut.c                                               //
 // Routine(s):                                                                //
 //    Exponential_Variate_Ziggurat                                            //
+//    Exponential_Variate_Ziggurat_r                                          //
+//    Exponential_Variate_Ziggurat_Array                                      //
 ////////////////////////////////////////////////////////////////////////////////
 
 #include <math.h>                          // required for abs() and exp()
 
+#include "random_state.h"
+
 //                    Required Externally Defined Routines                    //
 
-extern unsigned long  Uniform_32_Bits_Random_Variate( void );
-extern double Uniform_0_1_Random_Variate( void );
-        
+extern Random_State* Uniform_0_1_Default_State( void );
+extern unsigned long  Uniform_32_Bits_Random_Variate_r( Random_State *state );
+extern double Uniform_0_1_Random_Variate_r( Random_State *state );
+extern void Uniform_32_Bits_Random_Variate_Array( Random_State *state,
+                                                    unsigned long u[], int n );
+
+//                    Required Internally Defined Routines                    //
+
+double Exponential_Variate_Ziggurat_r( Random_State *state );
+static int Wedge_Or_Tail( Random_State *state, int i, double *x );
+static void Rectangle_Test( const unsigned long w[], int m, double x[],
+                                                     unsigned char rejected[] );
+
+#if defined(__GNUC__) && defined(__x86_64__) && defined(__LP64__)
+#define ZIGGURAT_SIMD
+#include <immintrin.h>          // required for the AVX2 and AVX-512 intrinsics
+static void Rectangle_Test_AVX2( const unsigned long w[], int m, double x[],
+                                                     unsigned char rejected[] );
+static void Rectangle_Test_AVX512( const unsigned long w[], int m, double x[],
+                                                     unsigned char rejected[] );
+#endif
+
+static void (*rectangle_test)( const unsigned long w[], int m, double x[],
+                                  unsigned char rejected[] ) = Rectangle_Test;
+
 ////////////////////////////////////////////////////////////////////////////////
 // double Exponential_Variate_Ziggurat( void )                                //
 //                                                                            //
@@ -268,18 +294,259 @@ static const double r = 7.697117470131049714;
 
 double Exponential_Variate_Ziggurat( void )
 {
-   union {
-      unsigned long v;
-      unsigned char b[4];
-   } j;
+   return Exponential_Variate_Ziggurat_r( Uniform_0_1_Default_State() );
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// double Exponential_Variate_Ziggurat_r( Random_State *state )               //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns an exponential variate with mean 1 using         //
+//     Marsaglia's ziggurat method with all of the random words and uniform   //
+//     variates drawn from state.                                             //
+//                                                                            //
+//  Arguments:                                                                //
+//     Random_State *state                                                    //
+//        The generator state from which the uniform variates are drawn.      //
+//                                                                            //
+//  Return Values:                                                            //
+//     As for Exponential_Variate_Ziggurat().                                 //
+//                                                                            //
+//  Example:                                                                  //
+//     Random_State state;                                                    //
+//     double x;                                                              //
+//                                                                            //
+//     Random_State_Init( &state, 12345 );                                    //
+//     x = Exponential_Variate_Ziggurat_r( &state );                          //
+////////////////////////////////////////////////////////////////////////////////
+
+double Exponential_Variate_Ziggurat_r( Random_State *state )
+{
+   unsigned long v;
+   int i;
    double x;
 
    for (;;) {
-      j.v = Uniform_32_Bits_Random_Variate();
-      if ( j.v < ke[j.b[0]] ) return x = j.v * we[j.b[0]];
-      if (j.b[0] == 0) return r - log(Uniform_0_1_Random_Variate());
-      x = j.v * we[j.b[0]];
-      if ( fe[j.b[0]] + Uniform_0_1_Random_Variate()
-                          * (fe[j.b[0]-1] - fe[j.b[0]]) < exp(-x) ) return x; 
+      v = Uniform_32_Bits_Random_Variate_r(state);
+      i = (int) (v & 0xff);
+      x = v * we[i];
+      if ( v < ke[i] ) return x;
+      if ( Wedge_Or_Tail(state, i, &x) ) return x;
    }   
 }
+
+
+////////////////////////////////////////////////////////////////////////////////
+// void Exponential_Variate_Ziggurat_Array( Random_State *state, double x[],  //
+//                                                                    int n ) //
+//                                                                            //
+//  Description:                                                              //
+//     This function fills the array x[] with n exponential variates with     //
+//     mean 1 using Marsaglia's ziggurat method.  As for                      //
+//     Gaussian_Variate_Marsaglias_Ziggurat_Array(), the rectangle test is    //
+//     applied to a whole block of random words at once and only the          //
+//     rejected candidates are completed one at a time.  On x86-64            //
+//     processors with AVX2 or AVX-512 the rectangle test is applied to 4 or  //
+//     8 candidates at a time, the version being chosen when the library is   //
+//     loaded.  Every version produces the same variates.                     //
+//                                                                            //
+//  Arguments:                                                                //
+//     Random_State *state                                                    //
+//        The generator state from which the random words are drawn.          //
+//     double x[]                                                             //
+//        The array of at least n elements which is set to the variates.      //
+//     int n                                                                  //
+//        The number of variates to generate.                                 //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     #define N 1000                                                         //
+//     Random_State state;                                                    //
+//     double x[N];                                                           //
+//                                                                            //
+//     Random_State_Init( &state, 12345 );                                    //
+//     Exponential_Variate_Ziggurat_Array( &state, x, N );                    //
+////////////////////////////////////////////////////////////////////////////////
+
+#define BLOCK 256
+
+void Exponential_Variate_Ziggurat_Array( Random_State *state, double x[],
+                                                                        int n )
+{
+   unsigned long w[BLOCK];
+   unsigned char rejected[BLOCK];
+   int j, k, m;
+
+   for (j = 0; j < n; j += m) {
+      m = (n - j < BLOCK) ? n - j : BLOCK;
+      Uniform_32_Bits_Random_Variate_Array(state, w, m);
+      (*rectangle_test)(w, m, &x[j], rejected);
+      for (k = 0; k < m; k++) {
+         if ( !rejected[k] ) continue;
+         if ( !Wedge_Or_Tail(state, (int) (w[k] & 0xff), &x[j + k]) )
+            x[j + k] = Exponential_Variate_Ziggurat_r(state);
+      }
+   }
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// static int Wedge_Or_Tail( Random_State *state, int i, double *x )          //
+//                                                                            //
+//  Description:                                                              //
+//     This function completes the ziggurat test for a candidate x which      //
+//     failed the rectangle test in layer i.  For the base layer, i = 0, the  //
+//     variate r - ln(u) from the tail is returned.  For the other layers the //
+//     candidate is accepted if a uniformly distributed point in the wedge    //
+//     lies below the density.                                                //
+//                                                                            //
+//  Arguments:                                                                //
+//     Random_State *state                                                    //
+//            The generator state from which the uniform variates are drawn.  //
+//     int    i                                                               //
+//            The layer of the ziggurat, 0 <= i < 256.                        //
+//     double *x                                                              //
+//            On input the candidate, on output the accepted variate.         //
+//                                                                            //
+//  Return Values:                                                            //
+//     1 if *x is accepted, 0 if the candidate is rejected and a new one      //
+//     must be drawn.                                                         //
+////////////////////////////////////////////////////////////////////////////////
+
+static int Wedge_Or_Tail( Random_State *state, int i, double *x )
+{
+   if (i == 0) {
+      *x = r - log(Uniform_0_1_Random_Variate_r(state));
+      return 1;
+   }
+   return ( fe[i] + Uniform_0_1_Random_Variate_r(state) * (fe[i-1] - fe[i])
+                                                                < exp(-*x) );
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// static void Rectangle_Test( const unsigned long w[], int m, double x[],    //
+//                                                  unsigned char rejected[] )//
+//                                                                            //
+//  Description:                                                              //
+//     This function forms the candidates x[k] = w[k] we[i] for a block of m  //
+//     random words, where the layer i is the low byte of w[k], and flags in  //
+//     rejected[k] the candidates which fail the rectangle test w[k] < ke[i]. //
+//     Rectangle_Test_AVX2() and Rectangle_Test_AVX512() below produce bit    //
+//     for bit the same output.                                               //
+//                                                                            //
+//  Arguments:                                                                //
+//     const unsigned long w[]                                                //
+//            The m random words.                                             //
+//     int    m                                                               //
+//            The number of candidates.                                       //
+//     double x[]                                                             //
+//            The m candidates.                                               //
+//     unsigned char rejected[]                                               //
+//            rejected[k] is set to 1 if x[k] failed the rectangle test and   //
+//            to 0 if x[k] is accepted.                                       //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+////////////////////////////////////////////////////////////////////////////////
+
+static void Rectangle_Test( const unsigned long w[], int m, double x[],
+                                                      unsigned char rejected[] )
+{
+   int i, k;
+
+   for (k = 0; k < m; k++) {
+      i = (int) (w[k] & 0xff);
+      x[k] = w[k] * we[i];
+      rejected[k] = ( w[k] >= ke[i] );
+   }
+}
+
+#ifdef ZIGGURAT_SIMD
+
+// The random words are less than 2^32, so they are converted to doubles by
+// placing them in the mantissa of 2^52 and subtracting 2^52.
+
+__attribute__((target("avx2")))
+static void Rectangle_Test_AVX2( const unsigned long w[], int m, double x[],
+                                                      unsigned char rejected[] )
+{
+   const __m256i byte = _mm256_set1_epi64x(0xff);
+   const __m256i two52 = _mm256_set1_epi64x(0x4330000000000000LL);
+   const __m256d two52d = _mm256_set1_pd(4503599627370496.0);
+   __m256i v, i, k;
+   __m256d u;
+   int accepted;
+   int j = 0;
+
+   for (; j + 4 <= m; j += 4) {
+      v = _mm256_loadu_si256((const __m256i *) &w[j]);
+      i = _mm256_and_si256(v, byte);
+      k = _mm256_i64gather_epi64((const long long *) ke, i, 8);
+      u = _mm256_sub_pd(_mm256_castsi256_pd(_mm256_or_si256(v, two52)), two52d);
+      _mm256_storeu_pd(&x[j], _mm256_mul_pd(u, _mm256_i64gather_pd(we, i, 8)));
+      accepted = _mm256_movemask_pd(_mm256_castsi256_pd(
+                                                   _mm256_cmpgt_epi64(k, v)));
+      rejected[j]     = !(accepted & 1);
+      rejected[j + 1] = !(accepted & 2);
+      rejected[j + 2] = !(accepted & 4);
+      rejected[j + 3] = !(accepted & 8);
+   }
+   if (j < m) Rectangle_Test(&w[j], m - j, &x[j], &rejected[j]);
+}
+
+__attribute__((target("avx512f")))
+static void Rectangle_Test_AVX512( const unsigned long w[], int m, double x[],
+                                                      unsigned char rejected[] )
+{
+   const __m512i byte = _mm512_set1_epi64(0xff);
+   const __m512i two52 = _mm512_set1_epi64(0x4330000000000000LL);
+   const __m512d two52d = _mm512_set1_pd(4503599627370496.0);
+   __m512i v, i, k;
+   __m512d u;
+   __mmask8 accepted;
+   int b;
+   int j = 0;
+
+   for (; j + 8 <= m; j += 8) {
+      v = _mm512_loadu_si512((const void *) &w[j]);
+      i = _mm512_and_si512(v, byte);
+      k = _mm512_i64gather_epi64(i, (const void *) ke, 8);
+      u = _mm512_sub_pd(_mm512_castsi512_pd(_mm512_or_si512(v, two52)), two52d);
+      u = _mm512_mul_pd(u, _mm512_i64gather_pd(i, (const void *) we, 8));
+      _mm512_storeu_pd(&x[j], u);
+      accepted = _mm512_cmplt_epu64_mask(v, k);
+      for (b = 0; b < 8; b++) rejected[j + b] = !((accepted >> b) & 1);
+   }
+   if (j < m) Rectangle_Test(&w[j], m - j, &x[j], &rejected[j]);
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// static void Init_Rectangle_Test( void )                                    //
+//                                                                            //
+//  Description:                                                              //
+//     This function is run when the library is loaded.  It selects the       //
+//     widest version of the rectangle test which the processor supports.     //
+//                                                                            //
+//  Arguments:                                                                //
+//     None                                                                   //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+////////////////////////////////////////////////////////////////////////////////
+
+__attribute__((constructor))
+static void Init_Rectangle_Test( void )
+{
+   __builtin_cpu_init();
+   if ( __builtin_cpu_supports("avx512f") )
+      rectangle_test = Rectangle_Test_AVX512;
+   else if ( __builtin_cpu_supports("avx2") )
+      rectangle_test = Rectangle_Test_AVX2;
+}
+
+#endif
@@ -0,0 +1,139 @@
+////////////////////////////////////////////////////////////////////////////////
+// File: f_random_variate.c                                                   //
+// Routine(s):                                                                //
+//    F_Random_Variate                                                        //
+//    F_Random_Variate_r                                                      //
+//    F_Random_Variate_Array                                                  //
+////////////////////////////////////////////////////////////////////////////////
+
+#include "random_state.h"
+#include "f_sampler.h"
+
+//                    Required Externally Defined Routines                    //
+
+extern Random_State* Uniform_0_1_Default_State( void );
+extern void F_Sampler_Init( F_Sampler *sampler, double nu1, double nu2 );
+extern double F_Sampler_Variate_r( Random_State *state,
+                                                    const F_Sampler *sampler );
+extern void F_Sampler_Variate_Array( Random_State *state, double x[],
+                                             int n, const F_Sampler *sampler );
+
+//                    Required Internally Defined Routines                    //
+
+double F_Random_Variate_r( Random_State *state, double nu1, double nu2 );
+
+////////////////////////////////////////////////////////////////////////////////
+// double F_Random_Variate( double nu1, double nu2 )                          //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns a random variate with the F-distribution with    //
+//     nu1 and nu2 degrees of freedom, (nu2 / nu1) G1 / G2 where G1 and G2    //
+//     are independent Gamma(nu1/2) and Gamma(nu2/2) variates, see            //
+//     F_Sampler_Variate_r().  Unlike F_Variate_Inversion(), nu1 and nu2 need //
+//     not be integers and no quantile function is evaluated.                 //
+//                                                                            //
+//  Arguments:                                                                //
+//     double nu1                                                             //
+//        The number of degrees of freedom of the numerator, nu1 > 0.         //
+//     double nu2                                                             //
+//        The number of degrees of freedom of the denominator, nu2 > 0.       //
+//                                                                            //
+//  Return Values:                                                            //
+//     A random number with an F-distribution with nu1 and nu2 degrees of     //
+//     freedom.                                                               //
+//                                                                            //
+//  Example:                                                                  //
+//     double x;                                                              //
+//     double nu1, nu2;                                                       //
+//                                                                            //
+//     x = F_Random_Variate( nu1, nu2 );                                      //
+////////////////////////////////////////////////////////////////////////////////
+
+double F_Random_Variate( double nu1, double nu2 )
+{
+   return F_Random_Variate_r( Uniform_0_1_Default_State(), nu1, nu2 );
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// double F_Random_Variate_r( Random_State *state, double nu1, double nu2 )   //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns a random variate as for F_Random_Variate(),      //
+//     drawing from state.  The constants of the method are computed by       //
+//     F_Sampler_Init() on each call; callers who generate many variates with //
+//     the same parameters should prepare a F_Sampler once and call           //
+//     F_Sampler_Variate_r().                                                 //
+//                                                                            //
+//  Arguments:                                                                //
+//     Random_State *state                                                    //
+//        The generator state from which the variates are drawn.              //
+//     double nu1                                                             //
+//        As for F_Random_Variate().                                          //
+//     double nu2                                                             //
+//        As for F_Random_Variate().                                          //
+//                                                                            //
+//  Return Values:                                                            //
+//     A random number with an F-distribution with nu1 and nu2 degrees of     //
+//     freedom.                                                               //
+//                                                                            //
+//  Example:                                                                  //
+//     double x;                                                              //
+//     Random_State state;                                                    //
+//     double nu1, nu2;                                                       //
+//                                                                            //
+//     Random_State_Init( &state, 12345 );                                    //
+//     x = F_Random_Variate_r( &state, nu1, nu2 );                            //
+////////////////////////////////////////////////////////////////////////////////
+
+double F_Random_Variate_r( Random_State *state, double nu1, double nu2 )
+{
+   F_Sampler sampler;
+
+   F_Sampler_Init(&sampler, nu1, nu2);
+   return F_Sampler_Variate_r(state, &sampler);
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// void F_Random_Variate_Array( Random_State *state, double x[], int n,       //
+//                              double nu1, double nu2 )                      //
+//                                                                            //
+//  Description:                                                              //
+//     This function fills the array x[] with n random variates as for        //
+//     F_Random_Variate().  The constants of the method are computed once for //
+//     the whole array, which is then filled by F_Sampler_Variate_Array()     //
+//     from blocks of Gaussian and uniform variates.                          //
+//                                                                            //
+//  Arguments:                                                                //
+//     Random_State *state                                                    //
+//        The generator state from which the variates are drawn.              //
+//     double x[]                                                             //
+//        The array of at least n elements which is set to the variates.      //
+//     int n                                                                  //
+//        The number of variates to generate.                                 //
+//     double nu1                                                             //
+//        As for F_Random_Variate().                                          //
+//     double nu2                                                             //
+//        As for F_Random_Variate().                                          //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     #define N 1000                                                         //
+//     Random_State state;                                                    //
+//     double x[N];                                                           //
+//                                                                            //
+//     Random_State_Init( &state, 12345 );                                    //
+//     F_Random_Variate_Array( &state, x, N, 5.0, 12.0 );                     //
+////////////////////////////////////////////////////////////////////////////////
+
+void F_Random_Variate_Array( Random_State *state, double x[], int n,
+                                                       double nu1, double nu2 )
+{
+   F_Sampler sampler;
+
+   F_Sampler_Init(&sampler, nu1, nu2);
+   F_Sampler_Variate_Array(state, x, n, &sampler);
+}
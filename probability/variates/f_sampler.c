@@ -0,0 +1,181 @@
+////////////////////////////////////////////////////////////////////////////////
+// File: f_sampler.c                                                          //
+// Routine(s):                                                                //
+//    F_Sampler_Init                                                          //
+//    F_Sampler_Variate                                                       //
+//    F_Sampler_Variate_r                                                     //
+//    F_Sampler_Variate_Array                                                 //
+////////////////////////////////////////////////////////////////////////////////
+
+#include "random_state.h"
+#include "f_sampler.h"
+
+//                    Required Externally Defined Routines                    //
+
+extern Random_State* Uniform_0_1_Default_State( void );
+extern void Gamma_Sampler_Init( Gamma_Sampler *sampler, double shape );
+extern double Gamma_Sampler_Variate_r( Random_State *state,
+                                                const Gamma_Sampler *sampler );
+extern void Gamma_Sampler_Variate_Array( Random_State *state, double x[],
+                                         int n, const Gamma_Sampler *sampler );
+
+//                    Required Internally Defined Routines                    //
+
+double F_Sampler_Variate_r( Random_State *state, const F_Sampler *sampler );
+
+#define BLOCK 256
+
+////////////////////////////////////////////////////////////////////////////////
+// void F_Sampler_Init( F_Sampler *sampler, double nu1, double nu2 )          //
+//                                                                            //
+//  Description:                                                              //
+//     This function prepares sampler to generate variates with the           //
+//     F-distribution with nu1 and nu2 degrees of freedom by preparing the    //
+//     Gamma_Samplers for shapes nu1 / 2 and nu2 / 2.  nu1 and nu2 need not   //
+//     be integers.                                                           //
+//                                                                            //
+//  Arguments:                                                                //
+//     F_Sampler *sampler                                                     //
+//        The sampler to prepare.                                             //
+//     double nu1                                                             //
+//        The number of degrees of freedom of the numerator, nu1 > 0.         //
+//     double nu2                                                             //
+//        The number of degrees of freedom of the denominator, nu2 > 0.       //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     F_Sampler sampler;                                                     //
+//     double nu1, nu2;                                                       //
+//                                                                            //
+//     F_Sampler_Init( &sampler, nu1, nu2 );                                  //
+////////////////////////////////////////////////////////////////////////////////
+
+void F_Sampler_Init( F_Sampler *sampler, double nu1, double nu2 )
+{
+   sampler->nu1 = nu1;
+   sampler->nu2 = nu2;
+   sampler->ratio = nu2 / nu1;
+   Gamma_Sampler_Init(&sampler->numerator, 0.5 * nu1);
+   Gamma_Sampler_Init(&sampler->denominator, 0.5 * nu2);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// double F_Sampler_Variate( const F_Sampler *sampler )                       //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns a random variate with the F-distribution with    //
+//     the numbers of degrees of freedom given to F_Sampler_Init().  The      //
+//     variates are drawn from the library's default generator state.         //
+//                                                                            //
+//  Arguments:                                                                //
+//     const F_Sampler *sampler                                               //
+//        A sampler prepared by F_Sampler_Init().                             //
+//                                                                            //
+//  Return Values:                                                            //
+//     A random number with an F-distribution with the numbers of degrees of  //
+//     freedom of sampler.                                                    //
+//                                                                            //
+//  Example:                                                                  //
+//     F_Sampler sampler;                                                     //
+//     double x;                                                              //
+//                                                                            //
+//     x = F_Sampler_Variate( &sampler );                                     //
+////////////////////////////////////////////////////////////////////////////////
+
+double F_Sampler_Variate( const F_Sampler *sampler )
+{
+   return F_Sampler_Variate_r( Uniform_0_1_Default_State(), sampler );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// double F_Sampler_Variate_r( Random_State *state,                           //
+//                             const F_Sampler *sampler )                     //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns a random variate with the F-distribution with    //
+//     the numbers of degrees of freedom nu1 and nu2 given to                 //
+//     F_Sampler_Init(), (nu2 / nu1) G1 / G2 where G1 and G2 are independent  //
+//     Gamma(nu1/2) and Gamma(nu2/2) variates generated by                    //
+//     Gamma_Sampler_Variate_r().  This is the ratio of two independent chi-  //
+//     square variates each divided by its number of degrees of freedom, the  //
+//     factors of 2 cancelling.                                               //
+//                                                                            //
+//  Arguments:                                                                //
+//     Random_State *state                                                    //
+//        The generator state from which the variates are drawn.              //
+//     const F_Sampler *sampler                                               //
+//        A sampler prepared by F_Sampler_Init().                             //
+//                                                                            //
+//  Return Values:                                                            //
+//     A random number with an F-distribution with the numbers of degrees of  //
+//     freedom of sampler.                                                    //
+//                                                                            //
+//  Example:                                                                  //
+//     F_Sampler sampler;                                                     //
+//     Random_State state;                                                    //
+//     double x;                                                              //
+//                                                                            //
+//     Random_State_Init( &state, 12345 );                                    //
+//     x = F_Sampler_Variate_r( &state, &sampler );                           //
+////////////////////////////////////////////////////////////////////////////////
+
+double F_Sampler_Variate_r( Random_State *state, const F_Sampler *sampler )
+{
+   double g1 = Gamma_Sampler_Variate_r(state, &sampler->numerator);
+   double g2 = Gamma_Sampler_Variate_r(state, &sampler->denominator);
+
+   return sampler->ratio * g1 / g2;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// void F_Sampler_Variate_Array( Random_State *state, double x[], int n,      //
+//                               const F_Sampler *sampler )                   //
+//                                                                            //
+//  Description:                                                              //
+//     This function fills the array x[] with n random variates with the      //
+//     F-distribution with the numbers of degrees of freedom given to         //
+//     F_Sampler_Init().  The array is first filled with the Gamma(nu1/2)     //
+//     numerators by Gamma_Sampler_Variate_Array(), and the Gamma(nu2/2)      //
+//     denominators are then generated a block at a time in the same way.     //
+//                                                                            //
+//  Arguments:                                                                //
+//     Random_State *state                                                    //
+//        The generator state from which the variates are drawn.              //
+//     double x[]                                                             //
+//        The array of at least n elements which is set to the variates.      //
+//     int n                                                                  //
+//        The number of variates to generate.                                 //
+//     const F_Sampler *sampler                                               //
+//        A sampler prepared by F_Sampler_Init().                             //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     #define N 1000                                                         //
+//     F_Sampler sampler;                                                     //
+//     Random_State state;                                                    //
+//     double x[N];                                                           //
+//                                                                            //
+//     Random_State_Init( &state, 12345 );                                    //
+//     F_Sampler_Init( &sampler, 5.0, 12.0 );                                 //
+//     F_Sampler_Variate_Array( &state, x, N, &sampler );                     //
+////////////////////////////////////////////////////////////////////////////////
+
+void F_Sampler_Variate_Array( Random_State *state, double x[], int n,
+                                                     const F_Sampler *sampler )
+{
+   double denominator[BLOCK];
+   int i, j, m;
+
+   Gamma_Sampler_Variate_Array(state, x, n, &sampler->numerator);
+   for (j = 0; j < n; j += m) {
+      m = (n - j < BLOCK) ? n - j : BLOCK;
+      Gamma_Sampler_Variate_Array(state, denominator, m,
+                                                       &sampler->denominator);
+      for (i = 0; i < m; i++)
+         x[j + i] = sampler->ratio * x[j + i] / denominator[i];
+   }
+}
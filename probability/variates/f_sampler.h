@@ -0,0 +1,28 @@
+////////////////////////////////////////////////////////////////////////////////
+// File: f_sampler.h                                                          //
+// Type(s):                                                                   //
+//    F_Sampler                                                               //
+////////////////////////////////////////////////////////////////////////////////
+#ifndef F_SAMPLER_H
+#define F_SAMPLER_H
+
+#include "gamma_sampler.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// F_Sampler                                                                  //
+//                                                                            //
+//  Description:                                                              //
+//     The numbers of degrees of freedom nu1 and nu2 of an F-distribution     //
+//     together with the Gamma_Samplers for shapes nu1 / 2 and nu2 / 2,       //
+//     prepared once by F_Sampler_Init().  An F variate is ratio G1 / G2,     //
+//     where G1 and G2 are independent Gamma(nu1/2) and Gamma(nu2/2) variates //
+//     and ratio = nu2 / nu1.                                                 //
+////////////////////////////////////////////////////////////////////////////////
+
+typedef struct {
+   double nu1, nu2;
+   double ratio;
+   Gamma_Sampler numerator, denominator;
+} F_Sampler;
+
+#endif
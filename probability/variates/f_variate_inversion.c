@@ -0,0 +1,129 @@
+////////////////////////////////////////////////////////////////////////////////
+// File: f_variate_inversion.c                                                //
+// Routine(s):                                                                //
+//    F_Variate_Inversion                                                     //
+//    F_Variate_Inversion_r                                                   //
+//    F_Variate_Inversion_Array                                               //
+////////////////////////////////////////////////////////////////////////////////
+
+#include "random_state.h"
+
+//                    Required Externally Defined Routines                    //
+
+extern Random_State* Uniform_0_1_Default_State( void );
+extern double Uniform_0_1_Random_Variate_r( Random_State *state );
+extern double F_Quantile(double p, int v1, int v2);
+
+//                    Required Internally Defined Routines                    //
+
+double F_Variate_Inversion_r( Random_State *state, int v1, int v2 );
+
+////////////////////////////////////////////////////////////////////////////////
+// double F_Variate_Inversion( int v1, int v2 )                               //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns a random variate with an F-distribution with v1  //
+//     and v2 degrees of freedom using the inversion method, i.e.             //
+//     x = F_Quantile(u, v1, v2) where u is a uniform(0,1) random variate.    //
+//                                                                            //
+//  Arguments:                                                                //
+//     int v1                                                                 //
+//        The numerator degrees of freedom, v1 >= 1.                          //
+//     int v2                                                                 //
+//        The denominator degrees of freedom, v2 >= 1.                        //
+//                                                                            //
+//  Return Values:                                                            //
+//     A random number with an F-distribution with v1 and v2 degrees of       //
+//     freedom.  The value returned is in the interval [0, DBL_MAX].          //
+//                                                                            //
+//  Example:                                                                  //
+//     double x;                                                              //
+//     int v1;                                                                //
+//     int v2;                                                                //
+//                                                                            //
+//     x = F_Variate_Inversion(v1, v2);                                       //
+////////////////////////////////////////////////////////////////////////////////
+
+double F_Variate_Inversion( int v1, int v2 )
+{
+   return F_Variate_Inversion_r( Uniform_0_1_Default_State(), v1, v2 );
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// double F_Variate_Inversion_r( Random_State *state, int v1, int v2 )        //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns F_Quantile(u, v1, v2) where the uniform variate  //
+//     u is drawn from state.                                                 //
+//                                                                            //
+//  Arguments:                                                                //
+//     Random_State *state                                                    //
+//        The generator state from which the uniform variate is drawn.        //
+//     int v1                                                                 //
+//        As for F_Variate_Inversion().                                       //
+//     int v2                                                                 //
+//        As for F_Variate_Inversion().                                       //
+//                                                                            //
+//  Return Values:                                                            //
+//     As for F_Variate_Inversion().                                          //
+//                                                                            //
+//  Example:                                                                  //
+//     Random_State state;                                                    //
+//     double x;                                                              //
+//     int v1;                                                                //
+//     int v2;                                                                //
+//                                                                            //
+//     Random_State_Init( &state, 12345 );                                    //
+//     x = F_Variate_Inversion_r( &state, v1, v2 );                           //
+////////////////////////////////////////////////////////////////////////////////
+
+double F_Variate_Inversion_r( Random_State *state, int v1, int v2 )
+{
+   return F_Quantile( Uniform_0_1_Random_Variate_r(state), v1, v2 );
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// void F_Variate_Inversion_Array( double u[], double x[], int n, int v1,     //
+//                                                                   int v2 ) //
+//                                                                            //
+//  Description:                                                              //
+//     This function sets x[i] to F_Quantile(u[i], v1, v2) for i = 0,...,n-1  //
+//     where the uniform variates u[] are supplied by the caller, one per     //
+//     variate.                                                               //
+//                                                                            //
+//  Arguments:                                                                //
+//     double u[]                                                             //
+//        The array of n uniform variates, 0 <= u[i] <= 1.                    //
+//     double x[]                                                             //
+//        The array of at least n elements which is set to the variates,      //
+//        x[i] = F_Quantile(u[i], v1, v2).  x may be the same array as u.     //
+//     int n                                                                  //
+//        The number of variates.                                             //
+//     int v1                                                                 //
+//        As for F_Variate_Inversion().                                       //
+//     int v2                                                                 //
+//        As for F_Variate_Inversion().                                       //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     #define N 1000                                                         //
+//     Random_State state;                                                    //
+//     double u[N], x[N];                                                     //
+//     int v1;                                                                //
+//     int v2;                                                                //
+//                                                                            //
+//     Random_State_Init( &state, 12345 );                                    //
+//     Uniform_0_1_Random_Variate_Array( &state, u, N );                      //
+//     F_Variate_Inversion_Array( u, x, N, v1, v2 );                          //
+////////////////////////////////////////////////////////////////////////////////
+
+void F_Variate_Inversion_Array( double u[], double x[], int n, int v1, int v2 )
+{
+   int i;
+
+   for (i = 0; i < n; i++) x[i] = F_Quantile(u[i], v1, v2);
+}
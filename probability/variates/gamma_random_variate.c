@@ -2,37 +2,44 @@
 // File: gamma_random_variate.c                                               //
 // Routine(s):                                                                //
 //    Gamma_Random_Variate                                                    //
+//    Gamma_Random_Variate_r                                                  //
+//    Gamma_Random_Variate_Array                                              //
 ////////////////////////////////////////////////////////////////////////////////
 
-#include <math.h>                    // required for sqrt(), log(), and pow()
+#include "random_state.h"
+#include "gamma_sampler.h"
 
 //                    Required Externally Defined Routines                    //
 
-extern double Uniform_0_1_Random_Variate( void );
-extern double Exponential_Random_Variate( void );
+extern Random_State* Uniform_0_1_Default_State( void );
+extern void Gamma_Sampler_Init( Gamma_Sampler *sampler, double shape );
+extern double Gamma_Sampler_Variate_r( Random_State *state,
+                                                const Gamma_Sampler *sampler );
+extern void Gamma_Sampler_Variate_Array( Random_State *state, double x[],
+                                         int n, const Gamma_Sampler *sampler );
 
 //                    Required Internally Defined Routines                    //
 
-static double Gamma_Variate_Small_Shape_Parameter( double shape );
+double Gamma_Random_Variate_r( Random_State *state, double shape );
 
 ////////////////////////////////////////////////////////////////////////////////
 // double Gamma_Random_Variate( double shape )                                //
 //                                                                            //
 //  Description:                                                              //
 //     This function returns a Gamma distributed random variate with shape    //
-//     parameter "shape" using Best's rejection method from a t-distribution  //
-//     with 2 degrees of freedom.                                             //
+//     parameter "shape" using the squeeze method of Marsaglia and Tsang, a   //
+//     rejection method from a transformed Gaussian variate which accepts     //
+//     more than 95% of the candidates, see Gamma_Sampler_Variate_r().        //
 //                                                                            //
-//     Best's algorithm requires that the shape parameter be strictly         //
-//     greater than 1.  If the shape parameter equals one, the Gamma          //
-//     distribution becomes the exponential distribution.  If the shape       //
-//     parameter is positive and strictly less than 1, then Stuart's theorem  //
-//     can be used (see Gamma_Variate_Small_Shape_Parameter ).                //
+//     The method requires that the shape parameter be at least 1.  If the    //
+//     shape parameter is positive and strictly less than 1, then Stuart's    //
+//     theorem is used:  If X has a Gamma(a+1) distribution and U has a       //
+//     uniform(0,1) distribution, then X U^(1/a) has a Gamma(a) distribution. //
 //                                                                            //
 //  Arguments:                                                                //
 //     double shape                                                           //
 //            The shape parameter of the gamma distribution i.e. the          //
-//            parameter a where the gamma distribution is given as"           //
+//            parameter a where the gamma distribution is given as            //
 //                       (1/gamma(a)) x^(a-1) e^(-x)                          //
 //            The shape parameter must be positive.                           //
 //                                                                            //
@@ -51,64 +58,89 @@ static double Gamma_Variate_Small_Shape_Parameter( double shape );
         
 double Gamma_Random_Variate( double shape )
 {
-   double u, v;                 // uniform(0,1) variates
-   double w;                    // auxiliary variable
-   double x;                    // Gamma(shape) variate
-   double y;                    // x - (shape - 1)
-   double z;                    
-   double a = shape - 1;
-   
-   if (shape < 1.0) return Gamma_Variate_Small_Shape_Parameter(shape);
-   if (shape == 1.0) return Exponential_Random_Variate(); 
-   for ( ; ;) {
-      u = Uniform_0_1_Random_Variate();
-      v = Uniform_0_1_Random_Variate();
-      w = u * (1.0 - u);
-      y = sqrt( 3.0 * (shape - 0.25) / w) * (u - 0.5);
-      x = y + a;
-      if ( v == 0.0 ) return x;
-      w *= 4.0;
-      v *= w;
-      z = w * v * v;
-      if (log(z) <= 2.0 * (a * log(x/a) - y) ) return x;
-   }
+   return Gamma_Random_Variate_r( Uniform_0_1_Default_State(), shape );
 }
 
 
 ////////////////////////////////////////////////////////////////////////////////
-// static double Gamma_Variate_Small_Shape_Parameter( double shape )          //
+// double Gamma_Random_Variate_r( Random_State *state, double shape )         //
 //                                                                            //
 //  Description:                                                              //
 //     This function returns a Gamma distributed random variate with shape    //
-//     parameter "shape" using Stuart's theorem:  If X has a Gamma(a+1)       //
-//     distribution and U has a uniform(0,1) distribution, then X(U^(1/a))    //
-//     has a Gamma(a) distribution.                                           //
+//     parameter "shape" using the method of Marsaglia and Tsang, or Stuart's //
+//     theorem for shape < 1, with every Gaussian and uniform variate drawn   //
+//     from state.  The constants of the method are computed for this call    //
+//     only; use a Gamma_Sampler to generate many variates with the same      //
+//     shape.                                                                 //
 //                                                                            //
 //  Arguments:                                                                //
+//     Random_State *state                                                    //
+//        The generator state from which the variates are drawn.              //
 //     double shape                                                           //
-//            The shape parameter of the gamma distribution i.e. the          //
-//            parameter "a" where the gamma distribution is given as          //
-//                       (1/gamma(a)) x^(a-1) e^(-x)                          //
-//            The shape parameter must be positive.                           //
+//        As for Gamma_Random_Variate().                                      //
 //                                                                            //
 //  Return Values:                                                            //
-//     A random number distributed as a Gamma distribution with shape         //
-//     parameter "shape".                                                     //
+//     As for Gamma_Random_Variate().                                         //
 //                                                                            //
 //  Example:                                                                  //
+//     Random_State state;                                                    //
 //     double x;                                                              //
 //     double a;                                                              //
 //                                                                            //
+//     Random_State_Init( &state, 12345 );                                    //
+//     x = Gamma_Random_Variate_r( &state, a );                               //
+////////////////////////////////////////////////////////////////////////////////
+
+double Gamma_Random_Variate_r( Random_State *state, double shape )
+{
+   Gamma_Sampler sampler;
+
+   Gamma_Sampler_Init(&sampler, shape);
+   return Gamma_Sampler_Variate_r(state, &sampler);
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// void Gamma_Random_Variate_Array( Random_State *state, double x[], int n,   //
+//                                                             double shape ) //
+//                                                                            //
+//  Description:                                                              //
+//     This function fills the array x[] with n Gamma distributed random      //
+//     variates with shape parameter "shape".  The constants of the method of //
+//     Marsaglia and Tsang are computed once for the whole array, which is    //
+//     then filled by Gamma_Sampler_Variate_Array() from blocks of Gaussian   //
+//     and uniform variates.                                                  //
+//                                                                            //
+//  Arguments:                                                                //
+//     Random_State *state                                                    //
+//            The generator state from which the uniform variates are drawn.  //
+//     double x[]                                                             //
+//            The array of at least n elements which is set to the variates.  //
+//     int    n                                                               //
+//            The number of variates to generate.                             //
+//     double shape                                                           //
+//            The shape parameter of the gamma distribution, shape > 0.       //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     #define N 1000                                                         //
+//     Random_State state;                                                    //
+//     double x[N];                                                           //
+//     double a;                                                              //
+//                                                                            //
 //                    (* Set the shape parameter a > 0 *)                     //
 //                                                                            //
-//     x = Gamma_Variate_Small_Shape_Parameter( a );                          //
+//     Random_State_Init( &state, 12345 );                                    //
+//     Gamma_Random_Variate_Array( &state, x, N, a );                         //
 ////////////////////////////////////////////////////////////////////////////////
-        
-static double Gamma_Variate_Small_Shape_Parameter( double shape )
+
+void Gamma_Random_Variate_Array( Random_State *state, double x[], int n,
+                                                                 double shape )
 {
-   double u;
-   
-   if (shape >= 1.0) return Gamma_Random_Variate(shape);
-   u = Uniform_0_1_Random_Variate();
-   return (u == 0.0) ? 0.0 : Gamma_Random_Variate(shape+1.0)*pow(u, 1.0/shape);
+   Gamma_Sampler sampler;
+
+   Gamma_Sampler_Init(&sampler, shape);
+   Gamma_Sampler_Variate_Array(state, x, n, &sampler);
 }
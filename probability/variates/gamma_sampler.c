@@ -0,0 +1,253 @@
+////////////////////////////////////////////////////////////////////////////////
+// File: gamma_sampler.c                                                      //
+// Routine(s):                                                                //
+//    Gamma_Sampler_Init                                                      //
+//    Gamma_Sampler_Variate                                                   //
+//    Gamma_Sampler_Variate_r                                                 //
+//    Gamma_Sampler_Variate_Array                                             //
+////////////////////////////////////////////////////////////////////////////////
+
+#include <math.h>                    // required for log(), pow(), sqrt()
+
+#include "random_state.h"
+#include "gamma_sampler.h"
+
+//                    Required Externally Defined Routines                    //
+
+extern Random_State* Uniform_0_1_Default_State( void );
+extern double Uniform_0_1_Random_Variate_r( Random_State *state );
+extern void Uniform_0_1_Random_Variate_Array( Random_State *state, double u[],
+                                                                       int n );
+extern double Exponential_Random_Variate_r( Random_State *state );
+extern double Gaussian_Variate_Marsaglias_Ziggurat_r( Random_State *state );
+extern void Gaussian_Variate_Marsaglias_Ziggurat_Array( Random_State *state,
+                                                           double x[], int n );
+
+//                    Required Internally Defined Routines                    //
+
+double Gamma_Sampler_Variate_r( Random_State *state,
+                                                const Gamma_Sampler *sampler );
+
+#define BLOCK 256
+
+////////////////////////////////////////////////////////////////////////////////
+// void Gamma_Sampler_Init( Gamma_Sampler *sampler, double shape )            //
+//                                                                            //
+//  Description:                                                              //
+//     This function prepares sampler to generate Gamma distributed variates  //
+//     with shape parameter "shape", i.e. with density x^(shape-1) exp(-x) /  //
+//     Gamma(shape), by computing the constants d and c of the method of      //
+//     Marsaglia and Tsang.                                                   //
+//                                                                            //
+//  Arguments:                                                                //
+//     Gamma_Sampler *sampler                                                 //
+//        The sampler to prepare.                                             //
+//     double shape                                                           //
+//        The shape parameter of the gamma distribution, shape > 0.           //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     Gamma_Sampler sampler;                                                 //
+//     double a;                                                              //
+//                                                                            //
+//     Gamma_Sampler_Init( &sampler, a );                                     //
+////////////////////////////////////////////////////////////////////////////////
+
+void Gamma_Sampler_Init( Gamma_Sampler *sampler, double shape )
+{
+   double a = shape;
+
+   sampler->shape = shape;
+   sampler->small = ( shape < 1.0 );
+   if ( sampler->small ) {
+      a = shape + 1.0;
+      sampler->inverse_shape = 1.0 / shape;
+   }
+   else sampler->inverse_shape = 0.0;
+   sampler->d = a - 1.0 / 3.0;
+   sampler->c = 1.0 / sqrt(9.0 * sampler->d);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// double Gamma_Sampler_Variate( const Gamma_Sampler *sampler )               //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns a Gamma distributed random variate with the      //
+//     shape parameter given to Gamma_Sampler_Init(), drawing from the        //
+//     library's default generator state.                                     //
+//                                                                            //
+//  Arguments:                                                                //
+//     const Gamma_Sampler *sampler                                           //
+//        A sampler prepared by Gamma_Sampler_Init().                         //
+//                                                                            //
+//  Return Values:                                                            //
+//     A random number distributed as a Gamma distribution with the shape     //
+//     parameter of sampler.                                                  //
+//                                                                            //
+//  Example:                                                                  //
+//     Gamma_Sampler sampler;                                                 //
+//     double x;                                                              //
+//                                                                            //
+//     x = Gamma_Sampler_Variate( &sampler );                                 //
+////////////////////////////////////////////////////////////////////////////////
+
+double Gamma_Sampler_Variate( const Gamma_Sampler *sampler )
+{
+   return Gamma_Sampler_Variate_r( Uniform_0_1_Default_State(), sampler );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// double Gamma_Sampler_Variate_r( Random_State *state,                       //
+//                                 const Gamma_Sampler *sampler )             //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns a Gamma distributed random variate with the      //
+//     shape parameter given to Gamma_Sampler_Init() using the squeeze method //
+//     of Marsaglia and Tsang.  For shape a >= 1, let z be a standard         //
+//     Gaussian variate, generated by the ziggurat method, and v = (1 + c     //
+//     z)^3; if v > 0 and a uniform variate u satisfies either the squeeze u  //
+//     < 1 - 0.0331 z^4 or ln(u) < z^2/2 + d (1 - v + ln(v)), then d v is a   //
+//     Gamma(a) variate, otherwise the pair is rejected.  The squeeze accepts //
+//     about 98% of the pairs without a logarithm and the overall acceptance  //
+//     rate exceeds 95% for all a >= 1.  For shape < 1 a Gamma(shape + 1)     //
+//     variate is multiplied by u^(1/shape), u uniform on (0,1).  For shape = //
+//     1 the Gamma distribution is the exponential distribution and           //
+//     Exponential_Random_Variate_r() is used instead.                        //
+//                                                                            //
+//  Arguments:                                                                //
+//     Random_State *state                                                    //
+//        The generator state from which the Gaussian and uniform variates    //
+//        are drawn.                                                          //
+//     const Gamma_Sampler *sampler                                           //
+//        A sampler prepared by Gamma_Sampler_Init().                         //
+//                                                                            //
+//  Return Values:                                                            //
+//     A random number distributed as a Gamma distribution with the shape     //
+//     parameter of sampler.                                                  //
+//                                                                            //
+//  Example:                                                                  //
+//     Gamma_Sampler sampler;                                                 //
+//     Random_State state;                                                    //
+//     double x;                                                              //
+//                                                                            //
+//     Random_State_Init( &state, 12345 );                                    //
+//     x = Gamma_Sampler_Variate_r( &state, &sampler );                       //
+////////////////////////////////////////////////////////////////////////////////
+
+double Gamma_Sampler_Variate_r( Random_State *state,
+                                                 const Gamma_Sampler *sampler )
+{
+   double d = sampler->d;
+   double c = sampler->c;
+   double z, v, u, x;
+
+   if ( sampler->shape == 1.0 ) return Exponential_Random_Variate_r(state);
+   for (;;) {
+      z = Gaussian_Variate_Marsaglias_Ziggurat_r(state);
+      v = 1.0 + c * z;
+      if ( v <= 0.0 ) continue;
+      v = v * v * v;
+      u = Uniform_0_1_Random_Variate_r(state);
+      z *= z;
+      if ( u < 1.0 - 0.0331 * z * z ) break;
+      if ( log(u) < 0.5 * z + d * (1.0 - v + log(v)) ) break;
+   }
+   x = d * v;
+   if ( !sampler->small ) return x;
+   u = Uniform_0_1_Random_Variate_r(state);
+   return ( u == 0.0 ) ? 0.0 : x * pow(u, sampler->inverse_shape);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// void Gamma_Sampler_Variate_Array( Random_State *state, double x[], int n,  //
+//                                   const Gamma_Sampler *sampler )           //
+//                                                                            //
+//  Description:                                                              //
+//     This function fills the array x[] with n Gamma distributed random      //
+//     variates with the shape parameter given to Gamma_Sampler_Init() by the //
+//     method of Gamma_Sampler_Variate_r().  The Gaussian and uniform         //
+//     variates are generated in blocks by                                    //
+//     Gaussian_Variate_Marsaglias_Ziggurat_Array() and                       //
+//     Uniform_0_1_Random_Variate_Array(), a rejected pair simply moving on   //
+//     to the next in the block.  For shape < 1 the array is first filled     //
+//     with Gamma(shape + 1) variates which are then scaled by u^(1/shape) a  //
+//     block at a time, and for shape = 1 each element is an exponential      //
+//     variate.  The variates therefore have the same distribution as, but    //
+//     are not the same as, those of n successive calls to                    //
+//     Gamma_Sampler_Variate_r().                                             //
+//                                                                            //
+//  Arguments:                                                                //
+//     Random_State *state                                                    //
+//        The generator state from which the Gaussian and uniform variates    //
+//        are drawn.                                                          //
+//     double x[]                                                             //
+//        The array of at least n elements which is set to the variates.      //
+//     int n                                                                  //
+//        The number of variates to generate.                                 //
+//     const Gamma_Sampler *sampler                                           //
+//        A sampler prepared by Gamma_Sampler_Init().                         //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     #define N 1000                                                         //
+//     Gamma_Sampler sampler;                                                 //
+//     Random_State state;                                                    //
+//     double x[N];                                                           //
+//     double a;                                                              //
+//                                                                            //
+//     Random_State_Init( &state, 12345 );                                    //
+//     Gamma_Sampler_Init( &sampler, a );                                     //
+//     Gamma_Sampler_Variate_Array( &state, x, N, &sampler );                 //
+////////////////////////////////////////////////////////////////////////////////
+
+void Gamma_Sampler_Variate_Array( Random_State *state, double x[], int n,
+                                                 const Gamma_Sampler *sampler )
+{
+   double gaussian[BLOCK];
+   double uniform[BLOCK];
+   double d = sampler->d;
+   double c = sampler->c;
+   double z, v, u;
+   int i, j, k, m;
+
+   if ( sampler->shape == 1.0 ) {
+      for (i = 0; i < n; i++) x[i] = Exponential_Random_Variate_r(state);
+      return;
+   }
+
+                      // Fill x[] with Gamma(a) variates, a = shape //
+                      // or shape + 1.                              //
+
+   for (i = 0, k = 0, m = 0; i < n; ) {
+      if ( k == m ) {
+         m = (n - i < BLOCK) ? n - i : BLOCK;
+         Gaussian_Variate_Marsaglias_Ziggurat_Array(state, gaussian, m);
+         Uniform_0_1_Random_Variate_Array(state, uniform, m);
+         k = 0;
+      }
+      z = gaussian[k];
+      u = uniform[k++];
+      v = 1.0 + c * z;
+      if ( v <= 0.0 ) continue;
+      v = v * v * v;
+      z *= z;
+      if ( u < 1.0 - 0.0331 * z * z
+                          || log(u) < 0.5 * z + d * (1.0 - v + log(v)) )
+         x[i++] = d * v;
+   }
+   if ( !sampler->small ) return;
+
+                        // For shape < 1, scale by u^(1/shape). //
+
+   for (j = 0; j < n; j += m) {
+      m = (n - j < BLOCK) ? n - j : BLOCK;
+      Uniform_0_1_Random_Variate_Array(state, uniform, m);
+      for (i = 0; i < m; i++)
+         x[j + i] = (uniform[i] == 0.0)
+               ? 0.0 : x[j + i] * pow(uniform[i], sampler->inverse_shape);
+   }
+}
@@ -0,0 +1,31 @@
+////////////////////////////////////////////////////////////////////////////////
+// File: gamma_sampler.h                                                      //
+// Type(s):                                                                   //
+//    Gamma_Sampler                                                           //
+////////////////////////////////////////////////////////////////////////////////
+#ifndef GAMMA_SAMPLER_H
+#define GAMMA_SAMPLER_H
+
+////////////////////////////////////////////////////////////////////////////////
+// Gamma_Sampler                                                              //
+//                                                                            //
+//  Description:                                                              //
+//     The shape parameter of a Gamma distribution together with the          //
+//     constants of the squeeze method of Marsaglia and Tsang, computed once  //
+//     by Gamma_Sampler_Init() so that repeated variates with the same shape  //
+//     do not recompute them.                                                 //
+//                                                                            //
+//     d = a - 1/3 and c = 1 / sqrt(9 d), where a = shape if shape >= 1 and a //
+//     = shape + 1 otherwise.  In the latter case small is nonzero and a      //
+//     Gamma(shape + 1) variate is multiplied by u^inverse_shape, u uniform   //
+//     on (0,1), inverse_shape = 1 / shape.                                   //
+////////////////////////////////////////////////////////////////////////////////
+
+typedef struct {
+   double shape;
+   double d, c;
+   double inverse_shape;
+   int small;
+} Gamma_Sampler;
+
+#endif
@@ -0,0 +1,132 @@
+////////////////////////////////////////////////////////////////////////////////
+// File: gamma_variate_inversion.c                                            //
+// Routine(s):                                                                //
+//    Gamma_Variate_Inversion                                                 //
+//    Gamma_Variate_Inversion_r                                               //
+//    Gamma_Variate_Inversion_Array                                           //
+////////////////////////////////////////////////////////////////////////////////
+
+#include "random_state.h"
+
+//                    Required Externally Defined Routines                    //
+
+extern Random_State* Uniform_0_1_Default_State( void );
+extern double Uniform_0_1_Random_Variate_r( Random_State *state );
+extern double Gamma_Quantile(double p, double nu);
+
+//                    Required Internally Defined Routines                    //
+
+double Gamma_Variate_Inversion_r( Random_State *state, double shape );
+
+////////////////////////////////////////////////////////////////////////////////
+// double Gamma_Variate_Inversion( double shape )                             //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns a Gamma distributed random variate with shape    //
+//     parameter "shape" using the inversion method, i.e.                     //
+//     x = Gamma_Quantile(u, shape) where u is a uniform(0,1) random variate. //
+//                                                                            //
+//     Inversion costs two or three evaluations of the Gamma distribution and //
+//     is therefore slower than the rejection method of                       //
+//     Gamma_Random_Variate(), but it uses exactly one uniform variate per    //
+//     variate and x increases with u, which the rejection method cannot      //
+//     offer.                                                                 //
+//                                                                            //
+//  Arguments:                                                                //
+//     double shape                                                           //
+//        The shape parameter of the gamma distribution, shape > 0.           //
+//                                                                            //
+//  Return Values:                                                            //
+//     A random number distributed as a Gamma distribution with shape         //
+//     parameter "shape".  The value returned is in the interval              //
+//     [0, DBL_MAX].                                                          //
+//                                                                            //
+//  Example:                                                                  //
+//     double x;                                                              //
+//     double shape;                                                          //
+//                                                                            //
+//                    (* Set the shape parameter shape > 0 *)                 //
+//                                                                            //
+//     x = Gamma_Variate_Inversion(shape);                                    //
+////////////////////////////////////////////////////////////////////////////////
+
+double Gamma_Variate_Inversion( double shape )
+{
+   return Gamma_Variate_Inversion_r( Uniform_0_1_Default_State(), shape );
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// double Gamma_Variate_Inversion_r( Random_State *state, double shape )      //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns Gamma_Quantile(u, shape) where the uniform       //
+//     variate u is drawn from state.                                         //
+//                                                                            //
+//  Arguments:                                                                //
+//     Random_State *state                                                    //
+//        The generator state from which the uniform variate is drawn.        //
+//     double shape                                                           //
+//        As for Gamma_Variate_Inversion().                                   //
+//                                                                            //
+//  Return Values:                                                            //
+//     As for Gamma_Variate_Inversion().                                      //
+//                                                                            //
+//  Example:                                                                  //
+//     Random_State state;                                                    //
+//     double x;                                                              //
+//     double shape;                                                          //
+//                                                                            //
+//     Random_State_Init( &state, 12345 );                                    //
+//     x = Gamma_Variate_Inversion_r( &state, shape );                        //
+////////////////////////////////////////////////////////////////////////////////
+
+double Gamma_Variate_Inversion_r( Random_State *state, double shape )
+{
+   return Gamma_Quantile( Uniform_0_1_Random_Variate_r(state), shape );
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// void Gamma_Variate_Inversion_Array( double u[], double x[], int n,         //
+//                                                             double shape ) //
+//                                                                            //
+//  Description:                                                              //
+//     This function sets x[i] to Gamma_Quantile(u[i], shape) for             //
+//     i = 0,...,n-1 where the uniform variates u[] are supplied by the       //
+//     caller.  The uniforms are used in order, one per variate, so that if   //
+//     u[] holds common random numbers, antithetic pairs or quasi-random      //
+//     points, x[] inherits that structure.                                   //
+//                                                                            //
+//  Arguments:                                                                //
+//     double u[]                                                             //
+//        The array of n uniform variates, 0 <= u[i] <= 1.                    //
+//     double x[]                                                             //
+//        The array of at least n elements which is set to the variates,      //
+//        x[i] = Gamma_Quantile(u[i], shape).  x may be the same array as u.  //
+//     int n                                                                  //
+//        The number of variates.                                             //
+//     double shape                                                           //
+//        As for Gamma_Variate_Inversion().                                   //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     #define N 1000                                                         //
+//     Random_State state;                                                    //
+//     double u[N], x[N];                                                     //
+//     double shape;                                                          //
+//                                                                            //
+//     Random_State_Init( &state, 12345 );                                    //
+//     Uniform_0_1_Random_Variate_Array( &state, u, N );                      //
+//     Gamma_Variate_Inversion_Array( u, x, N, shape );                       //
+////////////////////////////////////////////////////////////////////////////////
+
+void Gamma_Variate_Inversion_Array( double u[], double x[], int n,
+                                                                 double shape )
+{
+   int i;
+
+   for (i = 0; i < n; i++) x[i] = Gamma_Quantile(u[i], shape);
+}
@@ -3,9 +3,18 @@
 // Routine(s):                                                                //
 //    Init_Gaussian_Random_Variate                                            //
 //    Gaussian_Random_Variate                                                 //
+//    Init_Gaussian_Random_Variate_r                                          //
+//    Gaussian_Random_Variate_r                                               //
 ////////////////////////////////////////////////////////////////////////////////
 
+#include "random_state.h"
+
+//                    Required Externally Defined Routines                    //
+
+extern double Gaussian_Variate_Marsaglias_Ziggurat_r( Random_State *state );
+
 static double (*rn)(void);
+static double (*rn_r)(Random_State *) = Gaussian_Variate_Marsaglias_Ziggurat_r;
 
 ////////////////////////////////////////////////////////////////////////////////
 // void Init_Gaussian_Random_Variate( double (*r_generator)(void) )           //
@@ -55,3 +64,64 @@ void Init_Gaussian_Random_Variate( double (*r_generator)(void) )
 ////////////////////////////////////////////////////////////////////////////////
         
 double Gaussian_Random_Variate( void ) { return (*rn)(); }
+
+
+////////////////////////////////////////////////////////////////////////////////
+// void Init_Gaussian_Random_Variate_r(                                       //
+//                           double (*r_generator)(Random_State*) )           //
+//                                                                            //
+//  Description:                                                              //
+//     This function saves the pointer to a gaussian random number generator  //
+//     which draws its uniform variates from a caller supplied state.         //
+//     Subsequent calls to Gaussian_Random_Variate_r (below) will call this   //
+//     routine.  The default is Gaussian_Variate_Marsaglias_Ziggurat().  The  //
+//     pointer is shared by all threads, so it should be set before any       //
+//     thread calls Gaussian_Random_Variate_r().                              //
+//                                                                            //
+//  Arguments:                                                                //
+//     double (*r_generator)(Random_State*)                                   //
+//        The user supplied random number generator generating a gaussian     //
+//        distributed random number on [-inf,inf].                            //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     extern double gaussian_rng( Random_State *state );                     //
+//                                                                            //
+//     Init_Gaussian_Random_Variate_r( gaussian_rng );                        //
+////////////////////////////////////////////////////////////////////////////////
+        
+void Init_Gaussian_Random_Variate_r( double (*r_generator)(Random_State*) )
+{
+   rn_r = r_generator;
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// double Gaussian_Random_Variate_r( Random_State *state )                    //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns a Gaussian distributed random variate on         //
+//     [-DBL_MAX, DBL_MAX] drawn from the generator state "state" by the      //
+//     routine set with Init_Gaussian_Random_Variate_r().                     //
+//                                                                            //
+//  Arguments:                                                                //
+//     Random_State *state                                                    //
+//        The generator state.                                                //
+//                                                                            //
+//  Return Values:                                                            //
+//     A random number with a gaussian distribution.                          //
+//                                                                            //
+//  Example:                                                                  //
+//     Random_State state;                                                    //
+//     double x;                                                              //
+//                                                                            //
+//     Random_State_Init( &state, 12345 );                                    //
+//     x = Gaussian_Random_Variate_r( &state );                               //
+////////////////////////////////////////////////////////////////////////////////
+        
+double Gaussian_Random_Variate_r( Random_State *state )
+{
+   return (*rn_r)(state);
+}
@@ -0,0 +1,120 @@
+////////////////////////////////////////////////////////////////////////////////
+// File: gaussian_variate_inversion.c                                         //
+// Routine(s):                                                                //
+//    Gaussian_Variate_Inversion                                              //
+//    Gaussian_Variate_Inversion_r                                            //
+//    Gaussian_Variate_Inversion_Array                                        //
+////////////////////////////////////////////////////////////////////////////////
+
+#include "random_state.h"
+
+//                    Required Externally Defined Routines                    //
+
+extern Random_State* Uniform_0_1_Default_State( void );
+extern double Uniform_0_1_Random_Variate_r( Random_State *state );
+extern double Gaussian_Quantile(double p);
+
+//                    Required Internally Defined Routines                    //
+
+double Gaussian_Variate_Inversion_r( Random_State *state );
+
+////////////////////////////////////////////////////////////////////////////////
+// double Gaussian_Variate_Inversion( void )                                  //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns a standard Normal (Gaussian) random variate      //
+//     using the inversion method, i.e. x = Gaussian_Quantile(u) where u is a //
+//     uniform(0,1) random variate.                                           //
+//                                                                            //
+//     Each variate consumes exactly one uniform variate and x is an          //
+//     increasing function of u.  Unlike the Box-Muller, polar and ziggurat   //
+//     methods there is neither a rejection loop nor a saved second variate,  //
+//     so the stream of variates can be driven by stratified, antithetic or   //
+//     quasi-random uniforms, and two simulations fed the same uniforms see   //
+//     correlated variates.                                                   //
+//                                                                            //
+//  Arguments:                                                                //
+//     None                                                                   //
+//                                                                            //
+//  Return Values:                                                            //
+//     A random number with a standard Normal distribution.  The value        //
+//     returned is in the interval [-DBL_MAX, DBL_MAX].                       //
+//                                                                            //
+//  Example:                                                                  //
+//     double x;                                                              //
+//                                                                            //
+//     x = Gaussian_Variate_Inversion();                                      //
+////////////////////////////////////////////////////////////////////////////////
+
+double Gaussian_Variate_Inversion( void )
+{
+   return Gaussian_Variate_Inversion_r( Uniform_0_1_Default_State() );
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// double Gaussian_Variate_Inversion_r( Random_State *state )                 //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns Gaussian_Quantile(u) where the uniform variate u //
+//     is drawn from state.                                                   //
+//                                                                            //
+//  Arguments:                                                                //
+//     Random_State *state                                                    //
+//        The generator state from which the uniform variate is drawn.        //
+//                                                                            //
+//  Return Values:                                                            //
+//     As for Gaussian_Variate_Inversion().                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     Random_State state;                                                    //
+//     double x;                                                              //
+//                                                                            //
+//     Random_State_Init( &state, 12345 );                                    //
+//     x = Gaussian_Variate_Inversion_r( &state );                            //
+////////////////////////////////////////////////////////////////////////////////
+
+double Gaussian_Variate_Inversion_r( Random_State *state )
+{
+   return Gaussian_Quantile( Uniform_0_1_Random_Variate_r(state) );
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// void Gaussian_Variate_Inversion_Array( double u[], double x[], int n )     //
+//                                                                            //
+//  Description:                                                              //
+//     This function sets x[i] to the standard Normal variate                 //
+//     Gaussian_Quantile(u[i]) for i = 0,...,n-1, where the uniform variates  //
+//     u[] are supplied by the caller.  The uniforms are used in order, one   //
+//     per variate, so that if u[] holds common random numbers, antithetic    //
+//     pairs or quasi-random points, x[] inherits that structure.             //
+//                                                                            //
+//  Arguments:                                                                //
+//     double u[]                                                             //
+//        The array of n uniform variates, 0 <= u[i] <= 1.                    //
+//     double x[]                                                             //
+//        The array of at least n elements which is set to the variates,      //
+//        x[i] = Gaussian_Quantile(u[i]).  x may be the same array as u.      //
+//     int n                                                                  //
+//        The number of variates.                                             //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     #define N 1000                                                         //
+//     Random_State state;                                                    //
+//     double u[N], x[N];                                                     //
+//                                                                            //
+//     Random_State_Init( &state, 12345 );                                    //
+//     Uniform_0_1_Random_Variate_Array( &state, u, N );                      //
+//     Gaussian_Variate_Inversion_Array( u, x, N );                           //
+////////////////////////////////////////////////////////////////////////////////
+
+void Gaussian_Variate_Inversion_Array( double u[], double x[], int n )
+{
+   int i;
+
+   for (i = 0; i < n; i++) x[i] = Gaussian_Quantile(u[i]);
+}
@@ -2,15 +2,44 @@
 // File: gaussian_ziggarut.c                                                  //
 // Routine(s):                                                                //
 //    Gaussian_Variate_Marsaglias_Ziggurat                                    //
+//    Gaussian_Variate_Marsaglias_Ziggurat_r                                  //
+//    Gaussian_Variate_Marsaglias_Ziggurat_Array                              //
 ////////////////////////////////////////////////////////////////////////////////
 
 #include <math.h>                          // required for abs() and exp()
 
+#include "random_state.h"
+
 //                    Required Externally Defined Routines                    //
 
-extern unsigned long  Uniform_32_Bits_Random_Variate( void );
-extern double Uniform_0_1_Random_Variate( void );
-        
+extern Random_State* Uniform_0_1_Default_State( void );
+extern unsigned long  Uniform_32_Bits_Random_Variate_r( Random_State *state );
+extern double Uniform_0_1_Random_Variate_r( Random_State *state );
+extern void Uniform_32_Bits_Random_Variate_Array( Random_State *state,
+                                                    unsigned long u[], int n );
+
+//                    Required Internally Defined Routines                    //
+
+double Gaussian_Variate_Marsaglias_Ziggurat_r( Random_State *state );
+static int Wedge_Or_Tail( Random_State *state, int i, int negative, double *x );
+static void Rectangle_Test( const unsigned long hz[], const unsigned long iz[],
+                               int m, double x[], unsigned char rejected[] );
+
+#if defined(__GNUC__) && defined(__x86_64__) && defined(__LP64__)
+#define ZIGGURAT_SIMD
+#include <immintrin.h>          // required for the AVX2 and AVX-512 intrinsics
+static void Rectangle_Test_AVX2( const unsigned long hz[],
+                                 const unsigned long iz[], int m, double x[],
+                                                     unsigned char rejected[] );
+static void Rectangle_Test_AVX512( const unsigned long hz[],
+                                   const unsigned long iz[], int m, double x[],
+                                                     unsigned char rejected[] );
+#endif
+
+static void (*rectangle_test)( const unsigned long hz[],
+                                const unsigned long iz[], int m, double x[],
+                                  unsigned char rejected[] ) = Rectangle_Test;
+
 ////////////////////////////////////////////////////////////////////////////////
 // double Gaussian_Variate_Marsaglias_Ziggurat( void )                        //
 //                                                                            //
@@ -269,32 +298,303 @@ static const double r = 3.6541528853610087716454;
 static const double rr = (1.0 / 3.6541528853610087716454);
 
 double Gaussian_Variate_Marsaglias_Ziggurat( void )
+{
+   return Gaussian_Variate_Marsaglias_Ziggurat_r( Uniform_0_1_Default_State() );
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// double Gaussian_Variate_Marsaglias_Ziggurat_r( Random_State *state )       //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns a standard Gaussian variate using Marsaglia's    //
+//     ziggurat method with all of the random words and uniform variates      //
+//     drawn from state.                                                      //
+//                                                                            //
+//  Arguments:                                                                //
+//     Random_State *state                                                    //
+//        The generator state from which the uniform variates are drawn.      //
+//                                                                            //
+//  Return Values:                                                            //
+//     As for Gaussian_Variate_Marsaglias_Ziggurat().                         //
+//                                                                            //
+//  Example:                                                                  //
+//     Random_State state;                                                    //
+//     double x;                                                              //
+//                                                                            //
+//     Random_State_Init( &state, 12345 );                                    //
+//     x = Gaussian_Variate_Marsaglias_Ziggurat_r( &state );                  //
+////////////////////////////////////////////////////////////////////////////////
+
+double Gaussian_Variate_Marsaglias_Ziggurat_r( Random_State *state )
 {
    unsigned long hz;
-   union {
-      unsigned long iv;
-      unsigned char ib[4];
-   } istep;
-   char sign;
-   double x, y;
+   unsigned long iz;
+   int i;
+   int negative;
+   double x;
 
    for (;;) {
-      hz = Uniform_32_Bits_Random_Variate();
-      istep.iv = Uniform_32_Bits_Random_Variate();
-      sign = (signed) istep.ib[2];
-      x = hz * wn[istep.ib[3]];
-      if (sign < 0) x = -x;
-      if ( hz < kn[istep.ib[3]] ) return x;
-      if (istep.ib[3] == 0) {
-         do {
-            x = -log( Uniform_0_1_Random_Variate() ) * rr;
-            y = -log( Uniform_0_1_Random_Variate() );
-         }
-         while ( y + y < x * x );
-         return ( sign > 0 ) ? r + x : r - x;
-      }
-      if ( fn[istep.ib[3]] +
-            Uniform_0_1_Random_Variate()*(fn[istep.ib[3]-1] - fn[istep.ib[3]])
-                                               < exp(-0.5 * x * x) ) return x; 
+      hz = Uniform_32_Bits_Random_Variate_r(state);
+      iz = Uniform_32_Bits_Random_Variate_r(state);
+      i = (int) ((iz >> 24) & 0xff);
+      negative = (int) ((iz >> 23) & 1);
+      x = hz * wn[i];
+      if (negative) x = -x;
+      if ( hz < kn[i] ) return x;
+      if ( Wedge_Or_Tail(state, i, negative, &x) ) return x;
    }   
 }
+
+
+////////////////////////////////////////////////////////////////////////////////
+// void Gaussian_Variate_Marsaglias_Ziggurat_Array( Random_State *state,      //
+//                                                      double x[], int n )   //
+//                                                                            //
+//  Description:                                                              //
+//     This function fills the array x[] with n standard Gaussian variates    //
+//     using Marsaglia's ziggurat method.  The random words for a block of    //
+//     variates are generated together, then the rectangle test, which        //
+//     accepts about 99% of the candidates, is applied to the whole block in  //
+//     a loop without calls or data dependent branches.  Only the rejected    //
+//     candidates go on to the wedge and tail tests.  On x86-64 processors    //
+//     with AVX2 or AVX-512 the rectangle test is applied to 4 or 8           //
+//     candidates at a time.  The version is chosen when the library is       //
+//     loaded, so the same binary runs on any processor, and every version    //
+//     produces the same variates.                                            //
+//                                                                            //
+//  Arguments:                                                                //
+//     Random_State *state                                                    //
+//        The generator state from which the random words are drawn.          //
+//     double x[]                                                             //
+//        The array of at least n elements which is set to the variates.      //
+//     int n                                                                  //
+//        The number of variates to generate.                                 //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     #define N 1000                                                         //
+//     Random_State state;                                                    //
+//     double x[N];                                                           //
+//                                                                            //
+//     Random_State_Init( &state, 12345 );                                    //
+//     Gaussian_Variate_Marsaglias_Ziggurat_Array( &state, x, N );            //
+////////////////////////////////////////////////////////////////////////////////
+
+#define BLOCK 256
+
+void Gaussian_Variate_Marsaglias_Ziggurat_Array( Random_State *state,
+                                                            double x[], int n )
+{
+   unsigned long w[2 * BLOCK];
+   unsigned char rejected[BLOCK];
+   unsigned long iz;
+   int i, j, k, m;
+
+   for (j = 0; j < n; j += m) {
+      m = (n - j < BLOCK) ? n - j : BLOCK;
+      Uniform_32_Bits_Random_Variate_Array(state, w, m + m);
+      (*rectangle_test)(w, &w[m], m, &x[j], rejected);
+      for (k = 0; k < m; k++) {
+         if ( !rejected[k] ) continue;
+         iz = w[m + k];
+         i = (int) ((iz >> 24) & 0xff);
+         if ( !Wedge_Or_Tail(state, i, (int) ((iz >> 23) & 1), &x[j + k]) )
+            x[j + k] = Gaussian_Variate_Marsaglias_Ziggurat_r(state);
+      }
+   }
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// static int Wedge_Or_Tail( Random_State *state, int i, int negative,        //
+//                                                       double *x )          //
+//                                                                            //
+//  Description:                                                              //
+//     This function completes the ziggurat test for a candidate x which      //
+//     failed the rectangle test in layer i.  For the base layer, i = 0, a    //
+//     variate from the tail beyond r is generated using Marsaglia's method   //
+//     and is always accepted.  For the other layers the candidate is         //
+//     accepted if a uniformly distributed point in the wedge lies below the  //
+//     density.                                                               //
+//                                                                            //
+//  Arguments:                                                                //
+//     Random_State *state                                                    //
+//            The generator state from which the uniform variates are drawn.  //
+//     int    i                                                               //
+//            The layer of the ziggurat, 0 <= i < 256.                        //
+//     int    negative                                                        //
+//            1 if the candidate is negative, 0 otherwise.                    //
+//     double *x                                                              //
+//            On input the candidate, on output the accepted variate.         //
+//                                                                            //
+//  Return Values:                                                            //
+//     1 if *x is accepted, 0 if the candidate is rejected and a new one      //
+//     must be drawn.                                                         //
+////////////////////////////////////////////////////////////////////////////////
+
+static int Wedge_Or_Tail( Random_State *state, int i, int negative, double *x )
+{
+   double t, y;
+
+   if (i == 0) {
+      do {
+         t = -log( Uniform_0_1_Random_Variate_r(state) ) * rr;
+         y = -log( Uniform_0_1_Random_Variate_r(state) );
+      }
+      while ( y + y < t * t );
+      *x = ( negative ) ? -(r + t) : r + t;
+      return 1;
+   }
+   return ( fn[i] + Uniform_0_1_Random_Variate_r(state) * (fn[i-1] - fn[i])
+                                                      < exp(-0.5 * *x * *x) );
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// static void Rectangle_Test( const unsigned long hz[],                      //
+//                             const unsigned long iz[], int m, double x[],   //
+//                                                  unsigned char rejected[] )//
+//                                                                            //
+//  Description:                                                              //
+//     This function forms the candidates x[k] = +-hz[k] wn[i] for a block of //
+//     m pairs of random words, where the layer i is bits 24-31 of iz[k] and  //
+//     the sign is bit 23 of iz[k], and flags in rejected[k] the candidates   //
+//     which fail the rectangle test hz[k] < kn[i].  Rectangle_Test_AVX2()    //
+//     and Rectangle_Test_AVX512() below produce bit for bit the same output. //
+//                                                                            //
+//  Arguments:                                                                //
+//     const unsigned long hz[]                                               //
+//            The m random words which form the magnitudes of the candidates. //
+//     const unsigned long iz[]                                               //
+//            The m random words which select the layers and signs.           //
+//     int    m                                                               //
+//            The number of candidates.                                       //
+//     double x[]                                                             //
+//            The m candidates.                                               //
+//     unsigned char rejected[]                                               //
+//            rejected[k] is set to 1 if x[k] failed the rectangle test and   //
+//            to 0 if x[k] is accepted.                                       //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+////////////////////////////////////////////////////////////////////////////////
+
+static void Rectangle_Test( const unsigned long hz[], const unsigned long iz[],
+                                int m, double x[], unsigned char rejected[] )
+{
+   double v;
+   int i, k;
+
+   for (k = 0; k < m; k++) {
+      i = (int) ((iz[k] >> 24) & 0xff);
+      v = hz[k] * wn[i];
+      x[k] = ( (iz[k] >> 23) & 1 ) ? -v : v;
+      rejected[k] = ( hz[k] >= kn[i] );
+   }
+}
+
+#ifdef ZIGGURAT_SIMD
+
+// The random words are less than 2^32, so they are converted to doubles by
+// placing them in the mantissa of 2^52 and subtracting 2^52.  The sign bit
+// 23 of iz is moved to bit 63 and xor'ed into the product.
+// The upper halves of the vector registers are cleared before the remainder
+// is passed to Rectangle_Test(), since a tail call skips the vzeroupper which
+// the compiler places in the epilogue and the scalar code which follows would
+// otherwise pay the AVX to SSE transition penalty.
+
+__attribute__((target("avx2")))
+static void Rectangle_Test_AVX2( const unsigned long hz[],
+                                 const unsigned long iz[], int m, double x[],
+                                                      unsigned char rejected[] )
+{
+   const __m256i byte = _mm256_set1_epi64x(0xff);
+   const __m256i sign = _mm256_set1_epi64x(0x800000);
+   const __m256i two52 = _mm256_set1_epi64x(0x4330000000000000LL);
+   const __m256d two52d = _mm256_set1_pd(4503599627370496.0);
+   __m256i h, z, i, k;
+   __m256d v;
+   int accepted;
+   int j = 0;
+
+   for (; j + 4 <= m; j += 4) {
+      h = _mm256_loadu_si256((const __m256i *) &hz[j]);
+      z = _mm256_loadu_si256((const __m256i *) &iz[j]);
+      i = _mm256_and_si256(_mm256_srli_epi64(z, 24), byte);
+      k = _mm256_i64gather_epi64((const long long *) kn, i, 8);
+      v = _mm256_sub_pd(_mm256_castsi256_pd(_mm256_or_si256(h, two52)), two52d);
+      v = _mm256_mul_pd(v, _mm256_i64gather_pd(wn, i, 8));
+      z = _mm256_slli_epi64(_mm256_and_si256(z, sign), 40);
+      _mm256_storeu_pd(&x[j], _mm256_xor_pd(v, _mm256_castsi256_pd(z)));
+      accepted = _mm256_movemask_pd(_mm256_castsi256_pd(
+                                                   _mm256_cmpgt_epi64(k, h)));
+      rejected[j]     = !(accepted & 1);
+      rejected[j + 1] = !(accepted & 2);
+      rejected[j + 2] = !(accepted & 4);
+      rejected[j + 3] = !(accepted & 8);
+   }
+   _mm256_zeroupper();
+   if (j < m) Rectangle_Test(&hz[j], &iz[j], m - j, &x[j], &rejected[j]);
+}
+
+__attribute__((target("avx512f")))
+static void Rectangle_Test_AVX512( const unsigned long hz[],
+                                   const unsigned long iz[], int m, double x[],
+                                                      unsigned char rejected[] )
+{
+   const __m512i byte = _mm512_set1_epi64(0xff);
+   const __m512i sign = _mm512_set1_epi64(0x800000);
+   const __m512i two52 = _mm512_set1_epi64(0x4330000000000000LL);
+   const __m512d two52d = _mm512_set1_pd(4503599627370496.0);
+   __m512i h, z, i, k;
+   __m512d v;
+   __mmask8 accepted;
+   int b;
+   int j = 0;
+
+   for (; j + 8 <= m; j += 8) {
+      h = _mm512_loadu_si512((const void *) &hz[j]);
+      z = _mm512_loadu_si512((const void *) &iz[j]);
+      i = _mm512_and_si512(_mm512_srli_epi64(z, 24), byte);
+      k = _mm512_i64gather_epi64(i, (const void *) kn, 8);
+      v = _mm512_sub_pd(_mm512_castsi512_pd(_mm512_or_si512(h, two52)), two52d);
+      v = _mm512_mul_pd(v, _mm512_i64gather_pd(i, (const void *) wn, 8));
+      z = _mm512_slli_epi64(_mm512_and_si512(z, sign), 40);
+      _mm512_storeu_pd(&x[j], _mm512_castsi512_pd(
+                               _mm512_xor_si512(_mm512_castpd_si512(v), z)));
+      accepted = _mm512_cmplt_epu64_mask(h, k);
+      for (b = 0; b < 8; b++) rejected[j + b] = !((accepted >> b) & 1);
+   }
+   _mm256_zeroupper();
+   if (j < m) Rectangle_Test(&hz[j], &iz[j], m - j, &x[j], &rejected[j]);
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// static void Init_Rectangle_Test( void )                                    //
+//                                                                            //
+//  Description:                                                              //
+//     This function is run when the library is loaded.  It selects the       //
+//     widest version of the rectangle test which the processor supports.     //
+//                                                                            //
+//  Arguments:                                                                //
+//     None                                                                   //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+////////////////////////////////////////////////////////////////////////////////
+
+__attribute__((constructor))
+static void Init_Rectangle_Test( void )
+{
+   __builtin_cpu_init();
+   if ( __builtin_cpu_supports("avx512f") )
+      rectangle_test = Rectangle_Test_AVX512;
+   else if ( __builtin_cpu_supports("avx2") )
+      rectangle_test = Rectangle_Test_AVX2;
+}
+
+#endif
@@ -2,13 +2,21 @@
 // File: geometric_random_variate.c                                           //
 // Routine(s):                                                                //
 //    Geometric_Random_Variate                                                //
+//    Geometric_Random_Variate_r                                              //
 ////////////////////////////////////////////////////////////////////////////////
 
 #include <math.h>                    // required for log()
 
+#include "random_state.h"
+
 //                    Required Externally Defined Routines                    //
 
-extern double Exponential_Random_Variate( void );
+extern Random_State* Uniform_0_1_Default_State( void );
+extern double Exponential_Random_Variate_r( Random_State *state );
+
+//                    Required Internally Defined Routines                    //
+
+int Geometric_Random_Variate_r( Random_State *state, double p );
 
 ////////////////////////////////////////////////////////////////////////////////
 // int Geometric_Random_Variate( double p )                                   //
@@ -34,7 +42,39 @@ extern double Exponential_Random_Variate( void );
         
 int Geometric_Random_Variate( double p )
 {
-   double y = -Exponential_Random_Variate( );
+   return Geometric_Random_Variate_r( Uniform_0_1_Default_State(), p );
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// int Geometric_Random_Variate_r( Random_State *state, double p )            //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns a geometrically distributed random variate.  The //
+//     exponential variate is obtained from Exponential_Random_Variate_r()    //
+//     with the same state.                                                   //
+//                                                                            //
+//  Arguments:                                                                //
+//     Random_State *state                                                    //
+//        The generator state from which the uniform variates are drawn.      //
+//     double p                                                               //
+//        As for Geometric_Random_Variate().                                  //
+//                                                                            //
+//  Return Values:                                                            //
+//     As for Geometric_Random_Variate().                                     //
+//                                                                            //
+//  Example:                                                                  //
+//     Random_State state;                                                    //
+//     int x;                                                                 //
+//     double p;                                                              //
+//                                                                            //
+//     Random_State_Init( &state, 12345 );                                    //
+//     x = Geometric_Random_Variate_r( &state, p );                           //
+////////////////////////////////////////////////////////////////////////////////
+
+int Geometric_Random_Variate_r( Random_State *state, double p )
+{
+   double y = -Exponential_Random_Variate_r(state);
 
    return (int) (y / log(1.0 - p)); 
 }
@@ -2,13 +2,22 @@
 // File: gumbels_maximum_random_variate.c                                     //
 // Routine(s):                                                                //
 //    Gumbels_Maximum_Random_Variate                                          //
+//    Gumbels_Maximum_Random_Variate_r                                        //
 ////////////////////////////////////////////////////////////////////////////////
 
 #include <math.h>                                      // required for log()
 
+#include "random_state.h"
+
 //                    Required Externally Defined Routines                    //
-double Exponential_Random_Variate( void );
-        
+
+extern Random_State* Uniform_0_1_Default_State( void );
+double Exponential_Random_Variate_r( Random_State *state );
+
+//                    Required Internally Defined Routines                    //
+
+double Gumbels_Maximum_Random_Variate_r( Random_State *state );
+
 ////////////////////////////////////////////////////////////////////////////////
 // double Gumbels_Maximum_Random_Variate( void )                              //
 //                                                                            //
@@ -35,7 +44,36 @@ double Exponential_Random_Variate( void );
 
 double Gumbels_Maximum_Random_Variate( void )
 {
-   double e = Exponential_Random_Variate();
+   return Gumbels_Maximum_Random_Variate_r( Uniform_0_1_Default_State() );
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// double Gumbels_Maximum_Random_Variate_r( Random_State *state )             //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns a random variate from Gumbel's maximum extreme   //
+//     value distribution, -ln(e), where e is drawn by                        //
+//     Exponential_Random_Variate_r() from state.                             //
+//                                                                            //
+//  Arguments:                                                                //
+//     Random_State *state                                                    //
+//        The generator state from which the uniform variates are drawn.      //
+//                                                                            //
+//  Return Values:                                                            //
+//     As for Gumbels_Maximum_Random_Variate().                               //
+//                                                                            //
+//  Example:                                                                  //
+//     Random_State state;                                                    //
+//     double x;                                                              //
+//                                                                            //
+//     Random_State_Init( &state, 12345 );                                    //
+//     x = Gumbels_Maximum_Random_Variate_r( &state );                        //
+////////////////////////////////////////////////////////////////////////////////
+
+double Gumbels_Maximum_Random_Variate_r( Random_State *state )
+{
+   double e = Exponential_Random_Variate_r(state);
 
    return -log(e);
 }
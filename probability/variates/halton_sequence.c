@@ -0,0 +1,303 @@
+////////////////////////////////////////////////////////////////////////////////
+// File: halton_sequence.c                                                    //
+// Routine(s):                                                                //
+//    Halton_Sequence_Init                                                    //
+//    Halton_Sequence_Next                                                    //
+//    Halton_Sequence_Block                                                   //
+//    Halton_Sequence_Skip                                                    //
+//    Halton_Sequence_Free                                                    //
+////////////////////////////////////////////////////////////////////////////////
+
+#include <stdlib.h>                         // required for malloc(), free()
+
+#include "random_state.h"
+#include "halton_sequence.h"
+
+//                    Required Externally Defined Routines                    //
+
+extern double Uniform_0_1_Random_Variate_r( Random_State *state );
+
+//                    Required Internally Defined Routines                    //
+
+void Halton_Sequence_Block( Halton_Sequence *seq, double u[], int n );
+void Halton_Sequence_Free( Halton_Sequence *seq );
+
+//                         Internally Defined Constants                       //
+
+static const double two_53 = 9007199254740992.0;
+static const double one_minus_epsilon = 1.0 - 1.0 / 9007199254740992.0;
+
+////////////////////////////////////////////////////////////////////////////////
+// int Halton_Sequence_Init( Halton_Sequence *seq, int dimension,             //
+//                           Random_State *state )                            //
+//                                                                            //
+//  Description:                                                              //
+//     This function sets up seq to generate the Halton sequence in           //
+//     "dimension" dimensions, coordinate j being the radical inverse of the  //
+//     index of the point in the j-th prime base, starting with the point of  //
+//     index 0.                                                               //
+//                                                                            //
+//     In high dimensions the coordinates of the Halton sequence in large     //
+//     bases are strongly correlated for the first points.  If state is not   //
+//     NULL, the sequence is scrambled by a random linear digit scrambling:   //
+//     digit k of the radical inverse in base b is mapped by d -> (a d + c)   //
+//     mod b, where the multiplier a, 1 <= a < b, and the shift c, 0 <= c <   //
+//     b, are drawn from state independently for each digit and coordinate.   //
+//     This breaks up the correlations while keeping the low discrepancy of   //
+//     the sequence, and independent scramblings give independent randomized  //
+//     quasi-Monte Carlo estimates from which an error estimate can be        //
+//     formed.  A scrambled sequence never returns 0, whereas the unscrambled //
+//     sequence starts with the origin, which callers who transform the       //
+//     points by a quantile function usually skip with Halton_Sequence_Skip(  //
+//     seq, 1 ).                                                              //
+//                                                                            //
+//  Arguments:                                                                //
+//     Halton_Sequence *seq                                                   //
+//        The sequence to set up.  Its storage is allocated here and must be  //
+//        released by Halton_Sequence_Free().                                 //
+//     int dimension                                                          //
+//        The number of coordinates, dimension >= 1.                          //
+//     Random_State *state                                                    //
+//        The generator state from which the scrambling is drawn, or NULL for //
+//        the unscrambled sequence.                                           //
+//                                                                            //
+//  Return Values:                                                            //
+//     0 on success, -1 if dimension < 1 and -2 if memory could not be        //
+//     allocated.                                                             //
+//                                                                            //
+//  Example:                                                                  //
+//     Halton_Sequence seq;                                                   //
+//     Random_State state;                                                    //
+//                                                                            //
+//     Random_State_Init( &state, 12345 );                                    //
+//     Halton_Sequence_Init( &seq, 10, &state );                              //
+////////////////////////////////////////////////////////////////////////////////
+
+int Halton_Sequence_Init( Halton_Sequence *seq, int dimension,
+                                                          Random_State *state )
+{
+   double power, scale, tail;
+   int *multiplier, *shift;
+   int b, j, k, p;
+
+   seq->dimension = 0;
+   seq->index = 0;
+   seq->base = NULL;
+   seq->digits = NULL;
+   seq->multiplier = NULL;
+   seq->shift = NULL;
+   seq->tail = NULL;
+   if ( dimension < 1 ) return -1;
+
+   seq->base = (int*) malloc( dimension * sizeof(int) );
+   seq->digits = (int*) malloc( dimension * sizeof(int) );
+   seq->multiplier = (int*) malloc( dimension * HALTON_DIGITS * sizeof(int) );
+   seq->shift = (int*) malloc( dimension * HALTON_DIGITS * sizeof(int) );
+   seq->tail = (double*) malloc( dimension * HALTON_DIGITS * sizeof(double) );
+   if ( seq->base == NULL || seq->digits == NULL || seq->multiplier == NULL
+                              || seq->shift == NULL || seq->tail == NULL ) {
+      Halton_Sequence_Free( seq );
+      return -2;
+   }
+   seq->dimension = dimension;
+
+   for (j = 0, b = 2; j < dimension; j++, b++) {
+
+                        // Find the next prime by trial division. //
+
+      for (;; b++) {
+         for (p = 2; p * p <= b; p++) if ( b % p == 0 ) break;
+         if ( p * p > b ) break;
+      }
+      seq->base[j] = b;
+
+                 // Use enough digits that b^digits >= 2^53. //
+
+      for (k = 0, power = 1.0; power < two_53; k++) power *= b;
+      seq->digits[j] = k;
+
+      multiplier = &seq->multiplier[j * HALTON_DIGITS];
+      shift = &seq->shift[j * HALTON_DIGITS];
+      for (k = 0; k < seq->digits[j]; k++) {
+         if ( state == NULL ) {
+            multiplier[k] = 1;
+            shift[k] = 0;
+         }
+         else {
+            multiplier[k] = 1 + (int) ((b - 1)
+                                      * Uniform_0_1_Random_Variate_r(state));
+            shift[k] = (int) (b * Uniform_0_1_Random_Variate_r(state));
+         }
+      }
+
+          // tail[k] is the value of the shifts of digits k, k+1, ... . //
+
+      tail = 0.0;
+      scale = 1.0 / power;
+      for (k = seq->digits[j] - 1; k >= 0; k--) {
+         scale *= b;
+         tail += shift[k] * scale;
+         seq->tail[j * HALTON_DIGITS + k] = tail;
+      }
+   }
+   return 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// void Halton_Sequence_Next( Halton_Sequence *seq, double u[] )              //
+//                                                                            //
+//  Description:                                                              //
+//     This function sets u[] to the next point of the sequence and advances  //
+//     the sequence by one point.                                             //
+//                                                                            //
+//  Arguments:                                                                //
+//     Halton_Sequence *seq                                                   //
+//        A sequence set up by Halton_Sequence_Init().                        //
+//     double u[]                                                             //
+//        The array of at least seq->dimension elements which is set to the   //
+//        coordinates of the point.                                           //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     Halton_Sequence seq;                                                   //
+//     double u[10];                                                          //
+//                                                                            //
+//     Halton_Sequence_Next( &seq, u );                                       //
+////////////////////////////////////////////////////////////////////////////////
+
+void Halton_Sequence_Next( Halton_Sequence *seq, double u[] )
+{
+   Halton_Sequence_Block( seq, u, 1 );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// void Halton_Sequence_Block( Halton_Sequence *seq, double u[], int n )      //
+//                                                                            //
+//  Description:                                                              //
+//     This function fills u[] with the next n points of the sequence, stored //
+//     by rows: point i occupies u[i*d], ..., u[i*d + d - 1], where d =       //
+//     seq->dimension.  Each coordinate is formed from the digits of the      //
+//     index of the point, least significant first, until the remaining       //
+//     digits are all zero; the contribution of the scrambled zero digits is  //
+//     then taken from tail[].  Since the transformations of the inversion    //
+//     routines act element by element, the whole block may be passed to them //
+//     at once, e.g. Exponential_Variate_Inversion_Array( u, x, n * d ).      //
+//                                                                            //
+//  Arguments:                                                                //
+//     Halton_Sequence *seq                                                   //
+//        A sequence set up by Halton_Sequence_Init().                        //
+//     double u[]                                                             //
+//        The row-major n x seq->dimension array which is set to the points.  //
+//     int n                                                                  //
+//        The number of points to generate.                                   //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     #define N 1000                                                         //
+//     #define D 10                                                           //
+//     Halton_Sequence seq;                                                   //
+//     Random_State state;                                                    //
+//     double u[N][D], x[N][D];                                               //
+//                                                                            //
+//     Random_State_Init( &state, 12345 );                                    //
+//     Halton_Sequence_Init( &seq, D, &state );                               //
+//     Halton_Sequence_Block( &seq, &u[0][0], N );                            //
+//     Exponential_Variate_Inversion_Array( &u[0][0], &x[0][0], N * D );      //
+//     Halton_Sequence_Free( &seq );                                          //
+////////////////////////////////////////////////////////////////////////////////
+
+void Halton_Sequence_Block( Halton_Sequence *seq, double u[], int n )
+{
+   int d = seq->dimension;
+   const int *multiplier, *shift;
+   unsigned long long index, m;
+   double y, scale;
+   int b, digit, i, j, k;
+
+   for (i = 0; i < n; i++, u += d) {
+      index = seq->index++;
+      for (j = 0; j < d; j++) {
+         b = seq->base[j];
+         multiplier = &seq->multiplier[j * HALTON_DIGITS];
+         shift = &seq->shift[j * HALTON_DIGITS];
+         y = 0.0;
+         scale = 1.0;
+         for (k = 0, m = index; m > 0 && k < seq->digits[j]; k++, m /= b) {
+            digit = (int) (m % b);
+            scale /= b;
+            y += (double) ( ( (unsigned long long) multiplier[k] * digit
+                                                     + shift[k] ) % b ) * scale;
+         }
+         if ( k < seq->digits[j] ) y += seq->tail[j * HALTON_DIGITS + k];
+         u[j] = ( y < 1.0 ) ? y : one_minus_epsilon;
+      }
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// void Halton_Sequence_Skip( Halton_Sequence *seq, unsigned long long n )    //
+//                                                                            //
+//  Description:                                                              //
+//     This function advances the sequence by n points without generating     //
+//     them.  Since each point is computed from its index alone the cost is   //
+//     independent of n.  This allows independent processors to generate      //
+//     disjoint blocks of the same sequence.                                  //
+//                                                                            //
+//  Arguments:                                                                //
+//     Halton_Sequence *seq                                                   //
+//        A sequence set up by Halton_Sequence_Init().                        //
+//     unsigned long long n                                                   //
+//        The number of points to skip.                                       //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     Halton_Sequence seq;                                                   //
+//                                                                            //
+//     Halton_Sequence_Skip( &seq, 1 );                                       //
+////////////////////////////////////////////////////////////////////////////////
+
+void Halton_Sequence_Skip( Halton_Sequence *seq, unsigned long long n )
+{
+   seq->index += n;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// void Halton_Sequence_Free( Halton_Sequence *seq )                          //
+//                                                                            //
+//  Description:                                                              //
+//     This function releases the storage of a sequence set up by             //
+//     Halton_Sequence_Init().                                                //
+//                                                                            //
+//  Arguments:                                                                //
+//     Halton_Sequence *seq                                                   //
+//        The sequence to release.                                            //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     Halton_Sequence seq;                                                   //
+//                                                                            //
+//     Halton_Sequence_Free( &seq );                                          //
+////////////////////////////////////////////////////////////////////////////////
+
+void Halton_Sequence_Free( Halton_Sequence *seq )
+{
+   free( seq->base );
+   free( seq->digits );
+   free( seq->multiplier );
+   free( seq->shift );
+   free( seq->tail );
+   seq->base = NULL;
+   seq->digits = NULL;
+   seq->multiplier = NULL;
+   seq->shift = NULL;
+   seq->tail = NULL;
+   seq->dimension = 0;
+}
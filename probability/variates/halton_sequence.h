@@ -0,0 +1,39 @@
+////////////////////////////////////////////////////////////////////////////////
+// File: halton_sequence.h                                                    //
+// Type(s):                                                                   //
+//    Halton_Sequence                                                         //
+////////////////////////////////////////////////////////////////////////////////
+#ifndef HALTON_SEQUENCE_H
+#define HALTON_SEQUENCE_H
+
+////////////////////////////////////////////////////////////////////////////////
+// Halton_Sequence                                                            //
+//                                                                            //
+//  Description:                                                              //
+//     The state of a Halton low-discrepancy sequence in "dimension"          //
+//     dimensions, set up by Halton_Sequence_Init() and released by           //
+//     Halton_Sequence_Free().                                                //
+//                                                                            //
+//     Coordinate j is the radical inverse of the index of the point in the   //
+//     base base[j], the j-th prime, with digit k scrambled by d ->           //
+//     (multiplier[j * HALTON_DIGITS + k] d + shift[j * HALTON_DIGITS + k])   //
+//     mod base[j].  digits[j] is the number of digits of the radical inverse //
+//     which are computed, enough for the precision of a double, and tail[j * //
+//     HALTON_DIGITS + k] is the contribution of digits k, ..., digits[j] - 1 //
+//     when they are all zero before scrambling.  Without scrambling every    //
+//     multiplier is 1 and every shift and tail is 0.                         //
+////////////////////////////////////////////////////////////////////////////////
+
+#define HALTON_DIGITS 64
+
+typedef struct {
+   int dimension;
+   unsigned long long index;
+   int *base;
+   int *digits;
+   int *multiplier;
+   int *shift;
+   double *tail;
+} Halton_Sequence;
+
+#endif
@@ -0,0 +1,155 @@
+////////////////////////////////////////////////////////////////////////////////
+// File: hypergeometric_random_variate.c                                      //
+// Routine(s):                                                                //
+//    Hypergeometric_Random_Variate                                           //
+//    Hypergeometric_Random_Variate_r                                         //
+//    Hypergeometric_Random_Variate_Array                                     //
+////////////////////////////////////////////////////////////////////////////////
+
+#include "random_state.h"
+#include "hypergeometric_sampler.h"
+
+//                    Required Externally Defined Routines                    //
+
+extern Random_State* Uniform_0_1_Default_State( void );
+extern void Hypergeometric_Sampler_Init( Hypergeometric_Sampler *sampler,
+                                                       int n1, int n2, int n );
+extern int Hypergeometric_Sampler_Variate_r( Random_State *state,
+                                       const Hypergeometric_Sampler *sampler );
+extern void Hypergeometric_Sampler_Variate_Array( Random_State *state, int x[],
+                             int size, const Hypergeometric_Sampler *sampler );
+
+//                    Required Internally Defined Routines                    //
+
+int Hypergeometric_Random_Variate_r( Random_State *state, int n1, int n2,
+                                                                       int n );
+
+////////////////////////////////////////////////////////////////////////////////
+// int Hypergeometric_Random_Variate( int n1, int n2, int n )                 //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns a hypergeometric random variate, the number of   //
+//     1's among n objects drawn without replacement from n1 objects labeled  //
+//     1 and n2 objects labeled 0, the distribution of                        //
+//     Hypergeometric_Point_Distribution().  If min(n, n1 + n2 - n) >=        //
+//     HYPERGEOMETRIC_HRUA_THRESHOLD the ratio of uniforms algorithm HRUA of  //
+//     Stadlober is used, whose expected number of uniform variates is        //
+//     bounded independently of the parameters, otherwise the objects are     //
+//     drawn one at a time, see Hypergeometric_Sampler_Variate_r().           //
+//                                                                            //
+//  Arguments:                                                                //
+//     int n1                                                                 //
+//        The number of objects labeled 1, n1 >= 0.                           //
+//     int n2                                                                 //
+//        The number of objects labeled 0, n2 >= 0.                           //
+//     int n                                                                  //
+//        The number of objects drawn without replacement, 0 <= n <= n1 + n2. //
+//                                                                            //
+//  Return Values:                                                            //
+//     A random number with a hypergeometric distribution, between max(0, n - //
+//     n2) and min(n, n1).                                                    //
+//                                                                            //
+//  Example:                                                                  //
+//     int x;                                                                 //
+//     int n1, n2, n;                                                         //
+//                                                                            //
+//     x = Hypergeometric_Random_Variate( n1, n2, n );                        //
+////////////////////////////////////////////////////////////////////////////////
+
+int Hypergeometric_Random_Variate( int n1, int n2, int n )
+{
+   return Hypergeometric_Random_Variate_r( Uniform_0_1_Default_State(),
+                                                                   n1, n2, n );
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// int Hypergeometric_Random_Variate_r( Random_State *state,                  //
+//                                                    int n1, int n2, int n ) //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns a random variate as for                          //
+//     Hypergeometric_Random_Variate(), drawing from state.  The constants of //
+//     the method are computed by Hypergeometric_Sampler_Init() on each call; //
+//     callers who generate many variates with the same parameters should     //
+//     prepare a Hypergeometric_Sampler once and call                         //
+//     Hypergeometric_Sampler_Variate_r().                                    //
+//                                                                            //
+//  Arguments:                                                                //
+//     Random_State *state                                                    //
+//        The generator state from which the variates are drawn.              //
+//     int n1                                                                 //
+//        As for Hypergeometric_Random_Variate().                             //
+//     int n2                                                                 //
+//        As for Hypergeometric_Random_Variate().                             //
+//     int n                                                                  //
+//        As for Hypergeometric_Random_Variate().                             //
+//                                                                            //
+//  Return Values:                                                            //
+//     A random number with a hypergeometric distribution, between max(0, n - //
+//     n2) and min(n, n1).                                                    //
+//                                                                            //
+//  Example:                                                                  //
+//     int x;                                                                 //
+//     Random_State state;                                                    //
+//     int n1, n2, n;                                                         //
+//                                                                            //
+//     Random_State_Init( &state, 12345 );                                    //
+//     x = Hypergeometric_Random_Variate_r( &state, n1, n2, n );              //
+////////////////////////////////////////////////////////////////////////////////
+
+int Hypergeometric_Random_Variate_r( Random_State *state,
+                                                        int n1, int n2, int n )
+{
+   Hypergeometric_Sampler sampler;
+
+   Hypergeometric_Sampler_Init(&sampler, n1, n2, n);
+   return Hypergeometric_Sampler_Variate_r(state, &sampler);
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// void Hypergeometric_Random_Variate_Array( Random_State *state, int x[],    //
+//                                           int size, int n1, int n2,        //
+//                                           int n )                          //
+//                                                                            //
+//  Description:                                                              //
+//     This function fills the array x[] with size random variates as for     //
+//     Hypergeometric_Random_Variate().  The constants of the method are      //
+//     computed once for the whole array, which is then filled by             //
+//     Hypergeometric_Sampler_Variate_Array().                                //
+//                                                                            //
+//  Arguments:                                                                //
+//     Random_State *state                                                    //
+//        The generator state from which the variates are drawn.              //
+//     int x[]                                                                //
+//        The array of at least size elements which is set to the variates.   //
+//     int size                                                               //
+//        The number of variates to generate.                                 //
+//     int n1                                                                 //
+//        As for Hypergeometric_Random_Variate().                             //
+//     int n2                                                                 //
+//        As for Hypergeometric_Random_Variate().                             //
+//     int n                                                                  //
+//        As for Hypergeometric_Random_Variate().                             //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     #define N 1000                                                         //
+//     Random_State state;                                                    //
+//     int x[N];                                                              //
+//                                                                            //
+//     Random_State_Init( &state, 12345 );                                    //
+//     Hypergeometric_Random_Variate_Array( &state, x, N, 600, 400, 200 );    //
+////////////////////////////////////////////////////////////////////////////////
+
+void Hypergeometric_Random_Variate_Array( Random_State *state, int x[],
+                                              int size, int n1, int n2, int n )
+{
+   Hypergeometric_Sampler sampler;
+
+   Hypergeometric_Sampler_Init(&sampler, n1, n2, n);
+   Hypergeometric_Sampler_Variate_Array(state, x, size, &sampler);
+}
@@ -0,0 +1,329 @@
+////////////////////////////////////////////////////////////////////////////////
+// File: hypergeometric_sampler.c                                             //
+// Routine(s):                                                                //
+//    Hypergeometric_Sampler_Init                                             //
+//    Hypergeometric_Sampler_Variate                                          //
+//    Hypergeometric_Sampler_Variate_r                                        //
+//    Hypergeometric_Sampler_Variate_Array                                    //
+////////////////////////////////////////////////////////////////////////////////
+
+#include <math.h>                    // required for floor(), log(), sqrt()
+
+#include "random_state.h"
+#include "hypergeometric_sampler.h"
+
+//                    Required Externally Defined Routines                    //
+
+extern Random_State* Uniform_0_1_Default_State( void );
+extern double Uniform_0_1_Random_Variate_r( Random_State *state );
+extern double Ln_Factorial( int n );
+
+//                    Required Internally Defined Routines                    //
+
+int Hypergeometric_Sampler_Variate_r( Random_State *state,
+                                       const Hypergeometric_Sampler *sampler );
+static int HRUA( Random_State *state, const Hypergeometric_Sampler *s );
+static int Draw( Random_State *state, const Hypergeometric_Sampler *s );
+static double Ln_Factorial_Stirling( int n );
+
+//                         Internally Defined Constants                       //
+
+static const double D1 = 1.7155277699214135;  // 2 sqrt(2/e)
+static const double D2 = 0.8989161620588988;  // 3 - 2 sqrt(3/e)
+static const double ln_sqrt_2pi = 0.91893853320467274178;
+
+////////////////////////////////////////////////////////////////////////////////
+// void Hypergeometric_Sampler_Init( Hypergeometric_Sampler *sampler, int n1, //
+//                                                            int n2, int n ) //
+//                                                                            //
+//  Description:                                                              //
+//     This function prepares sampler to generate hypergeometric variates,    //
+//     the number of 1's among n objects drawn without replacement from n1    //
+//     objects labeled 1 and n2 objects labeled 0, with the parameters in the //
+//     order of Hypergeometric_Point_Distribution().                          //
+//                                                                            //
+//     If m = min(n, n1 + n2 - n) >= HYPERGEOMETRIC_HRUA_THRESHOLD the        //
+//     constants of Stadlober's algorithm HRUA are computed.  Its expected    //
+//     number of candidates is bounded independently of the parameters, but   //
+//     each costs four logarithms of factorials, so for fewer than 10 objects //
+//     drawing them one at a time is faster.                                  //
+//                                                                            //
+//  Arguments:                                                                //
+//     Hypergeometric_Sampler *sampler                                        //
+//        The sampler to prepare.                                             //
+//     int n1                                                                 //
+//        The number of objects labeled 1, n1 >= 0.                           //
+//     int n2                                                                 //
+//        The number of objects labeled 0, n2 >= 0.                           //
+//     int n                                                                  //
+//        The number of objects drawn without replacement, 0 <= n <= n1 + n2. //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     Hypergeometric_Sampler sampler;                                        //
+//     int n1, n2, n;                                                         //
+//                                                                            //
+//     Hypergeometric_Sampler_Init( &sampler, n1, n2, n );                    //
+////////////////////////////////////////////////////////////////////////////////
+
+void Hypergeometric_Sampler_Init( Hypergeometric_Sampler *sampler, int n1,
+                                                               int n2, int n )
+{
+   int population = n1 + n2;
+   double p, mode, top;
+   int m;
+
+   sampler->n1 = n1;
+   sampler->n2 = n2;
+   sampler->n = n;
+   sampler->m = m = (n <= population - n) ? n : population - n;
+   sampler->minimum = (n1 <= n2) ? n1 : n2;
+   sampler->maximum = (n1 <= n2) ? n2 : n1;
+   sampler->swap = ( n1 > n2 );
+   sampler->complement = ( m < n );
+   sampler->hrua = ( m >= HYPERGEOMETRIC_HRUA_THRESHOLD );
+   if ( !sampler->hrua ) return;
+
+   p = (double) sampler->minimum / (double) population;
+   sampler->mean = m * p + 0.5;
+   sampler->scale = D1 * sqrt( (double) (population - m) * n * p * (1.0 - p)
+                                    / (double) (population - 1) + 0.5 ) + D2;
+   mode = floor( (double) (m + 1) * (sampler->minimum + 1)
+                                                / (double) (population + 2) );
+   sampler->mode = mode;
+   sampler->ln_mode = Ln_Factorial_Stirling((int) mode)
+                    + Ln_Factorial_Stirling(sampler->minimum - (int) mode)
+                    + Ln_Factorial_Stirling(m - (int) mode)
+                    + Ln_Factorial_Stirling(sampler->maximum - m + (int) mode);
+   top = ( m < sampler->minimum ) ? m : sampler->minimum;
+   sampler->bound = floor(sampler->mean + 16.0 * (sampler->scale - D2) / D1);
+   if ( sampler->bound > top + 1.0 ) sampler->bound = top + 1.0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// int Hypergeometric_Sampler_Variate(                                        //
+//                                    const Hypergeometric_Sampler *sampler ) //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns a hypergeometric random variate with the         //
+//     parameters given to Hypergeometric_Sampler_Init().  The variates are   //
+//     drawn from the library's default generator state.                      //
+//                                                                            //
+//  Arguments:                                                                //
+//     const Hypergeometric_Sampler *sampler                                  //
+//        A sampler prepared by Hypergeometric_Sampler_Init().                //
+//                                                                            //
+//  Return Values:                                                            //
+//     A random number with the hypergeometric distribution of sampler.       //
+//                                                                            //
+//  Example:                                                                  //
+//     Hypergeometric_Sampler sampler;                                        //
+//     int x;                                                                 //
+//                                                                            //
+//     x = Hypergeometric_Sampler_Variate( &sampler );                        //
+////////////////////////////////////////////////////////////////////////////////
+
+int Hypergeometric_Sampler_Variate( const Hypergeometric_Sampler *sampler )
+{
+   return Hypergeometric_Sampler_Variate_r( Uniform_0_1_Default_State(),
+                                                                     sampler );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// int Hypergeometric_Sampler_Variate_r( Random_State *state,                 //
+//                                    const Hypergeometric_Sampler *sampler ) //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns a hypergeometric random variate with the         //
+//     parameters given to Hypergeometric_Sampler_Init(), the number of 1's   //
+//     among the n objects drawn.  The number of objects of the rarer label   //
+//     among the smaller of the sets drawn and not drawn is generated, by     //
+//     HRUA or by drawing the objects one at a time, and then transformed to  //
+//     the number of 1's drawn.                                               //
+//                                                                            //
+//  Arguments:                                                                //
+//     Random_State *state                                                    //
+//        The generator state from which the uniform variates are drawn.      //
+//     const Hypergeometric_Sampler *sampler                                  //
+//        A sampler prepared by Hypergeometric_Sampler_Init().                //
+//                                                                            //
+//  Return Values:                                                            //
+//     A random number with the hypergeometric distribution of sampler,       //
+//     between max(0, n - n2) and min(n, n1).                                 //
+//                                                                            //
+//  Example:                                                                  //
+//     Hypergeometric_Sampler sampler;                                        //
+//     Random_State state;                                                    //
+//     int k;                                                                 //
+//                                                                            //
+//     Random_State_Init( &state, 12345 );                                    //
+//     k = Hypergeometric_Sampler_Variate_r( &state, &sampler );              //
+////////////////////////////////////////////////////////////////////////////////
+
+int Hypergeometric_Sampler_Variate_r( Random_State *state,
+                                        const Hypergeometric_Sampler *sampler )
+{
+   int k = ( sampler->hrua ) ? HRUA(state, sampler) : Draw(state, sampler);
+
+   if ( sampler->swap ) k = sampler->m - k;
+   if ( sampler->complement ) k = sampler->n1 - k;
+   return k;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// void Hypergeometric_Sampler_Variate_Array( Random_State *state, int x[],   //
+//                          int size, const Hypergeometric_Sampler *sampler ) //
+//                                                                            //
+//  Description:                                                              //
+//     This function fills the array x[] with "size" hypergeometric random    //
+//     variates with the parameters given to Hypergeometric_Sampler_Init().   //
+//     The variates are the same as those of "size" successive calls to       //
+//     Hypergeometric_Sampler_Variate_r().                                    //
+//                                                                            //
+//  Arguments:                                                                //
+//     Random_State *state                                                    //
+//        The generator state from which the uniform variates are drawn.      //
+//     int x[]                                                                //
+//        The array of at least "size" elements which is set to the variates. //
+//     int size                                                               //
+//        The number of variates to generate.                                 //
+//     const Hypergeometric_Sampler *sampler                                  //
+//        A sampler prepared by Hypergeometric_Sampler_Init().                //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     #define N 1000                                                         //
+//     Hypergeometric_Sampler sampler;                                        //
+//     Random_State state;                                                    //
+//     int x[N];                                                              //
+//                                                                            //
+//     Random_State_Init( &state, 12345 );                                    //
+//     Hypergeometric_Sampler_Init( &sampler, 600, 400, 200 );                //
+//     Hypergeometric_Sampler_Variate_Array( &state, x, N, &sampler );        //
+////////////////////////////////////////////////////////////////////////////////
+
+void Hypergeometric_Sampler_Variate_Array( Random_State *state, int x[],
+                             int size, const Hypergeometric_Sampler *sampler )
+{
+   int i;
+
+   for (i = 0; i < size; i++)
+      x[i] = Hypergeometric_Sampler_Variate_r(state, sampler);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// static int HRUA( Random_State *state, const Hypergeometric_Sampler *s )    //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns the number of objects of the rarer label among   //
+//     the m drawn by the ratio of uniforms method with the table mountain    //
+//     hat of Stadlober's algorithm HRUA.  A candidate k = floor(mean + scale //
+//     (v - 1/2) / u), u and v uniform on (0,1), is accepted if u^2 <= f(k) / //
+//     f(mode), which is first tested against the squeezes u (4 - u) - 3 <=   //
+//     ln(f(k) / f(mode)) and u (u - ln(f(k) / f(mode))) >= 1 so that most    //
+//     candidates need no logarithm.  The logarithms of the probabilities are //
+//     formed by Ln_Factorial_Stirling().                                     //
+//                                                                            //
+//  Arguments:                                                                //
+//     Random_State *state                                                    //
+//        The generator state from which the uniform variates are drawn.      //
+//     const Hypergeometric_Sampler *s                                        //
+//        A sampler prepared by Hypergeometric_Sampler_Init() with hrua       //
+//        nonzero.                                                            //
+//                                                                            //
+//  Return Values:                                                            //
+//     The number of objects of the rarer label drawn.                        //
+////////////////////////////////////////////////////////////////////////////////
+
+static int HRUA( Random_State *state, const Hypergeometric_Sampler *s )
+{
+   double u, v, w, t;
+   int k;
+
+   for (;;) {
+      u = Uniform_0_1_Random_Variate_r(state);
+      v = Uniform_0_1_Random_Variate_r(state);
+      if ( u == 0.0 ) continue;
+      w = s->mean + s->scale * (v - 0.5) / u;
+      if ( w < 0.0 || w >= s->bound ) continue;
+      k = (int) w;
+      t = s->ln_mode - ( Ln_Factorial_Stirling(k)
+                         + Ln_Factorial_Stirling(s->minimum - k)
+                         + Ln_Factorial_Stirling(s->m - k)
+                         + Ln_Factorial_Stirling(s->maximum - s->m + k) );
+      if ( u * (4.0 - u) - 3.0 <= t ) return k;
+      if ( u * (u - t) >= 1.0 ) continue;
+      if ( 2.0 * log(u) <= t ) return k;
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// static int Draw( Random_State *state, const Hypergeometric_Sampler *s )    //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns the number of objects of the rarer label among   //
+//     the m drawn by drawing the objects one at a time, each being of the    //
+//     rarer label with probability equal to the fraction of the remaining    //
+//     objects which are.                                                     //
+//                                                                            //
+//  Arguments:                                                                //
+//     Random_State *state                                                    //
+//        The generator state from which the uniform variates are drawn.      //
+//     const Hypergeometric_Sampler *s                                        //
+//        A sampler prepared by Hypergeometric_Sampler_Init().                //
+//                                                                            //
+//  Return Values:                                                            //
+//     The number of objects of the rarer label drawn.                        //
+////////////////////////////////////////////////////////////////////////////////
+
+static int Draw( Random_State *state, const Hypergeometric_Sampler *s )
+{
+   int rare = s->minimum;
+   int total = s->minimum + s->maximum;
+   int k = 0;
+   int i;
+
+   for (i = 0; i < s->m && rare > 0; i++, total--)
+      if ( Uniform_0_1_Random_Variate_r(state) * total < rare ) {
+         k++;
+         rare--;
+      }
+   return k;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// static double Ln_Factorial_Stirling( int n )                               //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns ln(n!), taken from Ln_Factorial() for n <= 170,  //
+//     whose values are tabulated, and otherwise from the Stirling series     //
+//          ln(n!) = (x - 1/2) ln(x) - x + ln(sqrt(2 pi))                     //
+//                        + 1/(12 x) - 1/(360 x^3) + 1/(1260 x^5),            //
+//                                                                            //
+//     x = n + 1, whose truncation error is below 1/(1680 x^7) < 1e-18.       //
+//     Ln_Factorial() evaluates the same series in long double precision,     //
+//     which would dominate the cost of HRUA, whereas the acceptance test     //
+//     only needs double precision.                                           //
+//                                                                            //
+//  Arguments:                                                                //
+//     int n                                                                  //
+//        The argument of the factorial, n >= 0.                              //
+//                                                                            //
+//  Return Values:                                                            //
+//     ln(n!).                                                                //
+////////////////////////////////////////////////////////////////////////////////
+
+static double Ln_Factorial_Stirling( int n )
+{
+   double x, y;
+
+   if ( n <= 170 ) return Ln_Factorial(n);
+   x = (double) n + 1.0;
+   y = 1.0 / (x * x);
+   return (x - 0.5) * log(x) - x + ln_sqrt_2pi
+                        + (1.0 / 12.0 - y * (1.0 / 360.0 - y / 1260.0)) / x;
+}
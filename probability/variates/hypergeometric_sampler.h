@@ -0,0 +1,49 @@
+////////////////////////////////////////////////////////////////////////////////
+// File: hypergeometric_sampler.h                                             //
+// Type(s):                                                                   //
+//    Hypergeometric_Sampler                                                  //
+////////////////////////////////////////////////////////////////////////////////
+#ifndef HYPERGEOMETRIC_SAMPLER_H
+#define HYPERGEOMETRIC_SAMPLER_H
+
+////////////////////////////////////////////////////////////////////////////////
+// Hypergeometric_Sampler                                                     //
+//                                                                            //
+//  Description:                                                              //
+//     The parameters of a hypergeometric distribution, the number of 1's     //
+//     among n objects drawn without replacement from n1 objects labeled 1    //
+//     and n2 objects labeled 0, together with the constants of the ratio of  //
+//     uniforms algorithm HRUA of Stadlober, computed once by                 //
+//     Hypergeometric_Sampler_Init() so that repeated variates with the same  //
+//     parameters do not recompute them.                                      //
+//                                                                            //
+//     By symmetry the variate is generated as the number of the rarer label, //
+//     of which there are minimum = min(n1, n2) out of maximum = max(n1, n2), //
+//     among m = min(n, n1 + n2 - n) objects drawn, and then transformed      //
+//     back: if swap is nonzero, i.e. n1 > n2, the count is replaced by m     //
+//     minus the count, and if complement is nonzero, i.e. m < n, the count   //
+//     of 1's among the m objects not drawn is replaced by n1 minus it.       //
+//                                                                            //
+//     If hrua is zero, m is below the crossover                              //
+//     HYPERGEOMETRIC_HRUA_THRESHOLD and the m objects are drawn one at a     //
+//     time; the remaining fields are then unused.  Otherwise mean is the     //
+//     mean plus 1/2 and scale the width of the table mountain hat, mode the  //
+//     mode, ln_mode the logarithm of the product of the factorials in the    //
+//     denominator of the probability of the mode, and bound the upper bound  //
+//     of the region in which candidates are considered.                      //
+////////////////////////////////////////////////////////////////////////////////
+
+#define HYPERGEOMETRIC_HRUA_THRESHOLD 10
+
+typedef struct {
+   int n1, n2, n;
+   int m;
+   int minimum, maximum;
+   int swap, complement;
+   int hrua;
+   double mean, scale;
+   double mode, ln_mode;
+   double bound;
+} Hypergeometric_Sampler;
+
+#endif
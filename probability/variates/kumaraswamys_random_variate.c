@@ -2,14 +2,22 @@
 // File: kumaraswamys_random_variate.c                                        //
 // Routine(s):                                                                //
 //    Kumaraswamys_Random_Variate                                             //
+//    Kumaraswamys_Random_Variate_r                                           //
 ////////////////////////////////////////////////////////////////////////////////
 
 #include <math.h>                    // required for pow()
 
+#include "random_state.h"
+
 //                    Required Externally Defined Routines                    //
 
-double Uniform_0_1_Random_Variate( void );
-        
+extern Random_State* Uniform_0_1_Default_State( void );
+double Uniform_0_1_Random_Variate_r( Random_State *state );
+
+//                    Required Internally Defined Routines                    //
+
+double Kumaraswamys_Random_Variate_r( Random_State *state, double a, double b );
+
 ////////////////////////////////////////////////////////////////////////////////
 // double Kumaraswamys_Random_Variate( double a, double b )                   //
 //                                                                            //
@@ -36,7 +44,40 @@ double Uniform_0_1_Random_Variate( void );
 
 double Kumaraswamys_Random_Variate( double a, double b )
 {
-   double u = Uniform_0_1_Random_Variate();
+   return Kumaraswamys_Random_Variate_r( Uniform_0_1_Default_State(), a, b );
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// double Kumaraswamys_Random_Variate_r( Random_State *state, double a,       //
+//                                       double b )                           //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns a random variate from Kumaraswamy's distribution //
+//     by inversion of a uniform variate drawn from state.                    //
+//                                                                            //
+//  Arguments:                                                                //
+//     Random_State *state                                                    //
+//        The generator state from which the uniform variates are drawn.      //
+//     double a                                                               //
+//        As for Kumaraswamys_Random_Variate().                               //
+//     double b                                                               //
+//        As for Kumaraswamys_Random_Variate().                               //
+//                                                                            //
+//  Return Values:                                                            //
+//     As for Kumaraswamys_Random_Variate().                                  //
+//                                                                            //
+//  Example:                                                                  //
+//     Random_State state;                                                    //
+//     double x, a, b;                                                        //
+//                                                                            //
+//     Random_State_Init( &state, 12345 );                                    //
+//     x = Kumaraswamys_Random_Variate_r( &state, a, b );                     //
+////////////////////////////////////////////////////////////////////////////////
+
+double Kumaraswamys_Random_Variate_r( Random_State *state, double a, double b )
+{
+   double u = Uniform_0_1_Random_Variate_r(state);
 
    return pow( 1.0 - pow(u, 1.0 / b), 1.0/a);
 }
@@ -2,13 +2,21 @@
 // File: laplace_random_variate.c                                             //
 // Routine(s):                                                                //
 //    Laplace_Random_Variate                                                  //
+//    Laplace_Random_Variate_r                                                //
 ////////////////////////////////////////////////////////////////////////////////
 
+#include "random_state.h"
+
 //                    Required Externally Defined Routines                    //
 
-double Uniform_0_1_Random_Variate( void );
-double Exponential_Random_Variate( void );
-        
+extern Random_State* Uniform_0_1_Default_State( void );
+double Uniform_0_1_Random_Variate_r( Random_State *state );
+double Exponential_Random_Variate_r( Random_State *state );
+
+//                    Required Internally Defined Routines                    //
+
+double Laplace_Random_Variate_r( Random_State *state );
+
 ////////////////////////////////////////////////////////////////////////////////
 // double Laplace_Random_Variate( void )                                      //
 //                                                                            //
@@ -36,8 +44,37 @@ double Exponential_Random_Variate( void );
 
 double Laplace_Random_Variate( void )
 {
-   double u = Uniform_0_1_Random_Variate();
-   double e = Exponential_Random_Variate();
+   return Laplace_Random_Variate_r( Uniform_0_1_Default_State() );
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// double Laplace_Random_Variate_r( Random_State *state )                     //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns a Laplace distributed random variate.  Both the  //
+//     uniform variate which selects the sign and the exponential variate are //
+//     drawn from state.                                                      //
+//                                                                            //
+//  Arguments:                                                                //
+//     Random_State *state                                                    //
+//        The generator state from which the uniform variates are drawn.      //
+//                                                                            //
+//  Return Values:                                                            //
+//     As for Laplace_Random_Variate().                                       //
+//                                                                            //
+//  Example:                                                                  //
+//     Random_State state;                                                    //
+//     double x;                                                              //
+//                                                                            //
+//     Random_State_Init( &state, 12345 );                                    //
+//     x = Laplace_Random_Variate_r( &state );                                //
+////////////////////////////////////////////////////////////////////////////////
+
+double Laplace_Random_Variate_r( Random_State *state )
+{
+   double u = Uniform_0_1_Random_Variate_r(state);
+   double e = Exponential_Random_Variate_r(state);
 
    return (u < 0.5) ? -e : (u > 0.5) ? e : 0.0;
 }
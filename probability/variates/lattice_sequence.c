@@ -0,0 +1,347 @@
+////////////////////////////////////////////////////////////////////////////////
+// File: lattice_sequence.c                                                   //
+// Routine(s):                                                                //
+//    Lattice_Sequence_Init                                                   //
+//    Lattice_Sequence_Next                                                   //
+//    Lattice_Sequence_Block                                                  //
+//    Lattice_Sequence_Skip                                                   //
+//    Lattice_Sequence_Free                                                   //
+//    Lattice_Sequence_Korobov_Vector                                         //
+////////////////////////////////////////////////////////////////////////////////
+
+#include <stdlib.h>                         // required for malloc(), free()
+
+#include "random_state.h"
+#include "lattice_sequence.h"
+
+//                    Required Externally Defined Routines                    //
+
+extern double Uniform_0_1_Random_Variate_r( Random_State *state );
+
+//                    Required Internally Defined Routines                    //
+
+void Lattice_Sequence_Block( Lattice_Sequence *seq, double u[], int n );
+void Lattice_Sequence_Free( Lattice_Sequence *seq );
+static unsigned int Bit_Reverse( unsigned int i );
+
+//                         Internally Defined Constants                       //
+
+static const double two_32 = 4294967296.0;
+static const double two_pi_squared = 19.739208802178717237668981999752;
+
+////////////////////////////////////////////////////////////////////////////////
+// int Lattice_Sequence_Init( Lattice_Sequence *seq, unsigned int z[],        //
+//                            int dimension, Random_State *state )            //
+//                                                                            //
+//  Description:                                                              //
+//     This function sets up seq to generate the extensible rank-1 lattice    //
+//     sequence with generating vector z[] in "dimension" dimensions,         //
+//     starting with the point of index 0.  Point i is frac(phi(i) z +        //
+//     shift), where phi(i) is the base 2 radical inverse of the index i, so  //
+//     that the first 2^m points, for every m, form the rank-1 lattice with   //
+//     2^m points and generating vector z mod 2^m; the number of points can   //
+//     thus be doubled without discarding those already used.                 //
+//                                                                            //
+//     The quality of the lattice depends entirely on z[].  Published         //
+//     generating vectors constructed component by component for embedded     //
+//     lattices in base 2 may be used, or a Korobov vector tuned for a given  //
+//     number of points may be computed by Lattice_Sequence_Korobov_Vector(). //
+//     The components of z[] should be odd.                                   //
+//                                                                            //
+//     If state is not NULL, a uniformly distributed random shift is drawn    //
+//     from state; independent shifts give independent unbiased estimates     //
+//     from which an error estimate can be formed, and a shifted lattice does //
+//     not contain the origin.  Otherwise the shift is 0 and the first point  //
+//     is the origin, which callers who transform the points by a quantile    //
+//     function usually skip with Lattice_Sequence_Skip( seq, 1 ).            //
+//                                                                            //
+//  Arguments:                                                                //
+//     Lattice_Sequence *seq                                                  //
+//        The sequence to set up.  Its storage is allocated here and must be  //
+//        released by Lattice_Sequence_Free().                                //
+//     unsigned int z[]                                                       //
+//        The generating vector, of "dimension" elements, which is copied.    //
+//     int dimension                                                          //
+//        The number of coordinates, dimension >= 1.                          //
+//     Random_State *state                                                    //
+//        The generator state from which the random shift is drawn, or NULL   //
+//        for no shift.                                                       //
+//                                                                            //
+//  Return Values:                                                            //
+//     0 on success, -1 if dimension < 1 and -2 if memory could not be        //
+//     allocated.                                                             //
+//                                                                            //
+//  Example:                                                                  //
+//     #define D 10                                                           //
+//     Lattice_Sequence seq;                                                  //
+//     Random_State state;                                                    //
+//     unsigned int z[D];                                                     //
+//                                                                            //
+//     Lattice_Sequence_Korobov_Vector( z, D, 12 );                           //
+//     Random_State_Init( &state, 12345 );                                    //
+//     Lattice_Sequence_Init( &seq, z, D, &state );                           //
+////////////////////////////////////////////////////////////////////////////////
+
+int Lattice_Sequence_Init( Lattice_Sequence *seq, unsigned int z[],
+                                         int dimension, Random_State *state )
+{
+   int j;
+
+   seq->dimension = 0;
+   seq->index = 0;
+   seq->z = NULL;
+   seq->shift = NULL;
+   if ( dimension < 1 ) return -1;
+
+   seq->z = (unsigned int*) malloc( dimension * sizeof(unsigned int) );
+   seq->shift = (double*) malloc( dimension * sizeof(double) );
+   if ( seq->z == NULL || seq->shift == NULL ) {
+      Lattice_Sequence_Free( seq );
+      return -2;
+   }
+   seq->dimension = dimension;
+   for (j = 0; j < dimension; j++) {
+      seq->z[j] = z[j];
+      seq->shift[j] = ( state == NULL ) ? 0.0
+                                        : Uniform_0_1_Random_Variate_r(state);
+   }
+   return 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// void Lattice_Sequence_Next( Lattice_Sequence *seq, double u[] )            //
+//                                                                            //
+//  Description:                                                              //
+//     This function sets u[] to the next point of the sequence and advances  //
+//     the sequence by one point.                                             //
+//                                                                            //
+//  Arguments:                                                                //
+//     Lattice_Sequence *seq                                                  //
+//        A sequence set up by Lattice_Sequence_Init().                       //
+//     double u[]                                                             //
+//        The array of at least seq->dimension elements which is set to the   //
+//        coordinates of the point.                                           //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     Lattice_Sequence seq;                                                  //
+//     double u[10];                                                          //
+//                                                                            //
+//     Lattice_Sequence_Next( &seq, u );                                      //
+////////////////////////////////////////////////////////////////////////////////
+
+void Lattice_Sequence_Next( Lattice_Sequence *seq, double u[] )
+{
+   Lattice_Sequence_Block( seq, u, 1 );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// void Lattice_Sequence_Block( Lattice_Sequence *seq, double u[], int n )    //
+//                                                                            //
+//  Description:                                                              //
+//     This function fills u[] with the next n points of the sequence, stored //
+//     by rows: point i occupies u[i*d], ..., u[i*d + d - 1], where d =       //
+//     seq->dimension.  The radical inverse of the index is formed as a 32    //
+//     bit integer by reversing its bits, and the product with z[j] modulo    //
+//     2^32 is then the exact numerator over 2^32 of frac(phi(i) z[j]).  The  //
+//     sequence has 2^32 points.  Since the transformations of the inversion  //
+//     routines act element by element, the whole block may be passed to them //
+//     at once, e.g. t2_Variate_Inversion_Array( u, x, n * d ).               //
+//                                                                            //
+//  Arguments:                                                                //
+//     Lattice_Sequence *seq                                                  //
+//        A sequence set up by Lattice_Sequence_Init().                       //
+//     double u[]                                                             //
+//        The row-major n x seq->dimension array which is set to the points.  //
+//     int n                                                                  //
+//        The number of points to generate.                                   //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     #define N 4096                                                         //
+//     #define D 10                                                           //
+//     Lattice_Sequence seq;                                                  //
+//     double u[N][D], x[N][D];                                               //
+//                                                                            //
+//     Lattice_Sequence_Block( &seq, &u[0][0], N );                           //
+//     t2_Variate_Inversion_Array( &u[0][0], &x[0][0], N * D );               //
+////////////////////////////////////////////////////////////////////////////////
+
+void Lattice_Sequence_Block( Lattice_Sequence *seq, double u[], int n )
+{
+   int d = seq->dimension;
+   unsigned int phi;
+   double y;
+   int i, j;
+
+   for (i = 0; i < n; i++, u += d) {
+      phi = Bit_Reverse( (unsigned int) seq->index++ );
+      for (j = 0; j < d; j++) {
+         y = (double) (unsigned int) (phi * seq->z[j]) / two_32 + seq->shift[j];
+         u[j] = ( y < 1.0 ) ? y : y - 1.0;
+      }
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// void Lattice_Sequence_Skip( Lattice_Sequence *seq, unsigned long long n )  //
+//                                                                            //
+//  Description:                                                              //
+//     This function advances the sequence by n points without generating     //
+//     them.  Since each point is computed from its index alone the cost is   //
+//     independent of n.  This allows independent processors to generate      //
+//     disjoint blocks of the same sequence.                                  //
+//                                                                            //
+//  Arguments:                                                                //
+//     Lattice_Sequence *seq                                                  //
+//        A sequence set up by Lattice_Sequence_Init().                       //
+//     unsigned long long n                                                   //
+//        The number of points to skip.                                       //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     Lattice_Sequence seq;                                                  //
+//                                                                            //
+//     Lattice_Sequence_Skip( &seq, 1 );                                      //
+////////////////////////////////////////////////////////////////////////////////
+
+void Lattice_Sequence_Skip( Lattice_Sequence *seq, unsigned long long n )
+{
+   seq->index += n;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// void Lattice_Sequence_Free( Lattice_Sequence *seq )                        //
+//                                                                            //
+//  Description:                                                              //
+//     This function releases the storage of a sequence set up by             //
+//     Lattice_Sequence_Init().                                               //
+//                                                                            //
+//  Arguments:                                                                //
+//     Lattice_Sequence *seq                                                  //
+//        The sequence to release.                                            //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     Lattice_Sequence seq;                                                  //
+//                                                                            //
+//     Lattice_Sequence_Free( &seq );                                         //
+////////////////////////////////////////////////////////////////////////////////
+
+void Lattice_Sequence_Free( Lattice_Sequence *seq )
+{
+   free( seq->z );
+   free( seq->shift );
+   seq->z = NULL;
+   seq->shift = NULL;
+   seq->dimension = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// unsigned int Lattice_Sequence_Korobov_Vector( unsigned int z[],            //
+//                                               int dimension, int m )       //
+//                                                                            //
+//  Description:                                                              //
+//     This function sets z[] to the Korobov generating vector z[j] = a^j mod //
+//     2^m, j = 0, ..., dimension - 1, for the rank-1 lattice with N = 2^m    //
+//     points, choosing the odd multiplier a, 1 <= a < N/2, which minimizes   //
+//     the worst-case error                                                   //
+//          P2 = -1 + (1/N) Sum(k) Prod(j) (1 + 2 pi^2 g[j] B2(x[k][j]))      //
+//                                                                            //
+//     of the lattice rule in the weighted Korobov space of smoothness 2 with //
+//     product weights g[j] = 1 / (j + 1)^2, where B2(x) = x^2 - x + 1/6 is   //
+//     the Bernoulli polynomial of degree 2 and x[k][j] = frac(k z[j] / N).   //
+//     The weights make the earlier coordinates more important than the later //
+//     ones, as is usual in applications which order their variables by       //
+//     importance.                                                            //
+//                                                                            //
+//     Each candidate costs N * dimension evaluations, so the search takes    //
+//     O(N^2 dimension) operations and is intended for m <= 16 or so.  The    //
+//     vector is tuned for exactly N points; the sequence may still be        //
+//     extended beyond N points, but it then repeats the lattice with finer   //
+//     shifts.                                                                //
+//                                                                            //
+//  Arguments:                                                                //
+//     unsigned int z[]                                                       //
+//        The array of at least "dimension" elements which is set to the      //
+//        generating vector.                                                  //
+//     int dimension                                                          //
+//        The number of coordinates, dimension >= 1.                          //
+//     int m                                                                  //
+//        The base 2 logarithm of the number of points, 1 <= m <= 31.         //
+//                                                                            //
+//  Return Values:                                                            //
+//     The multiplier a, or 0 if dimension or m is out of range.              //
+//                                                                            //
+//  Example:                                                                  //
+//     #define D 10                                                           //
+//     unsigned int z[D];                                                     //
+//     unsigned int a;                                                        //
+//                                                                            //
+//     a = Lattice_Sequence_Korobov_Vector( z, D, 12 );                       //
+////////////////////////////////////////////////////////////////////////////////
+
+unsigned int Lattice_Sequence_Korobov_Vector( unsigned int z[], int dimension,
+                                                                        int m )
+{
+   unsigned long long N, a, best_a, k, zj;
+   double error, best_error, product, x;
+   int j;
+
+   if ( dimension < 1 || m < 1 || m > 31 ) return 0;
+   N = 1ULL << m;
+   best_a = 1;
+   best_error = 0.0;
+   for (a = 1; a == 1 || a < N / 2; a += 2) {
+      error = 0.0;
+      for (k = 0; k < N; k++) {
+         product = 1.0;
+         for (j = 0, zj = 1; j < dimension; j++, zj = (zj * a) % N) {
+            x = (double) ((k * zj) % N) / (double) N;
+            product *= 1.0 + two_pi_squared * (x * x - x + 1.0 / 6.0)
+                                                / (double) ((j + 1) * (j + 1));
+         }
+         error += product;
+      }
+      error = error / (double) N - 1.0;
+      if ( a == 1 || error < best_error ) {
+         best_error = error;
+         best_a = a;
+      }
+   }
+   for (j = 0, zj = 1; j < dimension; j++, zj = (zj * best_a) % N)
+      z[j] = (unsigned int) zj;
+   return (unsigned int) best_a;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// static unsigned int Bit_Reverse( unsigned int i )                          //
+//                                                                            //
+//  Description:                                                              //
+//     This function reverses the order of the 32 bits of i, so that i / 2^32 //
+//     becomes the base 2 radical inverse of the original i.                  //
+//                                                                            //
+//  Arguments:                                                                //
+//     unsigned int i                                                         //
+//        The integer whose bits are reversed.                                //
+//                                                                            //
+//  Return Values:                                                            //
+//     The integer with the bits of i in reverse order.                       //
+////////////////////////////////////////////////////////////////////////////////
+
+static unsigned int Bit_Reverse( unsigned int i )
+{
+   i = ((i >> 1) & 0x55555555U) | ((i & 0x55555555U) << 1);
+   i = ((i >> 2) & 0x33333333U) | ((i & 0x33333333U) << 2);
+   i = ((i >> 4) & 0x0F0F0F0FU) | ((i & 0x0F0F0F0FU) << 4);
+   i = ((i >> 8) & 0x00FF00FFU) | ((i & 0x00FF00FFU) << 8);
+   return (i >> 16) | (i << 16);
+}
@@ -0,0 +1,31 @@
+////////////////////////////////////////////////////////////////////////////////
+// File: lattice_sequence.h                                                   //
+// Type(s):                                                                   //
+//    Lattice_Sequence                                                        //
+////////////////////////////////////////////////////////////////////////////////
+#ifndef LATTICE_SEQUENCE_H
+#define LATTICE_SEQUENCE_H
+
+////////////////////////////////////////////////////////////////////////////////
+// Lattice_Sequence                                                           //
+//                                                                            //
+//  Description:                                                              //
+//     The state of an extensible rank-1 lattice sequence in "dimension"      //
+//     dimensions, set up by Lattice_Sequence_Init() and released by          //
+//     Lattice_Sequence_Free().                                               //
+//                                                                            //
+//     Point i has coordinates frac(phi(i) z[j] + shift[j]), where phi(i) is  //
+//     the base 2 radical inverse of i and z[] is the generating vector, so   //
+//     that for every m the first 2^m points form a shifted rank-1 lattice    //
+//     with generating vector z[] mod 2^m.  index is the position of the next //
+//     point in the sequence.                                                 //
+////////////////////////////////////////////////////////////////////////////////
+
+typedef struct {
+   int dimension;
+   unsigned long long index;
+   unsigned int *z;
+   double *shift;
+} Lattice_Sequence;
+
+#endif
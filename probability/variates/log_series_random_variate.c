@@ -2,13 +2,21 @@
 // File: log_series_random_variate.c                                          //
 // Routine(s):                                                                //
 //    Log_Series_Random_Variate                                               //
+//    Log_Series_Random_Variate_r                                             //
 ////////////////////////////////////////////////////////////////////////////////
 #include <math.h>                               // required for log()
 
+#include "random_state.h"
+
 //                    Required Externally Defined Routines                    //
 
-double Uniform_0_1_Random_Variate( void );
-        
+extern Random_State* Uniform_0_1_Default_State( void );
+double Uniform_0_1_Random_Variate_r( Random_State *state );
+
+//                    Required Internally Defined Routines                    //
+
+int Log_Series_Random_Variate_r( Random_State *state, double p );
+
 ////////////////////////////////////////////////////////////////////////////////
 // int Log_Series_Random_Variate( double p )                                  //
 //                                                                            //
@@ -37,11 +45,43 @@ double Uniform_0_1_Random_Variate( void );
 
 int Log_Series_Random_Variate( double p )
 {
-   double u = Uniform_0_1_Random_Variate();
+   return Log_Series_Random_Variate_r( Uniform_0_1_Default_State(), p );
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// int Log_Series_Random_Variate_r( Random_State *state, double p )           //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns a random variate from the logarithmic series     //
+//     distribution using Kemp's algorithm with both uniform variates drawn   //
+//     from state.                                                            //
+//                                                                            //
+//  Arguments:                                                                //
+//     Random_State *state                                                    //
+//        The generator state from which the uniform variates are drawn.      //
+//     double p                                                               //
+//        As for Log_Series_Random_Variate().                                 //
+//                                                                            //
+//  Return Values:                                                            //
+//     As for Log_Series_Random_Variate().                                    //
+//                                                                            //
+//  Example:                                                                  //
+//     Random_State state;                                                    //
+//     int x;                                                                 //
+//     double p;                                                              //
+//                                                                            //
+//     Random_State_Init( &state, 12345 );                                    //
+//     x = Log_Series_Random_Variate_r( &state, p );                          //
+////////////////////////////////////////////////////////////////////////////////
+
+int Log_Series_Random_Variate_r( Random_State *state, double p )
+{
+   double u = Uniform_0_1_Random_Variate_r(state);
    double y;
  
    if (u >= p) return 1;
-   y = 1.0 - pow(1.0 - p, Uniform_0_1_Random_Variate());
+   y = 1.0 - pow(1.0 - p, Uniform_0_1_Random_Variate_r(state));
    if (u > y) return 1;
    if (u > y*y) return 2;
    return (int)(1.0 + (log(u) / log(y)));
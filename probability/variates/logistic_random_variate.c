@@ -2,15 +2,23 @@
 // File: logistic_random_variate.c                                            //
 // Routine(s):                                                                //
 //    Logistic_Random_Variate                                                 //
+//    Logistic_Random_Variate_r                                               //
 ////////////////////////////////////////////////////////////////////////////////
 
 #include <math.h> 
 #include <float.h>             // required for DBL_MIN
 
+#include "random_state.h"
+
 //                    Required Externally Defined Routines                    //
 
-double Uniform_0_1_Random_Variate( void );
-        
+extern Random_State* Uniform_0_1_Default_State( void );
+double Uniform_0_1_Random_Variate_r( Random_State *state );
+
+//                    Required Internally Defined Routines                    //
+
+double Logistic_Random_Variate_r( Random_State *state );
+
 ////////////////////////////////////////////////////////////////////////////////
 // double Logistic_Random_Variate( void )                                     //
 //                                                                            //
@@ -35,7 +43,35 @@ double Uniform_0_1_Random_Variate( void );
 
 double Logistic_Random_Variate( void )
 {
-   double u = Uniform_0_1_Random_Variate();
+   return Logistic_Random_Variate_r( Uniform_0_1_Default_State() );
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// double Logistic_Random_Variate_r( Random_State *state )                    //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns a logistic random variate, ln(u / (1-u)), with   //
+//     the uniform variate u drawn from state.                                //
+//                                                                            //
+//  Arguments:                                                                //
+//     Random_State *state                                                    //
+//        The generator state from which the uniform variates are drawn.      //
+//                                                                            //
+//  Return Values:                                                            //
+//     As for Logistic_Random_Variate().                                      //
+//                                                                            //
+//  Example:                                                                  //
+//     Random_State state;                                                    //
+//     double x;                                                              //
+//                                                                            //
+//     Random_State_Init( &state, 12345 );                                    //
+//     x = Logistic_Random_Variate_r( &state );                               //
+////////////////////////////////////////////////////////////////////////////////
+
+double Logistic_Random_Variate_r( Random_State *state )
+{
+   double u = Uniform_0_1_Random_Variate_r(state);
 
    return log (u / (1.0 - u));
 }
@@ -0,0 +1,167 @@
+////////////////////////////////////////////////////////////////////////////////
+// File: multinomial_random_variate.c                                         //
+// Routine(s):                                                                //
+//    Multinomial_Random_Variate                                              //
+//    Multinomial_Random_Variate_r                                            //
+//    Multinomial_Random_Variate_Array                                        //
+////////////////////////////////////////////////////////////////////////////////
+
+#include "random_state.h"
+
+//                    Required Externally Defined Routines                    //
+
+extern Random_State* Uniform_0_1_Default_State( void );
+extern int Binomial_Random_Variate_r( Random_State *state, int n, double p );
+
+//                    Required Internally Defined Routines                    //
+
+void Multinomial_Random_Variate_r( Random_State *state, int x[], int n,
+                                                         double p[], int k );
+
+////////////////////////////////////////////////////////////////////////////////
+// void Multinomial_Random_Variate( int x[], int n, double p[], int k )       //
+//                                                                            //
+//  Description:                                                              //
+//     This function sets x[] to a Multinomial(n; p[0], ..., p[k-1])          //
+//     distributed random vector, the numbers of each of k outcomes in n      //
+//     independent trials, using the conditional binomial method:  x[0] has a //
+//     Binomial(n, p[0]) distribution and, given x[0], ..., x[i-1], x[i] has  //
+//     a Binomial(n - x[0] - ... - x[i-1], p[i] / (p[i] + ... + p[k-1]))      //
+//     distribution.  The method stops as soon as all n trials have been      //
+//     allotted, so it needs at most k - 1 binomial variates.                 //
+//                                                                            //
+//  Arguments:                                                                //
+//     int x[]                                                                //
+//        The vector of at least k elements which is set to the counts, which //
+//        sum to n.                                                           //
+//     int n                                                                  //
+//        The number of trials, n >= 0.                                       //
+//     double p[]                                                             //
+//        The probabilities of the k outcomes, or any nonnegative weights     //
+//        proportional to them, not all zero.                                 //
+//     int k                                                                  //
+//        The number of outcomes, k >= 1.                                     //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     #define K 3                                                            //
+//     int x[K], n;                                                           //
+//     double p[K];                                                           //
+//                                                                            //
+//     Multinomial_Random_Variate( x, n, p, K );                              //
+////////////////////////////////////////////////////////////////////////////////
+
+void Multinomial_Random_Variate( int x[], int n, double p[], int k )
+{
+   Multinomial_Random_Variate_r( Uniform_0_1_Default_State(), x, n, p, k );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// void Multinomial_Random_Variate_r( Random_State *state, int x[], int n,    //
+//                                    double p[], int k )                     //
+//                                                                            //
+//  Description:                                                              //
+//     This function sets x[] to a Multinomial(n; p[0], ..., p[k-1])          //
+//     distributed random vector by the same conditional binomial method as   //
+//     Multinomial_Random_Variate(), drawing the binomial variates from state //
+//     with Binomial_Random_Variate_r().                                      //
+//                                                                            //
+//  Arguments:                                                                //
+//     Random_State *state                                                    //
+//        The generator state from which the variates are drawn.              //
+//     int x[]                                                                //
+//        As for Multinomial_Random_Variate().                                //
+//     int n                                                                  //
+//        As for Multinomial_Random_Variate().                                //
+//     double p[]                                                             //
+//        As for Multinomial_Random_Variate().                                //
+//     int k                                                                  //
+//        As for Multinomial_Random_Variate().                                //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     #define K 3                                                            //
+//     Random_State state;                                                    //
+//     int x[K], n;                                                           //
+//     double p[K];                                                           //
+//                                                                            //
+//     Random_State_Init( &state, 12345 );                                    //
+//     Multinomial_Random_Variate_r( &state, x, n, p, K );                    //
+////////////////////////////////////////////////////////////////////////////////
+
+void Multinomial_Random_Variate_r( Random_State *state, int x[], int n,
+                                                         double p[], int k )
+{
+   double remaining = 0.0;
+   double q;
+   int i;
+
+   for (i = 0; i < k; i++) remaining += p[i];
+   for (i = 0; i < k - 1; i++) {
+      if ( n == 0 ) x[i] = 0;
+      else {
+         q = p[i] / remaining;
+         if ( q >= 1.0 ) x[i] = n;
+         else if ( q <= 0.0 ) x[i] = 0;
+         else x[i] = Binomial_Random_Variate_r(state, n, q);
+         n -= x[i];
+      }
+      remaining -= p[i];
+   }
+   x[k - 1] = n;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// void Multinomial_Random_Variate_Array( Random_State *state, int x[],       //
+//                                        int size, int n, double p[],        //
+//                                        int k )                             //
+//                                                                            //
+//  Description:                                                              //
+//     This function fills x[] with "size" Multinomial(n; p[0], ..., p[k-1])  //
+//     distributed random vectors, stored by rows: vector i occupies x[i*k],  //
+//     ..., x[i*k + k - 1].  Each row is generated by                         //
+//     Multinomial_Random_Variate_r(); the number of trials left to allot     //
+//     differs from row to row, so there is nothing which could be prepared   //
+//     once for the whole array.                                              //
+//                                                                            //
+//  Arguments:                                                                //
+//     Random_State *state                                                    //
+//        The generator state from which the variates are drawn.              //
+//     int x[]                                                                //
+//        The row-major "size" x k array which is set to the counts.          //
+//     int size                                                               //
+//        The number of vectors to generate.                                  //
+//     int n                                                                  //
+//        The number of trials, n >= 0.                                       //
+//     double p[]                                                             //
+//        The probabilities of the k outcomes, or any nonnegative weights     //
+//        proportional to them, not all zero.                                 //
+//     int k                                                                  //
+//        The number of outcomes, k >= 1.                                     //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     #define M 1000                                                         //
+//     #define K 3                                                            //
+//     Random_State state;                                                    //
+//     int x[M][K], n;                                                        //
+//     double p[K];                                                           //
+//                                                                            //
+//     Random_State_Init( &state, 12345 );                                    //
+//     Multinomial_Random_Variate_Array( &state, &x[0][0], M, n, p, K );      //
+////////////////////////////////////////////////////////////////////////////////
+
+void Multinomial_Random_Variate_Array( Random_State *state, int x[], int size,
+                                                  int n, double p[], int k )
+{
+   int i;
+
+   for (i = 0; i < size; i++, x += k)
+      Multinomial_Random_Variate_r(state, x, n, p, k);
+}
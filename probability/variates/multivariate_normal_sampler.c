@@ -0,0 +1,299 @@
+////////////////////////////////////////////////////////////////////////////////
+// File: multivariate_normal_sampler.c                                        //
+// Routine(s):                                                                //
+//    Multivariate_Normal_Sampler_Init                                        //
+//    Multivariate_Normal_Sampler_Variate                                     //
+//    Multivariate_Normal_Sampler_Variate_r                                   //
+//    Multivariate_Normal_Sampler_Variate_Array                               //
+//    Multivariate_Normal_Sampler_Free                                        //
+////////////////////////////////////////////////////////////////////////////////
+
+#include <stdlib.h>                         // required for malloc(), free()
+#include <math.h>                           // required for sqrt()
+
+#include "random_state.h"
+#include "multivariate_normal_sampler.h"
+
+//                    Required Externally Defined Routines                    //
+
+extern Random_State* Uniform_0_1_Default_State( void );
+extern void Gaussian_Variate_Marsaglias_Ziggurat_Array( Random_State *state,
+                                                           double x[], int n );
+
+//                    Required Internally Defined Routines                    //
+
+void Multivariate_Normal_Sampler_Variate_r( Random_State *state, double x[],
+                                   const Multivariate_Normal_Sampler *sampler );
+void Multivariate_Normal_Sampler_Free( Multivariate_Normal_Sampler *sampler );
+static void Transform( double x[], const Multivariate_Normal_Sampler *s );
+
+#define BLOCK 4096
+
+////////////////////////////////////////////////////////////////////////////////
+//int Multivariate_Normal_Sampler_Init( Multivariate_Normal_Sampler *sampler, //
+//                               double mean[], double covariance[], int n )  //
+//                                                                            //
+//  Description:                                                              //
+//     This function prepares sampler to generate variates with the n         //
+//     dimensional normal distribution with mean vector mean[] and covariance //
+//     matrix covariance[].  The Cholesky factorization covariance = L L' is  //
+//     computed once here, so that each variate thereafter costs n standard   //
+//     Gaussian variates and n (n + 1) / 2 multiply-adds.                     //
+//                                                                            //
+//  Arguments:                                                                //
+//     Multivariate_Normal_Sampler *sampler                                   //
+//        The sampler to prepare.  Its storage is allocated here and must be  //
+//        released by Multivariate_Normal_Sampler_Free().                     //
+//     double mean[]                                                          //
+//        The mean vector, of n elements.  If mean is NULL the mean is taken  //
+//        to be the zero vector.                                              //
+//     double covariance[]                                                    //
+//        The covariance matrix, an n x n symmetric positive definite matrix  //
+//        stored by rows.  Only the lower triangle, covariance[i*n + j] for j //
+//        <= i, is referenced.                                                //
+//     int n                                                                  //
+//        The dimension, n >= 1.                                              //
+//                                                                            //
+//  Return Values:                                                            //
+//     0 on success, -1 if n < 1 or the covariance matrix is not positive     //
+//     definite, and -2 if memory could not be allocated.  After a return of  //
+//     -1 or -2 the sampler is empty and Multivariate_Normal_Sampler_Free()   //
+//     may still be called.                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     #define N 3                                                            //
+//     Multivariate_Normal_Sampler sampler;                                   //
+//     double mean[N], covariance[N][N];                                      //
+//                                                                            //
+//     Multivariate_Normal_Sampler_Init( &sampler, mean, &covariance[0][0],   //
+//                                                                   N );     //
+////////////////////////////////////////////////////////////////////////////////
+
+int Multivariate_Normal_Sampler_Init( Multivariate_Normal_Sampler *sampler,
+                                double mean[], double covariance[], int n )
+{
+   double *lower;
+   double *row_i, *row_j;
+   double sum;
+   int i, j, k;
+
+   sampler->dimension = 0;
+   sampler->mean = NULL;
+   sampler->lower = NULL;
+   if ( n < 1 ) return -1;
+
+   sampler->mean = (double*) malloc( n * sizeof(double) );
+   sampler->lower = (double*) malloc( (n * (n + 1) / 2) * sizeof(double) );
+   if ( sampler->mean == NULL || sampler->lower == NULL ) {
+      Multivariate_Normal_Sampler_Free( sampler );
+      return -2;
+   }
+   for (i = 0; i < n; i++) sampler->mean[i] = (mean == NULL) ? 0.0 : mean[i];
+
+             // Cholesky-Banachiewicz factorization, row by row. //
+
+   lower = sampler->lower;
+   for (i = 0, row_i = lower; i < n; row_i += ++i) {
+      for (j = 0, row_j = lower; j <= i; row_j += ++j) {
+         sum = covariance[i * n + j];
+         for (k = 0; k < j; k++) sum -= row_i[k] * row_j[k];
+         if ( j < i ) row_i[j] = sum / row_j[j];
+         else if ( sum > 0.0 ) row_i[i] = sqrt(sum);
+         else {
+            Multivariate_Normal_Sampler_Free( sampler );
+            return -1;
+         }
+      }
+   }
+   sampler->dimension = n;
+   return 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//void Multivariate_Normal_Sampler_Variate( double x[],                       //
+//                              const Multivariate_Normal_Sampler *sampler )  //
+//                                                                            //
+//  Description:                                                              //
+//     This function sets x[] to a variate with the multivariate normal       //
+//     distribution of sampler, see Multivariate_Normal_Sampler_Variate_r(),  //
+//     drawing from the library's default generator state.                    //
+//                                                                            //
+//  Arguments:                                                                //
+//     double x[]                                                             //
+//        The vector of at least sampler->dimension elements which is set to  //
+//        the variate.                                                        //
+//     const Multivariate_Normal_Sampler *sampler                             //
+//        A sampler prepared by Multivariate_Normal_Sampler_Init().           //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     #define N 3                                                            //
+//     Multivariate_Normal_Sampler sampler;                                   //
+//     double x[N];                                                           //
+//                                                                            //
+//     Multivariate_Normal_Sampler_Variate( x, &sampler );                    //
+////////////////////////////////////////////////////////////////////////////////
+
+void Multivariate_Normal_Sampler_Variate( double x[],
+                                   const Multivariate_Normal_Sampler *sampler )
+{
+   Multivariate_Normal_Sampler_Variate_r( Uniform_0_1_Default_State(), x,
+                                                                    sampler );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//void Multivariate_Normal_Sampler_Variate_r( Random_State *state,            //
+//                  double x[], const Multivariate_Normal_Sampler *sampler )  //
+//                                                                            //
+//  Description:                                                              //
+//     This function sets x[] to a variate with the multivariate normal       //
+//     distribution of sampler.  A vector z of independent standard Gaussian  //
+//     variates is generated by the ziggurat method and x = mean + L z, where //
+//     L is the Cholesky factor of the covariance matrix.                     //
+//                                                                            //
+//  Arguments:                                                                //
+//     Random_State *state                                                    //
+//        The generator state from which the Gaussian variates are drawn.     //
+//     double x[]                                                             //
+//        The vector of at least sampler->dimension elements which is set to  //
+//        the variate.                                                        //
+//     const Multivariate_Normal_Sampler *sampler                             //
+//        A sampler prepared by Multivariate_Normal_Sampler_Init().           //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     #define N 3                                                            //
+//     Multivariate_Normal_Sampler sampler;                                   //
+//     Random_State state;                                                    //
+//     double x[N];                                                           //
+//                                                                            //
+//     Random_State_Init( &state, 12345 );                                    //
+//     Multivariate_Normal_Sampler_Variate_r( &state, x, &sampler );          //
+////////////////////////////////////////////////////////////////////////////////
+
+void Multivariate_Normal_Sampler_Variate_r( Random_State *state, double x[],
+                                    const Multivariate_Normal_Sampler *sampler )
+{
+   Gaussian_Variate_Marsaglias_Ziggurat_Array(state, x, sampler->dimension);
+   Transform(x, sampler);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//void Multivariate_Normal_Sampler_Variate_Array( Random_State *state,        //
+//        double x[], int size, const Multivariate_Normal_Sampler *sampler )  //
+//                                                                            //
+//  Description:                                                              //
+//     This function fills x[] with "size" variates with the multivariate     //
+//     normal distribution of sampler, stored by rows: variate i occupies     //
+//     x[i*n], ..., x[i*n + n - 1], where n = sampler->dimension.  The rows   //
+//     are generated in blocks of about BLOCK elements; the standard Gaussian //
+//     variates of a block are written straight into x[] by                   //
+//     Gaussian_Variate_Marsaglias_Ziggurat_Array() and each row is then      //
+//     transformed in place while the block is still in the cache.            //
+//                                                                            //
+//  Arguments:                                                                //
+//     Random_State *state                                                    //
+//        The generator state from which the Gaussian variates are drawn.     //
+//     double x[]                                                             //
+//        The row-major "size" x n array which is set to the variates.        //
+//     int size                                                               //
+//        The number of variates to generate.                                 //
+//     const Multivariate_Normal_Sampler *sampler                             //
+//        A sampler prepared by Multivariate_Normal_Sampler_Init().           //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     #define M 1000                                                         //
+//     #define N 3                                                            //
+//     Multivariate_Normal_Sampler sampler;                                   //
+//     Random_State state;                                                    //
+//     double x[M][N];                                                        //
+//                                                                            //
+//     Random_State_Init( &state, 12345 );                                    //
+//     Multivariate_Normal_Sampler_Variate_Array( &state, &x[0][0], M,        //
+//                                                           &sampler );      //
+////////////////////////////////////////////////////////////////////////////////
+
+void Multivariate_Normal_Sampler_Variate_Array( Random_State *state,
+         double x[], int size, const Multivariate_Normal_Sampler *sampler )
+{
+   int n = sampler->dimension;
+   int rows = (n < BLOCK) ? BLOCK / n : 1;
+   int i, j, m;
+
+   for (i = 0; i < size; i += m) {
+      m = (size - i < rows) ? size - i : rows;
+      Gaussian_Variate_Marsaglias_Ziggurat_Array(state, &x[i * n], m * n);
+      for (j = 0; j < m; j++) Transform(&x[(i + j) * n], sampler);
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// void Multivariate_Normal_Sampler_Free(                                     //
+//                                     Multivariate_Normal_Sampler *sampler ) //
+//                                                                            //
+//  Description:                                                              //
+//     This function releases the storage of a sampler prepared by            //
+//     Multivariate_Normal_Sampler_Init() and leaves it empty.                //
+//                                                                            //
+//  Arguments:                                                                //
+//     Multivariate_Normal_Sampler *sampler                                   //
+//        The sampler to release.                                             //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     Multivariate_Normal_Sampler sampler;                                   //
+//                                                                            //
+//     Multivariate_Normal_Sampler_Free( &sampler );                          //
+////////////////////////////////////////////////////////////////////////////////
+
+void Multivariate_Normal_Sampler_Free( Multivariate_Normal_Sampler *sampler )
+{
+   free( sampler->mean );
+   free( sampler->lower );
+   sampler->mean = NULL;
+   sampler->lower = NULL;
+   sampler->dimension = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// static void Transform( double x[], const Multivariate_Normal_Sampler *s )  //
+//                                                                            //
+//  Description:                                                              //
+//     This function replaces the vector z in x[] by mean + L z.  Since L is  //
+//     lower triangular, component i of the result depends only on z[0], ..., //
+//     z[i], so the components are computed from the last to the first and    //
+//     each may overwrite z[i].                                               //
+//                                                                            //
+//  Arguments:                                                                //
+//     double x[]                                                             //
+//        On input the vector z of standard Gaussian variates, on output mean //
+//        + L z.                                                              //
+//     const Multivariate_Normal_Sampler *s                                   //
+//        A sampler prepared by Multivariate_Normal_Sampler_Init().           //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+////////////////////////////////////////////////////////////////////////////////
+
+static void Transform( double x[], const Multivariate_Normal_Sampler *s )
+{
+   const double *row;
+   double sum;
+   int i, j;
+
+   for (i = s->dimension - 1; i >= 0; i--) {
+      row = &s->lower[i * (i + 1) / 2];
+      sum = s->mean[i];
+      for (j = 0; j <= i; j++) sum += row[j] * x[j];
+      x[i] = sum;
+   }
+}
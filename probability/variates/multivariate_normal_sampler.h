@@ -0,0 +1,30 @@
+////////////////////////////////////////////////////////////////////////////////
+// File: multivariate_normal_sampler.h                                        //
+// Type(s):                                                                   //
+//    Multivariate_Normal_Sampler                                             //
+////////////////////////////////////////////////////////////////////////////////
+#ifndef MULTIVARIATE_NORMAL_SAMPLER_H
+#define MULTIVARIATE_NORMAL_SAMPLER_H
+
+////////////////////////////////////////////////////////////////////////////////
+// Multivariate_Normal_Sampler                                                //
+//                                                                            //
+//  Description:                                                              //
+//     The mean vector and the Cholesky factor of the covariance matrix of a  //
+//     multivariate normal distribution in "dimension" dimensions, computed   //
+//     once by Multivariate_Normal_Sampler_Init() and released by             //
+//     Multivariate_Normal_Sampler_Free().                                    //
+//                                                                            //
+//     mean[] has "dimension" elements.  lower[] is the lower triangular      //
+//     matrix L, with L L' the covariance matrix, stored by rows without the  //
+//     zeros above the diagonal, so that L[i][j], j <= i, is lower[i (i + 1)  //
+//     / 2 + j].                                                              //
+////////////////////////////////////////////////////////////////////////////////
+
+typedef struct {
+   int dimension;
+   double *mean;
+   double *lower;
+} Multivariate_Normal_Sampler;
+
+#endif
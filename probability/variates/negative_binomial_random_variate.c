@@ -2,14 +2,22 @@
 // File: negative_binomial_random_variate.c                                   //
 // Routine(s):                                                                //
 //    Negative_Binomial_Random_Variate                                        //
+//    Negative_Binomial_Random_Variate_r                                      //
 ////////////////////////////////////////////////////////////////////////////////
 
 #include <math.h>                    // required for log()
 
+#include "random_state.h"
+
 //                    Required Externally Defined Routines                    //
 
-extern double Gamma_Random_Variate( double a );
-extern int Poisson_Random_Variate( double mu );
+extern Random_State* Uniform_0_1_Default_State( void );
+extern double Gamma_Random_Variate_r( Random_State *state, double a );
+extern int Poisson_Random_Variate_r( Random_State *state, double mu );
+
+//                    Required Internally Defined Routines                    //
+
+int Negative_Binomial_Random_Variate_r( Random_State *state, int n, double p );
 
 ////////////////////////////////////////////////////////////////////////////////
 // int Negative_Binomial_Random_Variate( int n, double p )                    //
@@ -42,7 +50,42 @@ extern int Poisson_Random_Variate( double mu );
         
 int Negative_Binomial_Random_Variate( int n, double p )
 {
-   double y = Gamma_Random_Variate( (double)n );
+   return Negative_Binomial_Random_Variate_r(Uniform_0_1_Default_State(), n, p);
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// int Negative_Binomial_Random_Variate_r( Random_State *state, int n,        //
+//                                         double p )                         //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns a negative binomial random variate as a Poisson  //
+//     variate whose mean is a scaled gamma variate.  Both the gamma and the  //
+//     Poisson variate are drawn from state.                                  //
+//                                                                            //
+//  Arguments:                                                                //
+//     Random_State *state                                                    //
+//        The generator state from which the uniform variates are drawn.      //
+//     int n                                                                  //
+//        As for Negative_Binomial_Random_Variate().                          //
+//     double p                                                               //
+//        As for Negative_Binomial_Random_Variate().                          //
+//                                                                            //
+//  Return Values:                                                            //
+//     As for Negative_Binomial_Random_Variate().                             //
+//                                                                            //
+//  Example:                                                                  //
+//     Random_State state;                                                    //
+//     int x, n;                                                              //
+//     double p;                                                              //
+//                                                                            //
+//     Random_State_Init( &state, 12345 );                                    //
+//     x = Negative_Binomial_Random_Variate_r( &state, n, p );                //
+////////////////////////////////////////////////////////////////////////////////
+
+int Negative_Binomial_Random_Variate_r( Random_State *state, int n, double p )
+{
+   double y = Gamma_Random_Variate_r( state, (double)n );
 
-   return Poisson_Random_Variate( (1.0 - p) * y / p ); 
+   return Poisson_Random_Variate_r( state, (1.0 - p) * y / p ); 
 }
@@ -2,13 +2,21 @@
 // File: pareto_random_variate.c                                              //
 // Routine(s):                                                                //
 //    Pareto_Random_Variate                                                   //
+//    Pareto_Random_Variate_r                                                 //
 ////////////////////////////////////////////////////////////////////////////////
 
+#include "random_state.h"
+
 //                    Required Externally Defined Routines                    //
 
-double Gamma_Random_Variate( double a );
-double Exponential_Random_Variate( void );
-        
+extern Random_State* Uniform_0_1_Default_State( void );
+double Gamma_Random_Variate_r( Random_State *state, double a );
+double Exponential_Random_Variate_r( Random_State *state );
+
+//                    Required Internally Defined Routines                    //
+
+double Pareto_Random_Variate_r( Random_State *state, double a );
+
 ////////////////////////////////////////////////////////////////////////////////
 // double Pareto_Random_Variate( double a )                                   //
 //                                                                            //
@@ -34,8 +42,39 @@ double Exponential_Random_Variate( void );
 
 double Pareto_Random_Variate( double a )
 {
-   double e = Exponential_Random_Variate();
-   double g = Gamma_Random_Variate(a);
+   return Pareto_Random_Variate_r( Uniform_0_1_Default_State(), a );
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// double Pareto_Random_Variate_r( Random_State *state, double a )            //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns a Pareto distributed random variate, 1 + e / g,  //
+//     where the exponential variate e and the gamma variate g are drawn from //
+//     state.                                                                 //
+//                                                                            //
+//  Arguments:                                                                //
+//     Random_State *state                                                    //
+//        The generator state from which the uniform variates are drawn.      //
+//     double a                                                               //
+//        As for Pareto_Random_Variate().                                     //
+//                                                                            //
+//  Return Values:                                                            //
+//     As for Pareto_Random_Variate().                                        //
+//                                                                            //
+//  Example:                                                                  //
+//     Random_State state;                                                    //
+//     double x, a;                                                           //
+//                                                                            //
+//     Random_State_Init( &state, 12345 );                                    //
+//     x = Pareto_Random_Variate_r( &state, a );                              //
+////////////////////////////////////////////////////////////////////////////////
+
+double Pareto_Random_Variate_r( Random_State *state, double a )
+{
+   double e = Exponential_Random_Variate_r(state);
+   double g = Gamma_Random_Variate_r(state, a);
 
    return 1.0 + e / g;
 }
@@ -2,18 +2,32 @@
 // File: poisson_random_variate.c                                             //
 // Routine(s):                                                                //
 //    Poisson_Random_Variate                                                  //
+//    Poisson_Random_Variate_r                                                //
+//    Poisson_Random_Variate_Array                                            //
 ////////////////////////////////////////////////////////////////////////////////
 
-//                    Required Externally Defined Routines                    //
+#include <math.h>                             // required for exp()
+
+#include "random_state.h"
+#include "poisson_sampler.h"
 
-double Exponential_Random_Variate( void );
-double Gamma_Random_Variate( double a );
-int    Binomial_Random_Variate( int n, double p );
+//                    Required Externally Defined Routines                    //
 
+extern Random_State* Uniform_0_1_Default_State( void );
+double Exponential_Random_Variate_r( Random_State *state );
+double Gamma_Random_Variate_r( Random_State *state, double a );
+int    Binomial_Random_Variate_r( Random_State *state, int n, double p );
+double Uniform_0_1_Random_Variate_r( Random_State *state );
+void   Poisson_Sampler_Init( Poisson_Sampler *sampler, double mu );
+int    Poisson_Sampler_Variate_r( Random_State *state,
+                                              const Poisson_Sampler *sampler );
+void   Poisson_Sampler_Variate_Array( Random_State *state, int x[], int n,
+                                              const Poisson_Sampler *sampler );
 
 //                    Required Internally Defined Routines                    //
 
-static int Inter_Arrival_Time( double mu );
+int Poisson_Random_Variate_r( Random_State *state, double mu );
+static int Inter_Arrival_Time( Random_State *state, double mu );
 
 #define THRESHOLD 6
 
@@ -41,27 +55,70 @@ static int Inter_Arrival_Time( double mu );
 ////////////////////////////////////////////////////////////////////////////////
 
 int Poisson_Random_Variate( double mu )
+{
+   return Poisson_Random_Variate_r( Uniform_0_1_Default_State(), mu );
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// int Poisson_Random_Variate_r( Random_State *state, double mu )             //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns a Poisson distributed random variate with mean   //
+//     mu by the same recursive method as Poisson_Random_Variate(), drawing   //
+//     all of the intermediate gamma, binomial and exponential variates from  //
+//     state.  If mu >= POISSON_PTRS_THRESHOLD the PTRS algorithm of          //
+//     Poisson_Sampler_Variate_r() is used instead, its constants being       //
+//     computed for this call only; use a Poisson_Sampler to generate many    //
+//     variates with the same mean.                                           //
+//                                                                            //
+//  Arguments:                                                                //
+//     Random_State *state                                                    //
+//        The generator state from which the uniform variates are drawn.      //
+//     double mu                                                              //
+//        As for Poisson_Random_Variate().                                    //
+//                                                                            //
+//  Return Values:                                                            //
+//     As for Poisson_Random_Variate().                                       //
+//                                                                            //
+//  Example:                                                                  //
+//     Random_State state;                                                    //
+//     int x;                                                                 //
+//     double mu;                                                             //
+//                                                                            //
+//     Random_State_Init( &state, 12345 );                                    //
+//     x = Poisson_Random_Variate_r( &state, mu );                            //
+////////////////////////////////////////////////////////////////////////////////
+
+int Poisson_Random_Variate_r( Random_State *state, double mu )
 {
    double g;
    int x;
    int n;
  
-   if (mu <= THRESHOLD) return Inter_Arrival_Time(mu);
+   if (mu <= THRESHOLD) return Inter_Arrival_Time(state, mu);
+   if (mu >= POISSON_PTRS_THRESHOLD) {
+      Poisson_Sampler sampler;
+      Poisson_Sampler_Init(&sampler, mu);
+      return Poisson_Sampler_Variate_r(state, &sampler);
+   }
    n = (int) (0.5 * mu);
-   g = Gamma_Random_Variate( (double) n );
-   if ( g <= mu ) return n + Poisson_Random_Variate(mu - g);
-   return Binomial_Random_Variate(n-1, mu / g);
+   g = Gamma_Random_Variate_r( state, (double) n );
+   if ( g <= mu ) return n + Poisson_Random_Variate_r(state, mu - g);
+   return Binomial_Random_Variate_r(state, n-1, mu / g);
 }
 
 
 ////////////////////////////////////////////////////////////////////////////////
-// static int Inter_Arrival_Time( double mu )                                 //
+// static int Inter_Arrival_Time( Random_State *state, double mu )            //
 //                                                                            //
 //  Description:                                                              //
 //     This function returns a Poisson distributed random variate with mean   //
 //     mu using the sum of exponential random variates.                       //
 //                                                                            //
 //  Arguments:                                                                //
+//     Random_State *state                                                    //
+//            The generator state from which the variates are drawn.          //
 //     double mu                                                              //
 //            The mean of the Poisson distibution: mu^x exp(-mu) / x!.        //
 //                                                                            //
@@ -71,17 +128,83 @@ int Poisson_Random_Variate( double mu )
 //  Example:                                                                  //
 //     double mu;                                                             //
 //                                                                            //
-//     Inter_Arrival_Time( mu );                                              //
+//     Inter_Arrival_Time( state, mu );                                       //
 ////////////////////////////////////////////////////////////////////////////////
 
-static int Inter_Arrival_Time( double mu )
+static int Inter_Arrival_Time( Random_State *state, double mu )
 {
    int x = 0;
    double sum = 0.0;
   
    while (sum <= mu) {
       x++;
-      sum += Exponential_Random_Variate();
+      sum += Exponential_Random_Variate_r(state);
    }
    return x - 1;
 }
+
+
+////////////////////////////////////////////////////////////////////////////////
+// void Poisson_Random_Variate_Array( Random_State *state, int x[], int n,    //
+//                                                                double mu ) //
+//                                                                            //
+//  Description:                                                              //
+//     This function fills the array x[] with n Poisson distributed random    //
+//     variates with mean mu.  The comparison of mu with THRESHOLD is made    //
+//     once for the whole array.  For mu <= THRESHOLD, exp(-mu) is computed   //
+//     once and each variate is the number of uniform variates whose running  //
+//     product stays above exp(-mu), which is equivalent to the inter-arrival //
+//     time method but requires no logarithms.  For mu >=                     //
+//     POISSON_PTRS_THRESHOLD the constants of the PTRS algorithm are         //
+//     computed once and the array is filled by                               //
+//     Poisson_Sampler_Variate_Array().  In between each variate is generated //
+//     by Poisson_Random_Variate_r().                                         //
+//                                                                            //
+//  Arguments:                                                                //
+//     Random_State *state                                                    //
+//            The generator state from which the uniform variates are drawn.  //
+//     int    x[]                                                             //
+//            The array of at least n elements which is set to the variates.  //
+//     int    n                                                               //
+//            The number of variates to generate.                             //
+//     double mu                                                              //
+//            The mean of the Poisson distribution, mu > 0.                   //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     #define N 1000                                                         //
+//     Random_State state;                                                    //
+//     int x[N];                                                              //
+//     double mu;                                                             //
+//                                                                            //
+//     Random_State_Init( &state, 12345 );                                    //
+//     Poisson_Random_Variate_Array( &state, x, N, mu );                      //
+////////////////////////////////////////////////////////////////////////////////
+
+void Poisson_Random_Variate_Array( Random_State *state, int x[], int n,
+                                                                     double mu )
+{
+   double exp_mu;
+   double product;
+   int i, k;
+
+   if (mu >= POISSON_PTRS_THRESHOLD) {
+      Poisson_Sampler sampler;
+      Poisson_Sampler_Init(&sampler, mu);
+      Poisson_Sampler_Variate_Array(state, x, n, &sampler);
+      return;
+   }
+   if (mu > THRESHOLD) {
+      for (i = 0; i < n; i++) x[i] = Poisson_Random_Variate_r(state, mu);
+      return;
+   }
+   exp_mu = exp(-mu);
+   for (i = 0; i < n; i++) {
+      product = Uniform_0_1_Random_Variate_r(state);
+      for (k = 0; product > exp_mu; k++)
+         product *= Uniform_0_1_Random_Variate_r(state);
+      x[i] = k;
+   }
+}
@@ -0,0 +1,221 @@
+////////////////////////////////////////////////////////////////////////////////
+// File: poisson_sampler.c                                                    //
+// Routine(s):                                                                //
+//    Poisson_Sampler_Init                                                    //
+//    Poisson_Sampler_Variate                                                 //
+//    Poisson_Sampler_Variate_r                                               //
+//    Poisson_Sampler_Variate_Array                                           //
+////////////////////////////////////////////////////////////////////////////////
+
+#include <math.h>                    // required for floor(), log(), sqrt()
+
+#include "random_state.h"
+#include "poisson_sampler.h"
+
+//                    Required Externally Defined Routines                    //
+
+extern Random_State* Uniform_0_1_Default_State( void );
+extern double Uniform_0_1_Random_Variate_r( Random_State *state );
+extern int Poisson_Random_Variate_r( Random_State *state, double mu );
+extern double Ln_Factorial( int n );
+
+//                    Required Internally Defined Routines                    //
+
+int Poisson_Sampler_Variate_r( Random_State *state,
+                                              const Poisson_Sampler *sampler );
+static int PTRS( Random_State *state, const Poisson_Sampler *s );
+
+////////////////////////////////////////////////////////////////////////////////
+// void Poisson_Sampler_Init( Poisson_Sampler *sampler, double mu )           //
+//                                                                            //
+//  Description:                                                              //
+//     This function prepares sampler to generate Poisson distributed         //
+//     variates with mean mu.  If mu >= POISSON_PTRS_THRESHOLD the constants  //
+//     of Hormann's PTRS algorithm are computed, otherwise the sampler defers //
+//     to Poisson_Random_Variate_r(), whose inter-arrival time method is      //
+//     faster for small means.  The threshold was chosen by timing both       //
+//     methods; it is also the smallest mean for which PTRS is valid.  Above  //
+//     it PTRS needs on average fewer than 2.3 uniform variates whatever mu,  //
+//     whereas the recursive method of Poisson_Random_Variate_r() draws a     //
+//     gamma and a binomial variate at each of about log2(mu) levels.         //
+//                                                                            //
+//  Arguments:                                                                //
+//     Poisson_Sampler *sampler                                               //
+//        The sampler to prepare.                                             //
+//     double mu                                                              //
+//        The mean of the Poisson distribution, mu > 0.                       //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     Poisson_Sampler sampler;                                               //
+//     double mu;                                                             //
+//                                                                            //
+//     Poisson_Sampler_Init( &sampler, mu );                                  //
+////////////////////////////////////////////////////////////////////////////////
+
+void Poisson_Sampler_Init( Poisson_Sampler *sampler, double mu )
+{
+   sampler->mu = mu;
+   sampler->ptrs = ( mu >= POISSON_PTRS_THRESHOLD );
+   if ( !sampler->ptrs ) return;
+
+   sampler->ln_mu = log(mu);
+   sampler->b = 0.931 + 2.53 * sqrt(mu);
+   sampler->a = -0.059 + 0.02483 * sampler->b;
+   sampler->ln_inverse_alpha = log(1.1239 + 1.1328 / (sampler->b - 3.4));
+   sampler->vr = 0.9277 - 3.6224 / (sampler->b - 2.0);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// int Poisson_Sampler_Variate( const Poisson_Sampler *sampler )              //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns a Poisson distributed random variate with the    //
+//     mean given to Poisson_Sampler_Init(), drawing from the library's       //
+//     default generator state.                                               //
+//                                                                            //
+//  Arguments:                                                                //
+//     const Poisson_Sampler *sampler                                         //
+//        A sampler prepared by Poisson_Sampler_Init().                       //
+//                                                                            //
+//  Return Values:                                                            //
+//     A Poisson distributed random quantity.                                 //
+//                                                                            //
+//  Example:                                                                  //
+//     Poisson_Sampler sampler;                                               //
+//     int x;                                                                 //
+//                                                                            //
+//     x = Poisson_Sampler_Variate( &sampler );                               //
+////////////////////////////////////////////////////////////////////////////////
+
+int Poisson_Sampler_Variate( const Poisson_Sampler *sampler )
+{
+   return Poisson_Sampler_Variate_r( Uniform_0_1_Default_State(), sampler );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// int Poisson_Sampler_Variate_r( Random_State *state,                        //
+//                                const Poisson_Sampler *sampler )            //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns a Poisson distributed random variate with the    //
+//     mean given to Poisson_Sampler_Init(), using the PTRS algorithm if the  //
+//     sampler was prepared for it and Poisson_Random_Variate_r() otherwise.  //
+//     All uniform variates are drawn from state.                             //
+//                                                                            //
+//  Arguments:                                                                //
+//     Random_State *state                                                    //
+//        The generator state from which the uniform variates are drawn.      //
+//     const Poisson_Sampler *sampler                                         //
+//        A sampler prepared by Poisson_Sampler_Init().                       //
+//                                                                            //
+//  Return Values:                                                            //
+//     A Poisson distributed random quantity.                                 //
+//                                                                            //
+//  Example:                                                                  //
+//     Poisson_Sampler sampler;                                               //
+//     Random_State state;                                                    //
+//     int x;                                                                 //
+//                                                                            //
+//     Random_State_Init( &state, 12345 );                                    //
+//     x = Poisson_Sampler_Variate_r( &state, &sampler );                     //
+////////////////////////////////////////////////////////////////////////////////
+
+int Poisson_Sampler_Variate_r( Random_State *state,
+                                               const Poisson_Sampler *sampler )
+{
+   if ( !sampler->ptrs ) return Poisson_Random_Variate_r(state, sampler->mu);
+   return PTRS(state, sampler);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// static int PTRS( Random_State *state, const Poisson_Sampler *s )           //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns a Poisson distributed random variate with mean   //
+//     mu >= 10 using Hormann's transformed rejection method with squeeze.  A //
+//     pair of uniform variates (u, v) is mapped by k = floor((2a / (1/2 -    //
+//     |u|) + b) u + mu + 0.43) onto a hat which closely fits the Poisson     //
+//     distribution.  Most candidates fall inside the squeeze and are         //
+//     accepted at once; the rest are accepted if ln(v) plus the logarithm of //
+//     the hat does not exceed -mu + k ln(mu) - ln(k!).                       //
+//                                                                            //
+//  Arguments:                                                                //
+//     Random_State *state                                                    //
+//        The generator state from which the uniform variates are drawn.      //
+//     const Poisson_Sampler *s                                               //
+//        A sampler prepared by Poisson_Sampler_Init() for the PTRS           //
+//        algorithm.                                                          //
+//                                                                            //
+//  Return Values:                                                            //
+//     A Poisson distributed random quantity.                                 //
+//                                                                            //
+//  Example:                                                                  //
+//     x = PTRS( state, sampler );                                            //
+////////////////////////////////////////////////////////////////////////////////
+
+static int PTRS( Random_State *state, const Poisson_Sampler *s )
+{
+   double u, v, us, k;
+
+   for (;;) {
+      u = Uniform_0_1_Random_Variate_r(state) - 0.5;
+      v = Uniform_0_1_Random_Variate_r(state);
+      us = 0.5 - fabs(u);
+      k = floor((2.0 * s->a / us + s->b) * u + s->mu + 0.43);
+      if ( us >= 0.07 && v <= s->vr ) return (int) k;
+      if ( k < 0.0 || (us < 0.013 && v > us) ) continue;
+      if ( log(v) + s->ln_inverse_alpha - log(s->a / (us * us) + s->b)
+                   <= -s->mu + k * s->ln_mu - Ln_Factorial((int) k) )
+         return (int) k;
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// void Poisson_Sampler_Variate_Array( Random_State *state, int x[], int n,   //
+//                                     const Poisson_Sampler *sampler )       //
+//                                                                            //
+//  Description:                                                              //
+//     This function fills the array x[] with n Poisson distributed random    //
+//     variates with the mean given to Poisson_Sampler_Init().  The result is //
+//     the same as n successive calls to Poisson_Sampler_Variate_r( state,    //
+//     sampler ).                                                             //
+//                                                                            //
+//  Arguments:                                                                //
+//     Random_State *state                                                    //
+//        The generator state from which the uniform variates are drawn.      //
+//     int x[]                                                                //
+//        The array of at least n elements which is set to the variates.      //
+//     int n                                                                  //
+//        The number of variates to generate.                                 //
+//     const Poisson_Sampler *sampler                                         //
+//        A sampler prepared by Poisson_Sampler_Init().                       //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     #define N 1000                                                         //
+//     Poisson_Sampler sampler;                                               //
+//     Random_State state;                                                    //
+//     int x[N];                                                              //
+//     double mu;                                                             //
+//                                                                            //
+//     Random_State_Init( &state, 12345 );                                    //
+//     Poisson_Sampler_Init( &sampler, mu );                                  //
+//     Poisson_Sampler_Variate_Array( &state, x, N, &sampler );               //
+////////////////////////////////////////////////////////////////////////////////
+
+void Poisson_Sampler_Variate_Array( Random_State *state, int x[], int n,
+                                               const Poisson_Sampler *sampler )
+{
+   int i;
+
+   if ( !sampler->ptrs )
+      for (i = 0; i < n; i++)
+         x[i] = Poisson_Random_Variate_r(state, sampler->mu);
+   else
+      for (i = 0; i < n; i++) x[i] = PTRS(state, sampler);
+}
@@ -0,0 +1,35 @@
+////////////////////////////////////////////////////////////////////////////////
+// File: poisson_sampler.h                                                    //
+// Type(s):                                                                   //
+//    Poisson_Sampler                                                         //
+////////////////////////////////////////////////////////////////////////////////
+#ifndef POISSON_SAMPLER_H
+#define POISSON_SAMPLER_H
+
+////////////////////////////////////////////////////////////////////////////////
+// Poisson_Sampler                                                            //
+//                                                                            //
+//  Description:                                                              //
+//     The mean of a Poisson distribution together with the constants of      //
+//     Hormann's PTRS algorithm (transformed rejection with squeeze),         //
+//     computed once by Poisson_Sampler_Init() so that repeated variates with //
+//     the same mean do not recompute them.                                   //
+//                                                                            //
+//     If ptrs is zero, mu is below the crossover POISSON_PTRS_THRESHOLD,     //
+//     also used by Poisson_Random_Variate_r() and                            //
+//     Poisson_Random_Variate_Array(), and the variates are generated by      //
+//     Poisson_Random_Variate_r(); the remaining fields are then unused.      //
+//     Otherwise a, b, vr and ln_inverse_alpha are the constants of the       //
+//     transformed rejection hat and ln_mu = ln(mu).                          //
+////////////////////////////////////////////////////////////////////////////////
+
+#define POISSON_PTRS_THRESHOLD 10.0
+
+typedef struct {
+   double mu;
+   int ptrs;
+   double ln_mu;
+   double a, b, vr, ln_inverse_alpha;
+} Poisson_Sampler;
+
+#endif
@@ -2,16 +2,24 @@
 // File: polar_marsaglia.c                                                    //
 // Routine(s):                                                                //
 //    Gaussian_Variate_Polar_Marsaglia                                        //
+//    Gaussian_Variate_Polar_Marsaglia_r                                      //
 ////////////////////////////////////////////////////////////////////////////////
 
 #include <math.h>              // required for sqrt(), log(), and M_PI
 #include <float.h>             // required for DBL_MIN
+
+#include "random_state.h"
 #define M_2PI (M_PI+M_PI)
 
 //                    Required Externally Defined Routines                    //
 
-double Uniform_0_1_Random_Variate( void );
-        
+extern Random_State* Uniform_0_1_Default_State( void );
+double Uniform_0_1_Random_Variate_r( Random_State *state );
+
+//                    Required Internally Defined Routines                    //
+
+double Gaussian_Variate_Polar_Marsaglia_r( Random_State *state );
+
 ////////////////////////////////////////////////////////////////////////////////
 // double Gaussian_Variate_Polar_Marsaglia( void )                            //
 //                                                                            //
@@ -37,23 +45,51 @@ double Uniform_0_1_Random_Variate( void );
 
 double Gaussian_Variate_Polar_Marsaglia( void )
 {
-   static double next_variate;
-   static int use_next_variate = 0;
+   return Gaussian_Variate_Polar_Marsaglia_r( Uniform_0_1_Default_State() );
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// double Gaussian_Variate_Polar_Marsaglia_r( Random_State *state )           //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns a standard Gaussian variate using Marsaglia's    //
+//     polar method with the uniform variates drawn from state.  The second   //
+//     variate of each pair is kept in the state rather than in a static      //
+//     variable.                                                              //
+//                                                                            //
+//  Arguments:                                                                //
+//     Random_State *state                                                    //
+//        The generator state from which the uniform variates are drawn.      //
+//                                                                            //
+//  Return Values:                                                            //
+//     As for Gaussian_Variate_Polar_Marsaglia().                             //
+//                                                                            //
+//  Example:                                                                  //
+//     Random_State state;                                                    //
+//     double x;                                                              //
+//                                                                            //
+//     Random_State_Init( &state, 12345 );                                    //
+//     x = Gaussian_Variate_Polar_Marsaglia_r( &state );                      //
+////////////////////////////////////////////////////////////////////////////////
+
+double Gaussian_Variate_Polar_Marsaglia_r( Random_State *state )
+{
    double u, v, w;
    double variate;
    
-   if (use_next_variate) variate = next_variate;
+   if (state->gaussian_saved) variate = state->gaussian_next;
    else {
       do { 
-         u = 2.0 * Uniform_0_1_Random_Variate() - 1.0;
-         v = 2.0 * Uniform_0_1_Random_Variate() - 1.0;
+         u = 2.0 * Uniform_0_1_Random_Variate_r(state) - 1.0;
+         v = 2.0 * Uniform_0_1_Random_Variate_r(state) - 1.0;
          w = u * u + v * v;
       } while ( w > 1.0 );
       if ( w == 0.0 ) w = DBL_MIN;
       w = sqrt(-2.0 * log(w) / w);
       variate = u * w;
-      next_variate = v * w;
+      state->gaussian_next = v * w;
    }
-   use_next_variate = !use_next_variate;
+   state->gaussian_saved = !state->gaussian_saved;
    return variate;
 }
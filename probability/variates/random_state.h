@@ -0,0 +1,50 @@
+////////////////////////////////////////////////////////////////////////////////
+// File: random_state.h                                                       //
+// Type(s):                                                                   //
+//    Random_State                                                            //
+////////////////////////////////////////////////////////////////////////////////
+#ifndef RANDOM_STATE_H
+#define RANDOM_STATE_H
+
+////////////////////////////////////////////////////////////////////////////////
+// Random_State                                                               //
+//                                                                            //
+//  Description:                                                              //
+//     The state of a uniform random number generator.  The library keeps     //
+//     one such state internally for Uniform_0_1_Random_Variate() and         //
+//     Uniform_32_Bits_Random_Variate(); callers who need an independent      //
+//     stream declare their own and pass its address to the routines whose    //
+//     names end in _r.                                                       //
+//                                                                            //
+//     engine selects the generator:                                          //
+//        RANDOM_ENGINE_XOSHIRO256  xoshiro256** (Blackman and Vigna), a      //
+//                                  64 bit generator with period 2^256 - 1.   //
+//                                  The four words of s[] are the state, at   //
+//                                  least one of which must be nonzero.       //
+//        RANDOM_ENGINE_LIBC_RAND   The C library rand(), kept for            //
+//                                  compatibility with earlier versions.  s[] //
+//                                  is unused and the stream is shared by     //
+//                                  the whole process.                        //
+//        RANDOM_ENGINE_PHILOX4X32  Philox4x32-10 (Salmon et al.), a counter  //
+//                                  based generator.  s[1]:s[0] is the 128    //
+//                                  bit position, s[1] being the stream,      //
+//                                  s[2] is the key and s[3] holds the        //
+//                                  second output of the current block when   //
+//                                  the position is odd.                      //
+//                                                                            //
+//     gaussian_next and gaussian_saved hold the second variate of the pair   //
+//     produced by the Box-Muller and polar methods until it is used.         //
+////////////////////////////////////////////////////////////////////////////////
+
+#define RANDOM_ENGINE_XOSHIRO256 0
+#define RANDOM_ENGINE_LIBC_RAND  1
+#define RANDOM_ENGINE_PHILOX4X32 2
+
+typedef struct {
+   unsigned long long s[4];
+   int engine;
+   double gaussian_next;
+   int gaussian_saved;
+} Random_State;
+
+#endif
@@ -0,0 +1,32 @@
+////////////////////////////////////////////////////////////////////////////////
+// File: sobol_sequence.h                                                     //
+// Type(s):                                                                   //
+//    Sobol_Sequence                                                          //
+////////////////////////////////////////////////////////////////////////////////
+#ifndef SOBOL_SEQUENCE_H
+#define SOBOL_SEQUENCE_H
+
+////////////////////////////////////////////////////////////////////////////////
+// Sobol_Sequence                                                             //
+//                                                                            //
+//  Description:                                                              //
+//     The state of a Sobol low-discrepancy sequence in "dimension"           //
+//     dimensions, 1 <= dimension <= SOBOL_MAX_DIMENSION, set up by           //
+//     Sobol_Sequence_Init() and released by Sobol_Sequence_Free().           //
+//                                                                            //
+//     direction[] holds the 32 direction numbers of each coordinate,         //
+//     direction[k * dimension + j] being the k-th direction number of        //
+//     coordinate j, x[] the numerators over 2^32 of the coordinates of the   //
+//     next point and index the position of the next point in the sequence.   //
+////////////////////////////////////////////////////////////////////////////////
+
+#define SOBOL_MAX_DIMENSION 1024
+
+typedef struct {
+   int dimension;
+   unsigned long long index;
+   unsigned int *direction;
+   unsigned int *x;
+} Sobol_Sequence;
+
+#endif
@@ -0,0 +1,132 @@
+////////////////////////////////////////////////////////////////////////////////
+// File: student_t_random_variate.c                                           //
+// Routine(s):                                                                //
+//    Student_t_Random_Variate                                                //
+//    Student_t_Random_Variate_r                                              //
+//    Student_t_Random_Variate_Array                                          //
+////////////////////////////////////////////////////////////////////////////////
+
+#include "random_state.h"
+#include "student_t_sampler.h"
+
+//                    Required Externally Defined Routines                    //
+
+extern Random_State* Uniform_0_1_Default_State( void );
+extern void Student_t_Sampler_Init( Student_t_Sampler *sampler, double nu );
+extern double Student_t_Sampler_Variate_r( Random_State *state,
+                                            const Student_t_Sampler *sampler );
+extern void Student_t_Sampler_Variate_Array( Random_State *state, double x[],
+                                     int n, const Student_t_Sampler *sampler );
+
+//                    Required Internally Defined Routines                    //
+
+double Student_t_Random_Variate_r( Random_State *state, double nu );
+
+////////////////////////////////////////////////////////////////////////////////
+// double Student_t_Random_Variate( double nu )                               //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns a random variate with Student's t-distribution   //
+//     with nu degrees of freedom using Bailey's polar method, see            //
+//     Student_t_Sampler_Variate_r().  Each variate needs on average about    //
+//     2.5 uniform variates, one logarithm and one exponential.  Unlike       //
+//     Student_t_Variate_Inversion(), nu need not be an integer and no        //
+//     quantile function is evaluated.                                        //
+//                                                                            //
+//  Arguments:                                                                //
+//     double nu                                                              //
+//        The number of degrees of freedom, nu > 0.                           //
+//                                                                            //
+//  Return Values:                                                            //
+//     A random number with a t-distribution with nu degrees of freedom.      //
+//                                                                            //
+//  Example:                                                                  //
+//     double x;                                                              //
+//     double nu;                                                             //
+//                                                                            //
+//     x = Student_t_Random_Variate( nu );                                    //
+////////////////////////////////////////////////////////////////////////////////
+
+double Student_t_Random_Variate( double nu )
+{
+   return Student_t_Random_Variate_r( Uniform_0_1_Default_State(), nu );
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// double Student_t_Random_Variate_r( Random_State *state, double nu )        //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns a random variate as for                          //
+//     Student_t_Random_Variate(), drawing from state.  The constants of the  //
+//     method are computed by Student_t_Sampler_Init() on each call; callers  //
+//     who generate many variates with the same parameters should prepare a   //
+//     Student_t_Sampler once and call Student_t_Sampler_Variate_r().         //
+//                                                                            //
+//  Arguments:                                                                //
+//     Random_State *state                                                    //
+//        The generator state from which the variates are drawn.              //
+//     double nu                                                              //
+//        As for Student_t_Random_Variate().                                  //
+//                                                                            //
+//  Return Values:                                                            //
+//     A random number with a t-distribution with nu degrees of freedom.      //
+//                                                                            //
+//  Example:                                                                  //
+//     double x;                                                              //
+//     Random_State state;                                                    //
+//     double nu;                                                             //
+//                                                                            //
+//     Random_State_Init( &state, 12345 );                                    //
+//     x = Student_t_Random_Variate_r( &state, nu );                          //
+////////////////////////////////////////////////////////////////////////////////
+
+double Student_t_Random_Variate_r( Random_State *state, double nu )
+{
+   Student_t_Sampler sampler;
+
+   Student_t_Sampler_Init(&sampler, nu);
+   return Student_t_Sampler_Variate_r(state, &sampler);
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// void Student_t_Random_Variate_Array( Random_State *state, double x[],      //
+//                                      int n, double nu )                    //
+//                                                                            //
+//  Description:                                                              //
+//     This function fills the array x[] with n random variates as for        //
+//     Student_t_Random_Variate().  The constants of the method are computed  //
+//     once for the whole array, which is then filled by                      //
+//     Student_t_Sampler_Variate_Array() from blocks of uniform variates.     //
+//                                                                            //
+//  Arguments:                                                                //
+//     Random_State *state                                                    //
+//        The generator state from which the variates are drawn.              //
+//     double x[]                                                             //
+//        The array of at least n elements which is set to the variates.      //
+//     int n                                                                  //
+//        The number of variates to generate.                                 //
+//     double nu                                                              //
+//        As for Student_t_Random_Variate().                                  //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     #define N 1000                                                         //
+//     Random_State state;                                                    //
+//     double x[N];                                                           //
+//                                                                            //
+//     Random_State_Init( &state, 12345 );                                    //
+//     Student_t_Random_Variate_Array( &state, x, N, 4.5 );                   //
+////////////////////////////////////////////////////////////////////////////////
+
+void Student_t_Random_Variate_Array( Random_State *state, double x[], int n,
+                                                                    double nu )
+{
+   Student_t_Sampler sampler;
+
+   Student_t_Sampler_Init(&sampler, nu);
+   Student_t_Sampler_Variate_Array(state, x, n, &sampler);
+}
@@ -0,0 +1,195 @@
+////////////////////////////////////////////////////////////////////////////////
+// File: student_t_sampler.c                                                  //
+// Routine(s):                                                                //
+//    Student_t_Sampler_Init                                                  //
+//    Student_t_Sampler_Variate                                               //
+//    Student_t_Sampler_Variate_r                                             //
+//    Student_t_Sampler_Variate_Array                                         //
+////////////////////////////////////////////////////////////////////////////////
+
+#include <math.h>                    // required for expm1(), log(), sqrt()
+
+#include "random_state.h"
+#include "student_t_sampler.h"
+
+//                    Required Externally Defined Routines                    //
+
+extern Random_State* Uniform_0_1_Default_State( void );
+extern double Uniform_0_1_Random_Variate_r( Random_State *state );
+extern void Uniform_0_1_Random_Variate_Array( Random_State *state, double u[],
+                                                                       int n );
+
+//                    Required Internally Defined Routines                    //
+
+double Student_t_Sampler_Variate_r( Random_State *state,
+                                            const Student_t_Sampler *sampler );
+
+#define BLOCK 256
+
+////////////////////////////////////////////////////////////////////////////////
+// void Student_t_Sampler_Init( Student_t_Sampler *sampler, double nu )       //
+//                                                                            //
+//  Description:                                                              //
+//     This function prepares sampler to generate variates with Student's     //
+//     t-distribution with nu degrees of freedom.  nu need not be an integer. //
+//                                                                            //
+//  Arguments:                                                                //
+//     Student_t_Sampler *sampler                                             //
+//        The sampler to prepare.                                             //
+//     double nu                                                              //
+//        The number of degrees of freedom, nu > 0.                           //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     Student_t_Sampler sampler;                                             //
+//     double nu;                                                             //
+//                                                                            //
+//     Student_t_Sampler_Init( &sampler, nu );                                //
+////////////////////////////////////////////////////////////////////////////////
+
+void Student_t_Sampler_Init( Student_t_Sampler *sampler, double nu )
+{
+   sampler->nu = nu;
+   sampler->exponent = -2.0 / nu;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// double Student_t_Sampler_Variate( const Student_t_Sampler *sampler )       //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns a random variate with Student's t-distribution   //
+//     with the number of degrees of freedom given to                         //
+//     Student_t_Sampler_Init().  The variates are drawn from the library's   //
+//     default generator state.                                               //
+//                                                                            //
+//  Arguments:                                                                //
+//     const Student_t_Sampler *sampler                                       //
+//        A sampler prepared by Student_t_Sampler_Init().                     //
+//                                                                            //
+//  Return Values:                                                            //
+//     A random number with a t-distribution with the number of degrees of    //
+//     freedom of sampler.                                                    //
+//                                                                            //
+//  Example:                                                                  //
+//     Student_t_Sampler sampler;                                             //
+//     double x;                                                              //
+//                                                                            //
+//     x = Student_t_Sampler_Variate( &sampler );                             //
+////////////////////////////////////////////////////////////////////////////////
+
+double Student_t_Sampler_Variate( const Student_t_Sampler *sampler )
+{
+   return Student_t_Sampler_Variate_r( Uniform_0_1_Default_State(), sampler );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// double Student_t_Sampler_Variate_r( Random_State *state,                   //
+//                                         const Student_t_Sampler *sampler ) //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns a random variate with Student's t-distribution   //
+//     with the number of degrees of freedom nu given to                      //
+//     Student_t_Sampler_Init() using Bailey's polar method.  A point (u,v)   //
+//     is chosen uniformly in the unit disc by rejection from the square,     //
+//     about 79% of the points being accepted, and with w = u^2 + v^2,        //
+//                   t = u sqrt( nu (w^(-2/nu) - 1) / w )                     //
+//                                                                            //
+//     has a t-distribution with nu degrees of freedom.  The method is exact  //
+//     for every nu > 0 and needs no Gaussian or Gamma variates.  w^(-2/nu) - //
+//     1 is evaluated by expm1() so that no precision is lost for large nu,   //
+//     where the distribution approaches the Gaussian.                        //
+//                                                                            //
+//  Arguments:                                                                //
+//     Random_State *state                                                    //
+//        The generator state from which the uniform variates are drawn.      //
+//     const Student_t_Sampler *sampler                                       //
+//        A sampler prepared by Student_t_Sampler_Init().                     //
+//                                                                            //
+//  Return Values:                                                            //
+//     A random number with a t-distribution with the number of degrees of    //
+//     freedom of sampler.                                                    //
+//                                                                            //
+//  Example:                                                                  //
+//     Student_t_Sampler sampler;                                             //
+//     Random_State state;                                                    //
+//     double x;                                                              //
+//                                                                            //
+//     Random_State_Init( &state, 12345 );                                    //
+//     x = Student_t_Sampler_Variate_r( &state, &sampler );                   //
+////////////////////////////////////////////////////////////////////////////////
+
+double Student_t_Sampler_Variate_r( Random_State *state,
+                                             const Student_t_Sampler *sampler )
+{
+   double u, v, w;
+
+   do {
+      u = 2.0 * Uniform_0_1_Random_Variate_r(state) - 1.0;
+      v = 2.0 * Uniform_0_1_Random_Variate_r(state) - 1.0;
+      w = u * u + v * v;
+   } while ( w >= 1.0 || w == 0.0 );
+   return u * sqrt( sampler->nu * expm1(sampler->exponent * log(w)) / w );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// void Student_t_Sampler_Variate_Array( Random_State *state, double x[],     //
+//                                  int n, const Student_t_Sampler *sampler ) //
+//                                                                            //
+//  Description:                                                              //
+//     This function fills the array x[] with n random variates with          //
+//     Student's t-distribution with the number of degrees of freedom given   //
+//     to Student_t_Sampler_Init() by the method of                           //
+//     Student_t_Sampler_Variate_r().  The uniform variates are generated in  //
+//     blocks by Uniform_0_1_Random_Variate_Array(), a rejected pair simply   //
+//     moving on to the next in the block, so the variates have the same      //
+//     distribution as, but are not the same as, those of n successive calls  //
+//     to Student_t_Sampler_Variate_r().                                      //
+//                                                                            //
+//  Arguments:                                                                //
+//     Random_State *state                                                    //
+//        The generator state from which the uniform variates are drawn.      //
+//     double x[]                                                             //
+//        The array of at least n elements which is set to the variates.      //
+//     int n                                                                  //
+//        The number of variates to generate.                                 //
+//     const Student_t_Sampler *sampler                                       //
+//        A sampler prepared by Student_t_Sampler_Init().                     //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     #define N 1000                                                         //
+//     Student_t_Sampler sampler;                                             //
+//     Random_State state;                                                    //
+//     double x[N];                                                           //
+//                                                                            //
+//     Random_State_Init( &state, 12345 );                                    //
+//     Student_t_Sampler_Init( &sampler, 4.5 );                               //
+//     Student_t_Sampler_Variate_Array( &state, x, N, &sampler );             //
+////////////////////////////////////////////////////////////////////////////////
+
+void Student_t_Sampler_Variate_Array( Random_State *state, double x[], int n,
+                                             const Student_t_Sampler *sampler )
+{
+   double uniform[2 * BLOCK];
+   double nu = sampler->nu;
+   double exponent = sampler->exponent;
+   double u, v, w;
+   int i, k, m;
+
+   for (i = 0, k = 0, m = 0; i < n; ) {
+      if ( k == m ) {
+         m = (n - i < BLOCK) ? 2 * (n - i) : 2 * BLOCK;
+         Uniform_0_1_Random_Variate_Array(state, uniform, m);
+         k = 0;
+      }
+      u = 2.0 * uniform[k++] - 1.0;
+      v = 2.0 * uniform[k++] - 1.0;
+      w = u * u + v * v;
+      if ( w >= 1.0 || w == 0.0 ) continue;
+      x[i++] = u * sqrt( nu * expm1(exponent * log(w)) / w );
+   }
+}
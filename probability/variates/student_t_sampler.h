@@ -0,0 +1,23 @@
+////////////////////////////////////////////////////////////////////////////////
+// File: student_t_sampler.h                                                  //
+// Type(s):                                                                   //
+//    Student_t_Sampler                                                       //
+////////////////////////////////////////////////////////////////////////////////
+#ifndef STUDENT_T_SAMPLER_H
+#define STUDENT_T_SAMPLER_H
+
+////////////////////////////////////////////////////////////////////////////////
+// Student_t_Sampler                                                          //
+//                                                                            //
+//  Description:                                                              //
+//     The number of degrees of freedom nu of a Student's t-distribution      //
+//     together with exponent = -2 / nu, the constant of Bailey's polar       //
+//     method, computed once by Student_t_Sampler_Init().                     //
+////////////////////////////////////////////////////////////////////////////////
+
+typedef struct {
+   double nu;
+   double exponent;
+} Student_t_Sampler;
+
+#endif
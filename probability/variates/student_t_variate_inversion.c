@@ -0,0 +1,125 @@
+////////////////////////////////////////////////////////////////////////////////
+// File: student_t_variate_inversion.c                                        //
+// Routine(s):                                                                //
+//    Student_t_Variate_Inversion                                             //
+//    Student_t_Variate_Inversion_r                                           //
+//    Student_t_Variate_Inversion_Array                                       //
+////////////////////////////////////////////////////////////////////////////////
+
+#include "random_state.h"
+
+//                    Required Externally Defined Routines                    //
+
+extern Random_State* Uniform_0_1_Default_State( void );
+extern double Uniform_0_1_Random_Variate_r( Random_State *state );
+extern double Student_t_Quantile(double p, int n);
+
+//                    Required Internally Defined Routines                    //
+
+double Student_t_Variate_Inversion_r( Random_State *state, int n );
+
+////////////////////////////////////////////////////////////////////////////////
+// double Student_t_Variate_Inversion( int n )                                //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns a random variate with Student's t-distribution   //
+//     with n degrees of freedom using the inversion method, i.e.             //
+//     x = Student_t_Quantile(u, n) where u is a uniform(0,1) random variate. //
+//     Each variate uses one uniform variate and is an increasing function of //
+//     it.                                                                    //
+//                                                                            //
+//  Arguments:                                                                //
+//     int n                                                                  //
+//        The number of degrees of freedom, n >= 1.                           //
+//                                                                            //
+//  Return Values:                                                            //
+//     A random number with a t-distribution with n degrees of freedom.  The  //
+//     value returned is in the interval [-DBL_MAX, DBL_MAX].                 //
+//                                                                            //
+//  Example:                                                                  //
+//     double x;                                                              //
+//     int n;                                                                 //
+//                                                                            //
+//     x = Student_t_Variate_Inversion(n);                                    //
+////////////////////////////////////////////////////////////////////////////////
+
+double Student_t_Variate_Inversion( int n )
+{
+   return Student_t_Variate_Inversion_r( Uniform_0_1_Default_State(), n );
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// double Student_t_Variate_Inversion_r( Random_State *state, int n )         //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns Student_t_Quantile(u, n) where the uniform       //
+//     variate u is drawn from state.                                         //
+//                                                                            //
+//  Arguments:                                                                //
+//     Random_State *state                                                    //
+//        The generator state from which the uniform variate is drawn.        //
+//     int n                                                                  //
+//        As for Student_t_Variate_Inversion().                               //
+//                                                                            //
+//  Return Values:                                                            //
+//     As for Student_t_Variate_Inversion().                                  //
+//                                                                            //
+//  Example:                                                                  //
+//     Random_State state;                                                    //
+//     double x;                                                              //
+//     int n;                                                                 //
+//                                                                            //
+//     Random_State_Init( &state, 12345 );                                    //
+//     x = Student_t_Variate_Inversion_r( &state, n );                        //
+////////////////////////////////////////////////////////////////////////////////
+
+double Student_t_Variate_Inversion_r( Random_State *state, int n )
+{
+   return Student_t_Quantile( Uniform_0_1_Random_Variate_r(state), n );
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// void Student_t_Variate_Inversion_Array( double u[], double x[], int size,  //
+//                                                                    int n ) //
+//                                                                            //
+//  Description:                                                              //
+//     This function sets x[i] to Student_t_Quantile(u[i], n) for             //
+//     i = 0,...,size-1 using the uniform variates u[] supplied by the        //
+//     caller.  The uniforms are used in order, one per variate, so that if   //
+//     u[] holds common random numbers, antithetic pairs or quasi-random      //
+//     points, x[] inherits that structure.                                   //
+//                                                                            //
+//  Arguments:                                                                //
+//     double u[]                                                             //
+//        The array of size uniform variates, 0 <= u[i] <= 1.                 //
+//     double x[]                                                             //
+//        The array of at least size elements which is set to the variates,   //
+//        x[i] = Student_t_Quantile(u[i], n).  x may be the same array as u.  //
+//     int size                                                               //
+//        The number of variates.                                             //
+//     int n                                                                  //
+//        As for Student_t_Variate_Inversion().                               //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     #define N 1000                                                         //
+//     Random_State state;                                                    //
+//     double u[N], x[N];                                                     //
+//     int n;                                                                 //
+//                                                                            //
+//     Random_State_Init( &state, 12345 );                                    //
+//     Uniform_0_1_Random_Variate_Array( &state, u, N );                      //
+//     Student_t_Variate_Inversion_Array( u, x, N, n );                       //
+////////////////////////////////////////////////////////////////////////////////
+
+void Student_t_Variate_Inversion_Array( double u[], double x[], int size,
+                                                                        int n )
+{
+   int i;
+
+   for (i = 0; i < size; i++) x[i] = Student_t_Quantile(u[i], n);
+}
@@ -2,12 +2,21 @@
 // File: sum_12_uniforms.c                                                    //
 // Routine(s):                                                                //
 //    Gaussian_Variate_Sum_12_Uniforms                                        //
+//    Gaussian_Variate_Sum_12_Uniforms_r                                      //
 ////////////////////////////////////////////////////////////////////////////////
 
+#include "random_state.h"
+
 //                    Required Externally Defined Routines                    //
+
+extern Random_State* Uniform_0_1_Default_State( void );
         
-extern double Uniform_0_1_Random_Variate( void );
-        
+extern double Uniform_0_1_Random_Variate_r( Random_State *state );
+
+//                    Required Internally Defined Routines                    //
+
+double Gaussian_Variate_Sum_12_Uniforms_r( Random_State *state );
+
 ////////////////////////////////////////////////////////////////////////////////
 // double Gaussian_Variate_Sum_12_Uniforms( void )                            //
 //                                                                            //
@@ -39,11 +48,40 @@ extern double Uniform_0_1_Random_Variate( void );
 ////////////////////////////////////////////////////////////////////////////////
 
 double Gaussian_Variate_Sum_12_Uniforms( void )
+{
+   return Gaussian_Variate_Sum_12_Uniforms_r( Uniform_0_1_Default_State() );
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// double Gaussian_Variate_Sum_12_Uniforms_r( Random_State *state )           //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns an approximately Gaussian variate with mean 0    //
+//     and variance 1 as the sum of twelve uniform variates drawn from state, //
+//     less 6.                                                                //
+//                                                                            //
+//  Arguments:                                                                //
+//     Random_State *state                                                    //
+//        The generator state from which the uniform variates are drawn.      //
+//                                                                            //
+//  Return Values:                                                            //
+//     As for Gaussian_Variate_Sum_12_Uniforms().                             //
+//                                                                            //
+//  Example:                                                                  //
+//     Random_State state;                                                    //
+//     double x;                                                              //
+//                                                                            //
+//     Random_State_Init( &state, 12345 );                                    //
+//     x = Gaussian_Variate_Sum_12_Uniforms_r( &state );                      //
+////////////////////////////////////////////////////////////////////////////////
+
+double Gaussian_Variate_Sum_12_Uniforms_r( Random_State *state )
 {
    double z = 0.0;
    int i;
    
-   for (i = 0; i < 12; i++) z += Uniform_0_1_Random_Variate();
+   for (i = 0; i < 12; i++) z += Uniform_0_1_Random_Variate_r(state);
    z -= 6.0;
 
    return z;
@@ -2,14 +2,23 @@
 // File: t2_variate_inversion.c                                               //
 // Routine(s):                                                                //
 //    t2_Variate_Inversion                                                    //
+//    t2_Variate_Inversion_r                                                  //
+//    t2_Variate_Inversion_Array                                              //
 ////////////////////////////////////////////////////////////////////////////////
 
 #include <math.h>                             // required for log()
 #include <float.h>                            // required for DBL_MAX
 
+#include "random_state.h"
+
 //                    Required Externally Defined Routines                    //
 
-extern double Uniform_0_1_Random_Variate( void );
+extern Random_State* Uniform_0_1_Default_State( void );
+extern double Uniform_0_1_Random_Variate_r( Random_State *state );
+
+//                    Required Internally Defined Routines                    //
+
+double t2_Variate_Inversion_r( Random_State *state );
 
 ////////////////////////////////////////////////////////////////////////////////
 // double t2_Variate_Inversion( void )                                        //
@@ -48,8 +57,79 @@ extern double Uniform_0_1_Random_Variate( void );
 
 double t2_Variate_Inversion( void )
 {
-   double u = Uniform_0_1_Random_Variate();
+   return t2_Variate_Inversion_r( Uniform_0_1_Default_State() );
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// double t2_Variate_Inversion_r( Random_State *state )                       //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns a random variate from Student's t distribution   //
+//     with 2 degrees of freedom by inversion of a uniform variate drawn from //
+//     state.                                                                 //
+//                                                                            //
+//  Arguments:                                                                //
+//     Random_State *state                                                    //
+//        The generator state from which the uniform variates are drawn.      //
+//                                                                            //
+//  Return Values:                                                            //
+//     As for t2_Variate_Inversion().                                         //
+//                                                                            //
+//  Example:                                                                  //
+//     Random_State state;                                                    //
+//     double x;                                                              //
+//                                                                            //
+//     Random_State_Init( &state, 12345 );                                    //
+//     x = t2_Variate_Inversion_r( &state );                                  //
+////////////////////////////////////////////////////////////////////////////////
+
+double t2_Variate_Inversion_r( Random_State *state )
+{
+   double u = Uniform_0_1_Random_Variate_r(state);
    if (u == 0.0) return -DBL_MAX;
    if (u == 1.0) return DBL_MAX;
    return M_SQRT2 * (u - 0.5) / sqrt( u * (1.0 - u) );
 }
+
+
+////////////////////////////////////////////////////////////////////////////////
+// void t2_Variate_Inversion_Array( double u[], double x[], int n )           //
+//                                                                            //
+//  Description:                                                              //
+//     This function sets x[i] to the t2 variate                              //
+//     sqrt(2) (u[i] - 1/2) / sqrt(u[i] (1 - u[i])) for i = 0,...,n-1 where   //
+//     the uniform variates u[] are supplied by the caller, one per variate,  //
+//     as in t2_Variate_Inversion_r().                                        //
+//                                                                            //
+//  Arguments:                                                                //
+//     double u[]                                                             //
+//        The array of n uniform variates, 0 <= u[i] <= 1.                    //
+//     double x[]                                                             //
+//        The array of at least n elements which is set to the variates.  x   //
+//        may be the same array as u.                                         //
+//     int n                                                                  //
+//        The number of variates.                                             //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     #define N 1000                                                         //
+//     Random_State state;                                                    //
+//     double u[N], x[N];                                                     //
+//                                                                            //
+//     Random_State_Init( &state, 12345 );                                    //
+//     Uniform_0_1_Random_Variate_Array( &state, u, N );                      //
+//     t2_Variate_Inversion_Array( u, x, N );                                 //
+////////////////////////////////////////////////////////////////////////////////
+
+void t2_Variate_Inversion_Array( double u[], double x[], int n )
+{
+   int i;
+
+   for (i = 0; i < n; i++)
+      if (u[i] == 0.0) x[i] = -DBL_MAX;
+      else if (u[i] == 1.0) x[i] = DBL_MAX;
+      else x[i] = M_SQRT2 * (u[i] - 0.5) / sqrt( u[i] * (1.0 - u[i]) );
+}
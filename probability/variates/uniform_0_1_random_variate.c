@@ -1,26 +1,387 @@
 ////////////////////////////////////////////////////////////////////////////////
 // File: uniform_0_1_variate.c                                                //
 // Routine(s):                                                                //
+//    Uniform_0_1_Init_Seed                                                   //
+//    Uniform_0_1_Init_Time                                                   //
+//    Uniform_0_1_Select_Engine                                               //
+//    Random_State_Init                                                       //
+//    Random_State_Init_Philox                                                //
+//    Random_State_Jump                                                       //
+//    Random_State_Skip                                                       //
+//    Uniform_0_1_Default_State                                               //
 //    Uniform_0_1_Random_Variate                                              //
+//    Uniform_0_1_Random_Variate_r                                            //
 //    Uniform_32_Bits_Random_Variate                                          //
+//    Uniform_32_Bits_Random_Variate_r                                        //
+//    Uniform_0_1_Random_Variate_Array                                        //
+//    Uniform_32_Bits_Random_Variate_Array                                    //
 ////////////////////////////////////////////////////////////////////////////////
 #include <stdlib.h>
 #include <time.h>
 
+#include "random_state.h"
+
+//                    Required Internally Defined Routines                    //
+
+void Random_State_Init( Random_State *state, unsigned long long seed );
+void Random_State_Init_Philox( Random_State *state, unsigned long long key,
+                                                    unsigned long long stream );
+void Random_State_Jump( Random_State *state );
+double Uniform_0_1_Random_Variate_r( Random_State *state );
+unsigned long Uniform_32_Bits_Random_Variate_r( Random_State *state );
+static unsigned long long Next_64_Bits( Random_State *state );
+static unsigned long long Philox_Next_64_Bits( Random_State *state );
+static void Philox_Block( Random_State *state, unsigned long long r[2] );
+
+// The state used by the routines without an explicit state argument.  The
+// initial words are those Random_State_Init() produces for a seed of 1, so
+// that an unseeded program behaves as if Uniform_0_1_Init_Seed(1) had been
+// called, just as srand(1) is implied for rand().
+
+static Random_State global_state = {
+   { 0x910a2dec89025cc1ULL, 0xbeeb8da1658eec67ULL,
+     0xf893a2eefb32555eULL, 0x71c18690ee42c90bULL },
+   RANDOM_ENGINE_XOSHIRO256,
+   0.0,
+   0
+};
+
+// The last seed given to Uniform_0_1_Init_Seed(), used to seed the engine
+// selected by Uniform_0_1_Select_Engine() when it changes the state layout.
+
+static unsigned long long global_seed = 1;
+
+
+////////////////////////////////////////////////////////////////////////////////
+// void Uniform_0_1_Init_Seed( unsigned long seed )                           //
+//                                                                            //
+//  Description:                                                              //
+//     This function seeds the generator used by Uniform_0_1_Random_Variate() //
+//     and Uniform_32_Bits_Random_Variate().  Both the xoshiro256** engine    //
+//     and rand() are seeded, so that the seed is retained if the engine is   //
+//     later changed.  If the Philox engine is selected, the seed becomes its //
+//     key and the stream is set to 0.                                        //
+//                                                                            //
+//  Arguments:                                                                //
+//     unsigned long seed                                                     //
+//        The seed.  Any value is permitted.                                  //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     Uniform_0_1_Init_Seed( 12345 );                                        //
+////////////////////////////////////////////////////////////////////////////////
+
 void Uniform_0_1_Init_Seed( unsigned long seed )
 {
+   int engine = global_state.engine;
+
+   global_seed = (unsigned long long) seed;
+   if (engine == RANDOM_ENGINE_PHILOX4X32)
+      Random_State_Init_Philox(&global_state, global_seed, 0);
+   else {
+      Random_State_Init(&global_state, global_seed);
+      global_state.engine = engine;
+   }
    srand((unsigned int)seed);
 }
 
 void Uniform_0_1_Init_Time( void )
 {
-   srand(time(NULL));
+   Uniform_0_1_Init_Seed( (unsigned long) time(NULL) );
 }
+
+
+////////////////////////////////////////////////////////////////////////////////
+// void Uniform_0_1_Select_Engine( int engine )                               //
+//                                                                            //
+//  Description:                                                              //
+//     This function selects the generator used by                            //
+//     Uniform_0_1_Random_Variate() and Uniform_32_Bits_Random_Variate() and  //
+//     hence by every variate generator built on them.  The default is        //
+//     RANDOM_ENGINE_XOSHIRO256.  RANDOM_ENGINE_LIBC_RAND restores the C      //
+//     library rand() used by earlier versions of this library.               //
+//     RANDOM_ENGINE_PHILOX4X32 selects the counter based Philox generator,   //
+//     see Random_State_Init_Philox().                                        //
+//                                                                            //
+//     Changing to or from the Philox engine reseeds the generator with the   //
+//     last seed given to Uniform_0_1_Init_Seed(), or 1 if it has not been    //
+//     called, since the two engines interpret the state differently.         //
+//                                                                            //
+//  Arguments:                                                                //
+//     int engine                                                             //
+//        RANDOM_ENGINE_XOSHIRO256 (0), RANDOM_ENGINE_LIBC_RAND (1) or        //
+//        RANDOM_ENGINE_PHILOX4X32 (2).  Any other value is ignored.          //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     Uniform_0_1_Select_Engine( RANDOM_ENGINE_LIBC_RAND );                  //
+//     Uniform_0_1_Init_Seed( 12345 );                                        //
+////////////////////////////////////////////////////////////////////////////////
+
+void Uniform_0_1_Select_Engine( int engine )
+{
+   if (engine != RANDOM_ENGINE_XOSHIRO256 && engine != RANDOM_ENGINE_LIBC_RAND
+                                        && engine != RANDOM_ENGINE_PHILOX4X32)
+      return;
+   if (engine == RANDOM_ENGINE_PHILOX4X32) {
+      if (global_state.engine != RANDOM_ENGINE_PHILOX4X32)
+         Random_State_Init_Philox(&global_state, global_seed, 0);
+   }
+   else if (global_state.engine == RANDOM_ENGINE_PHILOX4X32)
+      Random_State_Init(&global_state, global_seed);
+   global_state.engine = engine;
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// void Random_State_Init( Random_State *state, unsigned long long seed )     //
+//                                                                            //
+//  Description:                                                              //
+//     This function initializes a caller owned generator state for the       //
+//     xoshiro256** engine.  The four state words are generated from the      //
+//     seed by the splitmix64 generator, which guarantees that they are not   //
+//     all zero and that nearby seeds give unrelated streams.                 //
+//                                                                            //
+//  Arguments:                                                                //
+//     Random_State *state                                                    //
+//        The state to initialize.                                            //
+//     unsigned long long seed                                                //
+//        The seed.  Any value is permitted.                                  //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     Random_State state;                                                    //
+//     double u;                                                              //
+//                                                                            //
+//     Random_State_Init( &state, 12345 );                                    //
+//     u = Uniform_0_1_Random_Variate_r( &state );                            //
+////////////////////////////////////////////////////////////////////////////////
+
+void Random_State_Init( Random_State *state, unsigned long long seed )
+{
+   unsigned long long z;
+   int i;
+
+   for (i = 0; i < 4; i++) {
+      seed += 0x9e3779b97f4a7c15ULL;
+      z = seed;
+      z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+      z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+      state->s[i] = z ^ (z >> 31);
+   }
+   state->engine = RANDOM_ENGINE_XOSHIRO256;
+   state->gaussian_next = 0.0;
+   state->gaussian_saved = 0;
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// void Random_State_Init_Philox( Random_State *state,                        //
+//                                unsigned long long key,                     //
+//                                unsigned long long stream )                 //
+//                                                                            //
+//  Description:                                                              //
+//     This function initializes a caller owned generator state for the       //
+//     Philox4x32-10 engine of Salmon, Moraes, Dror and Shaw, "Parallel       //
+//     random numbers: as easy as 1, 2, 3" (SC11, 2011).  Philox is counter   //
+//     based: the i-th 64 bit output of a stream is a fixed function of the   //
+//     key, the stream and i alone, computed by ten rounds of a keyed         //
+//     bijection of the 128 bit counter.  The generator therefore has no      //
+//     state beyond its position, Random_State_Skip() moves to any position   //
+//     in constant time, and distinct (key, stream) pairs give independent    //
+//     sequences without any coordination.                                    //
+//                                                                            //
+//     Each stream is 2^64 outputs long and Random_State_Jump() moves to the  //
+//     same position in the next one.  A computation which is split into      //
+//     tasks, task t drawing from stream t of a common key, therefore gives   //
+//     bit-identical results however the tasks are distributed over threads   //
+//     or processes.  The outputs agree with the Random123 known-answer       //
+//     tests, the 128 bit counter being 2^63 stream + i/2 and the output i    //
+//     being the low (even i) or high (odd i) 64 bits of the block.           //
+//                                                                            //
+//  Arguments:                                                                //
+//     Random_State *state                                                    //
+//        The state to initialize.                                            //
+//     unsigned long long key                                                 //
+//        The key, e.g. the seed of the whole computation.  Any value is      //
+//        permitted.                                                          //
+//     unsigned long long stream                                              //
+//        The stream number.  Any value is permitted.                         //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     Random_State state;                                                    //
+//     double u;                                                              //
+//     int task;                                                              //
+//                                                                            //
+//     Random_State_Init_Philox( &state, 12345, task );                       //
+//     u = Uniform_0_1_Random_Variate_r( &state );                            //
+////////////////////////////////////////////////////////////////////////////////
+
+void Random_State_Init_Philox( Random_State *state, unsigned long long key,
+                                                     unsigned long long stream )
+{
+   state->s[0] = 0;
+   state->s[1] = stream;
+   state->s[2] = key;
+   state->s[3] = 0;
+   state->engine = RANDOM_ENGINE_PHILOX4X32;
+   state->gaussian_next = 0.0;
+   state->gaussian_saved = 0;
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// void Random_State_Jump( Random_State *state )                              //
+//                                                                            //
+//  Description:                                                              //
+//     This function advances a xoshiro256** state by 2^128 steps.  Starting  //
+//     from one seeded state and jumping once more for each worker gives up   //
+//     to 2^128 streams which are guaranteed not to overlap.                  //
+//                                                                            //
+//     For the Philox engine the state is instead moved to the same position  //
+//     in the next stream, i.e. it is advanced by 2^64 outputs.               //
+//                                                                            //
+//  Arguments:                                                                //
+//     Random_State *state                                                    //
+//        The state to advance.                                               //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     Random_State state[8];                                                 //
+//     int i;                                                                 //
+//                                                                            //
+//     Random_State_Init( &state[0], 12345 );                                 //
+//     for (i = 1; i < 8; i++) {                                              //
+//        state[i] = state[i-1];                                              //
+//        Random_State_Jump( &state[i] );                                     //
+//     }                                                                      //
+////////////////////////////////////////////////////////////////////////////////
+
+void Random_State_Jump( Random_State *state )
+{
+   static const unsigned long long jump[4] = {
+      0x180ec6d33cfd0abaULL, 0xd5a61266f0c9392cULL,
+      0xa9582618e03fc9aaULL, 0x39abdc4529b1661cULL
+   };
+   unsigned long long t[4] = { 0, 0, 0, 0 };
+   unsigned long long r[2];
+   int i, b;
+
+   if (state->engine == RANDOM_ENGINE_PHILOX4X32) {
+      state->s[1]++;
+      if (state->s[0] & 1) {
+         Philox_Block(state, r);
+         state->s[3] = r[1];
+      }
+      state->gaussian_saved = 0;
+      return;
+   }
+   for (i = 0; i < 4; i++)
+      for (b = 0; b < 64; b++) {
+         if (jump[i] & (1ULL << b)) {
+            t[0] ^= state->s[0];
+            t[1] ^= state->s[1];
+            t[2] ^= state->s[2];
+            t[3] ^= state->s[3];
+         }
+         Next_64_Bits(state);
+      }
+   for (i = 0; i < 4; i++) state->s[i] = t[i];
+   state->gaussian_saved = 0;
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// void Random_State_Skip( Random_State *state, unsigned long long n )        //
+//                                                                            //
+//  Description:                                                              //
+//     This function advances state as if Uniform_0_1_Random_Variate_r( state //
+//     ) had been called n times.  For the Philox engine this takes constant  //
+//     time; for the xoshiro256** and rand() engines the generator is stepped //
+//     n times.  Any saved Gaussian variate is discarded.                     //
+//                                                                            //
+//  Arguments:                                                                //
+//     Random_State *state                                                    //
+//        The state to advance.                                               //
+//     unsigned long long n                                                   //
+//        The number of uniform variates to skip.                             //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     #define BLOCK_SIZE 1000000                                             //
+//     Random_State state;                                                    //
+//     int block;                                                             //
+//                                                                            //
+//     Random_State_Init_Philox( &state, 12345, 0 );                          //
+//     Random_State_Skip( &state, (unsigned long long) block * BLOCK_SIZE );  //
+////////////////////////////////////////////////////////////////////////////////
+
+void Random_State_Skip( Random_State *state, unsigned long long n )
+{
+   unsigned long long r[2];
+
+   state->gaussian_saved = 0;
+   if (state->engine == RANDOM_ENGINE_PHILOX4X32) {
+      state->s[0] += n;
+      if (state->s[0] < n) state->s[1]++;
+      if (state->s[0] & 1) {
+         Philox_Block(state, r);
+         state->s[3] = r[1];
+      }
+   }
+   else if (state->engine == RANDOM_ENGINE_LIBC_RAND)
+      for (; n > 0; n--) rand();
+   else
+      for (; n > 0; n--) Next_64_Bits(state);
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// Random_State* Uniform_0_1_Default_State( void )                            //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns the address of the state used by the routines    //
+//     which do not take an explicit state argument.  The routines without    //
+//     the _r suffix call their _r form with this state.                      //
+//                                                                            //
+//  Arguments:                                                                //
+//     None                                                                   //
+//                                                                            //
+//  Return Values:                                                            //
+//     The address of the library's default generator state.                  //
+//                                                                            //
+//  Example:                                                                  //
+//     double x;                                                              //
+//                                                                            //
+//     x = Uniform_0_1_Random_Variate_r( Uniform_0_1_Default_State() );       //
+////////////////////////////////////////////////////////////////////////////////
+
+Random_State* Uniform_0_1_Default_State( void )
+{
+   return &global_state;
+}
+
+
 ////////////////////////////////////////////////////////////////////////////////
 // double Uniform_0_1_Random_Variate( void )                                  //
 //                                                                            //
 //  Description:                                                              //
-//     This function returns a uniform variate on [0,1].                      //
+//     This function returns a uniform variate on [0,1).  With the default    //
+//     engine the result is a multiple of 2^-53, i.e. every bit of the        //
+//     mantissa is random.                                                    //
 //                                                                            //
 //  Arguments:                                                                //
 //     None                                                                   //
@@ -36,7 +397,14 @@ void Uniform_0_1_Init_Time( void )
         
 double Uniform_0_1_Random_Variate( void )
 {
-   return (double) rand() / ((double) RAND_MAX + 1.0);
+   return Uniform_0_1_Random_Variate_r( &global_state );
+}
+
+double Uniform_0_1_Random_Variate_r( Random_State *state )
+{
+   if (state->engine == RANDOM_ENGINE_LIBC_RAND)
+      return (double) rand() / ((double) RAND_MAX + 1.0);
+   return (double) (Next_64_Bits(state) >> 11) * 0x1.0p-53;
 }
 
 
@@ -44,13 +412,13 @@ double Uniform_0_1_Random_Variate( void )
 // unsigned long Uniform_32_Bits_Random_Variate( void )                       //
 //                                                                            //
 //  Description:                                                              //
-//     This function returns a random integer on [0, 2^32].                   //
+//     This function returns a random integer on [0, 2^32).                   //
 //                                                                            //
 //  Arguments:                                                                //
 //     None                                                                   //
 //                                                                            //
 //  Return Values:                                                            //
-//     A uniform random number r, 0 <= r <= 2^32.                             //
+//     A uniform random number r, 0 <= r < 2^32.                              //
 //                                                                            //
 //  Example:                                                                  //
 //     unsigned long x;                                                       //
@@ -60,7 +428,218 @@ double Uniform_0_1_Random_Variate( void )
         
 unsigned long Uniform_32_Bits_Random_Variate( void )
 {
-   unsigned long x = (unsigned long) rand();
-   if (rand() < 1073741824) x |= 0x80000000;
+   return Uniform_32_Bits_Random_Variate_r( &global_state );
+}
+
+unsigned long Uniform_32_Bits_Random_Variate_r( Random_State *state )
+{
+   unsigned long x;
+
+   if (state->engine == RANDOM_ENGINE_LIBC_RAND) {
+      x = (unsigned long) rand();
+      if (rand() < 1073741824) x |= 0x80000000;
+      return x;
+   }
+   return (unsigned long) (Next_64_Bits(state) >> 32);
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// void Uniform_0_1_Random_Variate_Array( Random_State *state, double u[],    //
+//                                                                    int n ) //
+//                                                                            //
+//  Description:                                                              //
+//     This function fills the array u[] with n uniform variates on [0,1)     //
+//     drawn from state.  The result is the same as n successive calls to     //
+//     Uniform_0_1_Random_Variate_r( state ).                                 //
+//                                                                            //
+//  Arguments:                                                                //
+//     Random_State *state                                                    //
+//        The generator state.                                                //
+//     double u[]                                                             //
+//        The array of at least n elements which is set to the variates.      //
+//     int n                                                                  //
+//        The number of variates to generate.                                 //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     #define N 1000                                                         //
+//     Random_State state;                                                    //
+//     double u[N];                                                           //
+//                                                                            //
+//     Random_State_Init( &state, 12345 );                                    //
+//     Uniform_0_1_Random_Variate_Array( &state, u, N );                      //
+////////////////////////////////////////////////////////////////////////////////
+
+void Uniform_0_1_Random_Variate_Array( Random_State *state, double u[], int n )
+{
+   int i;
+
+   if (state->engine == RANDOM_ENGINE_LIBC_RAND)
+      for (i = 0; i < n; i++)
+         u[i] = (double) rand() / ((double) RAND_MAX + 1.0);
+   else
+      for (i = 0; i < n; i++)
+         u[i] = (double) (Next_64_Bits(state) >> 11) * 0x1.0p-53;
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// void Uniform_32_Bits_Random_Variate_Array( Random_State *state,            //
+//                                               unsigned long u[], int n )   //
+//                                                                            //
+//  Description:                                                              //
+//     This function fills the array u[] with n random integers on [0, 2^32)  //
+//     drawn from state.  The result is the same as n successive calls to     //
+//     Uniform_32_Bits_Random_Variate_r( state ).                             //
+//                                                                            //
+//  Arguments:                                                                //
+//     Random_State *state                                                    //
+//        The generator state.                                                //
+//     unsigned long u[]                                                      //
+//        The array of at least n elements which is set to the variates.      //
+//     int n                                                                  //
+//        The number of variates to generate.                                 //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     #define N 1000                                                         //
+//     Random_State state;                                                    //
+//     unsigned long u[N];                                                    //
+//                                                                            //
+//     Random_State_Init( &state, 12345 );                                    //
+//     Uniform_32_Bits_Random_Variate_Array( &state, u, N );                  //
+////////////////////////////////////////////////////////////////////////////////
+
+void Uniform_32_Bits_Random_Variate_Array( Random_State *state,
+                                                     unsigned long u[], int n )
+{
+   int i;
+
+   if (state->engine == RANDOM_ENGINE_LIBC_RAND)
+      for (i = 0; i < n; i++) u[i] = Uniform_32_Bits_Random_Variate_r(state);
+   else
+      for (i = 0; i < n; i++)
+         u[i] = (unsigned long) (Next_64_Bits(state) >> 32);
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// static unsigned long long Next_64_Bits( Random_State *state )              //
+//                                                                            //
+//  Description:                                                              //
+//     This function advances the xoshiro256** generator, or the Philox       //
+//     generator if it is selected in state, and returns the next 64 bit      //
+//     output.                                                                //
+//                                                                            //
+//  Arguments:                                                                //
+//     Random_State *state                                                    //
+//        The generator state.                                                //
+//                                                                            //
+//  Return Values:                                                            //
+//     A uniform random number r, 0 <= r < 2^64.                              //
+////////////////////////////////////////////////////////////////////////////////
+
+static unsigned long long Next_64_Bits( Random_State *state )
+{
+   unsigned long long *s = state->s;
+   unsigned long long x = s[1] * 5;
+   unsigned long long t = s[1] << 17;
+
+   if (state->engine == RANDOM_ENGINE_PHILOX4X32)
+      return Philox_Next_64_Bits(state);
+   x = ((x << 7) | (x >> 57)) * 9;
+   s[2] ^= s[0];
+   s[3] ^= s[1];
+   s[1] ^= s[2];
+   s[0] ^= s[3];
+   s[2] ^= t;
+   s[3] = (s[3] << 45) | (s[3] >> 19);
    return x;
 }
+
+
+////////////////////////////////////////////////////////////////////////////////
+// static unsigned long long Philox_Next_64_Bits( Random_State *state )       //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns the next 64 bit output of the Philox generator   //
+//     and advances its position.  The two outputs of a block are produced by //
+//     one evaluation of Philox_Block(), the second being kept in s[3] until  //
+//     it is used.                                                            //
+//                                                                            //
+//  Arguments:                                                                //
+//     Random_State *state                                                    //
+//        The generator state.                                                //
+//                                                                            //
+//  Return Values:                                                            //
+//     A uniform random number r, 0 <= r < 2^64.                              //
+////////////////////////////////////////////////////////////////////////////////
+
+static unsigned long long Philox_Next_64_Bits( Random_State *state )
+{
+   unsigned long long r[2];
+
+   if (state->s[0] & 1) r[0] = state->s[3];
+   else {
+      Philox_Block(state, r);
+      state->s[3] = r[1];
+   }
+   if (++state->s[0] == 0) state->s[1]++;
+   return r[0];
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// static void Philox_Block( Random_State *state, unsigned long long r[2] )   //
+//                                                                            //
+//  Description:                                                              //
+//     This function evaluates the Philox4x32-10 bijection with the key s[2]  //
+//     at the 128 bit counter (s[1]:s[0]) / 2, the block containing the       //
+//     current position, and returns the 128 bit result as two 64 bit words.  //
+//     Each round multiplies two of the four 32 bit counter words by fixed    //
+//     constants, exchanges the words and mixes the high halves of the        //
+//     products with the key, which is bumped by the Weyl constants between   //
+//     rounds.                                                                //
+//                                                                            //
+//  Arguments:                                                                //
+//     Random_State *state                                                    //
+//        The generator state.                                                //
+//     unsigned long long r[2]                                                //
+//        The block, r[0] from counter words 0 and 1 and r[1] from words 2    //
+//        and 3, the lower numbered word in the low half.                     //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+////////////////////////////////////////////////////////////////////////////////
+
+static void Philox_Block( Random_State *state, unsigned long long r[2] )
+{
+   unsigned long long lo = (state->s[0] >> 1) | (state->s[1] << 63);
+   unsigned long long hi = state->s[1] >> 1;
+   unsigned long c0 = (unsigned long) (lo & 0xffffffffUL);
+   unsigned long c1 = (unsigned long) (lo >> 32);
+   unsigned long c2 = (unsigned long) (hi & 0xffffffffUL);
+   unsigned long c3 = (unsigned long) (hi >> 32);
+   unsigned long k0 = (unsigned long) (state->s[2] & 0xffffffffUL);
+   unsigned long k1 = (unsigned long) (state->s[2] >> 32);
+   unsigned long long p0, p1;
+   int i;
+
+   for (i = 0; i < 10; i++) {
+      p0 = 0xD2511F53ULL * c0;
+      p1 = 0xCD9E8D57ULL * c2;
+      c0 = (unsigned long) ((p1 >> 32) ^ c1 ^ k0);
+      c2 = (unsigned long) ((p0 >> 32) ^ c3 ^ k1);
+      c1 = (unsigned long) (p1 & 0xffffffffUL);
+      c3 = (unsigned long) (p0 & 0xffffffffUL);
+      k0 = (k0 + 0x9E3779B9UL) & 0xffffffffUL;
+      k1 = (k1 + 0xBB67AE85UL) & 0xffffffffUL;
+   }
+   r[0] = ((unsigned long long) c1 << 32) | c0;
+   r[1] = ((unsigned long long) c3 << 32) | c2;
+}
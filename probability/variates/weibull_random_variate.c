@@ -2,13 +2,22 @@
 // File: weibull_random_variate.c                                             //
 // Routine(s):                                                                //
 //    Weibull_Random_Variate                                                  //
+//    Weibull_Random_Variate_r                                                //
 ////////////////////////////////////////////////////////////////////////////////
 
 #include <math.h>                                      // required for pow()
 
+#include "random_state.h"
+
 //                    Required Externally Defined Routines                    //
-double Exponential_Random_Variate( void );
-        
+
+extern Random_State* Uniform_0_1_Default_State( void );
+double Exponential_Random_Variate_r( Random_State *state );
+
+//                    Required Internally Defined Routines                    //
+
+double Weibull_Random_Variate_r( Random_State *state, double a );
+
 ////////////////////////////////////////////////////////////////////////////////
 // double Weibull_Random_Variate( double a )                                  //
 //                                                                            //
@@ -37,7 +46,37 @@ double Exponential_Random_Variate( void );
 
 double Weibull_Random_Variate( double a )
 {
-   double e = Exponential_Random_Variate();
+   return Weibull_Random_Variate_r( Uniform_0_1_Default_State(), a );
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// double Weibull_Random_Variate_r( Random_State *state, double a )           //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns a Weibull random variate, e^(1/a), where the     //
+//     exponential variate e is drawn from state.                             //
+//                                                                            //
+//  Arguments:                                                                //
+//     Random_State *state                                                    //
+//        The generator state from which the uniform variates are drawn.      //
+//     double a                                                               //
+//        As for Weibull_Random_Variate().                                    //
+//                                                                            //
+//  Return Values:                                                            //
+//     As for Weibull_Random_Variate().                                       //
+//                                                                            //
+//  Example:                                                                  //
+//     Random_State state;                                                    //
+//     double x, a;                                                           //
+//                                                                            //
+//     Random_State_Init( &state, 12345 );                                    //
+//     x = Weibull_Random_Variate_r( &state, a );                             //
+////////////////////////////////////////////////////////////////////////////////
+
+double Weibull_Random_Variate_r( Random_State *state, double a )
+{
+   double e = Exponential_Random_Variate_r(state);
 
    return ( e == 0.0 ) ?  0.0 : pow(e, 1.0/a);
 }
@@ -0,0 +1,123 @@
+////////////////////////////////////////////////////////////////////////////////
+// File: weibull_variate_inversion.c                                          //
+// Routine(s):                                                                //
+//    Weibull_Variate_Inversion                                               //
+//    Weibull_Variate_Inversion_r                                             //
+//    Weibull_Variate_Inversion_Array                                         //
+////////////////////////////////////////////////////////////////////////////////
+
+#include "random_state.h"
+
+//                    Required Externally Defined Routines                    //
+
+extern Random_State* Uniform_0_1_Default_State( void );
+extern double Uniform_0_1_Random_Variate_r( Random_State *state );
+extern double Weibull_Quantile(double p, double a);
+
+//                    Required Internally Defined Routines                    //
+
+double Weibull_Variate_Inversion_r( Random_State *state, double a );
+
+////////////////////////////////////////////////////////////////////////////////
+// double Weibull_Variate_Inversion( double a )                               //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns a Weibull distributed random variate with shape  //
+//     parameter a using the inversion method, x = (-ln(1 - u))^(1/a) =       //
+//     Weibull_Quantile(u, a) where u is a uniform(0,1) random variate.       //
+//     Weibull_Random_Variate() computes the same transformation of an        //
+//     exponential variate which is generated by the ziggurat method, so it   //
+//     does not use exactly one uniform variate per variate.                  //
+//                                                                            //
+//  Arguments:                                                                //
+//     double a                                                               //
+//        The shape parameter of the Weibull distribution, a > 0.             //
+//                                                                            //
+//  Return Values:                                                            //
+//     A random number with a Weibull distribution with shape parameter a.    //
+//     The value returned is in the interval [0, DBL_MAX].                    //
+//                                                                            //
+//  Example:                                                                  //
+//     double x;                                                              //
+//     double a;                                                              //
+//                                                                            //
+//     x = Weibull_Variate_Inversion(a);                                      //
+////////////////////////////////////////////////////////////////////////////////
+
+double Weibull_Variate_Inversion( double a )
+{
+   return Weibull_Variate_Inversion_r( Uniform_0_1_Default_State(), a );
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// double Weibull_Variate_Inversion_r( Random_State *state, double a )        //
+//                                                                            //
+//  Description:                                                              //
+//     This function returns Weibull_Quantile(u, a) where the uniform variate //
+//     u is drawn from state.                                                 //
+//                                                                            //
+//  Arguments:                                                                //
+//     Random_State *state                                                    //
+//        The generator state from which the uniform variate is drawn.        //
+//     double a                                                               //
+//        As for Weibull_Variate_Inversion().                                 //
+//                                                                            //
+//  Return Values:                                                            //
+//     As for Weibull_Variate_Inversion().                                    //
+//                                                                            //
+//  Example:                                                                  //
+//     Random_State state;                                                    //
+//     double x;                                                              //
+//     double a;                                                              //
+//                                                                            //
+//     Random_State_Init( &state, 12345 );                                    //
+//     x = Weibull_Variate_Inversion_r( &state, a );                          //
+////////////////////////////////////////////////////////////////////////////////
+
+double Weibull_Variate_Inversion_r( Random_State *state, double a )
+{
+   return Weibull_Quantile( Uniform_0_1_Random_Variate_r(state), a );
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// void Weibull_Variate_Inversion_Array( double u[], double x[], int n,       //
+//                                                                 double a ) //
+//                                                                            //
+//  Description:                                                              //
+//     This function sets x[i] to Weibull_Quantile(u[i], a) for i = 0,...,n-1 //
+//     where the uniform variates u[] are supplied by the caller, one per     //
+//     variate.                                                               //
+//                                                                            //
+//  Arguments:                                                                //
+//     double u[]                                                             //
+//        The array of n uniform variates, 0 <= u[i] <= 1.                    //
+//     double x[]                                                             //
+//        The array of at least n elements which is set to the variates,      //
+//        x[i] = Weibull_Quantile(u[i], a).  x may be the same array as u.    //
+//     int n                                                                  //
+//        The number of variates.                                             //
+//     double a                                                               //
+//        As for Weibull_Variate_Inversion().                                 //
+//                                                                            //
+//  Return Values:                                                            //
+//     None                                                                   //
+//                                                                            //
+//  Example:                                                                  //
+//     #define N 1000                                                         //
+//     Random_State state;                                                    //
+//     double u[N], x[N];                                                     //
+//     double a;                                                              //
+//                                                                            //
+//     Random_State_Init( &state, 12345 );                                    //
+//     Uniform_0_1_Random_Variate_Array( &state, u, N );                      //
+//     Weibull_Variate_Inversion_Array( u, x, N, a );                         //
+////////////////////////////////////////////////////////////////////////////////
+
+void Weibull_Variate_Inversion_Array( double u[], double x[], int n, double a )
+{
+   int i;
+
+   for (i = 0; i < n; i++) x[i] = Weibull_Quantile(u[i], a);
+}
@@ -1,6 +1,8 @@
 ////////////////////////////////////////////////////////////////////////////////
 // File: power_series_Cin.c                                                   //
 // Routine(s):                                                                //
+//    xPower_Series_Cin                                                       //
+//    dPower_Series_Cin                                                       //
 ////////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////
 // long double xPower_Series_Cin( long double x )                             //
@@ -26,7 +28,8 @@
 //                                                                            //
 //     y = xPower_Series_Cin( x );                                            //
 ////////////////////////////////////////////////////////////////////////////////
-#include <math.h>                      // required for fabsl(), expl()
+#include <math.h>                      // required for fabsl(), expl(), fabs(),
+                                       // exp()
 
 long double xPower_Series_Cin( long double x )
 { 
@@ -49,3 +52,52 @@ long double xPower_Series_Cin( long double x )
    }
    return -xx * sum / 2.0L;
 }
+
+
+#ifdef MATHQ_NATIVE_DOUBLE
+
+////////////////////////////////////////////////////////////////////////////////
+// double dPower_Series_Cin( double x )                                       //
+//                                                                            //
+//  Description:                                                              //
+//     This is the double precision version of xPower_Series_Cin() used when  //
+//     the library is compiled with MATHQ_NATIVE_DOUBLE defined.  It          //
+//     evaluates the power series for the entire cos integral, Cin(x) in the  //
+//     same way, but with all arithmetic in double precision.                 //
+//                                                                            //
+//  Arguments:                                                                //
+//     double  x  The argument of the entire cos integral.                    //
+//                                                                            //
+//  Return Value:                                                             //
+//     The value of Cin(x) evaluated at x.                                    //
+//                                                                            //
+//  Example:                                                                  //
+//     double y, x;                                                           //
+//                                                                            //
+//     ( code to initialize x )                                               //
+//                                                                            //
+//     y = dPower_Series_Cin( x );                                            //
+////////////////////////////////////////////////////////////////////////////////
+double dPower_Series_Cin( double x )
+{
+   double sum;
+   double xx = - x * x;
+   int n = (int) (2.41 * xx + 7.15 * fabs(x) + 7.00);
+   int k = n + n;
+  
+       // If the argument is sufficiently small use the approximation //
+                      // Cin(x) = x^2 exp(-x^2/24) / 4 //
+
+   if ( fabs(x) < 0.00025 ) return - (exp(xx / 24.0) * xx) / 4.0;
+
+       // Otherwise evaluate the power series expansion for Cin(x). //
+
+   sum = xx / ( k * k * (k - 1)) + 1.0 / (k - 2);
+   for (k -= 2; k > 2; k -= 2) {
+      sum *= xx / ( k * (k - 1) );
+      sum += 1.0 / (k - 2);
+   }
+   return -xx * sum / 2.0;
+}
+
+#endif
@@ -2,6 +2,7 @@
 // File: power_series_Si.c                                                    //
 // Routine(s):                                                                //
 //    xPower_Series_Si                                                        //
+//    dPower_Series_Si                                                        //
 ////////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////
 // long double xPower_Series_Si( long double x )                              //
@@ -28,7 +29,8 @@
 //                                                                            //
 //     y = xPower_Series_Si( x );                                             //
 ////////////////////////////////////////////////////////////////////////////////
-#include <math.h>           // required for fabsl(), expl()
+#include <math.h>           // required for fabsl(), expl(), fabs(),
+                            // exp()
 
 long double xPower_Series_Si( long double x )
 { 
@@ -51,3 +53,52 @@ long double xPower_Series_Si( long double x )
    }
    return x * sum;
 }
+
+
+#ifdef MATHQ_NATIVE_DOUBLE
+
+////////////////////////////////////////////////////////////////////////////////
+// double dPower_Series_Si( double x )                                        //
+//                                                                            //
+//  Description:                                                              //
+//     This is the double precision version of xPower_Series_Si() used when   //
+//     the library is compiled with MATHQ_NATIVE_DOUBLE defined.  It          //
+//     evaluates the power series for the sin integral, Si(x) in the same     //
+//     way, but with all arithmetic in double precision.                      //
+//                                                                            //
+//  Arguments:                                                                //
+//     double  x  The argument of the sin integral.                           //
+//                                                                            //
+//  Return Value:                                                             //
+//     The value of Si(x) evaluated at x.                                     //
+//                                                                            //
+//  Example:                                                                  //
+//     double y, x;                                                           //
+//                                                                            //
+//     ( code to initialize x )                                               //
+//                                                                            //
+//     y = dPower_Series_Si( x );                                             //
+////////////////////////////////////////////////////////////////////////////////
+double dPower_Series_Si( double x )
+{
+   double sum;
+   double xx = - x * x;
+   int n = (int) (3.42 * xx + 7.46 * fabs(x) + 6.95);
+   int k = n + n;
+
+       // If the argument is sufficiently small use the approximation //
+                         // Si(x) = x exp(-x^2/18) //
+  
+   if ( fabs(x) <= 0.0003 ) return x * exp(xx / 18.0);
+
+        // Otherwise evaluate the power series expansion for Si(x). //
+
+   sum = xx / ( (k + 1) * (k + 1) * k) + 1.0 / (k - 1);
+   for (k--; k >= 3; k -=2) {
+      sum *= xx / ( k * (k - 1) );
+      sum += 1.0 / (k - 2);
+   }
+   return x * sum;
+}
+
+#endif
